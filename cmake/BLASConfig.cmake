@@ -229,6 +229,34 @@ else()
     endif()
 endif()
 
+#-------------------------------------------------------------------------------
+# gemmt is not in reference BLAS, but MKL, OpenBLAS >= 0.3.22, and others
+# provide it; otherwise, blas::gemmt uses a blocked fallback.
+message( STATUS "Checking BLAS gemmt" )
+
+try_run(
+    run_result compile_result ${CMAKE_CURRENT_BINARY_DIR}
+    SOURCES
+        "${CMAKE_CURRENT_SOURCE_DIR}/config/gemmt.cc"
+    LINK_LIBRARIES
+        ${BLAS_LIBRARIES} ${openmp_lib} # not "..." quoted; screws up OpenMP
+    COMPILE_DEFINITIONS
+        ${blaspp_defs_}
+    COMPILE_OUTPUT_VARIABLE
+        compile_output
+    RUN_OUTPUT_VARIABLE
+        run_output
+)
+debug_try_run( "gemmt.cc" "${compile_result}" "${compile_output}"
+                          "${run_result}" "${run_output}" )
+
+if (compile_result AND "${run_output}" MATCHES "ok")
+    message( "${blue}   BLAS has gemmt${plain}" )
+    list( APPEND blaspp_defs_ "-DBLAS_HAVE_GEMMT" )
+else()
+    message( "${red}   BLAS does not have gemmt; using blocked fallback${plain}" )
+endif()
+
 #-------------------------------------------------------------------------------
 message( DEBUG "
 blaspp_defs_ = '${blaspp_defs_}'
@@ -614,6 +614,44 @@ def openmp( flags=['-fopenmp', '-qopenmp', '-openmp', '-omp', ''] ):
     # end
 # end
 
+#-------------------------------------------------------------------------------
+def threads( flags=['-pthread', ''] ):
+    '''
+    Tests for std::thread support with one of the given flags.
+    If a flag works, it is added to both CXXFLAGS and LDFLAGS.
+    '''
+    print_header( 'Thread support' )
+    src = 'config/thread.cc'
+    for flag in flags:
+        print_test( flag )
+        env = {'CXXFLAGS': flag, 'LDFLAGS': flag}
+        (rc, out, err) = compile_run( src, env )
+        print_result( flag, rc )
+        if (rc == 0):
+            environ.merge( env )
+            break
+    # end
+# end
+
+#-------------------------------------------------------------------------------
+def dl( libs=['', '-ldl'] ):
+    '''
+    Tests for dlopen with one of the given libraries.
+    If a library works, it is added to LIBS.
+    '''
+    print_header( 'Dynamic loading (dlopen)' )
+    src = 'config/dl.cc'
+    for lib in libs:
+        print_test( lib )
+        env = {'LIBS': lib}
+        (rc, out, err) = compile_run( src, env )
+        print_result( lib, rc )
+        if (rc == 0):
+            environ.merge( env )
+            break
+    # end
+# end
+
 #-------------------------------------------------------------------------------
 def cublas_library():
     '''
@@ -0,0 +1,15 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <dlfcn.h>
+#include <stdio.h>
+
+int main()
+{
+    // dlopen of the program itself, which always exists.
+    void* handle = dlopen( nullptr, RTLD_NOW );
+    printf( "ok %d\n", handle != nullptr );
+    return (handle != nullptr ? 0 : 1);
+}
@@ -0,0 +1,35 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <stdio.h>
+
+#include "config.h"
+
+#define BLAS_dgemmt FORTRAN_NAME( dgemmt, DGEMMT )
+
+#ifdef __cplusplus
+extern "C"
+#endif
+void BLAS_dgemmt( const char* uplo, const char* transA, const char* transB,
+                  const blas_int* n, const blas_int* k,
+                  const double* alpha,
+                  const double* A, const blas_int* lda,
+                  const double* B, const blas_int* ldb,
+                  const double* beta,
+                  double* C, const blas_int* ldc );
+
+int main()
+{
+    // C = A B, lower triangle only; C(0, 1) must be unchanged.
+    blas_int n = 2, k = 2;
+    double alpha = 1, beta = 0;
+    double A[] = { 1, 2, 3, 4 };
+    double B[] = { 5, 6, 7, 8 };
+    double C[] = { 0, 0, -1, 0 };
+    BLAS_dgemmt( "l", "n", "n", &n, &k, &alpha, A, &n, B, &n, &beta, C, &n );
+    bool okay = (C[0] == 23 && C[1] == 34 && C[2] == -1 && C[3] == 50);
+    printf( "%s\n", okay ? "ok" : "failed" );
+    return ! okay;
+}
@@ -562,6 +562,19 @@ def blas_float_return():
         print_warn( 'unexpected error!' )
 # end
 
+#-------------------------------------------------------------------------------
+def blas_gemmt():
+    '''
+    gemmt is not in reference BLAS, but MKL, OpenBLAS >= 0.3.22, and others
+    provide it; otherwise, blas::gemmt uses a blocked fallback.
+    '''
+    (rc, out, err) = config.compile_run(
+        'config/gemmt.cc', {},
+        'BLAS has gemmt' )
+    if (rc == 0):
+        config.environ.append( 'CXXFLAGS', define('HAVE_GEMMT') )
+# end
+
 #-------------------------------------------------------------------------------
 def blas_complex_return():
     '''
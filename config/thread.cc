@@ -0,0 +1,16 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <thread>
+#include <stdio.h>
+
+int main()
+{
+    int x = 0;
+    std::thread t( [&x]() { x = 1; } );
+    t.join();
+    printf( "ok %d\n", x );
+    return 0;
+}
@@ -58,11 +58,14 @@ def main():
    #config.prog_cxx_flag( '-Werror' )
 
     config.openmp()
+    config.threads()
+    config.dl()
 
     config.lapack.blas()
     print()
     config.lapack.blas_float_return()
     config.lapack.blas_complex_return()
+    config.lapack.blas_gemmt()
     config.lapack.vendor_version()
 
     # Must test mkl_version before cblas and lapacke, to define HAVE_MKL.
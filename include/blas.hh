@@ -8,6 +8,8 @@
 
 #include "blas/defines.h"
 
+#include <string>
+
 // Version is updated by make_release.py; DO NOT EDIT.
 // Version 2022.07.00
 #define BLASPP_VERSION 20220700
@@ -17,6 +19,24 @@ namespace blas {
 int blaspp_version();
 const char* blaspp_id();
 
+void set_backend( std::string const& library,
+                  std::string const& routine = "" );
+
+std::string get_backend( std::string const& routine );
+
+void autotune( std::string const& filename = "",
+               std::string const& routine = "" );
+
+double get_crossover( std::string const& routine );
+
+void set_crossover( std::string const& routine, double work );
+
+void set_trace( bool enable );
+bool get_trace();
+void trace_clear();
+std::string trace_summary();
+void trace_write( std::string const& filename );
+
 }  // namespace blas
 
 #include "blas/wrappers.hh"
@@ -41,22 +61,29 @@ const char* blaspp_id();
 // =============================================================================
 // Level 2 BLAS template implementations
 
+#include "blas/gbmv.hh"
 #include "blas/gemv.hh"
 #include "blas/ger.hh"
 #include "blas/geru.hh"
+#include "blas/hbmv.hh"
 #include "blas/hemv.hh"
 #include "blas/her.hh"
 #include "blas/her2.hh"
+#include "blas/sbmv.hh"
 #include "blas/symv.hh"
 #include "blas/syr.hh"
 #include "blas/syr2.hh"
+#include "blas/tbmv.hh"
+#include "blas/tbsv.hh"
 #include "blas/trmv.hh"
 #include "blas/trsv.hh"
 
 // =============================================================================
 // Level 3 BLAS template implementations
 
+#include "blas/gbmm.hh"
 #include "blas/gemm.hh"
+#include "blas/gemmt.hh"
 #include "blas/hemm.hh"
 #include "blas/herk.hh"
 #include "blas/her2k.hh"
@@ -7,10 +7,29 @@
 #define BLAS_ASUM_HH
 
 #include "blas/util.hh"
+#include "blas/simd.hh"
 
 #include <limits>
 
 namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Unit-stride asum for generic types. Overloads in blas/simd.hh
+/// provide vectorized versions for float, double, and complex.
+template< typename T >
+real_type<T> asum_unit(
+    int64_t n,
+    T const *x )
+{
+    real_type<T> result = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        result += abs1( x[i] );
+    }
+    return result;
+}
+
+}  // namespace internal
 
 // =============================================================================
 /// @return 1-norm of vector,
@@ -45,9 +64,7 @@ asum(
     real_t result = 0;
     if (incx == 1) {
         // unit stride
-        for (int64_t i = 0; i < n; ++i) {
-            result += abs1( x[i] );
-        }
+        result = internal::asum_unit( n, x );
     }
     else {
         // non-unit stride
@@ -7,10 +7,29 @@
 #define BLAS_AXPY_HH
 
 #include "blas/util.hh"
+#include "blas/simd.hh"
 
 #include <limits>
 
 namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Unit-stride axpy for generic types. Overloads in blas/simd.hh
+/// provide vectorized versions for float, double, and complex.
+template< typename TX, typename TY >
+void axpy_unit(
+    int64_t n,
+    blas::scalar_type<TX, TY> alpha,
+    TX const *x,
+    TY       *y )
+{
+    for (int64_t i = 0; i < n; ++i) {
+        y[i] += alpha*x[i];
+    }
+}
+
+}  // namespace internal
 
 // =============================================================================
 /// Add scaled vector, $y = \alpha x + y$.
@@ -59,9 +78,7 @@ void axpy(
 
     if (incx == 1 && incy == 1) {
         // unit stride
-        for (int64_t i = 0; i < n; ++i) {
-            y[i] += alpha*x[i];
-        }
+        internal::axpy_unit( n, alpha, x, y );
     }
     else {
         // non-unit stride
@@ -8,8 +8,16 @@
 
 #include "blas/util.hh"
 #include <algorithm>  // std::min/max
+#include <numeric>    // std::iota
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
 namespace blas {
 namespace batch {
 
@@ -22,9 +30,219 @@ T extract(std::vector<T> const &ivector, const int64_t index)
 }
 
 // -----------------------------------------------------------------------------
-// batch gemm check
+// Error checking of individual problems is fused into each parallel loop
+// over the batch (here, or in the compute loops of the host batch routines),
+// so it needs no workspace and no extra pass. Each iteration records its
+// info with set_info, into info[i] if info has one entry per problem, and
+// into lerror, which the loop reduces with OpenMP reduction(max:lerror),
+// without locks, to the first argument in error. After the loop,
+// finish_info sets info[0] if info has one entry, and throws on any error.
+
+inline void set_info(
+    std::vector<int64_t>& info, size_t i, int64_t info_, int64_t& lerror )
+{
+    if (info.size() > 1)
+        info[i] = info_;
+    if (info_ != 0)
+        lerror = std::max( lerror, info_ );
+}
+
+inline void finish_info( std::vector<int64_t>& info, int64_t lerror )
+{
+    if (info.size() == 1) {
+        info[0] = (lerror == INTERNAL_INFO_DEFAULT) ? 0 : lerror;
+        blas_error_if_msg( info[0] != 0, "info = %lld", (long long) info[0] );
+    }
+    else if (info.size() > 1) {
+        blas_error_if_msg( lerror != INTERNAL_INFO_DEFAULT,
+                           "One or more non-zero entry in vector info" );
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Runs task( i ) for each problem i in the batch, then reports errors
+// with finish_info. task returns the problem's info: 0, or -p if it
+// skipped the problem because argument p is invalid.
+//
+// Schedule::InOrder runs problems in input order, dynamically scheduled
+// over threads, with no workspace.
+//
+// Schedule::Balanced sorts problems by cost( i ), e.g., Gflop, largest first.
+// Each problem costing more than an even share of the total, which a single
+// thread can't balance, runs alone, outside the parallel region, so the
+// vendor BLAS uses all threads for it. The rest then run single-threaded
+// in parallel, largest first, so small problems fill in at the end.
+// If all problems have the same dimensions, sorting is skipped.
+template <typename Cost, typename Task>
+void schedule_batch(
+    size_t batch, Schedule schedule, bool uniform,
+    std::vector<int64_t>& info, Cost cost, Task task )
+{
+    int64_t lerror = INTERNAL_INFO_DEFAULT;
+    if (schedule == Schedule::InOrder || uniform || batch <= 1) {
+        #pragma omp parallel for schedule(dynamic) reduction(max:lerror)
+        for (size_t i = 0; i < batch; ++i) {
+            set_info( info, i, task( i ), lerror );
+        }
+    }
+    else {
+        std::vector< std::pair<double, size_t> > order( batch );
+        double total = 0;
+        for (size_t i = 0; i < batch; ++i) {
+            order[ i ] = std::make_pair( cost( i ), i );
+            total += order[ i ].first;
+        }
+        std::stable_sort(
+            order.begin(), order.end(),
+            [] ( std::pair<double, size_t> const& a,
+                 std::pair<double, size_t> const& b ) {
+                return a.first > b.first;
+            } );
+
+        int nthreads = 1;
+        #ifdef _OPENMP
+            nthreads = omp_get_max_threads();
+        #endif
+        size_t nbig = 0;
+        while (nthreads > 1 && nbig < batch
+               && order[ nbig ].first * nthreads > total) {
+            ++nbig;
+        }
+
+        for (size_t j = 0; j < nbig; ++j) {
+            size_t i = order[ j ].second;
+            set_info( info, i, task( i ), lerror );
+        }
+
+        #pragma omp parallel for schedule(dynamic) reduction(max:lerror)
+        for (size_t j = nbig; j < batch; ++j) {
+            size_t i = order[ j ].second;
+            set_info( info, i, task( i ), lerror );
+        }
+    }
+    finish_info( info, lerror );
+}
+
+// -----------------------------------------------------------------------------
+// Grouping of variable-size batches. Problems whose arguments match in
+// everything but the matrix pointers form a group, which can run through
+// a fixed-size batched kernel. group_batch buckets problems by key( str, i ),
+// which appends the arguments of problem i to str with append_key.
+// Groups are ordered by their first problem; problems within each group
+// are in input order. If all arguments are scalars, all problems form one
+// group, built by one_group without hashing.
+
+inline void append_key( std::string& )
+{}
+
+// Appends the bytes of each value to str.
+template <typename T, typename... Args>
+void append_key( std::string& str, T const& value, Args const&... args )
+{
+    str.append( (char const*) &value, sizeof(T) );
+    append_key( str, args... );
+}
+
+inline std::vector< std::vector<size_t> > one_group( size_t batch )
+{
+    std::vector< std::vector<size_t> > groups;
+    if (batch > 0) {
+        groups.push_back( std::vector<size_t>( batch ) );
+        std::iota( groups[ 0 ].begin(), groups[ 0 ].end(), size_t( 0 ) );
+    }
+    return groups;
+}
+
+template <typename Key>
+std::vector< std::vector<size_t> > group_batch( size_t batch, Key key )
+{
+    std::vector< std::vector<size_t> > groups;
+    std::unordered_map< std::string, size_t > index;
+    std::string str;
+    for (size_t i = 0; i < batch; ++i) {
+        str.clear();
+        key( str, i );
+        auto iter = index.emplace( str, groups.size() ).first;
+        if (iter->second == groups.size())
+            groups.push_back( std::vector<size_t>() );
+        groups[ iter->second ].push_back( i );
+    }
+    return groups;
+}
+
+// Host batch routines pack groups of at least compact_width<T>() problems
+// with all dimensions up to compact_max_dim into the compact format.
+const int64_t compact_max_dim = 16;
+
+// -----------------------------------------------------------------------------
+// batch gemm groups of problems with equal arguments.
+template <typename T>
+std::vector< std::vector<size_t> > gemm_groups(
+        std::vector<blas::Op> const &transA,
+        std::vector<blas::Op> const &transB,
+        std::vector<int64_t>  const &m,
+        std::vector<int64_t>  const &n,
+        std::vector<int64_t>  const &k,
+        std::vector<T >       const &alpha,
+        std::vector<int64_t>  const &lda,
+        std::vector<int64_t>  const &ldb,
+        std::vector<T >       const &beta,
+        std::vector<int64_t>  const &ldc,
+        const size_t batchCount)
+{
+    if (transA.size() == 1 && transB.size() == 1 && m.size() == 1 &&
+        n.size() == 1 && k.size() == 1 && alpha.size() == 1 &&
+        lda.size() == 1 && ldb.size() == 1 && beta.size() == 1 &&
+        ldc.size() == 1) {
+        return one_group( batchCount );
+    }
+    return group_batch(
+        batchCount,
+        [&]( std::string& str, size_t i ) {
+            append_key( str, extract<Op>(transA, i), extract<Op>(transB, i),
+                        extract<int64_t>(m, i), extract<int64_t>(n, i),
+                        extract<int64_t>(k, i),
+                        extract<T>(alpha, i), extract<T>(beta, i),
+                        extract<int64_t>(lda, i), extract<int64_t>(ldb, i),
+                        extract<int64_t>(ldc, i) );
+        } );
+}
+
+// -----------------------------------------------------------------------------
+// batch trsm and trmm groups of problems with equal arguments.
+template <typename T>
+std::vector< std::vector<size_t> > trsm_groups(
+        std::vector<blas::Side> const &side,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op>   const &trans,
+        std::vector<blas::Diag> const &diag,
+        std::vector<int64_t>    const &m,
+        std::vector<int64_t>    const &n,
+        std::vector<T >         const &alpha,
+        std::vector<int64_t>    const &lda,
+        std::vector<int64_t>    const &ldb,
+        const size_t batchCount)
+{
+    if (side.size() == 1 && uplo.size() == 1 && trans.size() == 1 &&
+        diag.size() == 1 && m.size() == 1 && n.size() == 1 &&
+        alpha.size() == 1 && lda.size() == 1 && ldb.size() == 1) {
+        return one_group( batchCount );
+    }
+    return group_batch(
+        batchCount,
+        [&]( std::string& str, size_t i ) {
+            append_key( str, extract<Side>(side, i), extract<Uplo>(uplo, i),
+                        extract<Op>(trans, i), extract<Diag>(diag, i),
+                        extract<int64_t>(m, i), extract<int64_t>(n, i),
+                        extract<T>(alpha, i),
+                        extract<int64_t>(lda, i), extract<int64_t>(ldb, i) );
+        } );
+}
+
+// -----------------------------------------------------------------------------
+// batch gemm check of the argument vector sizes, once per batch
 template<typename T>
-void gemm_check(
+void gemm_check_sizes(
         blas::Layout                 layout,
         std::vector<blas::Op> const &transA,
         std::vector<blas::Op> const &transB,
@@ -36,7 +254,7 @@ void gemm_check(
         std::vector<T*>       const &B, std::vector<int64_t> const &ldb,
         std::vector<T >       const &beta,
         std::vector<T*>       const &C, std::vector<int64_t> const &ldc,
-        const size_t batchCount, std::vector<int64_t> &info)
+        const size_t batchCount)
 {
     // size error checking
     blas_error_if( (transA.size() != 1 && transA.size() != batchCount) );
@@ -69,82 +287,190 @@ void gemm_check(
                 A.size()      > 1 || B.size()      > 1
                 )
              );
+}
 
-    int64_t* internal_info;
-    if (info.size() == 1) {
-        internal_info = new int64_t[batchCount];
+// -----------------------------------------------------------------------------
+// batch gemm check of the arguments of problem i.
+// Returns 0, or -p if the p-th argument is invalid.
+inline int64_t gemm_check_one(
+        blas::Layout layout,
+        std::vector<blas::Op> const &transA,
+        std::vector<blas::Op> const &transB,
+        std::vector<int64_t> const &m,
+        std::vector<int64_t> const &n,
+        std::vector<int64_t> const &k,
+        std::vector<int64_t> const &lda,
+        std::vector<int64_t> const &ldb,
+        std::vector<int64_t> const &ldc,
+        size_t i)
+{
+    Op transA_ = extract<Op>(transA, i);
+    Op transB_ = extract<Op>(transB, i);
+
+    int64_t m_ = extract<int64_t>(m, i);
+    int64_t n_ = extract<int64_t>(n, i);
+    int64_t k_ = extract<int64_t>(k, i);
+
+    int64_t lda_ = extract<int64_t>(lda, i);
+    int64_t ldb_ = extract<int64_t>(ldb, i);
+    int64_t ldc_ = extract<int64_t>(ldc, i);
+
+    int64_t nrowA_ = ((transA_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? m_ : k_;
+    int64_t nrowB_ = ((transB_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? k_ : n_;
+    int64_t nrowC_ = (layout == Layout::ColMajor) ? m_ : n_;
+
+    if (transA_ != Op::NoTrans &&
+       transA_ != Op::Trans   &&
+       transA_ != Op::ConjTrans) {
+        return -2;
     }
-    else {
-        internal_info = &info[0];
+    else if (transB_ != Op::NoTrans &&
+            transB_ != Op::Trans   &&
+            transB_ != Op::ConjTrans) {
+        return -3;
     }
+    else if (m_ < 0) return -4;
+    else if (n_ < 0) return -5;
+    else if (k_ < 0) return -6;
+    else if (lda_ < nrowA_) return -8;
+    else if (ldb_ < nrowB_) return -11;
+    else if (ldc_ < nrowC_) return -14;
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+// batch gemm check
+template<typename T>
+void gemm_check(
+        blas::Layout                 layout,
+        std::vector<blas::Op> const &transA,
+        std::vector<blas::Op> const &transB,
+        std::vector<int64_t>  const &m,
+        std::vector<int64_t>  const &n,
+        std::vector<int64_t>  const &k,
+        std::vector<T >       const &alpha,
+        std::vector<T*>       const &A, std::vector<int64_t> const &lda,
+        std::vector<T*>       const &B, std::vector<int64_t> const &ldb,
+        std::vector<T >       const &beta,
+        std::vector<T*>       const &C, std::vector<int64_t> const &ldc,
+        const size_t batchCount, std::vector<int64_t> &info)
+{
+    gemm_check_sizes( layout, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount );
 
-    #pragma omp parallel for schedule(dynamic)
+    int64_t lerror = INTERNAL_INFO_DEFAULT;
+    #pragma omp parallel for schedule(dynamic) reduction(max:lerror)
     for (size_t i = 0; i < batchCount; ++i) {
-        Op transA_ = extract<Op>(transA, i);
-        Op transB_ = extract<Op>(transB, i);
-
-        int64_t m_ = extract<int64_t>(m, i);
-        int64_t n_ = extract<int64_t>(n, i);
-        int64_t k_ = extract<int64_t>(k, i);
-
-        int64_t lda_ = extract<int64_t>(lda, i);
-        int64_t ldb_ = extract<int64_t>(ldb, i);
-        int64_t ldc_ = extract<int64_t>(ldc, i);
-
-        int64_t nrowA_ = ((transA_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? m_ : k_;
-        int64_t nrowB_ = ((transB_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? k_ : n_;
-        int64_t nrowC_ = (layout == Layout::ColMajor) ? m_ : n_;
-
-        internal_info[i] = 0;
-        if (transA_ != Op::NoTrans &&
-           transA_ != Op::Trans   &&
-           transA_ != Op::ConjTrans) {
-            internal_info[i] = -2;
-        }
-        else if (transB_ != Op::NoTrans &&
-                transB_ != Op::Trans   &&
-                transB_ != Op::ConjTrans) {
-            internal_info[i] = -3;
-        }
-        else if (m_ < 0) internal_info[i] = -4;
-        else if (n_ < 0) internal_info[i] = -5;
-        else if (k_ < 0) internal_info[i] = -6;
-        else if (lda_ < nrowA_) internal_info[i] = -8;
-        else if (ldb_ < nrowB_) internal_info[i] = -11;
-        else if (ldc_ < nrowC_) internal_info[i] = -14;
+        int64_t info_ = gemm_check_one( layout, transA, transB, m, n, k, lda, ldb, ldc, i );
+        set_info( info, i, info_, lerror );
     }
+    finish_info( info, lerror );
+}
 
-    if (info.size() == 1) {
-        // do a reduction that finds the first argument to encounter an error
-        int64_t lerror = INTERNAL_INFO_DEFAULT;
-        #pragma omp parallel for reduction(max:lerror)
-        for (size_t i = 0; i < batchCount; ++i) {
-            if (internal_info[i] == 0)
-                continue;    // skip problems that passed error checks
-            lerror = std::max(lerror, internal_info[i]);
-        }
-        info[0] = (lerror == INTERNAL_INFO_DEFAULT) ? 0 : lerror;
+// -----------------------------------------------------------------------------
+// batch gemmt check of the argument vector sizes, once per batch
+template<typename T>
+void gemmt_check_sizes(
+        blas::Layout                   layout,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op>   const &transA,
+        std::vector<blas::Op>   const &transB,
+        std::vector<int64_t>    const &n,
+        std::vector<int64_t>    const &k,
+        std::vector<T>          const &alpha,
+        std::vector<T*>         const &A, std::vector<int64_t> const &lda,
+        std::vector<T*>         const &B, std::vector<int64_t> const &ldb,
+        std::vector<T>          const &beta,
+        std::vector<T*>         const &C, std::vector<int64_t> const &ldc,
+        const size_t batchCount)
+{
+    // size error checking
+    blas_error_if( (uplo.size()   != 1 && uplo.size()   != batchCount) );
+    blas_error_if( (transA.size() != 1 && transA.size() != batchCount) );
+    blas_error_if( (transB.size() != 1 && transB.size() != batchCount) );
 
-        // delete the internal vector
-        delete[] internal_info;
+    blas_error_if( (n.size() != 1 && n.size() != batchCount) );
+    blas_error_if( (k.size() != 1 && k.size() != batchCount) );
 
-        // throw an exception if needed
-        blas_error_if_msg( info[0] != 0, "info = %lld", (long long) info[0] );
+    blas_error_if( (alpha.size() != 1 && alpha.size() != batchCount) );
+    blas_error_if( (beta.size()  != 1 && beta.size()  != batchCount) );
+
+    blas_error_if( (lda.size() != 1 && lda.size() != batchCount) );
+    blas_error_if( (ldb.size() != 1 && ldb.size() != batchCount) );
+    blas_error_if( (ldc.size() != 1 && ldc.size() != batchCount) );
+
+    // to support checking errors for the group interface, batchCount will be equal to group_count
+    // but the data arrays are generally >= group_count
+    blas_error_if( (A.size() != 1 && A.size() < batchCount) );
+    blas_error_if( (B.size() != 1 && B.size() < batchCount) );
+    blas_error_if( (C.size() < batchCount) );
+
+    blas_error_if( A.size() == 1 && (n.size() > 1 || k.size() > 1 || lda.size() > 1) );
+    blas_error_if( B.size() == 1 && (n.size() > 1 || k.size() > 1 || ldb.size() > 1) );
+    blas_error_if( C.size() == 1 &&
+               (uplo.size()   > 1 ||
+                transA.size() > 1 || transB.size() > 1 ||
+                n.size()      > 1 || k.size()      > 1 ||
+                alpha.size()  > 1 || beta.size()   > 1 ||
+                lda.size()    > 1 || ldb.size()    > 1 || ldc.size() > 1 ||
+                A.size()      > 1 || B.size()      > 1
+                )
+             );
+}
+
+// -----------------------------------------------------------------------------
+// batch gemmt check of the arguments of problem i.
+// Returns 0, or -p if the p-th argument is invalid.
+inline int64_t gemmt_check_one(
+        blas::Layout layout,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op> const &transA,
+        std::vector<blas::Op> const &transB,
+        std::vector<int64_t> const &n,
+        std::vector<int64_t> const &k,
+        std::vector<int64_t> const &lda,
+        std::vector<int64_t> const &ldb,
+        std::vector<int64_t> const &ldc,
+        size_t i)
+{
+    Uplo uplo_   = extract<Uplo>(uplo, i);
+    Op   transA_ = extract<Op>(transA, i);
+    Op   transB_ = extract<Op>(transB, i);
+
+    int64_t n_ = extract<int64_t>(n, i);
+    int64_t k_ = extract<int64_t>(k, i);
+
+    int64_t lda_ = extract<int64_t>(lda, i);
+    int64_t ldb_ = extract<int64_t>(ldb, i);
+    int64_t ldc_ = extract<int64_t>(ldc, i);
+
+    int64_t nrowA_ = ((transA_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? n_ : k_;
+    int64_t nrowB_ = ((transB_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? k_ : n_;
+
+    if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
+        return -2;
     }
-    else {
-        int64_t info_ = 0;
-        #pragma omp parallel for reduction(+:info_)
-        for (size_t i = 0; i < batchCount; ++i) {
-            info_ += info[i];
-        }
-        blas_error_if_msg( info_ != 0, "One or more non-zero entry in vector info");
+    else if (transA_ != Op::NoTrans &&
+             transA_ != Op::Trans   &&
+             transA_ != Op::ConjTrans) {
+        return -3;
     }
+    else if (transB_ != Op::NoTrans &&
+             transB_ != Op::Trans   &&
+             transB_ != Op::ConjTrans) {
+        return -4;
+    }
+    else if (n_ < 0) return -5;
+    else if (k_ < 0) return -6;
+    else if (lda_ < nrowA_) return -9;
+    else if (ldb_ < nrowB_) return -11;
+    else if (ldc_ < n_) return -14;
+    return 0;
 }
 
 // -----------------------------------------------------------------------------
-// batch trsm check
+// batch trsm check of the argument vector sizes, once per batch
 template<typename T>
-void trsm_check(
+void trsm_check_sizes(
         blas::Layout                   layout,
         std::vector<blas::Side> const &side,
         std::vector<blas::Uplo> const &uplo,
@@ -155,7 +481,7 @@ void trsm_check(
         std::vector<T>          const &alpha,
         std::vector<T*>         const &A, std::vector<int64_t> const &lda,
         std::vector<T*>         const &B, std::vector<int64_t> const &ldb,
-        const size_t batchCount, std::vector<int64_t> &info)
+        const size_t batchCount)
 {
     // size error checking
     blas_error_if( (side.size()  != 1 && side.size()  != batchCount) );
@@ -185,81 +511,60 @@ void trsm_check(
                                       m.size()     > 1 || n.size()    > 1 ||
                                       alpha.size() > 1 || A.size()    > 1 ||
                                       lda.size()   > 1 || ldb.size()  > 1 ));
+}
 
-    int64_t* internal_info;
-    if (info.size() == 1) {
-        internal_info = new int64_t[batchCount];
-    }
-    else {
-        internal_info = &info[0];
-    }
-
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batchCount; ++i) {
-        Side  side_ = extract<Side>(side , i);
-        Uplo  uplo_ = extract<Uplo>(uplo , i);
-        Op   trans_ = extract<Op  >(trans, i);
-        Diag  diag_ = extract<Diag>(diag , i);
+// -----------------------------------------------------------------------------
+// batch trsm check of the arguments of problem i.
+// Returns 0, or -p if the p-th argument is invalid.
+inline int64_t trsm_check_one(
+        blas::Layout layout,
+        std::vector<blas::Side> const &side,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op> const &trans,
+        std::vector<blas::Diag> const &diag,
+        std::vector<int64_t> const &m,
+        std::vector<int64_t> const &n,
+        std::vector<int64_t> const &lda,
+        std::vector<int64_t> const &ldb,
+        size_t i)
+{
+    Side  side_ = extract<Side>(side , i);
+    Uplo  uplo_ = extract<Uplo>(uplo , i);
+    Op   trans_ = extract<Op  >(trans, i);
+    Diag  diag_ = extract<Diag>(diag , i);
 
-        int64_t m_ = extract<int64_t>(m, i);
-        int64_t n_ = extract<int64_t>(n, i);
+    int64_t m_ = extract<int64_t>(m, i);
+    int64_t n_ = extract<int64_t>(n, i);
 
-        int64_t lda_ = extract<int64_t>(lda, i);
-        int64_t ldb_ = extract<int64_t>(ldb, i);
+    int64_t lda_ = extract<int64_t>(lda, i);
+    int64_t ldb_ = extract<int64_t>(ldb, i);
 
-        int64_t nrowA_ = (side_ == Side::Left) ? m_ : n_;
-        int64_t nrowB_ = (layout == Layout::ColMajor) ? m_ : n_;
+    int64_t nrowA_ = (side_ == Side::Left) ? m_ : n_;
+    int64_t nrowB_ = (layout == Layout::ColMajor) ? m_ : n_;
 
-        internal_info[i] = 0;
-        if (side_ != Side::Left && side_ != Side::Right) {
-            internal_info[i] = -2;
-        }
-        else if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
-            internal_info[i] = -3;
-        }
-        else if (trans_ != Op::NoTrans && trans_ != Op::Trans && trans_ != Op::ConjTrans) {
-            internal_info[i] = -4;
-        }
-        else if (diag_ != Diag::NonUnit && diag_ != Diag::Unit) {
-            internal_info[i] = -5;
-        }
-        else if (m_ < 0) internal_info[i] = -6;
-        else if (n_ < 0) internal_info[i] = -7;
-        else if (lda_ < nrowA_) internal_info[i] = -10;
-        else if (ldb_ < nrowB_) internal_info[i] = -12;
+    if (side_ != Side::Left && side_ != Side::Right) {
+        return -2;
     }
-
-    if (info.size() == 1) {
-        // do a reduction that finds the first argument to encounter an error
-        int64_t lerror = INTERNAL_INFO_DEFAULT;
-        #pragma omp parallel for reduction(max:lerror)
-        for (size_t i = 0; i < batchCount; ++i) {
-            if (internal_info[i] == 0)
-                continue;    // skip problems that passed error checks
-            lerror = std::max(lerror, internal_info[i]);
-        }
-        info[0] = (lerror == INTERNAL_INFO_DEFAULT) ? 0 : lerror;
-
-        // delete the internal vector
-        delete[] internal_info;
-
-        // throw an exception if needed
-        blas_error_if_msg( info[0] != 0, "info = %lld", (long long) info[0] );
+    else if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
+        return -3;
     }
-    else {
-        int64_t info_ = 0;
-        #pragma omp parallel for reduction(+:info_)
-        for (size_t i = 0; i < batchCount; ++i) {
-            info_ += info[i];
-        }
-        blas_error_if_msg( info_ != 0, "One or more non-zero entry in vector info");
+    else if (trans_ != Op::NoTrans && trans_ != Op::Trans && trans_ != Op::ConjTrans) {
+        return -4;
+    }
+    else if (diag_ != Diag::NonUnit && diag_ != Diag::Unit) {
+        return -5;
     }
+    else if (m_ < 0) return -6;
+    else if (n_ < 0) return -7;
+    else if (lda_ < nrowA_) return -10;
+    else if (ldb_ < nrowB_) return -12;
+    return 0;
 }
 
 // -----------------------------------------------------------------------------
-// batch trmm check
+// batch trsm check
 template<typename T>
-void trmm_check(
+void trsm_check(
         blas::Layout                   layout,
         std::vector<blas::Side> const &side,
         std::vector<blas::Uplo> const &uplo,
@@ -271,6 +576,33 @@ void trmm_check(
         std::vector<T*>         const &A, std::vector<int64_t> const &lda,
         std::vector<T*>         const &B, std::vector<int64_t> const &ldb,
         const size_t batchCount, std::vector<int64_t> &info)
+{
+    trsm_check_sizes( layout, side, uplo, trans, diag, m, n, alpha, A, lda, B, ldb, batchCount );
+
+    int64_t lerror = INTERNAL_INFO_DEFAULT;
+    #pragma omp parallel for schedule(dynamic) reduction(max:lerror)
+    for (size_t i = 0; i < batchCount; ++i) {
+        int64_t info_ = trsm_check_one( layout, side, uplo, trans, diag, m, n, lda, ldb, i );
+        set_info( info, i, info_, lerror );
+    }
+    finish_info( info, lerror );
+}
+
+// -----------------------------------------------------------------------------
+// batch trmm check of the argument vector sizes, once per batch
+template<typename T>
+void trmm_check_sizes(
+        blas::Layout                   layout,
+        std::vector<blas::Side> const &side,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op>   const &trans,
+        std::vector<blas::Diag> const &diag,
+        std::vector<int64_t>    const &m,
+        std::vector<int64_t>    const &n,
+        std::vector<T>          const &alpha,
+        std::vector<T*>         const &A, std::vector<int64_t> const &lda,
+        std::vector<T*>         const &B, std::vector<int64_t> const &ldb,
+        const size_t batchCount)
 {
     // size error checking
     blas_error_if( (side.size()  != 1 && side.size()  != batchCount) );
@@ -300,81 +632,87 @@ void trmm_check(
                                       m.size()     > 1 || n.size()    > 1 ||
                                       alpha.size() > 1 || A.size()    > 1 ||
                                       lda.size()   > 1 || ldb.size()  > 1 ));
+}
 
-    int64_t* internal_info;
-    if (info.size() == 1) {
-        internal_info = new int64_t[batchCount];
-    }
-    else {
-        internal_info = &info[0];
-    }
-
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batchCount; ++i) {
-        Side  side_ = extract<Side>(side , i);
-        Uplo  uplo_ = extract<Uplo>(uplo , i);
-        Op   trans_ = extract<Op  >(trans, i);
-        Diag  diag_ = extract<Diag>(diag , i);
+// -----------------------------------------------------------------------------
+// batch trmm check of the arguments of problem i.
+// Returns 0, or -p if the p-th argument is invalid.
+inline int64_t trmm_check_one(
+        blas::Layout layout,
+        std::vector<blas::Side> const &side,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op> const &trans,
+        std::vector<blas::Diag> const &diag,
+        std::vector<int64_t> const &m,
+        std::vector<int64_t> const &n,
+        std::vector<int64_t> const &lda,
+        std::vector<int64_t> const &ldb,
+        size_t i)
+{
+    Side  side_ = extract<Side>(side , i);
+    Uplo  uplo_ = extract<Uplo>(uplo , i);
+    Op   trans_ = extract<Op  >(trans, i);
+    Diag  diag_ = extract<Diag>(diag , i);
 
-        int64_t m_ = extract<int64_t>(m, i);
-        int64_t n_ = extract<int64_t>(n, i);
+    int64_t m_ = extract<int64_t>(m, i);
+    int64_t n_ = extract<int64_t>(n, i);
 
-        int64_t lda_ = extract<int64_t>(lda, i);
-        int64_t ldb_ = extract<int64_t>(ldb, i);
+    int64_t lda_ = extract<int64_t>(lda, i);
+    int64_t ldb_ = extract<int64_t>(ldb, i);
 
-        int64_t nrowA_ = (side_ == Side::Left) ? m_ : n_;
-        int64_t nrowB_ = (layout == Layout::ColMajor) ? m_ : n_;
+    int64_t nrowA_ = (side_ == Side::Left) ? m_ : n_;
+    int64_t nrowB_ = (layout == Layout::ColMajor) ? m_ : n_;
 
-        internal_info[i] = 0;
-        if (side_ != Side::Left && side_ != Side::Right) {
-            internal_info[i] = -2;
-        }
-        else if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
-            internal_info[i] = -3;
-        }
-        else if (trans_ != Op::NoTrans && trans_ != Op::Trans && trans_ != Op::ConjTrans) {
-            internal_info[i] = -4;
-        }
-        else if (diag_ != Diag::NonUnit && diag_ != Diag::Unit) {
-            internal_info[i] = -5;
-        }
-        else if (m_ < 0) internal_info[i] = -6;
-        else if (n_ < 0) internal_info[i] = -7;
-        else if (lda_ < nrowA_) internal_info[i] = -10;
-        else if (ldb_ < nrowB_) internal_info[i] = -12;
+    if (side_ != Side::Left && side_ != Side::Right) {
+        return -2;
     }
+    else if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
+        return -3;
+    }
+    else if (trans_ != Op::NoTrans && trans_ != Op::Trans && trans_ != Op::ConjTrans) {
+        return -4;
+    }
+    else if (diag_ != Diag::NonUnit && diag_ != Diag::Unit) {
+        return -5;
+    }
+    else if (m_ < 0) return -6;
+    else if (n_ < 0) return -7;
+    else if (lda_ < nrowA_) return -10;
+    else if (ldb_ < nrowB_) return -12;
+    return 0;
+}
 
-    if (info.size() == 1) {
-        // do a reduction that finds the first argument to encounter an error
-        int64_t lerror = INTERNAL_INFO_DEFAULT;
-        #pragma omp parallel for reduction(max:lerror)
-        for (size_t i = 0; i < batchCount; ++i) {
-            if (internal_info[i] == 0)
-                continue;    // skip problems that passed error checks
-            lerror = std::max(lerror, internal_info[i]);
-        }
-        info[0] = (lerror == INTERNAL_INFO_DEFAULT) ? 0 : lerror;
-
-        // delete the internal vector
-        delete[] internal_info;
+// -----------------------------------------------------------------------------
+// batch trmm check
+template<typename T>
+void trmm_check(
+        blas::Layout                   layout,
+        std::vector<blas::Side> const &side,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op>   const &trans,
+        std::vector<blas::Diag> const &diag,
+        std::vector<int64_t>    const &m,
+        std::vector<int64_t>    const &n,
+        std::vector<T>          const &alpha,
+        std::vector<T*>         const &A, std::vector<int64_t> const &lda,
+        std::vector<T*>         const &B, std::vector<int64_t> const &ldb,
+        const size_t batchCount, std::vector<int64_t> &info)
+{
+    trmm_check_sizes( layout, side, uplo, trans, diag, m, n, alpha, A, lda, B, ldb, batchCount );
 
-        // throw an exception if needed
-        blas_error_if_msg( info[0] != 0, "info = %lld", (long long) info[0] );
-    }
-    else {
-        int64_t info_ = 0;
-        #pragma omp parallel for reduction(+:info_)
-        for (size_t i = 0; i < batchCount; ++i) {
-            info_ += info[i];
-        }
-        blas_error_if_msg( info_ != 0, "One or more non-zero entry in vector info");
+    int64_t lerror = INTERNAL_INFO_DEFAULT;
+    #pragma omp parallel for schedule(dynamic) reduction(max:lerror)
+    for (size_t i = 0; i < batchCount; ++i) {
+        int64_t info_ = trmm_check_one( layout, side, uplo, trans, diag, m, n, lda, ldb, i );
+        set_info( info, i, info_, lerror );
     }
+    finish_info( info, lerror );
 }
 
 // -----------------------------------------------------------------------------
-// batch hemm check
+// batch hemm check of the argument vector sizes, once per batch
 template<typename T>
-void hemm_check(
+void hemm_check_sizes(
         blas::Layout                   layout,
         std::vector<blas::Side> const &side,
         std::vector<blas::Uplo> const &uplo,
@@ -385,7 +723,7 @@ void hemm_check(
         std::vector<T*>         const &B, std::vector<int64_t> const &ldb,
         std::vector<T>          const &beta,
         std::vector<T*>         const &C, std::vector<int64_t> const &ldc,
-        const size_t batchCount, std::vector<int64_t> &info)
+        const size_t batchCount)
 {
     // size error checking
     blas_error_if( (side.size()  != 1 && side.size()  != batchCount) );
@@ -430,76 +768,81 @@ void hemm_check(
                    ldb.size()   > 1 ||
                    beta.size()  > 1 ||
                    ldc.size()   > 1 ));
+}
 
-    int64_t* internal_info;
-    if (info.size() == 1) {
-        internal_info = new int64_t[batchCount];
-    }
-    else {
-        internal_info = &info[0];
-    }
-
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batchCount; ++i) {
-        Side  side_ = extract<Side>(side , i);
-        Uplo  uplo_ = extract<Uplo>(uplo , i);
+// -----------------------------------------------------------------------------
+// batch hemm check of the arguments of problem i.
+// Returns 0, or -p if the p-th argument is invalid.
+inline int64_t hemm_check_one(
+        blas::Layout layout,
+        std::vector<blas::Side> const &side,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<int64_t> const &m,
+        std::vector<int64_t> const &n,
+        std::vector<int64_t> const &lda,
+        std::vector<int64_t> const &ldb,
+        std::vector<int64_t> const &ldc,
+        size_t i)
+{
+    Side  side_ = extract<Side>(side , i);
+    Uplo  uplo_ = extract<Uplo>(uplo , i);
 
-        int64_t m_ = extract<int64_t>(m, i);
-        int64_t n_ = extract<int64_t>(n, i);
+    int64_t m_ = extract<int64_t>(m, i);
+    int64_t n_ = extract<int64_t>(n, i);
 
-        int64_t lda_ = extract<int64_t>(lda, i);
-        int64_t ldb_ = extract<int64_t>(ldb, i);
-        int64_t ldc_ = extract<int64_t>(ldc, i);
+    int64_t lda_ = extract<int64_t>(lda, i);
+    int64_t ldb_ = extract<int64_t>(ldb, i);
+    int64_t ldc_ = extract<int64_t>(ldc, i);
 
-        int64_t nrowA_ = (side_ == Side::Left) ? m_ : n_;
-        int64_t nrowB_ = (layout == Layout::ColMajor) ? m_ : n_;
-        int64_t nrowC_ = (layout == Layout::ColMajor) ? m_ : n_;
+    int64_t nrowA_ = (side_ == Side::Left) ? m_ : n_;
+    int64_t nrowB_ = (layout == Layout::ColMajor) ? m_ : n_;
+    int64_t nrowC_ = (layout == Layout::ColMajor) ? m_ : n_;
 
-        internal_info[i] = 0;
-        if (side_ != Side::Left && side_ != Side::Right) {
-            internal_info[i] = -2;
-        }
-        else if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
-            internal_info[i] = -3;
-        }
-        else if (m_ < 0) internal_info[i] = -4;
-        else if (n_ < 0) internal_info[i] = -5;
-        else if (lda_ < nrowA_) internal_info[i] = -8;
-        else if (ldb_ < nrowB_) internal_info[i] = -10;
-        else if (ldc_ < nrowC_) internal_info[i] = -13;
+    if (side_ != Side::Left && side_ != Side::Right) {
+        return -2;
     }
+    else if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
+        return -3;
+    }
+    else if (m_ < 0) return -4;
+    else if (n_ < 0) return -5;
+    else if (lda_ < nrowA_) return -8;
+    else if (ldb_ < nrowB_) return -10;
+    else if (ldc_ < nrowC_) return -13;
+    return 0;
+}
 
-    if (info.size() == 1) {
-        // do a reduction that finds the first argument to encounter an error
-        int64_t lerror = INTERNAL_INFO_DEFAULT;
-        #pragma omp parallel for reduction(max:lerror)
-        for (size_t i = 0; i < batchCount; ++i) {
-            if (internal_info[i] == 0)
-                continue;    // skip problems that passed error checks
-            lerror = std::max(lerror, internal_info[i]);
-        }
-        info[0] = (lerror == INTERNAL_INFO_DEFAULT) ? 0 : lerror;
-
-        // delete the internal vector
-        delete[] internal_info;
+// -----------------------------------------------------------------------------
+// batch hemm check
+template<typename T>
+void hemm_check(
+        blas::Layout                   layout,
+        std::vector<blas::Side> const &side,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<int64_t>    const &m,
+        std::vector<int64_t>    const &n,
+        std::vector<T>          const &alpha,
+        std::vector<T*>         const &A, std::vector<int64_t> const &lda,
+        std::vector<T*>         const &B, std::vector<int64_t> const &ldb,
+        std::vector<T>          const &beta,
+        std::vector<T*>         const &C, std::vector<int64_t> const &ldc,
+        const size_t batchCount, std::vector<int64_t> &info)
+{
+    hemm_check_sizes( layout, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount );
 
-        // throw an exception if needed
-         blas_error_if_msg( info[0] != 0, "info = %lld", (long long) info[0] );
-    }
-    else {
-        int64_t info_ = 0;
-        #pragma omp parallel for reduction(+:info_)
-        for (size_t i = 0; i < batchCount; ++i) {
-            info_ += info[i];
-        }
-        blas_error_if_msg( info_ != 0, "One or more non-zero entry in vector info");
+    int64_t lerror = INTERNAL_INFO_DEFAULT;
+    #pragma omp parallel for schedule(dynamic) reduction(max:lerror)
+    for (size_t i = 0; i < batchCount; ++i) {
+        int64_t info_ = hemm_check_one( layout, side, uplo, m, n, lda, ldb, ldc, i );
+        set_info( info, i, info_, lerror );
     }
+    finish_info( info, lerror );
 }
 
 // -----------------------------------------------------------------------------
-// batch herk check
+// batch herk check of the argument vector sizes, once per batch
 template<typename T, typename scalarT>
-void herk_check(
+void herk_check_sizes(
         blas::Layout                   layout,
         std::vector<blas::Uplo> const &uplo,
         std::vector<blas::Op>   const &trans,
@@ -509,7 +852,7 @@ void herk_check(
         std::vector<T*>         const &A, std::vector<int64_t> const &lda,
         std::vector<scalarT>    const &beta,
         std::vector<T*>         const &C, std::vector<int64_t> const &ldc,
-        const size_t batchCount, std::vector<int64_t> &info)
+        const size_t batchCount)
 {
     // size error checking
     blas_error_if( (uplo.size()  != 1 && uplo.size()  != batchCount) );
@@ -545,70 +888,108 @@ void herk_check(
                    lda.size()   > 1 ||
                    beta.size()  > 1 ||
                    ldc.size()   > 1 ));
+}
 
-    int64_t* internal_info;
-    if (info.size() == 1) {
-        internal_info = new int64_t[batchCount];
-    }
-    else {
-        internal_info = &info[0];
-    }
-
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batchCount; ++i) {
-        Uplo  uplo_ = extract<Uplo>(uplo , i);
-        Op   trans_ = extract<Op>(trans , i);
+// -----------------------------------------------------------------------------
+// batch herk check of the arguments of problem i.
+// Returns 0, or -p if the p-th argument is invalid.
+inline int64_t herk_check_one(
+        blas::Layout layout,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op> const &trans,
+        std::vector<int64_t> const &n,
+        std::vector<int64_t> const &k,
+        std::vector<int64_t> const &lda,
+        std::vector<int64_t> const &ldc,
+        size_t i)
+{
+    Uplo  uplo_ = extract<Uplo>(uplo , i);
+    Op   trans_ = extract<Op>(trans , i);
 
-        int64_t n_ = extract<int64_t>(n, i);
-        int64_t k_ = extract<int64_t>(k, i);
+    int64_t n_ = extract<int64_t>(n, i);
+    int64_t k_ = extract<int64_t>(k, i);
 
-        int64_t lda_ = extract<int64_t>(lda, i);
-        int64_t ldc_ = extract<int64_t>(ldc, i);
+    int64_t lda_ = extract<int64_t>(lda, i);
+    int64_t ldc_ = extract<int64_t>(ldc, i);
 
-        int64_t nrowA_ = ((trans_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? n_ : k_;
+    int64_t nrowA_ = ((trans_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? n_ : k_;
 
-        internal_info[i] = 0;
-        if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
-            internal_info[i] = -2;
-        }
-        else if (trans_ != Op::NoTrans && trans_ != Op::ConjTrans) {
-            internal_info[i] = -3;
-        }
-        else if (n_ < 0) internal_info[i] = -4;
-        else if (k_ < 0) internal_info[i] = -5;
-        else if (lda_ < nrowA_) internal_info[i] = -8;
-        else if (ldc_ < n_) internal_info[i] = -11;
+    if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
+        return -2;
     }
+    else if (trans_ != Op::NoTrans && trans_ != Op::ConjTrans) {
+        return -3;
+    }
+    else if (n_ < 0) return -4;
+    else if (k_ < 0) return -5;
+    else if (lda_ < nrowA_) return -8;
+    else if (ldc_ < n_) return -11;
+    return 0;
+}
 
-    if (info.size() == 1) {
-        // do a reduction that finds the first argument to encounter an error
-        int64_t lerror = INTERNAL_INFO_DEFAULT;
-        #pragma omp parallel for reduction(max:lerror)
-        for (size_t i = 0; i < batchCount; ++i) {
-            if (internal_info[i] == 0)
-                continue;    // skip problems that passed error checks
-            lerror = std::max(lerror, internal_info[i]);
-        }
-        info[0] = (lerror == INTERNAL_INFO_DEFAULT) ? 0 : lerror;
-
-        // delete the internal vector
-        delete[] internal_info;
+// -----------------------------------------------------------------------------
+// batch herk check
+template<typename T, typename scalarT>
+void herk_check(
+        blas::Layout                   layout,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op>   const &trans,
+        std::vector<int64_t>    const &n,
+        std::vector<int64_t>    const &k,
+        std::vector<scalarT>    const &alpha,
+        std::vector<T*>         const &A, std::vector<int64_t> const &lda,
+        std::vector<scalarT>    const &beta,
+        std::vector<T*>         const &C, std::vector<int64_t> const &ldc,
+        const size_t batchCount, std::vector<int64_t> &info)
+{
+    herk_check_sizes( layout, uplo, trans, n, k, alpha, A, lda, beta, C, ldc, batchCount );
 
-        // throw an exception if needed
-        blas_error_if_msg( info[0] != 0, "info = %lld", (long long) info[0] );
-    }
-    else {
-        int64_t info_ = 0;
-        #pragma omp parallel for reduction(+:info_)
-        for (size_t i = 0; i < batchCount; ++i) {
-            info_ += info[i];
-        }
-        blas_error_if_msg( info_ != 0, "One or more non-zero entry in vector info");
+    int64_t lerror = INTERNAL_INFO_DEFAULT;
+    #pragma omp parallel for schedule(dynamic) reduction(max:lerror)
+    for (size_t i = 0; i < batchCount; ++i) {
+        int64_t info_ = herk_check_one( layout, uplo, trans, n, k, lda, ldc, i );
+        set_info( info, i, info_, lerror );
     }
+    finish_info( info, lerror );
 }
 
 // -----------------------------------------------------------------------------
-// batch hemm check
+// batch symm check of the argument vector sizes, once per batch
+template<typename T>
+void symm_check_sizes(
+        blas::Layout                   layout,
+        std::vector<blas::Side> const &side,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<int64_t>    const &m,
+        std::vector<int64_t>    const &n,
+        std::vector<T>          const &alpha,
+        std::vector<T*>         const &A, std::vector<int64_t> const &lda,
+        std::vector<T*>         const &B, std::vector<int64_t> const &ldb,
+        std::vector<T>          const &beta,
+        std::vector<T*>         const &C, std::vector<int64_t> const &ldc,
+        const size_t batchCount)
+{
+    hemm_check_sizes(layout, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+// -----------------------------------------------------------------------------
+// batch symm check of the arguments of problem i.
+inline int64_t symm_check_one(
+        blas::Layout layout,
+        std::vector<blas::Side> const &side,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<int64_t> const &m,
+        std::vector<int64_t> const &n,
+        std::vector<int64_t> const &lda,
+        std::vector<int64_t> const &ldb,
+        std::vector<int64_t> const &ldc,
+        size_t i)
+{
+    return hemm_check_one(layout, side, uplo, m, n, lda, ldb, ldc, i);
+}
+
+// -----------------------------------------------------------------------------
+// batch symm check
 template<typename T>
 void symm_check(
         blas::Layout                   layout,
@@ -627,9 +1008,9 @@ void symm_check(
 }
 
 // -----------------------------------------------------------------------------
-// batch syrk check
+// batch syrk check of the argument vector sizes, once per batch
 template<typename T>
-void syrk_check(
+void syrk_check_sizes(
         blas::Layout                   layout,
         std::vector<blas::Uplo> const &uplo,
         std::vector<blas::Op>   const &trans,
@@ -639,7 +1020,7 @@ void syrk_check(
         std::vector<T*>         const &A, std::vector<int64_t> const &lda,
         std::vector<T>          const &beta,
         std::vector<T*>         const &C, std::vector<int64_t> const &ldc,
-        const size_t batchCount, std::vector<int64_t> &info)
+        const size_t batchCount)
 {
     // size error checking
     blas_error_if( (uplo.size()  != 1 && uplo.size()  != batchCount) );
@@ -675,72 +1056,75 @@ void syrk_check(
                    lda.size()   > 1 ||
                    beta.size()  > 1 ||
                    ldc.size()   > 1 ));
+}
 
-    int64_t* internal_info;
-    if (info.size() == 1) {
-        internal_info = new int64_t[batchCount];
-    }
-    else {
-        internal_info = &info[0];
-    }
-
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batchCount; ++i) {
-        Uplo  uplo_ = extract<Uplo>(uplo , i);
-        Op   trans_ = extract<Op>(trans , i);
+// -----------------------------------------------------------------------------
+// batch syrk check of the arguments of problem i.
+// Returns 0, or -p if the p-th argument is invalid.
+inline int64_t syrk_check_one(
+        blas::Layout layout,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op> const &trans,
+        std::vector<int64_t> const &n,
+        std::vector<int64_t> const &k,
+        std::vector<int64_t> const &lda,
+        std::vector<int64_t> const &ldc,
+        size_t i)
+{
+    Uplo  uplo_ = extract<Uplo>(uplo , i);
+    Op   trans_ = extract<Op>(trans , i);
 
-        int64_t n_ = extract<int64_t>(n, i);
-        int64_t k_ = extract<int64_t>(k, i);
+    int64_t n_ = extract<int64_t>(n, i);
+    int64_t k_ = extract<int64_t>(k, i);
 
-        int64_t lda_ = extract<int64_t>(lda, i);
-        int64_t ldc_ = extract<int64_t>(ldc, i);
+    int64_t lda_ = extract<int64_t>(lda, i);
+    int64_t ldc_ = extract<int64_t>(ldc, i);
 
-        int64_t nrowA_ = ((trans_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? n_ : k_;
+    int64_t nrowA_ = ((trans_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? n_ : k_;
 
-        internal_info[i] = 0;
-        if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
-            internal_info[i] = -2;
-        }
-        else if (trans_ != Op::NoTrans && trans_ != Op::Trans) {
-            internal_info[i] = -3;
-        }
-        else if (n_ < 0) internal_info[i] = -4;
-        else if (k_ < 0) internal_info[i] = -5;
-        else if (lda_ < nrowA_) internal_info[i] = -8;
-        else if (ldc_ < n_) internal_info[i] = -11;
+    if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
+        return -2;
     }
+    else if (trans_ != Op::NoTrans && trans_ != Op::Trans) {
+        return -3;
+    }
+    else if (n_ < 0) return -4;
+    else if (k_ < 0) return -5;
+    else if (lda_ < nrowA_) return -8;
+    else if (ldc_ < n_) return -11;
+    return 0;
+}
 
-    if (info.size() == 1) {
-        // do a reduction that finds the first argument to encounter an error
-        int64_t lerror = INTERNAL_INFO_DEFAULT;
-        #pragma omp parallel for reduction(max:lerror)
-        for (size_t i = 0; i < batchCount; ++i) {
-            if (internal_info[i] == 0)
-                continue;    // skip problems that passed error checks
-            lerror = std::max(lerror, internal_info[i]);
-        }
-        info[0] = (lerror == INTERNAL_INFO_DEFAULT) ? 0 : lerror;
-
-        // delete the internal vector
-        delete[] internal_info;
+// -----------------------------------------------------------------------------
+// batch syrk check
+template<typename T>
+void syrk_check(
+        blas::Layout                   layout,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op>   const &trans,
+        std::vector<int64_t>    const &n,
+        std::vector<int64_t>    const &k,
+        std::vector<T>          const &alpha,
+        std::vector<T*>         const &A, std::vector<int64_t> const &lda,
+        std::vector<T>          const &beta,
+        std::vector<T*>         const &C, std::vector<int64_t> const &ldc,
+        const size_t batchCount, std::vector<int64_t> &info)
+{
+    syrk_check_sizes( layout, uplo, trans, n, k, alpha, A, lda, beta, C, ldc, batchCount );
 
-        // throw an exception if needed
-        blas_error_if_msg( info[0] != 0, "info = %lld", (long long) info[0] );
-    }
-    else {
-        int64_t info_ = 0;
-        #pragma omp parallel for reduction(+:info_)
-        for (size_t i = 0; i < batchCount; ++i) {
-            info_ += info[i];
-        }
-        blas_error_if_msg( info_ != 0, "One or more non-zero entry in vector info");
+    int64_t lerror = INTERNAL_INFO_DEFAULT;
+    #pragma omp parallel for schedule(dynamic) reduction(max:lerror)
+    for (size_t i = 0; i < batchCount; ++i) {
+        int64_t info_ = syrk_check_one( layout, uplo, trans, n, k, lda, ldc, i );
+        set_info( info, i, info_, lerror );
     }
+    finish_info( info, lerror );
 }
 
 // -----------------------------------------------------------------------------
-// batch her2k check
+// batch her2k check of the argument vector sizes, once per batch
 template<typename T, typename scalarT>
-void her2k_check(
+void her2k_check_sizes(
         blas::Layout                   layout,
         std::vector<blas::Uplo> const &uplo,
         std::vector<blas::Op>   const &trans,
@@ -751,7 +1135,7 @@ void her2k_check(
         std::vector<T*>         const &B, std::vector<int64_t> const &ldb,
         std::vector<scalarT>    const &beta,
         std::vector<T*>         const &C, std::vector<int64_t> const &ldc,
-        const size_t batchCount, std::vector<int64_t> &info)
+        const size_t batchCount)
 {
     // size error checking
     blas_error_if( (uplo.size()  != 1 && uplo.size()  != batchCount) );
@@ -797,75 +1181,80 @@ void her2k_check(
                    ldb.size()   > 1 ||
                    beta.size()  > 1 ||
                    ldc.size()   > 1 ));
+}
 
-    int64_t* internal_info;
-    if (info.size() == 1) {
-        internal_info = new int64_t[batchCount];
-    }
-    else {
-        internal_info = &info[0];
-    }
-
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batchCount; ++i) {
-        Uplo  uplo_ = extract<Uplo>(uplo , i);
-        Op   trans_ = extract<Op>(trans , i);
+// -----------------------------------------------------------------------------
+// batch her2k check of the arguments of problem i.
+// Returns 0, or -p if the p-th argument is invalid.
+inline int64_t her2k_check_one(
+        blas::Layout layout,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op> const &trans,
+        std::vector<int64_t> const &n,
+        std::vector<int64_t> const &k,
+        std::vector<int64_t> const &lda,
+        std::vector<int64_t> const &ldb,
+        std::vector<int64_t> const &ldc,
+        size_t i)
+{
+    Uplo  uplo_ = extract<Uplo>(uplo , i);
+    Op   trans_ = extract<Op>(trans , i);
 
-        int64_t n_ = extract<int64_t>(n, i);
-        int64_t k_ = extract<int64_t>(k, i);
+    int64_t n_ = extract<int64_t>(n, i);
+    int64_t k_ = extract<int64_t>(k, i);
 
-        int64_t lda_ = extract<int64_t>(lda, i);
-        int64_t ldb_ = extract<int64_t>(ldb, i);
-        int64_t ldc_ = extract<int64_t>(ldc, i);
+    int64_t lda_ = extract<int64_t>(lda, i);
+    int64_t ldb_ = extract<int64_t>(ldb, i);
+    int64_t ldc_ = extract<int64_t>(ldc, i);
 
-        int64_t nrowA_ = ((trans_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? n_ : k_;
-        int64_t nrowB_ = ((trans_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? n_ : k_;
+    int64_t nrowA_ = ((trans_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? n_ : k_;
+    int64_t nrowB_ = ((trans_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? n_ : k_;
 
-        internal_info[i] = 0;
-        if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
-            internal_info[i] = -2;
-        }
-        else if (trans_ != Op::NoTrans && trans_ != Op::ConjTrans) {
-            internal_info[i] = -3;
-        }
-        else if (n_ < 0) internal_info[i] = -4;
-        else if (k_ < 0) internal_info[i] = -5;
-        else if (lda_ < nrowA_) internal_info[i] = -8;
-        else if (ldb_ < nrowB_) internal_info[i] = -10;
-        else if (ldc_ < n_) internal_info[i] = -13;
+    if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
+        return -2;
     }
+    else if (trans_ != Op::NoTrans && trans_ != Op::ConjTrans) {
+        return -3;
+    }
+    else if (n_ < 0) return -4;
+    else if (k_ < 0) return -5;
+    else if (lda_ < nrowA_) return -8;
+    else if (ldb_ < nrowB_) return -10;
+    else if (ldc_ < n_) return -13;
+    return 0;
+}
 
-    if (info.size() == 1) {
-        // do a reduction that finds the first argument to encounter an error
-        int64_t lerror = INTERNAL_INFO_DEFAULT;
-        #pragma omp parallel for reduction(max:lerror)
-        for (size_t i = 0; i < batchCount; ++i) {
-            if (internal_info[i] == 0)
-                continue;    // skip problems that passed error checks
-            lerror = std::max(lerror, internal_info[i]);
-        }
-        info[0] = (lerror == INTERNAL_INFO_DEFAULT) ? 0 : lerror;
-
-        // delete the internal vector
-        delete[] internal_info;
+// -----------------------------------------------------------------------------
+// batch her2k check
+template<typename T, typename scalarT>
+void her2k_check(
+        blas::Layout                   layout,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op>   const &trans,
+        std::vector<int64_t>    const &n,
+        std::vector<int64_t>    const &k,
+        std::vector<T>          const &alpha,
+        std::vector<T*>         const &A, std::vector<int64_t> const &lda,
+        std::vector<T*>         const &B, std::vector<int64_t> const &ldb,
+        std::vector<scalarT>    const &beta,
+        std::vector<T*>         const &C, std::vector<int64_t> const &ldc,
+        const size_t batchCount, std::vector<int64_t> &info)
+{
+    her2k_check_sizes( layout, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount );
 
-        // throw an exception if needed
-        blas_error_if_msg( info[0] != 0, "info = %lld", (long long) info[0] );
-    }
-    else {
-        int64_t info_ = 0;
-        #pragma omp parallel for reduction(+:info_)
-        for (size_t i = 0; i < batchCount; ++i) {
-            info_ += info[i];
-        }
-        blas_error_if_msg( info_ != 0, "One or more non-zero entry in vector info");
+    int64_t lerror = INTERNAL_INFO_DEFAULT;
+    #pragma omp parallel for schedule(dynamic) reduction(max:lerror)
+    for (size_t i = 0; i < batchCount; ++i) {
+        int64_t info_ = her2k_check_one( layout, uplo, trans, n, k, lda, ldb, ldc, i );
+        set_info( info, i, info_, lerror );
     }
+    finish_info( info, lerror );
 }
 
 // -----------------------------------------------------------------------------
-// batch syr2k check
+// batch syr2k check of the argument vector sizes, once per batch
 template<typename T>
-void syr2k_check(
+void syr2k_check_sizes(
         blas::Layout                   layout,
         std::vector<blas::Uplo> const &uplo,
         std::vector<blas::Op>   const &trans,
@@ -876,7 +1265,7 @@ void syr2k_check(
         std::vector<T*>         const &B, std::vector<int64_t> const &ldb,
         std::vector<T>          const &beta,
         std::vector<T*>         const &C, std::vector<int64_t> const &ldc,
-        const size_t batchCount, std::vector<int64_t> &info)
+        const size_t batchCount)
 {
     // size error checking
     blas_error_if( (uplo.size()  != 1 && uplo.size()  != batchCount) );
@@ -922,69 +1311,74 @@ void syr2k_check(
                    ldb.size()   > 1 ||
                    beta.size()  > 1 ||
                    ldc.size()   > 1 ));
+}
 
-    int64_t* internal_info;
-    if (info.size() == 1) {
-        internal_info = new int64_t[batchCount];
-    }
-    else {
-        internal_info = &info[0];
-    }
-
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batchCount; ++i) {
-        Uplo  uplo_ = extract<Uplo>(uplo , i);
-        Op   trans_ = extract<Op>(trans , i);
+// -----------------------------------------------------------------------------
+// batch syr2k check of the arguments of problem i.
+// Returns 0, or -p if the p-th argument is invalid.
+inline int64_t syr2k_check_one(
+        blas::Layout layout,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op> const &trans,
+        std::vector<int64_t> const &n,
+        std::vector<int64_t> const &k,
+        std::vector<int64_t> const &lda,
+        std::vector<int64_t> const &ldb,
+        std::vector<int64_t> const &ldc,
+        size_t i)
+{
+    Uplo  uplo_ = extract<Uplo>(uplo , i);
+    Op   trans_ = extract<Op>(trans , i);
 
-        int64_t n_ = extract<int64_t>(n, i);
-        int64_t k_ = extract<int64_t>(k, i);
+    int64_t n_ = extract<int64_t>(n, i);
+    int64_t k_ = extract<int64_t>(k, i);
 
-        int64_t lda_ = extract<int64_t>(lda, i);
-        int64_t ldb_ = extract<int64_t>(ldb, i);
-        int64_t ldc_ = extract<int64_t>(ldc, i);
+    int64_t lda_ = extract<int64_t>(lda, i);
+    int64_t ldb_ = extract<int64_t>(ldb, i);
+    int64_t ldc_ = extract<int64_t>(ldc, i);
 
-        int64_t nrowA_ = ((trans_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? n_ : k_;
-        int64_t nrowB_ = ((trans_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? n_ : k_;
+    int64_t nrowA_ = ((trans_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? n_ : k_;
+    int64_t nrowB_ = ((trans_ == Op::NoTrans) ^ (layout == Layout::RowMajor)) ? n_ : k_;
 
-        internal_info[i] = 0;
-        if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
-            internal_info[i] = -2;
-        }
-        else if (trans_ != Op::NoTrans && trans_ != Op::Trans) {
-            internal_info[i] = -3;
-        }
-        else if (n_ < 0) internal_info[i] = -4;
-        else if (k_ < 0) internal_info[i] = -5;
-        else if (lda_ < nrowA_) internal_info[i] = -8;
-        else if (ldb_ < nrowB_) internal_info[i] = -10;
-        else if (ldc_ < n_) internal_info[i] = -13;
+    if (uplo_ != Uplo::Lower && uplo_ != Uplo::Upper) {
+        return -2;
     }
+    else if (trans_ != Op::NoTrans && trans_ != Op::Trans) {
+        return -3;
+    }
+    else if (n_ < 0) return -4;
+    else if (k_ < 0) return -5;
+    else if (lda_ < nrowA_) return -8;
+    else if (ldb_ < nrowB_) return -10;
+    else if (ldc_ < n_) return -13;
+    return 0;
+}
 
-    if (info.size() == 1) {
-        // do a reduction that finds the first argument to encounter an error
-        int64_t lerror = INTERNAL_INFO_DEFAULT;
-        #pragma omp parallel for reduction(max:lerror)
-        for (size_t i = 0; i < batchCount; ++i) {
-            if (internal_info[i] == 0)
-                continue;    // skip problems that passed error checks
-            lerror = std::max(lerror, internal_info[i]);
-        }
-        info[0] = (lerror == INTERNAL_INFO_DEFAULT) ? 0 : lerror;
-
-        // delete the internal vector
-        delete[] internal_info;
+// -----------------------------------------------------------------------------
+// batch syr2k check
+template<typename T>
+void syr2k_check(
+        blas::Layout                   layout,
+        std::vector<blas::Uplo> const &uplo,
+        std::vector<blas::Op>   const &trans,
+        std::vector<int64_t>    const &n,
+        std::vector<int64_t>    const &k,
+        std::vector<T>          const &alpha,
+        std::vector<T*>         const &A, std::vector<int64_t> const &lda,
+        std::vector<T*>         const &B, std::vector<int64_t> const &ldb,
+        std::vector<T>          const &beta,
+        std::vector<T*>         const &C, std::vector<int64_t> const &ldc,
+        const size_t batchCount, std::vector<int64_t> &info)
+{
+    syr2k_check_sizes( layout, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount );
 
-        // throw an exception if needed
-        blas_error_if_msg( info[0] != 0, "info = %lld", (long long) info[0] );
-    }
-    else {
-        int64_t info_ = 0;
-        #pragma omp parallel for reduction(+:info_)
-        for (size_t i = 0; i < batchCount; ++i) {
-            info_ += info[i];
-        }
-        blas_error_if_msg( info_ != 0, "One or more non-zero entry in vector info");
+    int64_t lerror = INTERNAL_INFO_DEFAULT;
+    #pragma omp parallel for schedule(dynamic) reduction(max:lerror)
+    for (size_t i = 0; i < batchCount; ++i) {
+        int64_t info_ = syr2k_check_one( layout, uplo, trans, n, k, lda, ldb, ldc, i );
+        set_info( info, i, info_, lerror );
     }
+    finish_info( info, lerror );
 }
 
 }  // namespace batch
@@ -9,6 +9,8 @@
 #include "blas/util.hh"
 #include "blas/defines.h"
 
+#include <memory>
+
 #ifdef BLAS_HAVE_CUBLAS
     #include <cuda_runtime.h>
     #include <cublas_v2.h>
@@ -33,6 +35,10 @@
     #include <CL/sycl/detail/cl.h>  // For CL version
     #include <CL/sycl.hpp>
 
+#else
+    // host backend
+    #include <functional>
+
 #endif
 
 namespace blas {
@@ -111,7 +117,112 @@ enum class MemcpyKind : device_blas_int {
 // -----------------------------------------------------------------------------
 // constants
 const int DEV_QUEUE_DEFAULT_BATCH_LIMIT = 50000;
-const int DEV_QUEUE_FORK_SIZE           = 10;
+const int DEV_QUEUE_FORK_SIZE           = 10;  // default Queue::fork_size
+
+#if ! defined(BLAS_HAVE_CUBLAS) && ! defined(BLAS_HAVE_ROCBLAS) && ! defined(BLAS_HAVE_ONEMKL)
+namespace internal {
+
+//==============================================================================
+/// In-order stream of tasks, run asynchronously on a host worker thread.
+/// This is the host backend's equivalent of a CUDA or HIP stream, used
+/// when BLAS++ is compiled without GPU support: device memory is host
+/// memory, and device routines run the host BLAS on the stream's thread.
+/// The thread is started by the first submit.
+///
+class HostStream
+{
+public:
+    HostStream();
+    ~HostStream();
+    HostStream( HostStream const& ) = delete;
+    HostStream& operator=( HostStream const& ) = delete;
+
+    /// Adds task to the end of the stream.
+    void submit( std::function<void ()> task );
+
+    /// Waits until all submitted tasks are done. If a task threw an
+    /// exception, rethrows the first one.
+    void sync();
+
+    /// Waits until all tasks on all host streams are done.
+    static void sync_all();
+
+private:
+    struct State;
+    std::shared_ptr< State > state_;
+};
+
+struct HostEvent;
+
+}  // namespace internal
+#endif
+
+namespace internal {
+class QueuePool;
+}  // namespace internal
+
+//==============================================================================
+/// Statistics of a Queue's memory pool; see Queue::pool_stats.
+/// Sizes are in bytes, rounded up to the pool's size classes.
+///
+struct PoolStats
+{
+    int64_t allocs        = 0;  ///< pool_malloc calls
+    int64_t hits          = 0;  ///< pool_malloc calls served from the cache
+    int64_t frees         = 0;  ///< pool_free calls
+    int64_t device_allocs = 0;  ///< blocks allocated with device_malloc
+    int64_t device_frees  = 0;  ///< blocks freed with device_free
+    size_t  bytes_in_use  = 0;  ///< bytes held by callers
+    size_t  bytes_cached  = 0;  ///< bytes cached in the pool for reuse
+    size_t  high_water    = 0;  ///< peak of bytes_in_use + bytes_cached
+
+    /// @return fraction of pool_malloc calls served from the cache.
+    double hit_rate() const
+    {
+        return allocs > 0 ? double( hits ) / allocs : 0.0;
+    }
+};
+
+//==============================================================================
+/// Event marking a point in the work submitted to a Queue.
+/// Record it on one queue with Queue::record, then make another queue wait
+/// for it with Queue::wait, to order work between queues, e.g., copies and
+/// computation, without synchronizing with the host.
+/// An event that was never recorded is complete.
+///
+class Event
+{
+public:
+    Event();
+    ~Event();
+    // Disable copying; must construct anew.
+    Event( Event const& ) = delete;
+    Event& operator=( Event const& ) = delete;
+
+    bool query() const;
+    void sync();
+
+private:
+    friend class Queue;
+
+    #ifdef BLAS_HAVE_CUBLAS
+        // created by the first record, on device_
+        cudaEvent_t  event_;
+        blas::Device device_;
+
+    #elif defined(BLAS_HAVE_ROCBLAS)
+        // created by the first record, on device_
+        hipEvent_t   event_;
+        blas::Device device_;
+
+    #elif defined(BLAS_HAVE_ONEMKL)
+        cl::sycl::event event_;
+
+    #else
+        // set by the stream when it reaches the event; null if not recorded
+        std::shared_ptr< internal::HostEvent > event_;
+    #endif
+};
 
 //==============================================================================
 /// Queue for executing GPU device routines.
@@ -133,6 +244,11 @@ public:
     void                   sync();
     size_t                 get_batch_limit() { return batch_limit_; }
     void**                 get_dev_ptr_array();
+    void**                 set_dev_ptr_arrays(
+                               size_t count,
+                               void* const* Aarray,
+                               void* const* Barray,
+                               void* const* Carray );
 
     /// @return device workspace.
     void* work() { return (void*) work_; }
@@ -144,10 +260,46 @@ public:
     template <typename scalar_t>
     void work_resize( size_t lwork );
 
-    // switch from default stream to parallel streams
-    void fork();
+    //----------
+    // Stream-ordered memory pool.
+    // Blocks freed with pool_free are cached by size class. A cached block
+    // is reused at once by the stream that freed it, since work on a stream
+    // runs in order, and by any stream after the next sync, or the next
+    // outermost fork or join.
+
+    /// @return device memory for nelements of type T, from the pool.
+    /// Free with pool_free, not device_free.
+    template <typename T>
+    T* pool_malloc( int64_t nelements )
+    {
+        blas_error_if( nelements < 0 );
+        return (T*) pool_malloc_bytes( nelements * sizeof(T) );
+    }
+
+    void      pool_free( void* ptr );
+    void      pool_trim( size_t bytes_to_keep = 0 );
+    PoolStats pool_stats() const;
+    void      pool_reset_stats();
+
+    //----------
+    // Events. In fork mode, record covers work on all parallel streams,
+    // and wait applies to all parallel streams.
+    void record( Event& event );
+    void wait( Event const& event );
 
-    // switch back to the default stream
+    // number of parallel streams that fork can use
+    size_t fork_size() const { return fork_size_; }
+    void   set_fork_size( size_t fork_size );
+
+    // switch from the current stream to nstreams parallel streams;
+    // forks can be nested, and each fork must be matched by a join;
+    // a nested fork uses streams of its own, not those of enclosing forks
+    void fork( size_t nstreams );
+
+    // switch to all fork_size() parallel streams
+    void fork() { fork( fork_size_ ); }
+
+    // switch back to the stream that was current before the matching fork
     void join();
 
     // return the next-in-line stream (for both default and fork modes)
@@ -162,9 +314,20 @@ public:
     #elif defined(BLAS_HAVE_ONEMKL)
         cl::sycl::device sycl_device() const { return sycl_device_; }
         cl::sycl::queue  stream()      const { return *default_stream_; }
+    #else
+        internal::HostStream& stream() const { return *current_stream_; }
     #endif
 
 private:
+    void* pool_malloc_bytes( size_t bytes );
+    int   pool_stream() const;
+    void  pool_create();
+    void  pool_mark_ready();
+    void  pool_release();
+    void  ptr_arrays_resize( size_t nstreams );
+    void  parallel_streams_resize( size_t nstreams );
+    void  ptr_arrays_release();
+
     // associated device ID
     blas::Device device_;
 
@@ -172,10 +335,24 @@ private:
     // (e.g. a pointer array)
     size_t batch_limit_;
 
+    // Cache of device memory; see pool_malloc.
+    internal::QueuePool* pool_;
+
     // Workspace for pointer arrays of batch routines or other purposes.
     char* work_;
     size_t lwork_;
 
+    // Double-buffered pointer arrays; see set_dev_ptr_arrays.
+    // Each stream (default, then parallel) has 2 buffers in work_, and
+    // 2 pinned staging buffers and an upload stream, created on first use.
+    struct PtrArrayBuffer {
+        Event uploaded;  // staging buffer was copied to work_
+        Event used;      // kernels reading the buffer in work_ are done
+    };
+    std::vector< std::unique_ptr< PtrArrayBuffer > > ptr_array_buffers_;
+    std::vector< int >    ptr_array_last_;     // per stream: last buffer, or -1
+    std::vector< void** > ptr_array_staging_;  // per stream
+
     // the number of streams the queue is currently using for
     // launching kernels (1 by default)
     size_t num_active_streams_;
@@ -183,6 +360,21 @@ private:
     // an index to the current stream in use
     size_t current_stream_index_;
 
+    // number of parallel streams that fork can use
+    size_t fork_size_;
+
+    // index of the first parallel stream of the innermost fork; a nested
+    // fork uses the streams after those of the enclosing fork
+    size_t first_stream_index_;
+
+    // for each nested fork, the stream to return to on join
+    struct ForkLevel {
+        size_t stream_index;
+        size_t num_active_streams;
+        size_t first_stream_index;
+    };
+    std::vector< ForkLevel > fork_levels_;
+
     #ifdef BLAS_HAVE_CUBLAS
         // associated device blas handle
         cublasHandle_t handle_;
@@ -194,10 +386,13 @@ private:
         cudaStream_t default_stream_;
 
         // parallel streams in fork mode
-        cudaStream_t parallel_streams_[DEV_QUEUE_FORK_SIZE];
+        std::vector< cudaStream_t > parallel_streams_;
 
         cudaEvent_t  default_event_;
-        cudaEvent_t  parallel_events_[DEV_QUEUE_FORK_SIZE];
+        std::vector< cudaEvent_t > parallel_events_;
+
+        // upload streams for pointer arrays
+        std::vector< cudaStream_t > upload_streams_;
 
     #elif defined(BLAS_HAVE_ROCBLAS)
         // associated device blas handle
@@ -210,10 +405,13 @@ private:
         hipStream_t  default_stream_;
 
         // parallel streams in fork mode
-        hipStream_t  parallel_streams_[DEV_QUEUE_FORK_SIZE];
+        std::vector< hipStream_t > parallel_streams_;
 
         hipEvent_t   default_event_;
-        hipEvent_t   parallel_events_[DEV_QUEUE_FORK_SIZE];
+        std::vector< hipEvent_t > parallel_events_;
+
+        // upload streams for pointer arrays
+        std::vector< hipStream_t > upload_streams_;
 
     #elif defined(BLAS_HAVE_ONEMKL)
         // in addition to the integer device_ member, we need
@@ -229,10 +427,16 @@ private:
 
     #else
         // pointer to current stream (default or fork mode)
-        void** current_stream_;
+        internal::HostStream* current_stream_;
 
-        // default CUDA stream for this queue; may be NULL
-        void*  default_stream_;
+        // default host stream for this queue
+        internal::HostStream  default_stream_;
+
+        // parallel streams in fork mode
+        std::vector< std::unique_ptr< internal::HostStream > > parallel_streams_;
+
+        // upload streams for pointer arrays
+        std::vector< std::unique_ptr< internal::HostStream > > upload_streams_;
     #endif
 };
 
@@ -373,6 +577,21 @@ void device_free( void* ptr, blas::Queue &queue );
 void device_free_pinned( void* ptr );
 void device_free_pinned( void* ptr, blas::Queue &queue );
 
+#if ! defined(BLAS_HAVE_CUBLAS) && ! defined(BLAS_HAVE_ROCBLAS) && ! defined(BLAS_HAVE_ONEMKL)
+namespace internal {
+
+// Host backend memory functions, in bytes; see device_utils.cc.
+void* host_malloc( size_t bytes );
+void  host_memset( void* ptr, int value, size_t bytes, Queue& queue );
+void  host_copy_latency();
+void  host_memcpy_2d(
+    void*       dst, size_t dst_pitch,
+    void const* src, size_t src_pitch,
+    size_t width, size_t height, Queue& queue );
+
+}  // namespace internal
+#endif
+
 // -----------------------------------------------------------------------------
 // Template functions declared here
 // -----------------------------------------------------------------------------
@@ -400,8 +619,7 @@ T* device_malloc(
         throw blas::Error( "unsupported function for sycl backend", __func__ );
 
     #else
-
-        throw blas::Error( "device BLAS not available", __func__ );
+        ptr = (T*) internal::host_malloc( nelements * sizeof(T) );
     #endif
     return ptr;
 }
@@ -436,7 +654,7 @@ T* device_malloc(
             ptr = (T*)cl::sycl::malloc_shared( nelements*sizeof(T), queue.stream() ) );
 
     #else
-        throw blas::Error( "device BLAS not available", __func__ );
+        ptr = (T*) internal::host_malloc( nelements * sizeof(T) );
     #endif
     return ptr;
 }
@@ -464,7 +682,7 @@ T* device_malloc_pinned(
         throw blas::Error( "unsupported function for sycl backend", __func__ );
 
     #else
-        throw blas::Error( "device BLAS not available", __func__ );
+        ptr = (T*) internal::host_malloc( nelements * sizeof(T) );
     #endif
     return ptr;
 }
@@ -498,7 +716,7 @@ T* device_malloc_pinned(
             ptr = (T*)cl::sycl::malloc_host( nelements*sizeof(T), queue.stream() ) );
 
     #else
-        throw blas::Error( "device BLAS not available", __func__ );
+        ptr = (T*) internal::host_malloc( nelements * sizeof(T) );
     #endif
     return ptr;
 }
@@ -543,7 +761,7 @@ void device_memset(
             queue.stream().memset( ptr, value, nelements * sizeof(T) ) );
 
     #else
-        throw blas::Error( "device BLAS not available", __func__ );
+        internal::host_memset( ptr, value, nelements * sizeof(T), queue );
     #endif
 }
 
@@ -586,7 +804,8 @@ void device_memcpy(
             queue.stream().memcpy( dst, src, sizeof(T)*nelements ) );
 
     #else
-        throw blas::Error( "device BLAS not available", __func__ );
+        internal::host_memcpy_2d(
+            dst, 0, src, 0, sizeof(T)*nelements, 1, queue );
     #endif
 }
 
@@ -675,7 +894,10 @@ void device_memcpy_2d(
             }
         }
     #else
-        throw blas::Error( "device BLAS not available", __func__ );
+        internal::host_memcpy_2d(
+            dst, sizeof(T)*dst_pitch,
+            src, sizeof(T)*src_pitch,
+            sizeof(T)*width, height, queue );
     #endif
 }
 
@@ -897,12 +1119,14 @@ void Queue::work_resize( size_t lwork )
 {
     lwork *= sizeof(scalar_t);
     if (lwork > lwork_) {
-        sync();
+        // In fork mode, all parallel streams may use the workspace.
+        if (! fork_levels_.empty())
+            sync();
         if (work_) {
-            device_free( work_, *this );
+            pool_free( work_ );
         }
         lwork_ = lwork;
-        work_ = device_malloc<char>( lwork, *this );
+        work_ = pool_malloc<char>( lwork );
     }
 }
 
@@ -203,6 +203,60 @@ void gemm(
     std::complex<double>       *dC, int64_t lddc,
     blas::Queue &queue );
 
+// -----------------------------------------------------------------------------
+// gemmt
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *dA, int64_t ldda,
+    float const *dB, int64_t lddb,
+    float beta,
+    float       *dC, int64_t lddc,
+    blas::Queue &queue );
+
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *dA, int64_t ldda,
+    double const *dB, int64_t lddb,
+    double beta,
+    double       *dC, int64_t lddc,
+    blas::Queue &queue );
+
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda,
+    std::complex<float> const *dB, int64_t lddb,
+    std::complex<float> beta,
+    std::complex<float>       *dC, int64_t lddc,
+    blas::Queue &queue );
+
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda,
+    std::complex<double> const *dB, int64_t lddb,
+    std::complex<double> beta,
+    std::complex<double>       *dC, int64_t lddc,
+    blas::Queue &queue );
+
 // -----------------------------------------------------------------------------
 // trsm
 void trsm(
@@ -1191,5 +1245,488 @@ void syr2k(
     const size_t batch, std::vector<int64_t>       &info,
     blas::Queue &queue );
 
+// -----------------------------------------------------------------------------
+// Strided batch routines, with uniform arguments. Problem i uses the matrices
+// at dA + i*strideA, dB + i*strideB, and dC + i*strideC, so no pointer arrays
+// are built. Strides are in elements.
+
+// -----------------------------------------------------------------------------
+// batch gemm, strided
+void gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float const *dB, int64_t lddb, int64_t strideB,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double const *dB, int64_t lddb, int64_t strideB,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+// -----------------------------------------------------------------------------
+// batch hemm, strided
+void hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float const *dB, int64_t lddb, int64_t strideB,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double const *dB, int64_t lddb, int64_t strideB,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+// -----------------------------------------------------------------------------
+// batch her2k, strided
+void her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float const *dB, int64_t lddb, int64_t strideB,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double const *dB, int64_t lddb, int64_t strideB,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float> const *dB, int64_t lddb, int64_t strideB,
+    float beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double> const *dB, int64_t lddb, int64_t strideB,
+    double beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+// -----------------------------------------------------------------------------
+// batch herk, strided
+void herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    float beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    double beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+// -----------------------------------------------------------------------------
+// batch symm, strided
+void symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float const *dB, int64_t lddb, int64_t strideB,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double const *dB, int64_t lddb, int64_t strideB,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+// -----------------------------------------------------------------------------
+// batch syr2k, strided
+void syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float const *dB, int64_t lddb, int64_t strideB,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double const *dB, int64_t lddb, int64_t strideB,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+// -----------------------------------------------------------------------------
+// batch syrk, strided
+void syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float> beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+void syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double> beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue );
+
+// -----------------------------------------------------------------------------
+// batch trmm, strided
+void trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue );
+
+void trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue );
+
+void trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float>       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue );
+
+void trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double>       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue );
+
+// -----------------------------------------------------------------------------
+// batch trsm, strided
+void trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue );
+
+void trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue );
+
+void trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float>       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue );
+
+void trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double>       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue );
+
 }  // namespace batch
 }  // namespace blas
@@ -7,10 +7,30 @@
 #define BLAS_DOT_HH
 
 #include "blas/util.hh"
+#include "blas/simd.hh"
 
 #include <limits>
 
 namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Unit-stride dot = x^H y for generic types. Overloads in blas/simd.hh
+/// provide vectorized versions for float, double, and complex.
+template< typename TX, typename TY >
+scalar_type<TX, TY> dot_unit(
+    int64_t n,
+    TX const *x,
+    TY const *y )
+{
+    scalar_type<TX, TY> result = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        result += conj(x[i]) * y[i];
+    }
+    return result;
+}
+
+}  // namespace internal
 
 // =============================================================================
 /// @return dot product, $x^H y$.
@@ -53,9 +73,7 @@ scalar_type<TX, TY> dot(
     scalar_t result = 0;
     if (incx == 1 && incy == 1) {
         // unit stride
-        for (int64_t i = 0; i < n; ++i) {
-            result += conj(x[i]) * y[i];
-        }
+        result = internal::dot_unit( n, x, y );
     }
     else {
         // non-unit stride
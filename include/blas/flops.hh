@@ -89,6 +89,14 @@ inline double fmuls_gemm( double m, double n, double k )
 inline double fadds_gemm( double m, double n, double k )
     { return m*n*k; }
 
+// -----------------------------------------------------------------------------
+// gemmt computes the n*(n+1)/2 entries of one triangle of C.
+inline double fmuls_gemmt( double n, double k )
+    { return 0.5*k*n*(n+1); }
+
+inline double fadds_gemmt( double n, double k )
+    { return 0.5*k*n*(n+1); }
+
 // -----------------------------------------------------------------------------
 // Assume gbmm is band matrix A (m-by-k) and general matrix B (k-by-n).
 // Usually, the bottom equation (m-kl <= k and k-ku <= m) calculates the flops,
@@ -102,8 +110,13 @@ inline double fadds_gemm( double m, double n, double k )
 //        (kl*k + (k+1)*k/2 - (k-ku-1)*(k-ku)/2)*n;
 // We are conveniently left with the geometric interpretation of
 // rectangle plus triangle minus triangle.
+// Bandwidths wider than the matrix are limited to the matrix.
 inline double fmuls_gbmm( double m, double n, double k, double kl, double ku )
 {
+    if (m <= 0 || n <= 0 || k <= 0)
+        return 0;
+    kl = (kl < m - 1 ? kl : m - 1);
+    ku = (ku < k - 1 ? ku : k - 1);
     if (m-kl > k)
         return (kl*k + (k+1)*k/2. - (k-ku-1)*(k-ku)/2.)*n;
     if (k-ku > m)
@@ -117,6 +130,26 @@ inline double fadds_gbmm( double m, double n, double k, double kl, double ku )
     return fmuls_gbmm( m, n, k, kl, ku );
 }
 
+// -----------------------------------------------------------------------------
+// gbmv: A is m-by-n, with kl sub-diagonals and ku super-diagonals.
+inline double fmuls_gbmv( double m, double n, double kl, double ku )
+    { return fmuls_gbmm( m, 1, n, kl, ku ); }
+
+inline double fadds_gbmv( double m, double n, double kl, double ku )
+    { return fmuls_gbmv( m, n, kl, ku ); }
+
+// -----------------------------------------------------------------------------
+// tbmv: A is n-by-n triangular with kd off-diagonals,
+// limited to the matrix.
+inline double fmuls_tbmv( double n, double kd )
+{
+    kd = (kd < n - 1 ? kd : n - 1);
+    return n*(kd + 1) - 0.5*kd*(kd + 1);
+}
+
+inline double fadds_tbmv( double n, double kd )
+    { return fmuls_tbmv( n, kd ) - n; }
+
 // -----------------------------------------------------------------------------
 inline double fmuls_hemm( blas::Side side, double m, double n )
     { return (side == blas::Side::Left ? m*m*n : m*n*n); }
@@ -218,6 +251,24 @@ public:
     static double trsv( double n )
         { return trmv( n ); }
 
+    // read A band, x; write y
+    static double gbmv( double m, double n, double kl, double ku )
+        { return 1e-9 * ((fmuls_gbmv( m, n, kl, ku ) + m + n) * sizeof(T)); }
+
+    // read A band triangle, x; write y
+    static double hbmv( double n, double kd )
+        { return 1e-9 * ((fmuls_tbmv( n, kd ) + 2*n) * sizeof(T)); }
+
+    static double sbmv( double n, double kd )
+        { return hbmv( n, kd ); }
+
+    // read A band triangle, x; write x
+    static double tbmv( double n, double kd )
+        { return 1e-9 * ((fmuls_tbmv( n, kd ) + 2*n) * sizeof(T)); }
+
+    static double tbsv( double n, double kd )
+        { return tbmv( n, kd ); }
+
     // read A, x, y; write A
     static double ger( double m, double n )
         { return 1e-9 * ((2*m*n + m + n) * sizeof(T)); }
@@ -246,6 +297,19 @@ public:
     static double gemm( double m, double n, double k )
         { return 1e-9 * ((m*k + k*n + 2*m*n) * sizeof(T)); }
 
+    // read A, B of types TA, TB; read C; write C.
+    // E.g., Gbyte< int32_t >::gemm< int8_t, int8_t >( m, n, k ).
+    template <typename TA, typename TB>
+    static double gemm( double m, double n, double k )
+        { return 1e-9 * (m*k*sizeof(TA) + k*n*sizeof(TB) + 2*m*n*sizeof(T)); }
+
+    // read A, B, C triangle; write C triangle
+    static double gemmt( double n, double k )
+    {
+        double sizeC = 0.5*n*(n+1);
+        return 1e-9 * ((2*n*k + 2*sizeC) * sizeof(T));
+    }
+
     static double hemm( blas::Side side, double m, double n )
     {
         // read A, B, C; write C
@@ -314,6 +378,7 @@ public:
 // template class. Example:
 // gflop< float >::gemm( m, n, k ) yields flops for sgemm.
 // gflop< std::complex<float> >::gemm( m, n, k ) yields flops for cgemm.
+// gflop< int32_t >::gemm( m, n, k ) yields integer ops for int8 gemm.
 //==============================================================================
 template< typename T >
 class Gflop
@@ -373,6 +438,23 @@ public:
     static double trsv( double n )
         { return trmv( n ); }
 
+    static double gbmv( double m, double n, double kl, double ku )
+        { return 1e-9 * (mul_ops*fmuls_gbmv(m, n, kl, ku) +
+                         add_ops*fadds_gbmv(m, n, kl, ku)); }
+
+    static double sbmv( double n, double kd )
+        { return gbmv( n, n, kd, kd ); }
+
+    static double hbmv( double n, double kd )
+        { return sbmv( n, kd ); }
+
+    static double tbmv( double n, double kd )
+        { return 1e-9 * (mul_ops*fmuls_tbmv(n, kd) +
+                         add_ops*fadds_tbmv(n, kd)); }
+
+    static double tbsv( double n, double kd )
+        { return tbmv( n, kd ); }
+
     static double her( double n )
         { return ger( n, n ); }
 
@@ -395,6 +477,10 @@ public:
         { return 1e-9 * (mul_ops*fmuls_gemm(m, n, k) +
                          add_ops*fadds_gemm(m, n, k)); }
 
+    static double gemmt(double n, double k)
+        { return 1e-9 * (mul_ops*fmuls_gemmt(n, k) +
+                         add_ops*fadds_gemmt(n, k)); }
+
     static double gbmm(double m, double n, double k, double kl, double ku)
         { return 1e-9 * (mul_ops*fmuls_gbmm(m, n, k, kl, ku) +
                          add_ops*fadds_gbmm(m, n, k, kl, ku)); }
@@ -417,6 +417,51 @@ void BLAS_zgemv(
     blas_complex_double const *beta,
     blas_complex_double       *y, blas_int const *incy );
 
+// -----------------------------------------------------------------------------
+#define BLAS_sgbmv BLAS_FORTRAN_NAME( sgbmv, SGBMV )
+void BLAS_sgbmv(
+    char const *trans,
+    blas_int const *m, blas_int const *n,
+    blas_int const *kl, blas_int const *ku,
+    float const *alpha,
+    float const *A, blas_int const *lda,
+    float const *x, blas_int const *incx,
+    float const *beta,
+    float       *y, blas_int const *incy );
+
+#define BLAS_dgbmv BLAS_FORTRAN_NAME( dgbmv, DGBMV )
+void BLAS_dgbmv(
+    char const *trans,
+    blas_int const *m, blas_int const *n,
+    blas_int const *kl, blas_int const *ku,
+    double const *alpha,
+    double const *A, blas_int const *lda,
+    double const *x, blas_int const *incx,
+    double const *beta,
+    double       *y, blas_int const *incy );
+
+#define BLAS_cgbmv BLAS_FORTRAN_NAME( cgbmv, CGBMV )
+void BLAS_cgbmv(
+    char const *trans,
+    blas_int const *m, blas_int const *n,
+    blas_int const *kl, blas_int const *ku,
+    blas_complex_float const *alpha,
+    blas_complex_float const *A, blas_int const *lda,
+    blas_complex_float const *x, blas_int const *incx,
+    blas_complex_float const *beta,
+    blas_complex_float       *y, blas_int const *incy );
+
+#define BLAS_zgbmv BLAS_FORTRAN_NAME( zgbmv, ZGBMV )
+void BLAS_zgbmv(
+    char const *trans,
+    blas_int const *m, blas_int const *n,
+    blas_int const *kl, blas_int const *ku,
+    blas_complex_double const *alpha,
+    blas_complex_double const *A, blas_int const *lda,
+    blas_complex_double const *x, blas_int const *incx,
+    blas_complex_double const *beta,
+    blas_complex_double       *y, blas_int const *incy );
+
 // -----------------------------------------------------------------------------
 #define BLAS_sger BLAS_FORTRAN_NAME( sger, SGER )
 void BLAS_sger(
@@ -489,6 +534,27 @@ void BLAS_dsymv(
     double const *beta,
     double       *y, blas_int const *incy );
 
+// -----------------------------------------------------------------------------
+#define BLAS_ssbmv BLAS_FORTRAN_NAME( ssbmv, SSBMV )
+void BLAS_ssbmv(
+    char const *uplo,
+    blas_int const *n, blas_int const *k,
+    float const *alpha,
+    float const *A, blas_int const *lda,
+    float const *x, blas_int const *incx,
+    float const *beta,
+    float       *y, blas_int const *incy );
+
+#define BLAS_dsbmv BLAS_FORTRAN_NAME( dsbmv, DSBMV )
+void BLAS_dsbmv(
+    char const *uplo,
+    blas_int const *n, blas_int const *k,
+    double const *alpha,
+    double const *A, blas_int const *lda,
+    double const *x, blas_int const *incx,
+    double const *beta,
+    double       *y, blas_int const *incy );
+
 // [cz]symv moved to LAPACK++ since they are provided by LAPACK.
 // #define BLAS_csymv BLAS_FORTRAN_NAME( csymv, CSYMV )
 // void BLAS_csymv(
@@ -531,6 +597,27 @@ void BLAS_zhemv(
     blas_complex_double const *beta,
     blas_complex_double       *y, blas_int const *incy );
 
+// -----------------------------------------------------------------------------
+#define BLAS_chbmv BLAS_FORTRAN_NAME( chbmv, CHBMV )
+void BLAS_chbmv(
+    char const *uplo,
+    blas_int const *n, blas_int const *k,
+    blas_complex_float const *alpha,
+    blas_complex_float const *A, blas_int const *lda,
+    blas_complex_float const *x, blas_int const *incx,
+    blas_complex_float const *beta,
+    blas_complex_float       *y, blas_int const *incy );
+
+#define BLAS_zhbmv BLAS_FORTRAN_NAME( zhbmv, ZHBMV )
+void BLAS_zhbmv(
+    char const *uplo,
+    blas_int const *n, blas_int const *k,
+    blas_complex_double const *alpha,
+    blas_complex_double const *A, blas_int const *lda,
+    blas_complex_double const *x, blas_int const *incx,
+    blas_complex_double const *beta,
+    blas_complex_double       *y, blas_int const *incy );
+
 // -----------------------------------------------------------------------------
 #define BLAS_ssyr BLAS_FORTRAN_NAME( ssyr, SSYR )
 void BLAS_ssyr(
@@ -680,6 +767,64 @@ void BLAS_ztrsv(
     blas_complex_double const *A, blas_int const *lda,
     blas_complex_double       *x, blas_int const *incx );
 
+// -----------------------------------------------------------------------------
+#define BLAS_stbmv BLAS_FORTRAN_NAME( stbmv, STBMV )
+void BLAS_stbmv(
+    char const *uplo, char const *trans, char const *diag,
+    blas_int const *n, blas_int const *k,
+    float const *A, blas_int const *lda,
+    float       *x, blas_int const *incx );
+
+#define BLAS_dtbmv BLAS_FORTRAN_NAME( dtbmv, DTBMV )
+void BLAS_dtbmv(
+    char const *uplo, char const *trans, char const *diag,
+    blas_int const *n, blas_int const *k,
+    double const *A, blas_int const *lda,
+    double       *x, blas_int const *incx );
+
+#define BLAS_ctbmv BLAS_FORTRAN_NAME( ctbmv, CTBMV )
+void BLAS_ctbmv(
+    char const *uplo, char const *trans, char const *diag,
+    blas_int const *n, blas_int const *k,
+    blas_complex_float const *A, blas_int const *lda,
+    blas_complex_float       *x, blas_int const *incx );
+
+#define BLAS_ztbmv BLAS_FORTRAN_NAME( ztbmv, ZTBMV )
+void BLAS_ztbmv(
+    char const *uplo, char const *trans, char const *diag,
+    blas_int const *n, blas_int const *k,
+    blas_complex_double const *A, blas_int const *lda,
+    blas_complex_double       *x, blas_int const *incx );
+
+// -----------------------------------------------------------------------------
+#define BLAS_stbsv BLAS_FORTRAN_NAME( stbsv, STBSV )
+void BLAS_stbsv(
+    char const *uplo, char const *trans, char const *diag,
+    blas_int const *n, blas_int const *k,
+    float const *A, blas_int const *lda,
+    float       *x, blas_int const *incx );
+
+#define BLAS_dtbsv BLAS_FORTRAN_NAME( dtbsv, DTBSV )
+void BLAS_dtbsv(
+    char const *uplo, char const *trans, char const *diag,
+    blas_int const *n, blas_int const *k,
+    double const *A, blas_int const *lda,
+    double       *x, blas_int const *incx );
+
+#define BLAS_ctbsv BLAS_FORTRAN_NAME( ctbsv, CTBSV )
+void BLAS_ctbsv(
+    char const *uplo, char const *trans, char const *diag,
+    blas_int const *n, blas_int const *k,
+    blas_complex_float const *A, blas_int const *lda,
+    blas_complex_float       *x, blas_int const *incx );
+
+#define BLAS_ztbsv BLAS_FORTRAN_NAME( ztbsv, ZTBSV )
+void BLAS_ztbsv(
+    char const *uplo, char const *trans, char const *diag,
+    blas_int const *n, blas_int const *k,
+    blas_complex_double const *A, blas_int const *lda,
+    blas_complex_double       *x, blas_int const *incx );
+
 // =============================================================================
 // Level 3 BLAS - Fortran prototypes
 
@@ -724,6 +869,49 @@ void BLAS_zgemm(
     blas_complex_double const *beta,
     blas_complex_double       *C, blas_int const *ldc );
 
+// -----------------------------------------------------------------------------
+// Not in reference BLAS; provided by some libraries, e.g., MKL and
+// OpenBLAS >= 0.3.22. Used only if BLAS_HAVE_GEMMT is defined.
+#define BLAS_sgemmt BLAS_FORTRAN_NAME( sgemmt, SGEMMT )
+void BLAS_sgemmt(
+    char const *uplo, char const *transA, char const *transB,
+    blas_int const *n, blas_int const *k,
+    float const *alpha,
+    float const *A, blas_int const *lda,
+    float const *B, blas_int const *ldb,
+    float const *beta,
+    float       *C, blas_int const *ldc );
+
+#define BLAS_dgemmt BLAS_FORTRAN_NAME( dgemmt, DGEMMT )
+void BLAS_dgemmt(
+    char const *uplo, char const *transA, char const *transB,
+    blas_int const *n, blas_int const *k,
+    double const *alpha,
+    double const *A, blas_int const *lda,
+    double const *B, blas_int const *ldb,
+    double const *beta,
+    double       *C, blas_int const *ldc );
+
+#define BLAS_cgemmt BLAS_FORTRAN_NAME( cgemmt, CGEMMT )
+void BLAS_cgemmt(
+    char const *uplo, char const *transA, char const *transB,
+    blas_int const *n, blas_int const *k,
+    blas_complex_float const *alpha,
+    blas_complex_float const *A, blas_int const *lda,
+    blas_complex_float const *B, blas_int const *ldb,
+    blas_complex_float const *beta,
+    blas_complex_float       *C, blas_int const *ldc );
+
+#define BLAS_zgemmt BLAS_FORTRAN_NAME( zgemmt, ZGEMMT )
+void BLAS_zgemmt(
+    char const *uplo, char const *transA, char const *transB,
+    blas_int const *n, blas_int const *k,
+    blas_complex_double const *alpha,
+    blas_complex_double const *A, blas_int const *lda,
+    blas_complex_double const *B, blas_int const *ldb,
+    blas_complex_double const *beta,
+    blas_complex_double       *C, blas_int const *ldc );
+
 // -----------------------------------------------------------------------------
 #define BLAS_ssymm BLAS_FORTRAN_NAME( ssymm, SSYMM )
 void BLAS_ssymm(
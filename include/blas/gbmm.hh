@@ -0,0 +1,245 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_GBMM_HH
+#define BLAS_GBMM_HH
+
+#include "blas/util.hh"
+#include "blas/gemm.hh"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace blas {
+
+//==============================================================================
+/// General band matrix times general matrix multiply:
+/// \[
+///     C = \alpha op(A) \times op(B) + \beta C,
+/// \]
+/// where $op(X)$ is one of
+///     $op(X) = X$,
+///     $op(X) = X^T$, or
+///     $op(X) = X^H$,
+/// alpha and beta are scalars, A is a band matrix with kl sub-diagonals
+/// and ku super-diagonals, and B and C are general matrices, with
+/// $op(A)$ an m-by-k matrix, $op(B)$ a k-by-n matrix, and C an m-by-n matrix.
+///
+/// Generic implementation for arbitrary data types.
+/// For narrow bands, multiplies directly over the band. Otherwise,
+/// copies block columns of $op(A)$, with the rows its band touches,
+/// into a dense workspace, and multiplies each block with gemm.
+/// For float, double, and complex types, that gemm is the vendor gemm.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] transA
+///     The operation $op(A)$ to be used:
+///     - Op::NoTrans:   $op(A) = A$.
+///     - Op::Trans:     $op(A) = A^T$.
+///     - Op::ConjTrans: $op(A) = A^H$.
+///
+/// @param[in] transB
+///     The operation $op(B)$ to be used:
+///     - Op::NoTrans:   $op(B) = B$.
+///     - Op::Trans:     $op(B) = B^T$.
+///     - Op::ConjTrans: $op(B) = B^H$.
+///
+/// @param[in] m
+///     Number of rows of the matrix C and $op(A)$. m >= 0.
+///
+/// @param[in] n
+///     Number of columns of the matrix C and $op(B)$. n >= 0.
+///
+/// @param[in] k
+///     Number of columns of $op(A)$ and rows of $op(B)$. k >= 0.
+///
+/// @param[in] kl
+///     Number of sub-diagonals of the matrix A. kl >= 0.
+///
+/// @param[in] ku
+///     Number of super-diagonals of the matrix A. ku >= 0.
+///
+/// @param[in] alpha
+///     Scalar alpha. If alpha is zero, A and B are not accessed.
+///
+/// @param[in] A
+///     The band matrix A, in LAPACK band storage, as for gbmv:
+///     - If transA = NoTrans: A is m-by-k, stored in an lda-by-k array
+///       [RowMajor: m-by-lda].
+///     - Otherwise: A is k-by-m, stored in an lda-by-m array
+///       [RowMajor: k-by-lda].
+///
+///     A(i, j) is in A[ ku + i - j + j*lda ]
+///     [RowMajor: A[ kl + j - i + i*lda ]].
+///
+/// @param[in] lda
+///     Leading dimension of A. lda >= kl + ku + 1.
+///
+/// @param[in] B
+///     - If transB = NoTrans:
+///       the k-by-n matrix B, stored in an ldb-by-n array [RowMajor: k-by-ldb].
+///     - Otherwise:
+///       the n-by-k matrix B, stored in an ldb-by-k array [RowMajor: n-by-ldb].
+///
+/// @param[in] ldb
+///     Leading dimension of B.
+///     - If transB = NoTrans: ldb >= max(1, k) [RowMajor: ldb >= max(1, n)].
+///     - Otherwise:           ldb >= max(1, n) [RowMajor: ldb >= max(1, k)].
+///
+/// @param[in] beta
+///     Scalar beta. If beta is zero, C need not be set on input.
+///
+/// @param[in] C
+///     The m-by-n matrix C, stored in an ldc-by-n array [RowMajor: m-by-ldc].
+///
+/// @param[in] ldc
+///     Leading dimension of C. ldc >= max(1, m) [RowMajor: ldc >= max(1, n)].
+///
+/// @ingroup gbmm
+
+template< typename TA, typename TB, typename TC >
+void gbmm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int64_t kl, int64_t ku,
+    scalar_type<TA, TB, TC> alpha,
+    TA const *A, int64_t lda,
+    TB const *B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC       *C, int64_t ldc )
+{
+    typedef blas::scalar_type<TA, TB, TC> scalar_t;
+
+    // constants
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( kl < 0 );
+    blas_error_if( ku < 0 );
+    blas_error_if( lda < kl + ku + 1 );
+
+    bool colmajor = (layout == Layout::ColMajor);
+    if ((transB == Op::NoTrans) == colmajor)
+        blas_error_if( ldb < k );
+    else
+        blas_error_if( ldb < n );
+
+    blas_error_if( ldc < (colmajor ? m : n) );
+
+    // quick return
+    if (m == 0 || n == 0)
+        return;
+
+    // element strides: C(i, j) = C[ i*c_i + j*c_j ],
+    // op(B)(l, j) = B[ l*b_l + j*b_j ],
+    // op(A)(i, l) = A[ a_0 + i*a_i + l*a_l ], using that band storage
+    // puts A(r, c) in A[ ku + r + c*(lda - 1) ]
+    // [RowMajor: A[ kl + c + r*(lda - 1) ]]
+    int64_t c_i = (colmajor ? 1 : ldc);
+    int64_t c_j = (colmajor ? ldc : 1);
+    int64_t b_l = ((transB == Op::NoTrans) == colmajor ? 1 : ldb);
+    int64_t b_j = ((transB == Op::NoTrans) == colmajor ? ldb : 1);
+    int64_t a_0 = (colmajor ? ku : kl);
+    int64_t a_r = (colmajor ? 1 : lda - 1);
+    int64_t a_c = (colmajor ? lda - 1 : 1);
+    int64_t a_i = (transA == Op::NoTrans ? a_r : a_c);
+    int64_t a_l = (transA == Op::NoTrans ? a_c : a_r);
+    bool conjA = (transA == Op::ConjTrans);
+    bool conjB = (transB == Op::ConjTrans);
+
+    // op(A) has kl_ sub-diagonals and ku_ super-diagonals
+    int64_t kl_ = (transA == Op::NoTrans ? kl : ku);
+    int64_t ku_ = (transA == Op::NoTrans ? ku : kl);
+
+    #define C(i_, j_) C[ (i_)*c_i + (j_)*c_j ]
+    #define opA(i_, l_) (conjA ? conj( A[ a_0 + (i_)*a_i + (l_)*a_l ] ) \
+                               :       A[ a_0 + (i_)*a_i + (l_)*a_l ])
+    #define opB(l_, j_) (conjB ? conj( B[ (l_)*b_l + (j_)*b_j ] ) \
+                               :       B[ (l_)*b_l + (j_)*b_j ])
+
+    // form C = beta C
+    if (beta != one) {
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < m; ++i)
+                C(i, j) = (beta == zero ? zero : beta * C(i, j));
+        }
+    }
+    if (alpha == zero || k == 0)
+        return;
+
+    // alpha != zero
+    int64_t bandwidth = kl_ + ku_ + 1;
+    if (bandwidth < 16) {
+        // narrow band: C(:, j) += alpha op(A)(:, l) op(B)(l, j),
+        // using rows i_begin to i_end of column l of op(A)
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t l = 0; l < k; ++l) {
+                scalar_t tmp = alpha * opB(l, j);
+                int64_t i_begin = std::max< int64_t >( 0, l - ku_ );
+                int64_t i_end   = std::min( m, l + kl_ + 1 );
+                for (int64_t i = i_begin; i < i_end; ++i)
+                    C(i, j) += opA(i, l) * tmp;
+            }
+        }
+    }
+    else {
+        // wide band: block column l0 : l0 + lb - 1 of op(A) is nonzero
+        // only in rows i0 : i1 - 1; copy that ib-by-lb block, with zeros
+        // outside the band, to a workspace W and multiply it with gemm
+        int64_t nb = std::min< int64_t >( bandwidth, 256 );
+        std::vector<scalar_t> W( size_t(std::min( m, nb + bandwidth ))*nb );
+        for (int64_t l0 = 0; l0 < k; l0 += nb) {
+            int64_t lb = std::min( nb, k - l0 );
+            int64_t i0 = std::max< int64_t >( 0, l0 - ku_ );
+            int64_t i1 = std::min( m, l0 + lb + kl_ );
+            if (i0 >= i1)
+                break;  // remaining columns of op(A) are below row m
+            int64_t ib = i1 - i0;
+
+            // W is ib-by-lb, in the same layout as C
+            int64_t ldw = (colmajor ? ib : lb);
+            int64_t w_i = (colmajor ? 1 : lb);
+            int64_t w_l = (colmajor ? ib : 1);
+            std::fill( W.begin(), W.begin() + ib*lb, zero );
+            for (int64_t ll = 0; ll < lb; ++ll) {
+                int64_t l = l0 + ll;
+                int64_t i_begin = std::max< int64_t >( i0, l - ku_ );
+                int64_t i_end   = std::min( i1, l + kl_ + 1 );
+                for (int64_t i = i_begin; i < i_end; ++i)
+                    W[ (i - i0)*w_i + ll*w_l ] = opA(i, l);
+            }
+
+            gemm( layout, Op::NoTrans, transB, ib, n, lb,
+                  alpha, W.data(), ldw,
+                         &B[ l0*b_l ], ldb,
+                  one,   &C(i0, 0), ldc );
+        }
+    }
+
+    #undef C
+    #undef opA
+    #undef opB
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_GBMM_HH
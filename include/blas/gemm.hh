@@ -7,12 +7,158 @@
 #define BLAS_GEMM_HH
 
 #include "blas/util.hh"
+#include "blas/gemm_kernel.hh"
+#include "blas/simd.hh"
 
 #include <limits>
+#include <vector>
 
 namespace blas {
 
-// =============================================================================
+namespace internal {
+
+// -----------------------------------------------------------------------------
+/// Unblocked reference implementation of gemm, for column-major matrices,
+/// with arguments already checked and alpha != 0.
+/// Used for small problems that don't amortize the cost of packing,
+/// and as the reference to test the blocked engine against.
+
+template< typename TA, typename TB, typename TC >
+void gemm_reference(
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const *A, int64_t lda,
+    TB const *B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC       *C, int64_t ldc )
+{
+    typedef blas::scalar_type<TA, TB, TC> scalar_t;
+
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+    #define B(i_, j_) B[ (i_) + (j_)*ldb ]
+    #define C(i_, j_) C[ (i_) + (j_)*ldc ]
+
+    // constants
+    const scalar_t zero = 0;
+
+    if (transA == Op::NoTrans) {
+        if (transB == Op::NoTrans) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i)
+                    C(i, j) *= beta;
+                for (int64_t l = 0; l < k; ++l) {
+                    scalar_t alpha_Blj = alpha*scalar_t( B(l, j) );
+                    for (int64_t i = 0; i < m; ++i)
+                        C(i, j) += scalar_t( A(i, l) )*alpha_Blj;
+                }
+            }
+        }
+        else if (transB == Op::Trans) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i)
+                    C(i, j) *= beta;
+                for (int64_t l = 0; l < k; ++l) {
+                    scalar_t alpha_Bjl = alpha*scalar_t( B(j, l) );
+                    for (int64_t i = 0; i < m; ++i)
+                        C(i, j) += scalar_t( A(i, l) )*alpha_Bjl;
+                }
+            }
+        }
+        else { // transB == Op::ConjTrans
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i)
+                    C(i, j) *= beta;
+                for (int64_t l = 0; l < k; ++l) {
+                    scalar_t alpha_Bjl = alpha*scalar_t( conj(B(j, l)) );
+                    for (int64_t i = 0; i < m; ++i)
+                        C(i, j) += scalar_t( A(i, l) )*alpha_Bjl;
+                }
+            }
+        }
+    }
+    else if (transA == Op::Trans) {
+        if (transB == Op::NoTrans) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    scalar_t sum = zero;
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += scalar_t( A(l, i) )*scalar_t( B(l, j) );
+                    C(i, j) = alpha*sum + beta*C(i, j);
+                }
+            }
+        }
+        else if (transB == Op::Trans) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    scalar_t sum = zero;
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += scalar_t( A(l, i) )*scalar_t( B(j, l) );
+                    C(i, j) = alpha*sum + beta*C(i, j);
+                }
+            }
+        }
+        else { // transB == Op::ConjTrans
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    scalar_t sum = zero;
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += scalar_t( A(l, i) )*scalar_t( conj(B(j, l)) );
+                    C(i, j) = alpha*sum + beta*C(i, j);
+                }
+            }
+        }
+    }
+    else { // transA == Op::ConjTrans
+        if (transB == Op::NoTrans) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    scalar_t sum = zero;
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += scalar_t( conj(A(l, i)) )*scalar_t( B(l, j) );
+                    C(i, j) = alpha*sum + beta*C(i, j);
+                }
+            }
+        }
+        else if (transB == Op::Trans) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    scalar_t sum = zero;
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += scalar_t( conj(A(l, i)) )*scalar_t( B(j, l) );
+                    C(i, j) = alpha*sum + beta*C(i, j);
+                }
+            }
+        }
+        else { // transB == Op::ConjTrans
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    scalar_t sum = zero;
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += scalar_t( A(l, i) )*scalar_t( B(j, l) ); // little improvement here
+                    C(i, j) = alpha*conj(sum) + beta*C(i, j);
+                }
+            }
+        }
+    }
+
+    #undef A
+    #undef B
+    #undef C
+}
+
+// -----------------------------------------------------------------------------
+/// Returns true if gemm is small enough that the unblocked reference
+/// implementation is faster than packing for the blocked engine.
+inline bool gemm_use_reference( int64_t m, int64_t n, int64_t k )
+{
+    return m*n*k <= 16*16*16 || m < 4 || n < 4 || k < 4;
+}
+
+}  // namespace internal
+
+//==============================================================================
 /// General matrix-matrix multiply:
 /// \[
 ///     C = \alpha op(A) \times op(B) + \beta C,
@@ -25,6 +171,9 @@ namespace blas {
 /// $op(A)$ an m-by-k matrix, $op(B)$ a k-by-n matrix, and C an m-by-n matrix.
 ///
 /// Generic implementation for arbitrary data types.
+/// Except for small problems, uses a cache-blocked engine that packs
+/// panels of A and B, converted to the scalar type, and multiplies them
+/// with a register-blocked micro-kernel; see blas/gemm_kernel.hh.
 ///
 /// @param[in] layout
 ///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
@@ -119,8 +268,6 @@ void gemm(
 
     typedef blas::scalar_type<TA, TB, TC> scalar_t;
 
-    #define A(i_, j_) A[ (i_) + (j_)*lda ]
-    #define B(i_, j_) B[ (i_) + (j_)*ldb ]
     #define C(i_, j_) C[ (i_) + (j_)*ldc ]
 
     // constants
@@ -143,11 +290,11 @@ void gemm(
     blas_error_if( ldc < m );
 
     // quick return
-    if (m == 0 || n == 0 || k == 0)
+    if (m == 0 || n == 0)
         return;
 
-    // alpha == zero
-    if (alpha == zero) {
+    // alpha == zero or k == 0: C = beta C
+    if (alpha == zero || k == 0) {
         if (beta == zero) {
             for (int64_t j = 0; j < n; ++j) {
                 for (int64_t i = 0; i < m; ++i)
@@ -163,109 +310,31 @@ void gemm(
         return;
     }
 
-    // alpha != zero
-    if (transA == Op::NoTrans) {
-        if (transB == Op::NoTrans) {
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i)
-                    C(i, j) *= beta;
-                for (int64_t l = 0; l < k; ++l) {
-                    scalar_t alpha_Blj = alpha*B(l, j);
-                    for (int64_t i = 0; i < m; ++i)
-                        C(i, j) += A(i, l)*alpha_Blj;
-                }
-            }
-        }
-        else if (transB == Op::Trans) {
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i)
-                    C(i, j) *= beta;
-                for (int64_t l = 0; l < k; ++l) {
-                    scalar_t alpha_Bjl = alpha*B(j, l);
-                    for (int64_t i = 0; i < m; ++i)
-                        C(i, j) += A(i, l)*alpha_Bjl;
-                }
-            }
-        }
-        else { // transB == Op::ConjTrans
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i)
-                    C(i, j) *= beta;
-                for (int64_t l = 0; l < k; ++l) {
-                    scalar_t alpha_Bjl = alpha*conj(B(j, l));
-                    for (int64_t i = 0; i < m; ++i)
-                        C(i, j) += A(i, l)*alpha_Bjl;
-                }
-            }
-        }
+    // 16-bit C: accumulate in float workspace, rounding C once at the end,
+    // since the blocked engine updates C once per kc block.
+    // 16-bit A and B are converted to float as they are packed.
+    if (is_low_precision<TC>::value) {
+        std::vector<scalar_t> Cw( size_t(m)*n );
+        internal::convert_matrix( Uplo::General, m, n, C, ldc, Cw.data(), m );
+        gemm( Layout::ColMajor, transA, transB, m, n, k,
+              alpha, A, lda, B, ldb, beta, Cw.data(), m );
+        internal::convert_matrix( Uplo::General, m, n, Cw.data(), m, C, ldc );
+        return;
     }
-    else if (transA == Op::Trans) {
-        if (transB == Op::NoTrans) {
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i) {
-                    scalar_t sum = zero;
-                    for (int64_t l = 0; l < k; ++l)
-                        sum += A(l, i)*B(l, j);
-                    C(i, j) = alpha*sum + beta*C(i, j);
-                }
-            }
-        }
-        else if (transB == Op::Trans) {
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i) {
-                    scalar_t sum = zero;
-                    for (int64_t l = 0; l < k; ++l)
-                        sum += A(l, i)*B(j, l);
-                    C(i, j) = alpha*sum + beta*C(i, j);
-                }
-            }
-        }
-        else { // transB == Op::ConjTrans
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i) {
-                    scalar_t sum = zero;
-                    for (int64_t l = 0; l < k; ++l)
-                        sum += A(l, i)*conj(B(j, l));
-                    C(i, j) = alpha*sum + beta*C(i, j);
-                }
-            }
-        }
+
+    // alpha != zero
+    if (internal::gemm_use_reference( m, n, k )) {
+        internal::gemm_reference( transA, transB, m, n, k,
+                                  alpha, A, lda, B, ldb, beta, C, ldc );
     }
-    else { // transA == Op::ConjTrans
-        if (transB == Op::NoTrans) {
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i) {
-                    scalar_t sum = zero;
-                    for (int64_t l = 0; l < k; ++l)
-                        sum += conj(A(l, i))*B(l, j);
-                    C(i, j) = alpha*sum + beta*C(i, j);
-                }
-            }
-        }
-        else if (transB == Op::Trans) {
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i) {
-                    scalar_t sum = zero;
-                    for (int64_t l = 0; l < k; ++l)
-                        sum += conj(A(l, i))*B(j, l);
-                    C(i, j) = alpha*sum + beta*C(i, j);
-                }
-            }
-        }
-        else { // transB == Op::ConjTrans
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i) {
-                    scalar_t sum = zero;
-                    for (int64_t l = 0; l < k; ++l)
-                        sum += A(l, i)*B(j, l); // little improvement here
-                    C(i, j) = alpha*conj(sum) + beta*C(i, j);
-                }
-            }
-        }
+    else {
+        internal::gemm_blocked(
+            m, n, k, alpha,
+            internal::OpMatrix< scalar_t, TA >( transA, A, lda ),
+            internal::OpMatrix< scalar_t, TB >( transB, B, ldb ),
+            beta, C, ldc );
     }
 
-    #undef A
-    #undef B
     #undef C
 }
 
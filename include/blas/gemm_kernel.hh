@@ -0,0 +1,739 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_GEMM_KERNEL_HH
+#define BLAS_GEMM_KERNEL_HH
+
+#include "blas/util.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+namespace blas {
+
+//------------------------------------------------------------------------------
+/// @return reference to the thread count for template Level 3 routines.
+/// Use get_template_threads and set_template_threads instead.
+inline int& template_threads_()
+{
+    static int nthreads = 0;
+    return nthreads;
+}
+
+//------------------------------------------------------------------------------
+/// Sets the number of OpenMP threads used by template Level 3 routines,
+/// such as the generic blas::gemm. If nthreads <= 0, the default
+/// omp_get_max_threads() is used. Without OpenMP, this has no effect.
+/// The vendor BLAS has its own threading control.
+inline void set_template_threads( int nthreads )
+{
+    template_threads_() = nthreads;
+}
+
+//------------------------------------------------------------------------------
+/// @return number of OpenMP threads used by template Level 3 routines;
+/// 1 without OpenMP.
+inline int get_template_threads()
+{
+    #ifdef _OPENMP
+        int nthreads = template_threads_();
+        return (nthreads > 0 ? nthreads : omp_get_max_threads());
+    #else
+        return 1;
+    #endif
+}
+
+namespace internal {
+
+//==============================================================================
+// Packed, cache-blocked gemm engine for the template implementations,
+// following Goto & van de Geijn, "Anatomy of high-performance matrix
+// multiplication", ACM TOMS 34(3), 2008.
+//
+// C is partitioned into nc-wide column panels. For each panel, a kc-by-nc
+// panel of op(B) is packed into nr-wide micro-panels (sized for L3 cache),
+// then each mc-by-kc block of op(A) is packed into mr-tall micro-panels
+// (sized for L2 cache). The micro-kernel multiplies an mr-by-kc micro-panel
+// of A by a kc-by-nr micro-panel of B, holding the mr-by-nr block of C in
+// registers. Packing converts to the compute type, applies conj, and pads
+// edges with zeros, so the micro-kernel has no special cases.
+
+//------------------------------------------------------------------------------
+/// Register and cache blocking sizes for compute type T.
+/// The mr-by-nr accumulator tile is 256 bytes, which fits the 16 vector
+/// registers of AVX2 with room for operands; smaller or larger tiles were
+/// measured to defeat the compiler's vectorizer or spill registers.
+/// mc-by-kc blocks of A target ~192 KiB of L2 cache, and
+/// kc-by-nc panels of B a few MiB of L3 cache.
+/// mc must be a multiple of mr, and nc a multiple of nr.
+template <typename T>
+struct GemmBlocking
+{
+    static constexpr int64_t mr = (sizeof(T) <= 4 ? 16
+                                :  sizeof(T) <= 8 ?  8
+                                :                    4);
+    static constexpr int64_t nr = 4;
+    static constexpr int64_t kc = 256;
+    static constexpr int64_t mc = (sizeof(T) <= 8 ? 12*mr : 8*mr);
+    static constexpr int64_t nc = 512*nr;
+};
+
+/// Complex types are packed as separate real and imaginary parts,
+/// so blocking is based on the real type. Real and imaginary
+/// accumulators together take 128 bytes.
+template <typename T>
+struct GemmBlocking< std::complex<T> >
+{
+    static constexpr int64_t mr = (sizeof(T) <= 4 ? 8 : 4);
+    static constexpr int64_t nr = 2;
+    static constexpr int64_t kc = 256;
+    static constexpr int64_t mc = 12*mr;
+    static constexpr int64_t nc = 1024*nr;
+};
+
+template <typename T> constexpr int64_t GemmBlocking<T>::mr;
+template <typename T> constexpr int64_t GemmBlocking<T>::nr;
+template <typename T> constexpr int64_t GemmBlocking<T>::kc;
+template <typename T> constexpr int64_t GemmBlocking<T>::mc;
+template <typename T> constexpr int64_t GemmBlocking<T>::nc;
+
+template <typename T> constexpr int64_t GemmBlocking< std::complex<T> >::mr;
+template <typename T> constexpr int64_t GemmBlocking< std::complex<T> >::nr;
+template <typename T> constexpr int64_t GemmBlocking< std::complex<T> >::kc;
+template <typename T> constexpr int64_t GemmBlocking< std::complex<T> >::mc;
+template <typename T> constexpr int64_t GemmBlocking< std::complex<T> >::nc;
+
+//------------------------------------------------------------------------------
+/// Workspace for packed panels, aligned to a cache line (64 bytes).
+/// Alignment is done by element offset, so it is safe for any type T.
+template <typename T>
+class PackBuffer
+{
+public:
+    static constexpr size_t align = 64;
+
+    explicit PackBuffer( size_t size ):
+        data_( size + pad() )
+    {
+        data_ptr_ = data_.data();
+        for (size_t i = 0; i < pad(); ++i) {
+            if (reinterpret_cast<uintptr_t>( data_ptr_ ) % align == 0)
+                break;
+            ++data_ptr_;
+        }
+    }
+
+    T* data() { return data_ptr_; }
+
+private:
+    static constexpr size_t pad()
+        { return align / sizeof(T) + 1; }
+
+    std::vector<T> data_;
+    T* data_ptr_;
+};
+
+//------------------------------------------------------------------------------
+/// Read-only view of op(X), where X is a column-major matrix of type TX.
+/// Element (i, j) of op(X) is returned converted to the compute type T.
+/// Used as the source when packing panels for the gemm engine.
+template <typename T, typename TX>
+class OpMatrix
+{
+public:
+    OpMatrix( blas::Op op, TX const* X, int64_t ldx ):
+        op_( op ),
+        X_( X ),
+        ldx_( ldx )
+    {}
+
+    T operator()( int64_t i, int64_t j ) const
+    {
+        if (op_ == Op::NoTrans)
+            return T( X_[ i + j*ldx_ ] );
+        else if (op_ == Op::Trans)
+            return T( X_[ j + i*ldx_ ] );
+        else
+            return T( conj( X_[ j + i*ldx_ ] ) );
+    }
+
+private:
+    blas::Op op_;
+    TX const* X_;
+    int64_t ldx_;
+};
+
+//------------------------------------------------------------------------------
+/// Read-only view of a symmetric matrix X, of which only the uplo triangle
+/// is stored (Uplo::General is treated as Upper). Element (i, j) is taken
+/// from the stored triangle, so packing expands X to full form on the fly.
+template <typename T, typename TX>
+class SymMatrix
+{
+public:
+    SymMatrix( blas::Uplo uplo, TX const* X, int64_t ldx ):
+        lower_( uplo == Uplo::Lower ),
+        X_( X ),
+        ldx_( ldx )
+    {}
+
+    T operator()( int64_t i, int64_t j ) const
+    {
+        if (lower_ ? i >= j : i <= j)
+            return T( X_[ i + j*ldx_ ] );
+        else
+            return T( X_[ j + i*ldx_ ] );
+    }
+
+private:
+    bool lower_;
+    TX const* X_;
+    int64_t ldx_;
+};
+
+//------------------------------------------------------------------------------
+/// Read-only view of a Hermitian matrix X, of which only the uplo triangle
+/// is stored (Uplo::General is treated as Upper). Elements of the other
+/// triangle are conjugates of the stored ones; the imaginary parts of the
+/// diagonal are assumed zero.
+template <typename T, typename TX>
+class HermMatrix
+{
+public:
+    HermMatrix( blas::Uplo uplo, TX const* X, int64_t ldx ):
+        lower_( uplo == Uplo::Lower ),
+        X_( X ),
+        ldx_( ldx )
+    {}
+
+    T operator()( int64_t i, int64_t j ) const
+    {
+        if (i == j)
+            return T( real( X_[ i + i*ldx_ ] ) );
+        else if (lower_ ? i > j : i < j)
+            return T( X_[ i + j*ldx_ ] );
+        else
+            return T( conj( X_[ j + i*ldx_ ] ) );
+    }
+
+private:
+    bool lower_;
+    TX const* X_;
+    int64_t ldx_;
+};
+
+//------------------------------------------------------------------------------
+/// Read-only view of op(X), where X is a triangular matrix of which only
+/// the uplo triangle is stored. Elements of op(X) outside the triangle are
+/// zero; with Diag::Unit, diagonal elements are one and X's are not read.
+template <typename T, typename TX>
+class TriMatrix
+{
+public:
+    TriMatrix( blas::Uplo uplo, blas::Op op, blas::Diag diag,
+               TX const* X, int64_t ldx ):
+        lower_( uplo == Uplo::Lower ),
+        op_( op ),
+        unit_( diag == Diag::Unit ),
+        X_( X ),
+        ldx_( ldx )
+    {}
+
+    T operator()( int64_t i, int64_t j ) const
+    {
+        if (op_ != Op::NoTrans)
+            std::swap( i, j );
+        if (i == j && unit_)
+            return T( 1 );
+        else if (lower_ ? i < j : i > j)
+            return T( 0 );
+        else if (op_ == Op::ConjTrans)
+            return T( conj( X_[ i + j*ldx_ ] ) );
+        else
+            return T( X_[ i + j*ldx_ ] );
+    }
+
+private:
+    bool lower_;
+    blas::Op op_;
+    bool unit_;
+    TX const* X_;
+    int64_t ldx_;
+};
+
+//------------------------------------------------------------------------------
+/// Read-only view of the submatrix of X starting at (i0, j0), where X is
+/// an accessor such as OpMatrix.
+template <typename T, typename MatrixX>
+class SubMatrix
+{
+public:
+    SubMatrix( MatrixX const& X, int64_t i0, int64_t j0 ):
+        X_( X ),
+        i0_( i0 ),
+        j0_( j0 )
+    {}
+
+    T operator()( int64_t i, int64_t j ) const
+    {
+        return X_( i0_ + i, j0_ + j );
+    }
+
+private:
+    MatrixX const& X_;
+    int64_t i0_;
+    int64_t j0_;
+};
+
+//------------------------------------------------------------------------------
+/// Packing and micro-kernel for real compute type T.
+/// Packed panels hold elements of T; the accumulator tile is mr-by-nr,
+/// column-major, with leading dimension mr.
+template <typename T>
+struct GemmKernel
+{
+    typedef T pack_t;
+    static constexpr int64_t mr = GemmBlocking<T>::mr;
+    static constexpr int64_t nr = GemmBlocking<T>::nr;
+
+    /// Number of pack_t elements per element of T.
+    static constexpr int64_t pack_size = 1;
+
+    //----------------------------------------
+    /// Pack the mb-by-kb block of op(A) starting at (i0, l0) into
+    /// ceil(mb/mr) micro-panels, each stored as kb columns of mr elements.
+    template <typename MatrixA>
+    static void pack_a(
+        int64_t mb, int64_t kb,
+        MatrixA const& A, int64_t i0, int64_t l0,
+        pack_t* Ap )
+    {
+        const T zero = 0;
+        for (int64_t ir = 0; ir < mb; ir += mr) {
+            int64_t mb_ = std::min( mr, mb - ir );
+            for (int64_t l = 0; l < kb; ++l) {
+                int64_t i = 0;
+                for (; i < mb_; ++i)
+                    Ap[ i ] = A( i0 + ir + i, l0 + l );
+                for (; i < mr; ++i)
+                    Ap[ i ] = zero;
+                Ap += mr;
+            }
+        }
+    }
+
+    //----------------------------------------
+    /// Pack the kb-by-nb block of op(B) starting at (l0, j0) into
+    /// ceil(nb/nr) micro-panels, each stored as kb rows of nr elements.
+    template <typename MatrixB>
+    static void pack_b(
+        int64_t kb, int64_t nb,
+        MatrixB const& B, int64_t l0, int64_t j0,
+        pack_t* Bp )
+    {
+        const T zero = 0;
+        for (int64_t jr = 0; jr < nb; jr += nr) {
+            int64_t nb_ = std::min( nr, nb - jr );
+            for (int64_t l = 0; l < kb; ++l) {
+                int64_t j = 0;
+                for (; j < nb_; ++j)
+                    Bp[ j ] = B( l0 + l, j0 + jr + j );
+                for (; j < nr; ++j)
+                    Bp[ j ] = zero;
+                Bp += nr;
+            }
+        }
+    }
+
+    //----------------------------------------
+    /// AB = Ap * Bp, for an mr-by-kb micro-panel Ap and kb-by-nr
+    /// micro-panel Bp. Fixed loop bounds let the compiler keep the
+    /// accumulators in vector registers.
+    static void micro_kernel(
+        int64_t kb, pack_t const* Ap, pack_t const* Bp, T* AB )
+    {
+        T c[ nr ][ mr ];
+        for (int64_t j = 0; j < nr; ++j)
+            for (int64_t i = 0; i < mr; ++i)
+                c[ j ][ i ] = T( 0 );
+
+        T a[ mr ];
+        for (int64_t l = 0; l < kb; ++l) {
+            for (int64_t i = 0; i < mr; ++i)
+                a[ i ] = Ap[ i ];
+            for (int64_t j = 0; j < nr; ++j) {
+                T b = Bp[ j ];
+                for (int64_t i = 0; i < mr; ++i)
+                    c[ j ][ i ] += a[ i ] * b;
+            }
+            Ap += mr;
+            Bp += nr;
+        }
+
+        for (int64_t j = 0; j < nr; ++j)
+            for (int64_t i = 0; i < mr; ++i)
+                AB[ i + j*mr ] = c[ j ][ i ];
+    }
+};
+
+//------------------------------------------------------------------------------
+/// Packing and micro-kernel for complex compute type std::complex<R>.
+/// Each column of a packed A micro-panel stores mr real parts followed by
+/// mr imaginary parts (likewise nr for B), so the micro-kernel runs on
+/// real vectors and avoids the NaN-checking complex multiply.
+template <typename R>
+struct GemmKernel< std::complex<R> >
+{
+    typedef std::complex<R> T;
+    typedef R pack_t;
+    static constexpr int64_t mr = GemmBlocking<T>::mr;
+    static constexpr int64_t nr = GemmBlocking<T>::nr;
+    static constexpr int64_t pack_size = 2;
+
+    template <typename MatrixA>
+    static void pack_a(
+        int64_t mb, int64_t kb,
+        MatrixA const& A, int64_t i0, int64_t l0,
+        pack_t* Ap )
+    {
+        for (int64_t ir = 0; ir < mb; ir += mr) {
+            int64_t mb_ = std::min( mr, mb - ir );
+            for (int64_t l = 0; l < kb; ++l) {
+                int64_t i = 0;
+                for (; i < mb_; ++i) {
+                    T a = A( i0 + ir + i, l0 + l );
+                    Ap[ i      ] = real( a );
+                    Ap[ i + mr ] = imag( a );
+                }
+                for (; i < mr; ++i) {
+                    Ap[ i      ] = 0;
+                    Ap[ i + mr ] = 0;
+                }
+                Ap += 2*mr;
+            }
+        }
+    }
+
+    template <typename MatrixB>
+    static void pack_b(
+        int64_t kb, int64_t nb,
+        MatrixB const& B, int64_t l0, int64_t j0,
+        pack_t* Bp )
+    {
+        for (int64_t jr = 0; jr < nb; jr += nr) {
+            int64_t nb_ = std::min( nr, nb - jr );
+            for (int64_t l = 0; l < kb; ++l) {
+                int64_t j = 0;
+                for (; j < nb_; ++j) {
+                    T b = B( l0 + l, j0 + jr + j );
+                    Bp[ j      ] = real( b );
+                    Bp[ j + nr ] = imag( b );
+                }
+                for (; j < nr; ++j) {
+                    Bp[ j      ] = 0;
+                    Bp[ j + nr ] = 0;
+                }
+                Bp += 2*nr;
+            }
+        }
+    }
+
+    static void micro_kernel(
+        int64_t kb, pack_t const* Ap, pack_t const* Bp, T* AB )
+    {
+        R c_re[ nr ][ mr ];
+        R c_im[ nr ][ mr ];
+        for (int64_t j = 0; j < nr; ++j) {
+            for (int64_t i = 0; i < mr; ++i) {
+                c_re[ j ][ i ] = 0;
+                c_im[ j ][ i ] = 0;
+            }
+        }
+
+        for (int64_t l = 0; l < kb; ++l) {
+            for (int64_t j = 0; j < nr; ++j) {
+                R b_re = Bp[ j      ];
+                R b_im = Bp[ j + nr ];
+                for (int64_t i = 0; i < mr; ++i) {
+                    R a_re = Ap[ i      ];
+                    R a_im = Ap[ i + mr ];
+                    c_re[ j ][ i ] += a_re*b_re - a_im*b_im;
+                    c_im[ j ][ i ] += a_re*b_im + a_im*b_re;
+                }
+            }
+            Ap += 2*mr;
+            Bp += 2*nr;
+        }
+
+        for (int64_t j = 0; j < nr; ++j)
+            for (int64_t i = 0; i < mr; ++i)
+                AB[ i + j*mr ] = T( c_re[ j ][ i ], c_im[ j ][ i ] );
+    }
+};
+
+template <typename T> constexpr int64_t GemmKernel<T>::mr;
+template <typename T> constexpr int64_t GemmKernel<T>::nr;
+template <typename T> constexpr int64_t GemmKernel<T>::pack_size;
+
+template <typename R> constexpr int64_t GemmKernel< std::complex<R> >::mr;
+template <typename R> constexpr int64_t GemmKernel< std::complex<R> >::nr;
+template <typename R> constexpr int64_t GemmKernel< std::complex<R> >::pack_size;
+
+//------------------------------------------------------------------------------
+/// C = alpha AB + beta C for an mb-by-nb tile, mb <= mr, nb <= nr,
+/// where AB is the micro-kernel's accumulator tile with leading dimension mr.
+/// If beta is zero, C need not be set on input.
+template <typename T, typename TC>
+inline void gemm_tile_update(
+    int64_t mb, int64_t nb, int64_t mr,
+    T alpha, T const* AB,
+    T beta, TC* C, int64_t ldc )
+{
+    const T zero = 0;
+    if (beta == zero) {
+        for (int64_t j = 0; j < nb; ++j)
+            for (int64_t i = 0; i < mb; ++i)
+                C[ i + j*ldc ] = alpha*AB[ i + j*mr ];
+    }
+    else {
+        for (int64_t j = 0; j < nb; ++j)
+            for (int64_t i = 0; i < mb; ++i)
+                C[ i + j*ldc ] = alpha*AB[ i + j*mr ] + beta*C[ i + j*ldc ];
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Macro-kernel: C = alpha Ap Bp + beta C for an mb-by-nb block of C,
+/// given packed mb-by-kb block Ap and kb-by-nb panel Bp.
+template <typename T, typename TC>
+void gemm_macro_kernel(
+    int64_t mb, int64_t nb, int64_t kb,
+    T alpha,
+    typename GemmKernel<T>::pack_t const* Ap,
+    typename GemmKernel<T>::pack_t const* Bp,
+    T beta,
+    TC* C, int64_t ldc )
+{
+    typedef GemmKernel<T> kernel;
+    const int64_t mr = kernel::mr;
+    const int64_t nr = kernel::nr;
+    const int64_t ps = kernel::pack_size;
+
+    T AB[ mr*nr ];
+    for (int64_t jr = 0; jr < nb; jr += nr) {
+        int64_t nb_ = std::min( nr, nb - jr );
+        for (int64_t ir = 0; ir < mb; ir += mr) {
+            int64_t mb_ = std::min( mr, mb - ir );
+            kernel::micro_kernel( kb, &Ap[ ir*kb*ps ], &Bp[ jr*kb*ps ], AB );
+            gemm_tile_update( mb_, nb_, mr, alpha, AB, beta,
+                              &C[ ir + jr*ldc ], ldc );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Number of threads to use for a blocked m-by-n-by-k product:
+/// the template thread count, limited so each thread gets at least
+/// min_work multiply-adds, which amortizes the fork/join and packing cost.
+inline int gemm_num_threads( int64_t m, int64_t n, int64_t k )
+{
+    #ifdef _OPENMP
+        const double min_work = 64.*64.*64.;
+        int nthreads = get_template_threads();
+        double max_threads = std::max( 1.0, double(m) * n * k / min_work );
+        return int( std::min( double(nthreads), max_threads ) );
+    #else
+        blas_unused( m );
+        blas_unused( n );
+        blas_unused( k );
+        return 1;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// Blocked gemm driver: C = alpha op(A) op(B) + beta C,
+/// where op(A) is m-by-k, op(B) is k-by-n, and C is m-by-n column-major.
+/// A and B are accessors such as OpMatrix, returning element (i, j)
+/// of op(A) or op(B) as type T. Requires m, n, k > 0.
+///
+/// With OpenMP, threads cooperatively pack each kc-by-nc panel of B into
+/// a shared buffer, then split the mc-block (M) loop and, if there are
+/// fewer M blocks than threads, the nr-panel (N) loop within the B panel.
+/// Each thread packs the blocks of A it needs into its own buffer.
+template <typename T, typename MatrixA, typename MatrixB, typename TC>
+void gemm_blocked(
+    int64_t m, int64_t n, int64_t k,
+    T alpha,
+    MatrixA const& A,
+    MatrixB const& B,
+    T beta,
+    TC* C, int64_t ldc )
+{
+    typedef GemmKernel<T> kernel;
+    typedef typename kernel::pack_t pack_t;
+    typedef GemmBlocking<T> block;
+    const int64_t mr = kernel::mr;
+    const int64_t nr = kernel::nr;
+    const int64_t ps = kernel::pack_size;
+
+    const T one = 1;
+
+    // workspace, rounded up to full micro-panels
+    int64_t mc = std::min( block::mc, ((m + mr - 1) / mr) * mr );
+    int64_t nc = std::min( block::nc, ((n + nr - 1) / nr) * nr );
+    int64_t kc = std::min( block::kc, k );
+    PackBuffer<pack_t> Bp_buffer( kc*nc*ps );
+    pack_t* Bp = Bp_buffer.data();
+
+    // Split C into m_blocks-by-n_splits tasks per B panel.
+    int nthreads = gemm_num_threads( m, n, k );
+    int64_t m_blocks = (m + mc - 1) / mc;
+    int64_t n_splits = std::max( int64_t( 1 ), nthreads / m_blocks );
+    n_splits = std::min( n_splits, nc / nr );
+
+    #pragma omp parallel num_threads( nthreads ) if (nthreads > 1)
+    {
+        PackBuffer<pack_t> Ap_buffer( mc*kc*ps );
+        pack_t* Ap = Ap_buffer.data();
+
+        for (int64_t jc = 0; jc < n; jc += nc) {
+            int64_t nb = std::min( nc, n - jc );
+            int64_t n_panels = (nb + nr - 1) / nr;
+            for (int64_t pc = 0; pc < k; pc += kc) {
+                int64_t kb = std::min( kc, k - pc );
+                // beta applies only to the first k block
+                T beta_ = (pc == 0 ? beta : one);
+
+                // Pack B panel; implicit barrier before it is used.
+                #pragma omp for schedule( static )
+                for (int64_t jp = 0; jp < n_panels; ++jp) {
+                    int64_t jr = jp*nr;
+                    kernel::pack_b( kb, std::min( nr, nb - jr ), B,
+                                    pc, jc + jr, &Bp[ jr*kb*ps ] );
+                }
+
+                // Static schedule gives each thread consecutive tasks,
+                // so a thread can reuse its packed A block across N splits.
+                // Implicit barrier before the B panel is overwritten.
+                int64_t packed_ic = -1;
+                #pragma omp for schedule( static )
+                for (int64_t task = 0; task < m_blocks * n_splits; ++task) {
+                    int64_t ic = (task / n_splits) * mc;
+                    int64_t js = task % n_splits;
+                    int64_t mb = std::min( mc, m - ic );
+                    int64_t jr_begin = (n_panels *  js     ) / n_splits * nr;
+                    int64_t jr_end   = (n_panels * (js + 1)) / n_splits * nr;
+                    jr_end = std::min( jr_end, nb );
+                    if (jr_begin >= jr_end)
+                        continue;
+
+                    if (ic != packed_ic) {
+                        kernel::pack_a( mb, kb, A, ic, pc, Ap );
+                        packed_ic = ic;
+                    }
+                    gemm_macro_kernel( mb, jr_end - jr_begin, kb, alpha,
+                                       Ap, &Bp[ jr_begin*kb*ps ], beta_,
+                                       &C[ ic + (jc + jr_begin)*ldc ], ldc );
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Blocked update of the uplo triangle of C, for syrk, herk, syr2k, her2k:
+/// C = alpha op(A) op(B) + beta C,
+/// where op(A) is n-by-k, op(B) is k-by-n, and C is n-by-n column-major.
+/// A and B are accessors as in gemm_blocked. The other triangle of C is
+/// not referenced; Uplo::General is treated as Upper. If hermitian, the
+/// diagonal of C is made real. Requires n, k > 0.
+///
+/// C is split into nb-by-nb tiles, and only tiles touching the triangle are
+/// computed. Off-diagonal tiles use the gemm engine directly. Diagonal tiles
+/// are computed into a workspace, then only their triangle is added to C.
+/// Every tile has about the same work, so with OpenMP a static schedule over
+/// the list of tiles gives each thread an equal, contiguous share.
+template <typename T, typename MatrixA, typename MatrixB, typename TC>
+void syrk_blocked(
+    blas::Uplo uplo, bool hermitian,
+    int64_t n, int64_t k,
+    T alpha,
+    MatrixA const& A,
+    MatrixB const& B,
+    T beta,
+    TC* C, int64_t ldc )
+{
+    const T zero = 0;
+    const T one  = 1;
+    bool lower = (uplo == Uplo::Lower);
+
+    // Use smaller tiles if needed to have several tiles per thread.
+    int nthreads = gemm_num_threads( n, n, k );
+    int64_t nb = GemmBlocking<T>::kc;
+    int64_t nt = (n + nb - 1) / nb;
+    while (nb > 64 && nt*(nt + 1)/2 < 4*nthreads) {
+        nb /= 2;
+        nt = (n + nb - 1) / nb;
+    }
+
+    // offsets of tiles in the triangle, column by column
+    std::vector< std::pair<int64_t, int64_t> > tiles;
+    tiles.reserve( nt*(nt + 1)/2 );
+    for (int64_t j = 0; j < n; j += nb) {
+        int64_t i_begin = (lower ? j : 0);
+        int64_t i_end   = (lower ? n : j + 1);
+        for (int64_t i = i_begin; i < i_end; i += nb)
+            tiles.push_back( std::make_pair( i, j ) );
+    }
+    int64_t ntiles = tiles.size();
+
+    #pragma omp parallel for num_threads( nthreads ) if (nthreads > 1) \
+                             schedule( static )
+    for (int64_t t = 0; t < ntiles; ++t) {
+        int64_t i  = tiles[ t ].first;
+        int64_t j  = tiles[ t ].second;
+        int64_t ib = std::min( nb, n - i );
+        int64_t jb = std::min( nb, n - j );
+        SubMatrix< T, MatrixA > Ai( A, i, 0 );
+        SubMatrix< T, MatrixB > Bj( B, 0, j );
+        if (i != j) {
+            gemm_blocked( ib, jb, k, alpha, Ai, Bj,
+                          beta, &C[ i + j*ldc ], ldc );
+            continue;
+        }
+
+        // diagonal tile
+        std::vector<T> W( ib*ib );
+        gemm_blocked( ib, ib, k, one, Ai, Bj, zero, W.data(), ib );
+        for (int64_t jj = 0; jj < ib; ++jj) {
+            int64_t ii_begin = (lower ? jj : 0);
+            int64_t ii_end   = (lower ? ib : jj + 1);
+            for (int64_t ii = ii_begin; ii < ii_end; ++ii) {
+                TC& c = C[ (i + ii) + (j + jj)*ldc ];
+                T w = alpha * W[ ii + jj*ib ];
+                if (hermitian && ii == jj) {
+                    w = real( w );
+                    if (beta != zero)
+                        w += beta * T( real( c ) );
+                }
+                else if (beta != zero) {
+                    w += beta * T( c );
+                }
+                c = TC( w );
+            }
+        }
+    }
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_GEMM_KERNEL_HH
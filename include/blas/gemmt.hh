@@ -0,0 +1,200 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_GEMMT_HH
+#define BLAS_GEMMT_HH
+
+#include "blas/util.hh"
+#include "blas/gemm.hh"
+
+#include <limits>
+
+namespace blas {
+
+//==============================================================================
+/// General matrix-matrix multiply, updating only one triangle of C:
+/// \[
+///     C = \alpha op(A) \times op(B) + \beta C,
+/// \]
+/// where $op(X)$ is one of
+///     $op(X) = X$,
+///     $op(X) = X^T$, or
+///     $op(X) = X^H$,
+/// alpha and beta are scalars, and A, B, and C are matrices, with
+/// $op(A)$ an n-by-k matrix, $op(B)$ a k-by-n matrix, and C an n-by-n matrix.
+/// Only the lower or upper triangle of C is computed and referenced.
+/// Unlike syrk and syr2k, the result need not be symmetric.
+///
+/// Generic implementation for arbitrary data types.
+/// Except for small problems, computes only the tiles of the uplo
+/// triangle of C, using the blocked gemm engine; see blas/gemm_kernel.hh.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] uplo
+///     What part of the matrix C is referenced:
+///     - Uplo::Lower: only the lower triangular part of C is referenced.
+///     - Uplo::Upper: only the upper triangular part of C is referenced.
+///
+/// @param[in] transA
+///     The operation $op(A)$ to be used:
+///     - Op::NoTrans:   $op(A) = A$.
+///     - Op::Trans:     $op(A) = A^T$.
+///     - Op::ConjTrans: $op(A) = A^H$.
+///
+/// @param[in] transB
+///     The operation $op(B)$ to be used:
+///     - Op::NoTrans:   $op(B) = B$.
+///     - Op::Trans:     $op(B) = B^T$.
+///     - Op::ConjTrans: $op(B) = B^H$.
+///
+/// @param[in] n
+///     Number of rows and columns of the matrix C,
+///     rows of $op(A)$, and columns of $op(B)$. n >= 0.
+///
+/// @param[in] k
+///     Number of columns of $op(A)$ and rows of $op(B)$. k >= 0.
+///
+/// @param[in] alpha
+///     Scalar alpha. If alpha is zero, A and B are not accessed.
+///
+/// @param[in] A
+///     - If transA = NoTrans:
+///       the n-by-k matrix A, stored in an lda-by-k array [RowMajor: n-by-lda].
+///     - Otherwise:
+///       the k-by-n matrix A, stored in an lda-by-n array [RowMajor: k-by-lda].
+///
+/// @param[in] lda
+///     Leading dimension of A.
+///     - If transA = NoTrans: lda >= max(1, n) [RowMajor: lda >= max(1, k)].
+///     - Otherwise:           lda >= max(1, k) [RowMajor: lda >= max(1, n)].
+///
+/// @param[in] B
+///     - If transB = NoTrans:
+///       the k-by-n matrix B, stored in an ldb-by-n array [RowMajor: k-by-ldb].
+///     - Otherwise:
+///       the n-by-k matrix B, stored in an ldb-by-k array [RowMajor: n-by-ldb].
+///
+/// @param[in] ldb
+///     Leading dimension of B.
+///     - If transB = NoTrans: ldb >= max(1, k) [RowMajor: ldb >= max(1, n)].
+///     - Otherwise:           ldb >= max(1, n) [RowMajor: ldb >= max(1, k)].
+///
+/// @param[in] beta
+///     Scalar beta. If beta is zero, C need not be set on input.
+///
+/// @param[in] C
+///     The n-by-n matrix C, stored in an ldc-by-n array [RowMajor: n-by-ldc].
+///     Only the uplo triangle is referenced and updated.
+///
+/// @param[in] ldc
+///     Leading dimension of C. ldc >= max(1, n).
+///
+/// @ingroup gemmt
+
+template< typename TA, typename TB, typename TC >
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const *A, int64_t lda,
+    TB const *B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC       *C, int64_t ldc )
+{
+    typedef blas::scalar_type<TA, TB, TC> scalar_t;
+
+    #define C(i_, j_) C[ (i_) + (j_)*ldc ]
+
+    // constants
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    if ((transA == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( lda < n );
+    else
+        blas_error_if( lda < k );
+
+    if ((transB == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( ldb < k );
+    else
+        blas_error_if( ldb < n );
+
+    blas_error_if( ldc < n );
+
+    // redirect if row major: C^T = op(B)^T op(A)^T, in the other triangle
+    if (layout == Layout::RowMajor) {
+        gemmt( Layout::ColMajor,
+               (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower),
+               transB, transA, n, k,
+               alpha, B, ldb, A, lda, beta, C, ldc );
+        return;
+    }
+
+    // quick return
+    if (n == 0)
+        return;
+
+    bool lower = (uplo == Uplo::Lower);
+
+    // alpha == zero or k == 0: C = beta C
+    if (alpha == zero || k == 0) {
+        if (beta != one) {
+            for (int64_t j = 0; j < n; ++j) {
+                int64_t i_begin = (lower ? j : 0);
+                int64_t i_end   = (lower ? n : j + 1);
+                for (int64_t i = i_begin; i < i_end; ++i)
+                    C(i, j) = (beta == zero ? zero : beta * C(i, j));
+            }
+        }
+        return;
+    }
+
+    // alpha != zero
+    internal::OpMatrix< scalar_t, TA > opA( transA, A, lda );
+    internal::OpMatrix< scalar_t, TB > opB( transB, B, ldb );
+    if (! internal::gemm_use_reference( n, n, k )) {
+        internal::syrk_blocked( uplo, false, n, k, alpha, opA, opB,
+                                beta, C, ldc );
+    }
+    else {
+        for (int64_t j = 0; j < n; ++j) {
+            int64_t i_begin = (lower ? j : 0);
+            int64_t i_end   = (lower ? n : j + 1);
+            for (int64_t i = i_begin; i < i_end; ++i) {
+                scalar_t sum = zero;
+                for (int64_t l = 0; l < k; ++l)
+                    sum += opA( i, l ) * opB( l, j );
+                C(i, j) = (beta == zero
+                           ? alpha*sum
+                           : alpha*sum + beta*C(i, j));
+            }
+        }
+    }
+
+    #undef C
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_GEMMT_HH
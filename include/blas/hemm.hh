@@ -26,6 +26,8 @@ namespace blas {
 /// and B and C are m-by-n matrices.
 ///
 /// Generic implementation for arbitrary data types.
+/// Except for small problems, uses the blocked gemm engine, expanding
+/// the Hermitian A to full form as it is packed; see blas/gemm_kernel.hh.
 ///
 /// @param[in] layout
 ///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
@@ -153,6 +155,26 @@ void hemm(
     }
 
     // alpha != zero
+    // Except for small problems, use the blocked gemm engine,
+    // expanding A to full form as it is packed.
+    if (! internal::gemm_use_reference( m, n, (side == Side::Left ? m : n) )) {
+        if (side == Side::Left) {
+            internal::gemm_blocked(
+                m, n, m, alpha,
+                internal::HermMatrix< scalar_t, TA >( uplo, A, lda ),
+                internal::OpMatrix< scalar_t, TB >( Op::NoTrans, B, ldb ),
+                beta, C, ldc );
+        }
+        else {
+            internal::gemm_blocked(
+                m, n, n, alpha,
+                internal::OpMatrix< scalar_t, TB >( Op::NoTrans, B, ldb ),
+                internal::HermMatrix< scalar_t, TA >( uplo, A, lda ),
+                beta, C, ldc );
+        }
+        return;
+    }
+
     if (side == Side::Left) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
@@ -26,6 +26,8 @@ namespace blas {
 /// and A and B are n-by-k or k-by-n matrices.
 ///
 /// Generic implementation for arbitrary data types.
+/// Except for small problems, computes only the tiles of the uplo
+/// triangle of C, using the blocked gemm engine; see blas/gemm_kernel.hh.
 ///
 /// @param[in] layout
 ///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
@@ -205,7 +207,21 @@ void her2k(
     }
 
     // alpha != zero
-    if (trans == Op::NoTrans) {
+    if (! internal::gemm_use_reference( n, n, k )) {
+        // C = alpha op(A) op(B)^H + conj(alpha) op(B) op(A)^H + beta C
+        Op trans2 = (trans == Op::NoTrans ? Op::ConjTrans : Op::NoTrans);
+        internal::syrk_blocked(
+            uplo, true, n, k, alpha,
+            internal::OpMatrix< scalar_t, TA >( trans,  A, lda ),
+            internal::OpMatrix< scalar_t, TB >( trans2, B, ldb ),
+            scalar_t( beta ), C, ldc );
+        internal::syrk_blocked(
+            uplo, true, n, k, conj( alpha ),
+            internal::OpMatrix< scalar_t, TB >( trans,  B, ldb ),
+            internal::OpMatrix< scalar_t, TA >( trans2, A, lda ),
+            one, C, ldc );
+    }
+    else if (trans == Op::NoTrans) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
             for (int64_t j = 0; j < n; ++j) {
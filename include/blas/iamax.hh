@@ -7,10 +7,35 @@
 #define BLAS_IAMAX_HH
 
 #include "blas/util.hh"
+#include "blas/simd.hh"
 
 #include <limits>
 
 namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Unit-stride iamax for generic types. Overloads in blas/simd.hh
+/// provide vectorized versions for float, double, and complex.
+template< typename T >
+int64_t iamax_unit(
+    int64_t n,
+    T const *x )
+{
+    // todo: check NAN
+    real_type<T> result = -1;
+    int64_t index = -1;
+    for (int64_t i = 0; i < n; ++i) {
+        real_type<T> tmp = abs1( x[i] );
+        if (tmp > result) {
+            result = tmp;
+            index = i;
+        }
+    }
+    return index;
+}
+
+}  // namespace internal
 
 // =============================================================================
 /// @return Index of infinity-norm of vector, $|| x ||_{inf}$,
@@ -41,30 +66,23 @@ int64_t iamax(
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
-    // todo: check NAN
-    real_t result = -1;
-    int64_t index = -1;
     if (incx == 1) {
         // unit stride
-        for (int64_t i = 0; i < n; ++i) {
-            real_t tmp = abs1( x[i] );
-            if (tmp > result) {
-                result = tmp;
-                index = i;
-            }
-        }
+        return internal::iamax_unit( n, x );
     }
-    else {
-        // non-unit stride
-        int64_t ix = 0;
-        for (int64_t i = 0; i < n; ++i) {
-            real_t tmp = abs1( x[ix] );
-            if (tmp > result) {
-                result = tmp;
-                index = i;
-            }
-            ix += incx;
+
+    // todo: check NAN
+    real_t result = -1;
+    int64_t index = -1;
+    // non-unit stride
+    int64_t ix = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        real_t tmp = abs1( x[ix] );
+        if (tmp > result) {
+            result = tmp;
+            index = i;
         }
+        ix += incx;
     }
     return index;
 }
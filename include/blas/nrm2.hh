@@ -7,17 +7,138 @@
 #define BLAS_NRM2_HH
 
 #include "blas/util.hh"
+#include "blas/simd.hh"
 
+#include <cmath>
 #include <limits>
 
 namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Thresholds and scaling factors for Blue's algorithm, as in LAPACK 3.10
+/// dnrm2.f90 (Anderson, 2017). Elements with |x| > tbig are scaled by
+/// sbig, elements with |x| < tsml are scaled by ssml, and the rest are
+/// summed unscaled, so none of the three sums of squares can overflow
+/// or underflow prematurely.
+template< typename real_t >
+struct Nrm2Scaling {
+    Nrm2Scaling()
+    {
+        typedef std::numeric_limits< real_t > limits;
+        const real_t radix  = limits::radix;
+        const double min_exp = limits::min_exponent;
+        const double max_exp = limits::max_exponent;
+        const double digits  = limits::digits;
+        tsml = real_t( std::pow( radix,  std::ceil(  (min_exp - 1)*0.5 ) ) );
+        tbig = real_t( std::pow( radix,  std::floor( (max_exp - digits + 1)*0.5 ) ) );
+        ssml = real_t( std::pow( radix, -std::floor( (min_exp - digits)*0.5 ) ) );
+        sbig = real_t( std::pow( radix, -std::ceil(  (max_exp + digits - 1)*0.5 ) ) );
+    }
+
+    /// @return constants for real_t, computed once.
+    static Nrm2Scaling const& get()
+    {
+        static const Nrm2Scaling scaling;
+        return scaling;
+    }
+
+    real_t tsml, tbig, ssml, sbig;
+};
+
+//------------------------------------------------------------------------------
+/// Adds x^2 to one of Blue's accumulators: abig, amed, or asml.
+/// NaN goes to amed, so it propagates to the result.
+template< typename real_t >
+inline void nrm2_accumulate(
+    real_t x, Nrm2Scaling< real_t > const& s,
+    real_t& abig, real_t& amed, real_t& asml )
+{
+    real_t ax = std::abs( x );
+    if (ax > s.tbig) {
+        ax *= s.sbig;
+        abig += ax*ax;
+    }
+    else if (ax < s.tsml) {
+        ax *= s.ssml;
+        asml += ax*ax;
+    }
+    else {
+        amed += x*x;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return sqrt( abig/sbig^2 + amed + asml/ssml^2 ), combining Blue's
+/// accumulators without overflow or underflow. Small contributions are
+/// dropped only when they are below the rounding error of larger ones.
+template< typename real_t >
+real_t nrm2_combine(
+    real_t abig, real_t amed, real_t asml, Nrm2Scaling< real_t > const& s )
+{
+    const real_t one = 1;
+    real_t scl, sumsq;
+    if (abig > 0) {
+        // add amed to abig; if abig is large, asml is insignificant
+        if (amed > 0 || amed != amed)  // amed != amed is NaN
+            abig += (amed*s.sbig)*s.sbig;
+        scl = one / s.sbig;
+        sumsq = abig;
+    }
+    else if (asml > 0) {
+        if (amed > 0 || amed != amed) {
+            // combine amed and asml
+            real_t ymed = std::sqrt( amed );
+            real_t ymin = std::sqrt( asml ) / s.ssml;
+            real_t ymax = ymed;
+            if (ymin > ymed) {
+                ymax = ymin;
+                ymin = ymed;
+            }
+            scl = one;
+            sumsq = ymax*ymax * (one + (ymin/ymax)*(ymin/ymax));
+        }
+        else {
+            scl = one / s.ssml;
+            sumsq = asml;
+        }
+    }
+    else {
+        scl = one;
+        sumsq = amed;
+    }
+    return scl * std::sqrt( sumsq );
+}
+
+//------------------------------------------------------------------------------
+/// Unit-stride nrm2 for generic types. Overloads in blas/simd.hh
+/// provide vectorized versions for float, double, and complex.
+template< typename T >
+real_type<T> nrm2_unit(
+    int64_t n,
+    T const *x )
+{
+    typedef real_type<T> real_t;
+    auto const& s = Nrm2Scaling< real_t >::get();
+
+    real_t abig = 0, amed = 0, asml = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        nrm2_accumulate( real( x[i] ), s, abig, amed, asml );
+        if (is_complex<T>::value)
+            nrm2_accumulate( imag( x[i] ), s, abig, amed, asml );
+    }
+    return nrm2_combine( abig, amed, asml, s );
+}
+
+}  // namespace internal
 
 // =============================================================================
 /// @return 2-norm of vector,
 ///     $|| x ||_2 = (\sum_{i=0}^{n-1} |x_i|^2)^{1/2}$.
 ///
 /// Generic implementation for arbitrary data types.
-/// TODO: generic implementation does not currently scale to avoid over- or underflow.
+/// Uses Blue's algorithm, a single pass with three scaled accumulators,
+/// to avoid overflow and underflow.
 ///
 /// @param[in] n
 ///     Number of elements in x. n >= 0.
@@ -42,23 +163,22 @@ nrm2(
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
-    // todo: scale to avoid overflow & underflow
-    real_t result = 0;
     if (incx == 1) {
         // unit stride
-        for (int64_t i = 0; i < n; ++i) {
-            result += real(x[i]) * real(x[i]) + imag(x[i]) * imag(x[i]);
-        }
+        return internal::nrm2_unit( n, x );
     }
-    else {
-        // non-unit stride
-        int64_t ix = 0;
-        for (int64_t i = 0; i < n; ++i) {
-            result += real(x[ix]) * real(x[ix]) + imag(x[ix]) * imag(x[ix]);
-            ix += incx;
-        }
+
+    // non-unit stride
+    auto const& s = internal::Nrm2Scaling< real_t >::get();
+    real_t abig = 0, amed = 0, asml = 0;
+    int64_t ix = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        internal::nrm2_accumulate( real( x[ix] ), s, abig, amed, asml );
+        if (is_complex<T>::value)
+            internal::nrm2_accumulate( imag( x[ix] ), s, abig, amed, asml );
+        ix += incx;
     }
-    return std::sqrt( result );
+    return internal::nrm2_combine( abig, amed, asml, s );
 }
 
 }  // namespace blas
@@ -0,0 +1,161 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_SBMV_HH
+#define BLAS_SBMV_HH
+
+#include "blas/util.hh"
+
+#include <algorithm>
+#include <limits>
+
+namespace blas {
+
+// =============================================================================
+/// Symmetric band matrix-vector multiply:
+/// \[
+///     y = \alpha A x + \beta y,
+/// \]
+/// where alpha and beta are scalars, x and y are vectors,
+/// and A is an n-by-n symmetric band matrix with k off-diagonals.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] uplo
+///     What part of the matrix A is referenced,
+///     the opposite triangle being assumed from symmetry.
+///     - Uplo::Lower: only the lower triangular part of A is referenced.
+///     - Uplo::Upper: only the upper triangular part of A is referenced.
+///
+/// @param[in] n
+///     Number of rows and columns of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     Number of sub-diagonals (if lower) or super-diagonals (if upper)
+///     of the matrix A. k >= 0.
+///
+/// @param[in] alpha
+///     Scalar alpha. If alpha is zero, A and x are not accessed.
+///
+/// @param[in] A
+///     The uplo triangle of the n-by-n band matrix A, in LAPACK band storage,
+///     an lda-by-n array [RowMajor: n-by-lda]:
+///     - Uplo::Upper: A(i, j) is in A[ k + i - j + j*lda ]
+///       for max(0, j-k) <= i <= j.
+///     - Uplo::Lower: A(i, j) is in A[ i - j + j*lda ]
+///       for j <= i <= min(n-1, j+k).
+///
+/// @param[in] lda
+///     Leading dimension of A. lda >= k + 1.
+///
+/// @param[in] x
+///     The n-element vector x, in an array of length (n-1)*abs(incx) + 1.
+///
+/// @param[in] incx
+///     Stride between elements of x. incx must not be zero.
+///     If incx < 0, uses elements of x in reverse order: x(n-1), ..., x(0).
+///
+/// @param[in] beta
+///     Scalar beta. If beta is zero, y need not be set on input.
+///
+/// @param[in, out] y
+///     The n-element vector y, in an array of length (n-1)*abs(incy) + 1.
+///
+/// @param[in] incy
+///     Stride between elements of y. incy must not be zero.
+///     If incy < 0, uses elements of y in reverse order: y(n-1), ..., y(0).
+///
+/// @ingroup sbmv
+
+template< typename TA, typename TX, typename TY >
+void sbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n, int64_t k,
+    blas::scalar_type<TA, TX, TY> alpha,
+    TA const *A, int64_t lda,
+    TX const *x, int64_t incx,
+    blas::scalar_type<TA, TX, TY> beta,
+    TY *y, int64_t incy )
+{
+    typedef blas::scalar_type<TA, TX, TY> scalar_t;
+
+    // constants
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( lda < k + 1 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    // quick return
+    if (n == 0 || (alpha == zero && beta == one))
+        return;
+
+    // for row major, swap lower <=> upper, as A^T = A
+    if (layout == Layout::RowMajor) {
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+    }
+
+    bool upper = (uplo == Uplo::Upper);
+
+    // band storage: A(i, j) is in row k + i - j (upper) or i - j (lower)
+    // of column j
+    int64_t kd = (upper ? k : 0);
+    #define A(i_, j_) A[ kd + (i_) - (j_) + (j_)*lda ]
+
+    int64_t kx = (incx > 0 ? 0 : (-n + 1)*incx);
+    int64_t ky = (incy > 0 ? 0 : (-n + 1)*incy);
+
+    // form y = beta*y
+    if (beta != one) {
+        int64_t iy = ky;
+        for (int64_t i = 0; i < n; ++i) {
+            y[iy] = (beta == zero ? zero : beta * y[iy]);
+            iy += incy;
+        }
+    }
+    if (alpha == zero)
+        return;
+
+    // form y += alpha * A * x, one column j of the stored triangle at a time:
+    // y(i) += alpha A(i, j) x(j) and y(j) += alpha A(j, i) x(i)
+    int64_t jx = kx;
+    int64_t jy = ky;
+    for (int64_t j = 0; j < n; ++j) {
+        scalar_t tmp1 = alpha*x[jx];
+        scalar_t tmp2 = zero;
+        int64_t i_begin = (upper ? std::max< int64_t >( 0, j - k ) : j + 1);
+        int64_t i_end   = (upper ? j : std::min( n, j + k + 1 ));
+        int64_t ix = kx + i_begin*incx;
+        int64_t iy = ky + i_begin*incy;
+        for (int64_t i = i_begin; i < i_end; ++i) {
+            scalar_t a = A(i, j);
+            y[iy] += tmp1 * a;
+            tmp2 += a * x[ix];
+            ix += incx;
+            iy += incy;
+        }
+        y[jy] += tmp1 * A(j, j) + alpha * tmp2;
+        jx += incx;
+        jy += incy;
+    }
+
+    #undef A
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_SBMV_HH
@@ -7,10 +7,28 @@
 #define BLAS_SCAL_HH
 
 #include "blas/util.hh"
+#include "blas/simd.hh"
 
 #include <limits>
 
 namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Unit-stride scal for generic types. Overloads in blas/simd.hh
+/// provide vectorized versions for float, double, and complex.
+template< typename T >
+void scal_unit(
+    int64_t n,
+    T alpha,
+    T* x )
+{
+    for (int64_t i = 0; i < n; ++i) {
+        x[i] *= alpha;
+    }
+}
+
+}  // namespace internal
 
 // =============================================================================
 /// Scale vector by constant, $x = \alpha x$.
@@ -43,9 +61,7 @@ void scal(
 
     if (incx == 1) {
         // unit stride
-        for (int64_t i = 0; i < n; ++i) {
-            x[i] *= alpha;
-        }
+        internal::scal_unit( n, alpha, x );
     }
     else {
         // non-unit stride
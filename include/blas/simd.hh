@@ -0,0 +1,154 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_SIMD_HH
+#define BLAS_SIMD_HH
+
+#include "blas/util.hh"
+
+#include <algorithm>
+#include <complex>
+
+namespace blas {
+namespace internal {
+
+// =============================================================================
+// Vectorized kernels for unit-stride Level 1 template routines.
+//
+// The template routines (blas::axpy< TX, TY >, etc.) call these overloads
+// for unit stride when all arguments have the same type, float, double,
+// std::complex<float>, or std::complex<double>; other types use the
+// generic loops in each routine's header. The library is compiled with
+// kernels for each instruction set the compiler supports, and the best
+// one that the CPU supports is selected at runtime.
+// The same kernels convert arrays between 16-bit types and float.
+
+/// Instruction sets for Level 1 kernels, in increasing order of preference.
+enum class Simd : char {
+    Portable = 'p',  ///< Plain C++, for any CPU.
+    NEON     = 'n',  ///< ARM Advanced SIMD, 128-bit.
+    AVX2     = '2',  ///< x86 AVX2 with FMA, 256-bit.
+    AVX512   = '5',  ///< x86 AVX-512F, 512-bit.
+};
+
+//------------------------------------------------------------------------------
+/// @return instruction set currently used by the Level 1 kernels.
+Simd simd_isa();
+
+/// Sets the instruction set used by the Level 1 kernels, e.g., for testing.
+/// If isa is not supported by both the CPU and the library build,
+/// falls back to the next one in the order AVX512, AVX2, NEON, Portable.
+/// Not thread safe with concurrent Level 1 calls.
+/// @return instruction set actually selected.
+Simd set_simd_isa( Simd isa );
+
+//------------------------------------------------------------------------------
+inline const char* simd2str( Simd isa )
+{
+    switch (isa) {
+        case Simd::Portable: return "portable";
+        case Simd::NEON:     return "neon";
+        case Simd::AVX2:     return "avx2";
+        case Simd::AVX512:   return "avx512";
+    }
+    return "";
+}
+
+//------------------------------------------------------------------------------
+// y = alpha x + y
+void axpy_unit( int64_t n, float alpha,
+                float const* x, float* y );
+void axpy_unit( int64_t n, double alpha,
+                double const* x, double* y );
+void axpy_unit( int64_t n, std::complex<float> alpha,
+                std::complex<float> const* x, std::complex<float>* y );
+void axpy_unit( int64_t n, std::complex<double> alpha,
+                std::complex<double> const* x, std::complex<double>* y );
+
+//------------------------------------------------------------------------------
+// x = alpha x
+void scal_unit( int64_t n, float alpha, float* x );
+void scal_unit( int64_t n, double alpha, double* x );
+void scal_unit( int64_t n, std::complex<float> alpha,
+                std::complex<float>* x );
+void scal_unit( int64_t n, std::complex<double> alpha,
+                std::complex<double>* x );
+
+//------------------------------------------------------------------------------
+// x^H y
+float  dot_unit( int64_t n, float const* x, float const* y );
+double dot_unit( int64_t n, double const* x, double const* y );
+std::complex<float> dot_unit(
+    int64_t n, std::complex<float> const* x, std::complex<float> const* y );
+std::complex<double> dot_unit(
+    int64_t n, std::complex<double> const* x, std::complex<double> const* y );
+
+//------------------------------------------------------------------------------
+// x^T y
+float  dotu_unit( int64_t n, float const* x, float const* y );
+double dotu_unit( int64_t n, double const* x, double const* y );
+std::complex<float> dotu_unit(
+    int64_t n, std::complex<float> const* x, std::complex<float> const* y );
+std::complex<double> dotu_unit(
+    int64_t n, std::complex<double> const* x, std::complex<double> const* y );
+
+//------------------------------------------------------------------------------
+// sum_i |Re(x_i)| + |Im(x_i)|
+float  asum_unit( int64_t n, float const* x );
+double asum_unit( int64_t n, double const* x );
+float  asum_unit( int64_t n, std::complex<float> const* x );
+double asum_unit( int64_t n, std::complex<double> const* x );
+
+//------------------------------------------------------------------------------
+// ||x||_2
+float  nrm2_unit( int64_t n, float const* x );
+double nrm2_unit( int64_t n, double const* x );
+float  nrm2_unit( int64_t n, std::complex<float> const* x );
+double nrm2_unit( int64_t n, std::complex<double> const* x );
+
+//------------------------------------------------------------------------------
+// argmax_i |Re(x_i)| + |Im(x_i)|, first index, ignoring NaN; -1 if none.
+int64_t iamax_unit( int64_t n, float const* x );
+int64_t iamax_unit( int64_t n, double const* x );
+int64_t iamax_unit( int64_t n, std::complex<float> const* x );
+int64_t iamax_unit( int64_t n, std::complex<double> const* x );
+
+//------------------------------------------------------------------------------
+// y = x, converting between 16-bit types and float,
+// rounding to nearest, ties to even.
+void convert_unit( int64_t n, float16  const* x, float* y );
+void convert_unit( int64_t n, bfloat16 const* x, float* y );
+void convert_unit( int64_t n, float const* x, float16*  y );
+void convert_unit( int64_t n, float const* x, bfloat16* y );
+
+/// Generic conversion, for other pairs of types.
+template <typename TX, typename TY>
+void convert_unit( int64_t n, TX const* x, TY* y )
+{
+    for (int64_t i = 0; i < n; ++i)
+        y[ i ] = TY( x[ i ] );
+}
+
+//------------------------------------------------------------------------------
+/// Copies the uplo triangle (including diagonal) or, for Uplo::General,
+/// all of the m-by-n column-major matrix A to B, converting element types.
+/// Used to compute on 16-bit matrices in float workspace.
+template <typename TA, typename TB>
+void convert_matrix(
+    blas::Uplo uplo, int64_t m, int64_t n,
+    TA const* A, int64_t lda,
+    TB*       B, int64_t ldb )
+{
+    for (int64_t j = 0; j < n; ++j) {
+        int64_t i0 = (uplo == Uplo::Lower ? std::min( j, m ) : 0);
+        int64_t i1 = (uplo == Uplo::Upper ? std::min( j + 1, m ) : m);
+        convert_unit( i1 - i0, &A[ i0 + j*lda ], &B[ i0 + j*ldb ] );
+    }
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_SIMD_HH
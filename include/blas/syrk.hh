@@ -7,8 +7,11 @@
 #define BLAS_SYRK_HH
 
 #include "blas/util.hh"
+#include "blas/gemm.hh"
+#include "blas/simd.hh"
 
 #include <limits>
+#include <vector>
 
 namespace blas {
 
@@ -25,6 +28,8 @@ namespace blas {
 /// and A is an n-by-k or k-by-n matrix.
 ///
 /// Generic implementation for arbitrary data types.
+/// Except for small problems, computes only the tiles of the uplo
+/// triangle of C, using the blocked gemm engine; see blas/gemm_kernel.hh.
 ///
 /// @param[in] layout
 ///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
@@ -181,8 +186,30 @@ void syrk(
         return;
     }
 
+    // 16-bit types: compute in float workspace, rounding C once at the end
+    if (is_low_precision<TA>::value || is_low_precision<TC>::value) {
+        int64_t Am = (trans == Op::NoTrans ? n : k);
+        int64_t An = (trans == Op::NoTrans ? k : n);
+        std::vector<scalar_t> Aw( size_t(Am)*An ), Cw( size_t(n)*n );
+        internal::convert_matrix( Uplo::General, Am, An, A, lda, Aw.data(), Am );
+        internal::convert_matrix( uplo, n, n, C, ldc, Cw.data(), n );
+        syrk( Layout::ColMajor, uplo, trans, n, k,
+              alpha, Aw.data(), Am, beta, Cw.data(), n );
+        internal::convert_matrix( uplo, n, n, Cw.data(), n, C, ldc );
+        return;
+    }
+
     // alpha != zero
-    if (trans == Op::NoTrans) {
+    if (! internal::gemm_use_reference( n, n, k )) {
+        // C = alpha op(A) op(A)^T + beta C
+        Op trans2 = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
+        internal::syrk_blocked(
+            uplo, false, n, k, alpha,
+            internal::OpMatrix< scalar_t, TA >( trans,  A, lda ),
+            internal::OpMatrix< scalar_t, TA >( trans2, A, lda ),
+            beta, C, ldc );
+    }
+    else if (trans == Op::NoTrans) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
             for (int64_t j = 0; j < n; ++j) {
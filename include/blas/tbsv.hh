@@ -0,0 +1,219 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_TBSV_HH
+#define BLAS_TBSV_HH
+
+#include "blas/util.hh"
+
+#include <algorithm>
+#include <limits>
+
+namespace blas {
+
+// =============================================================================
+/// Solve the triangular band matrix-vector equation
+/// \[
+///     op(A) x = b,
+/// \]
+/// where $op(A)$ is one of
+///     $op(A) = A$,
+///     $op(A) = A^T$, or
+///     $op(A) = A^H$,
+/// x and b are vectors,
+/// and A is an n-by-n, unit or non-unit, upper or lower triangular band
+/// matrix with k off-diagonals.
+///
+/// No test for singularity or near-singularity is included in this
+/// routine. Such tests must be performed before calling this routine.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] uplo
+///     What part of the matrix A is referenced,
+///     the opposite triangle being assumed to be zero.
+///     - Uplo::Lower: A is lower triangular.
+///     - Uplo::Upper: A is upper triangular.
+///
+/// @param[in] trans
+///     The equation to be solved:
+///     - Op::NoTrans:   $A   x = b$,
+///     - Op::Trans:     $A^T x = b$,
+///     - Op::ConjTrans: $A^H x = b$.
+///
+/// @param[in] diag
+///     Whether A has a unit or non-unit diagonal:
+///     - Diag::Unit:    A is assumed to be unit triangular.
+///                      The diagonal elements of A are not referenced.
+///     - Diag::NonUnit: A is not assumed to be unit triangular.
+///
+/// @param[in] n
+///     Number of rows and columns of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     Number of sub-diagonals (if lower) or super-diagonals (if upper)
+///     of the matrix A. k >= 0.
+///
+/// @param[in] A
+///     The n-by-n triangular band matrix A, in LAPACK band storage,
+///     an lda-by-n array [RowMajor: n-by-lda]:
+///     - Uplo::Upper: A(i, j) is in A[ k + i - j + j*lda ]
+///       for max(0, j-k) <= i <= j.
+///     - Uplo::Lower: A(i, j) is in A[ i - j + j*lda ]
+///       for j <= i <= min(n-1, j+k).
+///
+/// @param[in] lda
+///     Leading dimension of A. lda >= k + 1.
+///
+/// @param[in, out] x
+///     On entry, the n-element vector b, in an array of length
+///     (n-1)*abs(incx) + 1. On exit, overwritten by the solution x.
+///
+/// @param[in] incx
+///     Stride between elements of x. incx must not be zero.
+///     If incx < 0, uses elements of x in reverse order: x(n-1), ..., x(0).
+///
+/// @ingroup tbsv
+
+template< typename TA, typename TX >
+void tbsv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t n, int64_t k,
+    TA const *A, int64_t lda,
+    TX       *x, int64_t incx )
+{
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( diag != Diag::NonUnit &&
+                   diag != Diag::Unit );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( lda < k + 1 );
+    blas_error_if( incx == 0 );
+
+    // quick return
+    if (n == 0)
+        return;
+
+    // for row major, swap lower <=> upper and
+    // A => A^T; A^T => A; A^H => A & conj
+    bool doconj = false;
+    if (layout == Layout::RowMajor) {
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+        if (trans == Op::NoTrans) {
+            trans = Op::Trans;
+        }
+        else {
+            if (trans == Op::ConjTrans) {
+                doconj = true;
+            }
+            trans = Op::NoTrans;
+        }
+    }
+    else if (trans == Op::ConjTrans) {
+        trans = Op::Trans;
+        doconj = true;
+    }
+
+    bool upper = (uplo == Uplo::Upper);
+    bool nonunit = (diag == Diag::NonUnit);
+    int64_t kx = (incx > 0 ? 0 : (-n + 1)*incx);
+
+    // band storage: A(i, j) is in row k + i - j (upper) or i - j (lower)
+    // of column j; A_ applies conj if needed
+    int64_t kd = (upper ? k : 0);
+    #define A(i_, j_) A[ kd + (i_) - (j_) + (j_)*lda ]
+    #define A_(i_, j_) (doconj ? conj( A(i_, j_) ) : A(i_, j_))
+
+    if (trans == Op::NoTrans) {
+        if (upper) {
+            // backwards: x(j) /= A(j, j); x(0:j-1) -= x(j) A(0:j-1, j)
+            int64_t jx = kx + (n - 1)*incx;
+            for (int64_t j = n-1; j >= 0; --j) {
+                if (nonunit)
+                    x[jx] /= A_(j, j);
+                TX tmp = x[jx];
+                int64_t i_begin = std::max< int64_t >( 0, j - k );
+                int64_t ix = kx + i_begin*incx;
+                for (int64_t i = i_begin; i < j; ++i) {
+                    x[ix] -= tmp * A_(i, j);
+                    ix += incx;
+                }
+                jx -= incx;
+            }
+        }
+        else {
+            // x(j) /= A(j, j); x(j+1:n-1) -= x(j) A(j+1:n-1, j)
+            int64_t jx = kx;
+            for (int64_t j = 0; j < n; ++j) {
+                if (nonunit)
+                    x[jx] /= A_(j, j);
+                TX tmp = x[jx];
+                int64_t i_end = std::min( n, j + k + 1 );
+                int64_t ix = jx + incx;
+                for (int64_t i = j + 1; i < i_end; ++i) {
+                    x[ix] -= tmp * A_(i, j);
+                    ix += incx;
+                }
+                jx += incx;
+            }
+        }
+    }
+    else {
+        if (upper) {
+            // x(j) = (x(j) - A(0:j-1, j)^T x(0:j-1)) / A(j, j)
+            int64_t jx = kx;
+            for (int64_t j = 0; j < n; ++j) {
+                TX tmp = x[jx];
+                int64_t i_begin = std::max< int64_t >( 0, j - k );
+                int64_t ix = kx + i_begin*incx;
+                for (int64_t i = i_begin; i < j; ++i) {
+                    tmp -= A_(i, j) * x[ix];
+                    ix += incx;
+                }
+                if (nonunit)
+                    tmp /= A_(j, j);
+                x[jx] = tmp;
+                jx += incx;
+            }
+        }
+        else {
+            // backwards: x(j) = (x(j) - A(j+1:n-1, j)^T x(j+1:n-1)) / A(j, j)
+            int64_t jx = kx + (n - 1)*incx;
+            for (int64_t j = n-1; j >= 0; --j) {
+                TX tmp = x[jx];
+                int64_t i_end = std::min( n, j + k + 1 );
+                int64_t ix = jx + incx;
+                for (int64_t i = j + 1; i < i_end; ++i) {
+                    tmp -= A_(i, j) * x[ix];
+                    ix += incx;
+                }
+                if (nonunit)
+                    tmp /= A_(j, j);
+                x[jx] = tmp;
+                jx -= incx;
+            }
+        }
+    }
+
+    #undef A
+    #undef A_
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_TBSV_HH
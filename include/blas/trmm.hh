@@ -7,11 +7,140 @@
 #define BLAS_TRMM_HH
 
 #include "blas/util.hh"
+#include "blas/gemm.hh"
 
 #include <limits>
+#include <vector>
 
 namespace blas {
 
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Blocked trmm on column-major matrices, using the gemm engine.
+/// B is overwritten one nb-row (Left) or nb-column (Right) block at a time,
+/// in the order that leaves the blocks still to be read unchanged. Each
+/// block is the product of its copy with the diagonal block of op(A),
+/// plus the product of the unchanged blocks with the nonzero off-diagonal
+/// part of op(A); zero blocks of op(A) are skipped.
+/// Requires m, n > 0 and alpha != 0.
+template< typename TA, typename TB >
+void trmm_blocked(
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m,
+    int64_t n,
+    blas::scalar_type<TA, TB> alpha,
+    TA const *A, int64_t lda,
+    TB       *B, int64_t ldb )
+{
+    typedef blas::scalar_type<TA, TB> scalar_t;
+    typedef OpMatrix< scalar_t, TA > MatrixA;
+    typedef TriMatrix< scalar_t, TA > TriA;
+    typedef OpMatrix< scalar_t, TB > MatrixB;
+    typedef OpMatrix< scalar_t, scalar_t > MatrixW;
+
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+    #define B(i_, j_) B[ (i_) + (j_)*ldb ]
+
+    // constants
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+    const int64_t nb = GemmBlocking< scalar_t >::kc;
+
+    // op(A) is lower triangular
+    bool lower = ((uplo == Uplo::Lower) == (trans == Op::NoTrans));
+
+    if (side == Side::Left) {
+        // Block row i of op(A) B uses block rows <= i (lower) or >= i
+        // (upper) of B, so go bottom-up (lower) or top-down (upper).
+        int64_t nblocks = (m + nb - 1) / nb;
+        std::vector<scalar_t> W( size_t( std::min( nb, m ) )*n );
+        for (int64_t b = 0; b < nblocks; ++b) {
+            int64_t i  = (lower ? nblocks - 1 - b : b) * nb;
+            int64_t ib = std::min( nb, m - i );
+
+            // B_i = alpha op(A_ii) B_i, with B_i copied to W
+            for (int64_t j = 0; j < n; ++j)
+                for (int64_t ii = 0; ii < ib; ++ii)
+                    W[ ii + j*ib ] = B(i + ii, j);
+            gemm_blocked(
+                ib, n, ib, alpha,
+                TriA( uplo, trans, diag, &A(i, i), lda ),
+                MatrixW( Op::NoTrans, W.data(), ib ),
+                zero, &B(i, 0), ldb );
+
+            if (lower && i > 0) {
+                // B_i += alpha op(A)(i, 0:i) B(0:i, :)
+                TA const* Aik = (trans == Op::NoTrans ? &A(i, 0) : &A(0, i));
+                gemm_blocked(
+                    ib, n, i, alpha,
+                    MatrixA( trans, Aik, lda ),
+                    MatrixB( Op::NoTrans, B, ldb ),
+                    one, &B(i, 0), ldb );
+            }
+            else if (! lower && i + ib < m) {
+                // B_i += alpha op(A)(i, k:m) B(k:m, :)
+                int64_t k = i + ib;
+                TA const* Aik = (trans == Op::NoTrans ? &A(i, k) : &A(k, i));
+                gemm_blocked(
+                    ib, n, m - k, alpha,
+                    MatrixA( trans, Aik, lda ),
+                    MatrixB( Op::NoTrans, &B(k, 0), ldb ),
+                    one, &B(i, 0), ldb );
+            }
+        }
+    }
+    else { // side == Side::Right
+        // Block column j of B op(A) uses block columns >= j (lower) or
+        // <= j (upper) of B, so go left to right (lower) or right to left
+        // (upper).
+        int64_t nblocks = (n + nb - 1) / nb;
+        std::vector<scalar_t> W( size_t( m )*std::min( nb, n ) );
+        for (int64_t b = 0; b < nblocks; ++b) {
+            int64_t j  = (lower ? b : nblocks - 1 - b) * nb;
+            int64_t jb = std::min( nb, n - j );
+
+            // B_j = alpha B_j op(A_jj), with B_j copied to W
+            for (int64_t jj = 0; jj < jb; ++jj)
+                for (int64_t i = 0; i < m; ++i)
+                    W[ i + jj*m ] = B(i, j + jj);
+            gemm_blocked(
+                m, jb, jb, alpha,
+                MatrixW( Op::NoTrans, W.data(), m ),
+                TriA( uplo, trans, diag, &A(j, j), lda ),
+                zero, &B(0, j), ldb );
+
+            if (lower && j + jb < n) {
+                // B_j += alpha B(:, k:n) op(A)(k:n, j)
+                int64_t k = j + jb;
+                TA const* Akj = (trans == Op::NoTrans ? &A(k, j) : &A(j, k));
+                gemm_blocked(
+                    m, jb, n - k, alpha,
+                    MatrixB( Op::NoTrans, &B(0, k), ldb ),
+                    MatrixA( trans, Akj, lda ),
+                    one, &B(0, j), ldb );
+            }
+            else if (! lower && j > 0) {
+                // B_j += alpha B(:, 0:j) op(A)(0:j, j)
+                TA const* Akj = (trans == Op::NoTrans ? &A(0, j) : &A(j, 0));
+                gemm_blocked(
+                    m, jb, j, alpha,
+                    MatrixB( Op::NoTrans, B, ldb ),
+                    MatrixA( trans, Akj, lda ),
+                    one, &B(0, j), ldb );
+            }
+        }
+    }
+
+    #undef A
+    #undef B
+}
+
+}  // namespace internal
+
 // =============================================================================
 /// Triangular matrix-matrix multiply:
 /// \[
@@ -29,6 +158,8 @@ namespace blas {
 /// upper or lower triangular matrix.
 ///
 /// Generic implementation for arbitrary data types.
+/// Except for small problems, uses the blocked gemm engine on block rows
+/// (Left) or columns (Right) of B, skipping the zero blocks of A.
 ///
 /// @param[in] layout
 ///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
@@ -150,6 +281,12 @@ void trmm(
     }
 
     // alpha != zero
+    if (! internal::gemm_use_reference( m, n, (side == Side::Left ? m : n) )) {
+        internal::trmm_blocked( side, uplo, trans, diag, m, n,
+                                alpha, A, lda, B, ldb );
+        return;
+    }
+
     if (side == Side::Left) {
         if (trans == Op::NoTrans) {
             if (uplo == Uplo::Upper) {
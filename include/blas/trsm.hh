@@ -7,91 +7,22 @@
 #define BLAS_TRSM_HH
 
 #include "blas/util.hh"
+#include "blas/gemm.hh"
+#include "blas/simd.hh"
 
 #include <limits>
+#include <vector>
 
 namespace blas {
 
-// =============================================================================
-/// Solve the triangular matrix-vector equation
-/// \[
-///     op(A) X = \alpha B,
-/// \]
-/// or
-/// \[
-///     X op(A) = \alpha B,
-/// \]
-/// where $op(A)$ is one of
-///     $op(A) = A$,
-///     $op(A) = A^T$, or
-///     $op(A) = A^H$,
-/// X and B are m-by-n matrices, and A is an m-by-m or n-by-n, unit or non-unit,
-/// upper or lower triangular matrix.
-///
-/// No test for singularity or near-singularity is included in this
-/// routine. Such tests must be performed before calling this routine.
-/// @see latrs for a more numerically robust implementation.
-///
-/// Generic implementation for arbitrary data types.
-///
-/// @param[in] layout
-///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
-///
-/// @param[in] side
-///     Whether $op(A)$ is on the left or right of X:
-///     - Side::Left:  $op(A) X = B$.
-///     - Side::Right: $X op(A) = B$.
-///
-/// @param[in] uplo
-///     What part of the matrix A is referenced,
-///     the opposite triangle being assumed to be zero:
-///     - Uplo::Lower: A is lower triangular.
-///     - Uplo::Upper: A is upper triangular.
-///
-/// @param[in] trans
-///     The form of $op(A)$:
-///     - Op::NoTrans:   $op(A) = A$.
-///     - Op::Trans:     $op(A) = A^T$.
-///     - Op::ConjTrans: $op(A) = A^H$.
-///
-/// @param[in] diag
-///     Whether A has a unit or non-unit diagonal:
-///     - Diag::Unit:    A is assumed to be unit triangular.
-///     - Diag::NonUnit: A is not assumed to be unit triangular.
-///
-/// @param[in] m
-///     Number of rows of matrices B and X. m >= 0.
-///
-/// @param[in] n
-///     Number of columns of matrices B and X. n >= 0.
-///
-/// @param[in] alpha
-///     Scalar alpha. If alpha is zero, A is not accessed.
-///
-/// @param[in] A
-///     - If side = Left:
-///       the m-by-m matrix A, stored in an lda-by-m array [RowMajor: m-by-lda].
-///     - If side = Right:
-///       the n-by-n matrix A, stored in an lda-by-n array [RowMajor: n-by-lda].
-///
-/// @param[in] lda
-///     Leading dimension of A.
-///     - If side = left:  lda >= max(1, m).
-///     - If side = right: lda >= max(1, n).
-///
-/// @param[in, out] B
-///     On entry,
-///     the m-by-n matrix B, stored in an ldb-by-n array [RowMajor: m-by-ldb].
-///     On exit, overwritten by the solution matrix X.
-///
-/// @param[in] ldb
-///     Leading dimension of B. ldb >= max(1, m) [RowMajor: ldb >= max(1, n)].
-///
-/// @ingroup trsm
+namespace internal {
 
+//------------------------------------------------------------------------------
+/// Unblocked trsm on column-major matrices, solving one column (Left)
+/// or row (Right) of B at a time. Used for the diagonal blocks of
+/// trsm_recursive. Requires alpha != 0.
 template< typename TA, typename TB >
-void trsm(
-    blas::Layout layout,
+void trsm_unblocked(
     blas::Side side,
     blas::Uplo uplo,
     blas::Op trans,
@@ -107,54 +38,6 @@ void trsm(
     #define A(i_, j_) A[ (i_) + (j_)*lda ]
     #define B(i_, j_) B[ (i_) + (j_)*ldb ]
 
-    // constants
-    const scalar_t zero = 0;
-
-    // check arguments
-    blas_error_if( layout != Layout::ColMajor &&
-                   layout != Layout::RowMajor );
-    blas_error_if( side != Side::Left &&
-                   side != Side::Right );
-    blas_error_if( uplo != Uplo::Lower &&
-                   uplo != Uplo::Upper );
-    blas_error_if( trans != Op::NoTrans &&
-                   trans != Op::Trans &&
-                   trans != Op::ConjTrans );
-    blas_error_if( diag != Diag::NonUnit &&
-                   diag != Diag::Unit );
-    blas_error_if( m < 0 );
-    blas_error_if( n < 0 );
-
-    // adapt if row major
-    if (layout == Layout::RowMajor) {
-        side = (side == Side::Left)
-               ? Side::Right
-               : Side::Left;
-        if (uplo == Uplo::Lower)
-            uplo = Uplo::Upper;
-        else if (uplo == Uplo::Upper)
-            uplo = Uplo::Lower;
-        std::swap( m, n );
-    }
-
-    // check remaining arguments
-    blas_error_if( lda < ((side == Side::Left) ? m : n) );
-    blas_error_if( ldb < m );
-
-    // quick return
-    if (m == 0 || n == 0)
-        return;
-
-    // alpha == zero
-    if (alpha == zero) {
-        for (int64_t j = 0; j < n; ++j) {
-            for (int64_t i = 0; i < m; ++i)
-                B(i, j) = zero;
-        }
-        return;
-    }
-
-    // alpha != zero
     if (side == Side::Left) {
         if (trans == Op::NoTrans) {
             if (uplo == Uplo::Upper) {
@@ -328,6 +211,316 @@ void trsm(
         }
     }
 
+
+    #undef A
+    #undef B
+}
+
+//------------------------------------------------------------------------------
+/// Size of the triangle at or below which trsm_recursive uses the
+/// unblocked solve.
+const int64_t trsm_nb = 64;
+
+//------------------------------------------------------------------------------
+/// Recursive trsm on column-major matrices. Splits the triangle in half,
+/// solves with the first half, updates B using the template gemm, then
+/// solves with the second half. Most flops are in the gemm updates,
+/// so this runs at gemm speed, unlike the unblocked solve.
+/// Requires m, n > 0 and alpha != 0.
+template< typename TA, typename TB >
+void trsm_recursive(
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m,
+    int64_t n,
+    blas::scalar_type<TA, TB> alpha,
+    TA const *A, int64_t lda,
+    TB       *B, int64_t ldb )
+{
+    typedef blas::scalar_type<TA, TB> scalar_t;
+
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+    #define B(i_, j_) B[ (i_) + (j_)*ldb ]
+
+    // constants
+    const scalar_t one = 1;
+
+    // op(A) is lower triangular
+    bool lower = ((uplo == Uplo::Lower) == (trans == Op::NoTrans));
+
+    if (side == Side::Left) {
+        if (m <= trsm_nb) {
+            trsm_unblocked( side, uplo, trans, diag, m, n,
+                            alpha, A, lda, B, ldb );
+            return;
+        }
+        int64_t m1 = m/2;
+        int64_t m2 = m - m1;
+        if (lower) {
+            // [ op(A11)  0       ] [ X1 ] = alpha [ B1 ]
+            // [ op(A)21  op(A22) ] [ X2 ]         [ B2 ]
+            TA const* A21 = (trans == Op::NoTrans ? &A(m1, 0) : &A(0, m1));
+            trsm_recursive( side, uplo, trans, diag, m1, n,
+                            alpha, A, lda, B, ldb );
+            gemm< TA, TB, TB >(
+                Layout::ColMajor, trans, Op::NoTrans, m2, n, m1,
+                -one, A21, lda, B, ldb, alpha, &B(m1, 0), ldb );
+            trsm_recursive( side, uplo, trans, diag, m2, n,
+                            one, &A(m1, m1), lda, &B(m1, 0), ldb );
+        }
+        else {
+            // [ op(A11)  op(A)12 ] [ X1 ] = alpha [ B1 ]
+            // [ 0        op(A22) ] [ X2 ]         [ B2 ]
+            TA const* A12 = (trans == Op::NoTrans ? &A(0, m1) : &A(m1, 0));
+            trsm_recursive( side, uplo, trans, diag, m2, n,
+                            alpha, &A(m1, m1), lda, &B(m1, 0), ldb );
+            gemm< TA, TB, TB >(
+                Layout::ColMajor, trans, Op::NoTrans, m1, n, m2,
+                -one, A12, lda, &B(m1, 0), ldb, alpha, B, ldb );
+            trsm_recursive( side, uplo, trans, diag, m1, n,
+                            one, A, lda, B, ldb );
+        }
+    }
+    else { // side == Side::Right
+        if (n <= trsm_nb) {
+            trsm_unblocked( side, uplo, trans, diag, m, n,
+                            alpha, A, lda, B, ldb );
+            return;
+        }
+        int64_t n1 = n/2;
+        int64_t n2 = n - n1;
+        if (lower) {
+            // [ X1 X2 ] [ op(A11)  0       ] = alpha [ B1 B2 ]
+            //           [ op(A)21  op(A22) ]
+            TA const* A21 = (trans == Op::NoTrans ? &A(n1, 0) : &A(0, n1));
+            trsm_recursive( side, uplo, trans, diag, m, n2,
+                            alpha, &A(n1, n1), lda, &B(0, n1), ldb );
+            gemm< TB, TA, TB >(
+                Layout::ColMajor, Op::NoTrans, trans, m, n1, n2,
+                -one, &B(0, n1), ldb, A21, lda, alpha, B, ldb );
+            trsm_recursive( side, uplo, trans, diag, m, n1,
+                            one, A, lda, B, ldb );
+        }
+        else {
+            // [ X1 X2 ] [ op(A11)  op(A)12 ] = alpha [ B1 B2 ]
+            //           [ 0        op(A22) ]
+            TA const* A12 = (trans == Op::NoTrans ? &A(0, n1) : &A(n1, 0));
+            trsm_recursive( side, uplo, trans, diag, m, n1,
+                            alpha, A, lda, B, ldb );
+            gemm< TB, TA, TB >(
+                Layout::ColMajor, Op::NoTrans, trans, m, n2, n1,
+                -one, B, ldb, A12, lda, alpha, &B(0, n1), ldb );
+            trsm_recursive( side, uplo, trans, diag, m, n2,
+                            one, &A(n1, n1), lda, &B(0, n1), ldb );
+        }
+    }
+
+    #undef A
+    #undef B
+}
+
+//------------------------------------------------------------------------------
+/// Number of threads for trsm with a k-by-k triangle and nrhs right-hand
+/// sides: as for gemm, but each thread gets at least trsm_nb
+/// right-hand sides.
+inline int trsm_num_threads( int64_t k, int64_t nrhs )
+{
+    int64_t nthreads = gemm_num_threads( k, nrhs, k );
+    return int( std::max( int64_t( 1 ),
+                          std::min( nthreads, nrhs / trsm_nb ) ) );
+}
+
+}  // namespace internal
+
+
+// =============================================================================
+/// Solve the triangular matrix-vector equation
+/// \[
+///     op(A) X = \alpha B,
+/// \]
+/// or
+/// \[
+///     X op(A) = \alpha B,
+/// \]
+/// where $op(A)$ is one of
+///     $op(A) = A$,
+///     $op(A) = A^T$, or
+///     $op(A) = A^H$,
+/// X and B are m-by-n matrices, and A is an m-by-m or n-by-n, unit or non-unit,
+/// upper or lower triangular matrix.
+///
+/// No test for singularity or near-singularity is included in this
+/// routine. Such tests must be performed before calling this routine.
+/// @see latrs for a more numerically robust implementation.
+///
+/// Generic implementation for arbitrary data types.
+/// Except for small problems, solves recursively, doing most of the work
+/// in the template gemm; with OpenMP, panels of right-hand sides are
+/// solved in parallel.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] side
+///     Whether $op(A)$ is on the left or right of X:
+///     - Side::Left:  $op(A) X = B$.
+///     - Side::Right: $X op(A) = B$.
+///
+/// @param[in] uplo
+///     What part of the matrix A is referenced,
+///     the opposite triangle being assumed to be zero:
+///     - Uplo::Lower: A is lower triangular.
+///     - Uplo::Upper: A is upper triangular.
+///
+/// @param[in] trans
+///     The form of $op(A)$:
+///     - Op::NoTrans:   $op(A) = A$.
+///     - Op::Trans:     $op(A) = A^T$.
+///     - Op::ConjTrans: $op(A) = A^H$.
+///
+/// @param[in] diag
+///     Whether A has a unit or non-unit diagonal:
+///     - Diag::Unit:    A is assumed to be unit triangular.
+///     - Diag::NonUnit: A is not assumed to be unit triangular.
+///
+/// @param[in] m
+///     Number of rows of matrices B and X. m >= 0.
+///
+/// @param[in] n
+///     Number of columns of matrices B and X. n >= 0.
+///
+/// @param[in] alpha
+///     Scalar alpha. If alpha is zero, A is not accessed.
+///
+/// @param[in] A
+///     - If side = Left:
+///       the m-by-m matrix A, stored in an lda-by-m array [RowMajor: m-by-lda].
+///     - If side = Right:
+///       the n-by-n matrix A, stored in an lda-by-n array [RowMajor: n-by-lda].
+///
+/// @param[in] lda
+///     Leading dimension of A.
+///     - If side = left:  lda >= max(1, m).
+///     - If side = right: lda >= max(1, n).
+///
+/// @param[in, out] B
+///     On entry,
+///     the m-by-n matrix B, stored in an ldb-by-n array [RowMajor: m-by-ldb].
+///     On exit, overwritten by the solution matrix X.
+///
+/// @param[in] ldb
+///     Leading dimension of B. ldb >= max(1, m) [RowMajor: ldb >= max(1, n)].
+///
+/// @ingroup trsm
+
+template< typename TA, typename TB >
+void trsm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m,
+    int64_t n,
+    blas::scalar_type<TA, TB> alpha,
+    TA const *A, int64_t lda,
+    TB       *B, int64_t ldb )
+{
+    typedef blas::scalar_type<TA, TB> scalar_t;
+
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+    #define B(i_, j_) B[ (i_) + (j_)*ldb ]
+
+    // constants
+    const scalar_t zero = 0;
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( side != Side::Left &&
+                   side != Side::Right );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( diag != Diag::NonUnit &&
+                   diag != Diag::Unit );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+
+    // adapt if row major
+    if (layout == Layout::RowMajor) {
+        side = (side == Side::Left)
+               ? Side::Right
+               : Side::Left;
+        if (uplo == Uplo::Lower)
+            uplo = Uplo::Upper;
+        else if (uplo == Uplo::Upper)
+            uplo = Uplo::Lower;
+        std::swap( m, n );
+    }
+
+    // check remaining arguments
+    blas_error_if( lda < ((side == Side::Left) ? m : n) );
+    blas_error_if( ldb < m );
+
+    // quick return
+    if (m == 0 || n == 0)
+        return;
+
+    // alpha == zero
+    if (alpha == zero) {
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < m; ++i)
+                B(i, j) = zero;
+        }
+        return;
+    }
+
+    // 16-bit types: compute in float workspace, rounding B once at the end
+    if (is_low_precision<TA>::value || is_low_precision<TB>::value) {
+        int64_t Am = (side == Side::Left ? m : n);
+        std::vector<scalar_t> Aw( size_t(Am)*Am ), Bw( size_t(m)*n );
+        internal::convert_matrix( uplo, Am, Am, A, lda, Aw.data(), Am );
+        internal::convert_matrix( Uplo::General, m, n, B, ldb, Bw.data(), m );
+        trsm( Layout::ColMajor, side, uplo, trans, diag, m, n,
+              alpha, Aw.data(), Am, Bw.data(), m );
+        internal::convert_matrix( Uplo::General, m, n, Bw.data(), m, B, ldb );
+        return;
+    }
+
+    // alpha != zero
+    // Right-hand sides are independent, so with OpenMP each thread solves
+    // a panel of them (columns of B for Left, rows for Right). If there
+    // are too few for that, the gemm updates are parallel instead.
+    int64_t nrhs = (side == Side::Left ? n : m);
+    int64_t k = (side == Side::Left ? m : n);
+    int nthreads = internal::trsm_num_threads( k, nrhs );
+    if (nthreads == 1) {
+        internal::trsm_recursive( side, uplo, trans, diag, m, n,
+                                  alpha, A, lda, B, ldb );
+    }
+    else {
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t begin = nrhs *  t      / nthreads;
+            int64_t end   = nrhs * (t + 1) / nthreads;
+            if (side == Side::Left) {
+                internal::trsm_recursive(
+                    side, uplo, trans, diag, m, end - begin,
+                    alpha, A, lda, &B(0, begin), ldb );
+            }
+            else {
+                internal::trsm_recursive(
+                    side, uplo, trans, diag, end - begin, n,
+                    alpha, A, lda, &B(begin, 0), ldb );
+            }
+        }
+    }
+
     #undef A
     #undef B
 }
@@ -9,6 +9,8 @@
 #include <exception>
 #include <complex>
 #include <cstdarg>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <vector>
 
@@ -138,6 +140,35 @@ inline Format char2format( char format )
     return Format( format );
 }
 
+namespace batch {
+
+// -----------------------------------------------------------------------------
+/// Order in which host batch routines run the problems in a batch.
+enum class Schedule : char {
+    InOrder  = 'I',  ///< Input order, dynamically scheduled over threads.
+    Balanced = 'B',  ///< Largest first; big problems use a threaded BLAS.
+};
+
+inline char schedule2char( Schedule schedule ) { return char(schedule); }
+
+inline const char* schedule2str( Schedule schedule )
+{
+    switch (schedule) {
+        case Schedule::InOrder:  return "inorder";
+        case Schedule::Balanced: return "balanced";
+    }
+    return "";
+}
+
+inline Schedule char2schedule( char schedule )
+{
+    schedule = (char) toupper( schedule );
+    assert( schedule == 'I' || schedule == 'B' );
+    return Schedule( schedule );
+}
+
+}  // namespace batch
+
 // -----------------------------------------------------------------------------
 /// Exception class for BLAS errors.
 class Error: public std::exception {
@@ -207,6 +238,288 @@ struct is_complex< std::complex<T> >:
     std::integral_constant<bool, true>
 {};
 
+//==============================================================================
+// 16-bit floating point types.
+//
+// float16 (IEEE binary16) and bfloat16 (the upper half of IEEE binary32)
+// are storage types: they convert implicitly to and from float, and
+// arithmetic on them is done in float. Routines on 16-bit data, such as
+// blas::gemm< float16, float16, float >, compute and accumulate in float,
+// since scalar_type< float16 > is float; see below.
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return bits of x as float16, rounded to nearest, ties to even.
+/// Overflow gives Inf; NaN gives a quiet NaN.
+/// From F. Giesen, "float->half variants", 2016.
+inline uint16_t float_to_float16_bits( float x )
+{
+    uint32_t f;
+    std::memcpy( &f, &x, sizeof(f) );
+    uint32_t sign = f & 0x80000000u;
+    f ^= sign;
+
+    uint16_t h;
+    if (f >= 0x47800000u) {
+        // |x| >= 2^16 or x is Inf or NaN
+        h = (f > 0x7f800000u ? 0x7e00 : 0x7c00);
+    }
+    else if (f < 0x38800000u) {
+        // |x| < 2^-14, subnormal or zero: aligning the mantissa by adding
+        // 0.5 rounds in the FPU, then the bits are the result.
+        const uint32_t magic_bits = 0x3f000000u;  // 0.5
+        float magic, y;
+        std::memcpy( &magic, &magic_bits, sizeof(magic) );
+        std::memcpy( &y, &f, sizeof(y) );
+        y += magic;
+        std::memcpy( &f, &y, sizeof(f) );
+        h = uint16_t( f - magic_bits );
+    }
+    else {
+        // normal: rebias exponent, then round mantissa to nearest even;
+        // a carry out of the mantissa correctly rounds up to Inf.
+        uint32_t mant_odd = (f >> 13) & 1;
+        f += 0xc8000fffu + mant_odd;  // (15 - 127) << 23, plus rounding
+        h = uint16_t( f >> 13 );
+    }
+    return uint16_t( h | (sign >> 16) );
+}
+
+//------------------------------------------------------------------------------
+/// @return float value of float16 bits h, which is exact.
+inline float float16_bits_to_float( uint16_t h )
+{
+    const uint32_t shifted_exp = 0x7c00u << 13;
+    uint32_t f = uint32_t( h & 0x7fff ) << 13;
+    uint32_t exp = f & shifted_exp;
+    f += (127 - 15) << 23;
+    if (exp == shifted_exp) {
+        // Inf or NaN
+        f += (128 - 16) << 23;
+    }
+    else if (exp == 0) {
+        // zero or subnormal: renormalize in the FPU
+        const uint32_t magic_bits = 113u << 23;  // 2^-14
+        float magic, y;
+        f += 1 << 23;
+        std::memcpy( &magic, &magic_bits, sizeof(magic) );
+        std::memcpy( &y, &f, sizeof(y) );
+        y -= magic;
+        std::memcpy( &f, &y, sizeof(f) );
+    }
+    f |= uint32_t( h & 0x8000 ) << 16;
+
+    float x;
+    std::memcpy( &x, &f, sizeof(x) );
+    return x;
+}
+
+//------------------------------------------------------------------------------
+/// @return bits of x as bfloat16, rounded to nearest, ties to even.
+/// NaN gives a quiet NaN.
+inline uint16_t float_to_bfloat16_bits( float x )
+{
+    uint32_t f;
+    std::memcpy( &f, &x, sizeof(f) );
+    if ((f & 0x7fffffffu) > 0x7f800000u)
+        return uint16_t( (f >> 16) | 0x0040 );
+    f += 0x7fffu + ((f >> 16) & 1);
+    return uint16_t( f >> 16 );
+}
+
+//------------------------------------------------------------------------------
+/// @return float value of bfloat16 bits h, which is exact.
+inline float bfloat16_bits_to_float( uint16_t h )
+{
+    uint32_t f = uint32_t( h ) << 16;
+    float x;
+    std::memcpy( &x, &f, sizeof(x) );
+    return x;
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// IEEE 754 binary16 (half precision) floating point number:
+/// 1 sign, 5 exponent, and 10 mantissa bits.
+class float16
+{
+public:
+    /// Uninitialized, like float.
+    float16() = default;
+
+    /// Rounds x to nearest float16. A double is first rounded to float.
+    float16( float x ):
+        bits_( internal::float_to_float16_bits( x ) )
+    {}
+
+    operator float() const
+        { return internal::float16_bits_to_float( bits_ ); }
+
+    float16& operator += ( float x ) { return *this = float( *this ) + x; }
+    float16& operator -= ( float x ) { return *this = float( *this ) - x; }
+    float16& operator *= ( float x ) { return *this = float( *this ) * x; }
+    float16& operator /= ( float x ) { return *this = float( *this ) / x; }
+
+    /// @return float16 with given IEEE binary16 bit pattern.
+    static float16 from_bits( uint16_t bits )
+    {
+        float16 x;
+        x.bits_ = bits;
+        return x;
+    }
+
+    uint16_t bits() const { return bits_; }
+
+private:
+    uint16_t bits_;
+};
+
+//------------------------------------------------------------------------------
+/// bfloat16 (brain floating point) number: 1 sign, 8 exponent,
+/// and 7 mantissa bits; the same range as float with less precision.
+class bfloat16
+{
+public:
+    /// Uninitialized, like float.
+    bfloat16() = default;
+
+    /// Rounds x to nearest bfloat16. A double is first rounded to float.
+    bfloat16( float x ):
+        bits_( internal::float_to_bfloat16_bits( x ) )
+    {}
+
+    operator float() const
+        { return internal::bfloat16_bits_to_float( bits_ ); }
+
+    bfloat16& operator += ( float x ) { return *this = float( *this ) + x; }
+    bfloat16& operator -= ( float x ) { return *this = float( *this ) - x; }
+    bfloat16& operator *= ( float x ) { return *this = float( *this ) * x; }
+    bfloat16& operator /= ( float x ) { return *this = float( *this ) / x; }
+
+    /// @return bfloat16 with given bit pattern.
+    static bfloat16 from_bits( uint16_t bits )
+    {
+        bfloat16 x;
+        x.bits_ = bits;
+        return x;
+    }
+
+    uint16_t bits() const { return bits_; }
+
+private:
+    uint16_t bits_;
+};
+
+static_assert( sizeof(float16)  == 2, "float16 must be 2 bytes" );
+static_assert( sizeof(bfloat16) == 2, "bfloat16 must be 2 bytes" );
+
+//------------------------------------------------------------------------------
+/// True if T is a 16-bit floating point type, float16 or bfloat16.
+template <typename T>
+struct is_low_precision:
+    std::integral_constant<bool, false>
+{};
+
+template <>
+struct is_low_precision< float16 >:
+    std::integral_constant<bool, true>
+{};
+
+template <>
+struct is_low_precision< bfloat16 >:
+    std::integral_constant<bool, true>
+{};
+
+}  // namespace blas
+
+//------------------------------------------------------------------------------
+// numeric_limits for the 16-bit types, as for float.
+namespace std {
+
+template <>
+class numeric_limits< blas::float16 >
+{
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr float_denorm_style has_denorm = denorm_present;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr float_round_style round_style = round_to_nearest;
+    static constexpr bool is_iec559 = true;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr int digits = 11;
+    static constexpr int digits10 = 3;
+    static constexpr int max_digits10 = 5;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = -13;
+    static constexpr int min_exponent10 = -4;
+    static constexpr int max_exponent = 16;
+    static constexpr int max_exponent10 = 4;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    static blas::float16 min()           { return blas::float16::from_bits( 0x0400 ); }
+    static blas::float16 lowest()        { return blas::float16::from_bits( 0xfbff ); }
+    static blas::float16 max()           { return blas::float16::from_bits( 0x7bff ); }
+    static blas::float16 epsilon()       { return blas::float16::from_bits( 0x1400 ); }
+    static blas::float16 round_error()   { return blas::float16::from_bits( 0x3800 ); }
+    static blas::float16 infinity()      { return blas::float16::from_bits( 0x7c00 ); }
+    static blas::float16 quiet_NaN()     { return blas::float16::from_bits( 0x7e00 ); }
+    static blas::float16 signaling_NaN() { return blas::float16::from_bits( 0x7d00 ); }
+    static blas::float16 denorm_min()    { return blas::float16::from_bits( 0x0001 ); }
+};
+
+template <>
+class numeric_limits< blas::bfloat16 >
+{
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr float_denorm_style has_denorm = denorm_present;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr float_round_style round_style = round_to_nearest;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr int digits = 8;
+    static constexpr int digits10 = 2;
+    static constexpr int max_digits10 = 4;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = -125;
+    static constexpr int min_exponent10 = -37;
+    static constexpr int max_exponent = 128;
+    static constexpr int max_exponent10 = 38;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    static blas::bfloat16 min()           { return blas::bfloat16::from_bits( 0x0080 ); }
+    static blas::bfloat16 lowest()        { return blas::bfloat16::from_bits( 0xff7f ); }
+    static blas::bfloat16 max()           { return blas::bfloat16::from_bits( 0x7f7f ); }
+    static blas::bfloat16 epsilon()       { return blas::bfloat16::from_bits( 0x3c00 ); }
+    static blas::bfloat16 round_error()   { return blas::bfloat16::from_bits( 0x3f00 ); }
+    static blas::bfloat16 infinity()      { return blas::bfloat16::from_bits( 0x7f80 ); }
+    static blas::bfloat16 quiet_NaN()     { return blas::bfloat16::from_bits( 0x7fc0 ); }
+    static blas::bfloat16 signaling_NaN() { return blas::bfloat16::from_bits( 0x7fa0 ); }
+    static blas::bfloat16 denorm_min()    { return blas::bfloat16::from_bits( 0x0001 ); }
+};
+
+}  // namespace std
+
+namespace blas {
+
 // -----------------------------------------------------------------------------
 // Previously extended real and imag to real types. Belatedly discovered that
 // C++11 extends std::real and std::imag to float and integer types,
@@ -259,12 +572,28 @@ struct scalar_type_traits< T >
     using type = decay_t<T>;
 };
 
+// 16-bit types compute in float
+template<>
+struct scalar_type_traits< float16 >
+{
+    using type = float;
+};
+
+template<>
+struct scalar_type_traits< bfloat16 >
+{
+    using type = float;
+};
+
 // for two types
-// relies on type of ?: operator being the common type of its two arguments
+// relies on type of ?: operator being the common type of its two arguments.
+// Each type is first mapped to its one-type scalar_type, so 16-bit types
+// promote to float rather than being ambiguous with it.
 template< typename T1, typename T2 >
 struct scalar_type_traits< T1, T2 >
 {
-    using type = decay_t< decltype( true ? std::declval<T1>() : std::declval<T2>() ) >;
+    using type = decay_t< decltype( true ? std::declval< scalar_type<T1> >()
+                                         : std::declval< scalar_type<T2> >() ) >;
 };
 
 // for either or both complex,
@@ -302,6 +631,7 @@ struct scalar_type_traits< T1, T2, Types... >
 // real_type< float, double, complex<float> >       is double
 //
 // scalar_type< float >                             is float
+// scalar_type< float16 >                           is float
 // scalar_type< float, complex<float> >             is complex<float>
 // scalar_type< float, double, complex<float> >     is complex<double>
 //
@@ -335,6 +665,19 @@ struct real_type_traits< std::complex<T> >
     using real_t = T;
 };
 
+// 16-bit types compute in float
+template<>
+struct real_type_traits< float16 >
+{
+    using real_t = float;
+};
+
+template<>
+struct real_type_traits< bfloat16 >
+{
+    using real_t = float;
+};
+
 // for two or more types
 template< typename T1, typename... Types >
 struct real_type_traits< T1, Types... >
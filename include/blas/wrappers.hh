@@ -332,6 +332,55 @@ void swap(
 // =============================================================================
 // Level 2 BLAS
 
+// -----------------------------------------------------------------------------
+/// @ingroup gbmv
+void gbmv(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    int64_t kl, int64_t ku,
+    float alpha,
+    float const *A, int64_t lda,
+    float const *x, int64_t incx,
+    float beta,
+    float       *y, int64_t incy );
+
+/// @ingroup gbmv
+void gbmv(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    int64_t kl, int64_t ku,
+    double alpha,
+    double const *A, int64_t lda,
+    double const *x, int64_t incx,
+    double beta,
+    double       *y, int64_t incy );
+
+/// @ingroup gbmv
+void gbmv(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    int64_t kl, int64_t ku,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda,
+    std::complex<float> const *x, int64_t incx,
+    std::complex<float> beta,
+    std::complex<float>       *y, int64_t incy );
+
+/// @ingroup gbmv
+void gbmv(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    int64_t kl, int64_t ku,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda,
+    std::complex<double> const *x, int64_t incx,
+    std::complex<double> beta,
+    std::complex<double>       *y, int64_t incy );
+
 // -----------------------------------------------------------------------------
 /// @ingroup gemv
 void gemv(
@@ -451,6 +500,51 @@ void geru(
     std::complex<double> const *y, int64_t incy,
     std::complex<double>       *A, int64_t lda );
 
+// -----------------------------------------------------------------------------
+/// @ingroup hbmv
+void hbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda,
+    float const *x, int64_t incx,
+    float beta,
+    float       *y, int64_t incy );
+
+/// @ingroup hbmv
+void hbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda,
+    double const *x, int64_t incx,
+    double beta,
+    double       *y, int64_t incy );
+
+/// @ingroup hbmv
+void hbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda,
+    std::complex<float> const *x, int64_t incx,
+    std::complex<float> beta,
+    std::complex<float>       *y, int64_t incy );
+
+/// @ingroup hbmv
+void hbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda,
+    std::complex<double> const *x, int64_t incx,
+    std::complex<double> beta,
+    std::complex<double>       *y, int64_t incy );
+
 // -----------------------------------------------------------------------------
 /// @ingroup hemv
 void hemv(
@@ -574,6 +668,29 @@ void her2(
     std::complex<double> const *y, int64_t incy,
     std::complex<double>       *A, int64_t lda );
 
+// -----------------------------------------------------------------------------
+/// @ingroup sbmv
+void sbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda,
+    float const *x, int64_t incx,
+    float beta,
+    float       *y, int64_t incy );
+
+/// @ingroup sbmv
+void sbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda,
+    double const *x, int64_t incx,
+    double beta,
+    double       *y, int64_t incy );
+
 // -----------------------------------------------------------------------------
 /// @ingroup symv
 void symv(
@@ -680,6 +797,88 @@ void syr2(
     std::complex<double> const *y, int64_t incy,
     std::complex<double>       *A, int64_t lda );
 
+// -----------------------------------------------------------------------------
+/// @ingroup tbmv
+void tbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t n, int64_t k,
+    float const *A, int64_t lda,
+    float       *x, int64_t incx );
+
+/// @ingroup tbmv
+void tbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t n, int64_t k,
+    double const *A, int64_t lda,
+    double       *x, int64_t incx );
+
+/// @ingroup tbmv
+void tbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t n, int64_t k,
+    std::complex<float> const *A, int64_t lda,
+    std::complex<float>       *x, int64_t incx );
+
+/// @ingroup tbmv
+void tbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t n, int64_t k,
+    std::complex<double> const *A, int64_t lda,
+    std::complex<double>       *x, int64_t incx );
+
+// -----------------------------------------------------------------------------
+/// @ingroup tbsv
+void tbsv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t n, int64_t k,
+    float const *A, int64_t lda,
+    float       *x, int64_t incx );
+
+/// @ingroup tbsv
+void tbsv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t n, int64_t k,
+    double const *A, int64_t lda,
+    double       *x, int64_t incx );
+
+/// @ingroup tbsv
+void tbsv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t n, int64_t k,
+    std::complex<float> const *A, int64_t lda,
+    std::complex<float>       *x, int64_t incx );
+
+/// @ingroup tbsv
+void tbsv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t n, int64_t k,
+    std::complex<double> const *A, int64_t lda,
+    std::complex<double>       *x, int64_t incx );
+
 // -----------------------------------------------------------------------------
 /// @ingroup trmv
 void trmv(
@@ -766,48 +965,52 @@ void trsv(
 // Level 3 BLAS
 
 // -----------------------------------------------------------------------------
-/// @ingroup gemm
-void gemm(
+/// @ingroup gbmm
+void gbmm(
     blas::Layout layout,
     blas::Op transA,
     blas::Op transB,
     int64_t m, int64_t n, int64_t k,
+    int64_t kl, int64_t ku,
     float alpha,
     float const *A, int64_t lda,
     float const *B, int64_t ldb,
     float beta,
     float       *C, int64_t ldc );
 
-/// @ingroup gemm
-void gemm(
+/// @ingroup gbmm
+void gbmm(
     blas::Layout layout,
     blas::Op transA,
     blas::Op transB,
     int64_t m, int64_t n, int64_t k,
+    int64_t kl, int64_t ku,
     double alpha,
     double const *A, int64_t lda,
     double const *B, int64_t ldb,
     double beta,
     double       *C, int64_t ldc );
 
-/// @ingroup gemm
-void gemm(
+/// @ingroup gbmm
+void gbmm(
     blas::Layout layout,
     blas::Op transA,
     blas::Op transB,
     int64_t m, int64_t n, int64_t k,
+    int64_t kl, int64_t ku,
     std::complex<float> alpha,
     std::complex<float> const *A, int64_t lda,
     std::complex<float> const *B, int64_t ldb,
     std::complex<float> beta,
     std::complex<float>       *C, int64_t ldc );
 
-/// @ingroup gemm
-void gemm(
+/// @ingroup gbmm
+void gbmm(
     blas::Layout layout,
     blas::Op transA,
     blas::Op transB,
     int64_t m, int64_t n, int64_t k,
+    int64_t kl, int64_t ku,
     std::complex<double> alpha,
     std::complex<double> const *A, int64_t lda,
     std::complex<double> const *B, int64_t ldb,
@@ -815,60 +1018,91 @@ void gemm(
     std::complex<double>       *C, int64_t ldc );
 
 // -----------------------------------------------------------------------------
-/// @ingroup hemm
-void hemm(
+/// @ingroup gemm
+void gemm(
     blas::Layout layout,
-    blas::Side side,
-    blas::Uplo uplo,
-    int64_t m, int64_t n,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
     float alpha,
     float const *A, int64_t lda,
     float const *B, int64_t ldb,
     float beta,
     float       *C, int64_t ldc );
 
-/// @ingroup hemm
-void hemm(
+/// @ingroup gemm
+void gemm(
     blas::Layout layout,
-    blas::Side side,
-    blas::Uplo uplo,
-    int64_t m, int64_t n,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
     double alpha,
     double const *A, int64_t lda,
     double const *B, int64_t ldb,
     double beta,
     double       *C, int64_t ldc );
 
-/// @ingroup hemm
-void hemm(
+/// @ingroup gemm
+void gemm(
     blas::Layout layout,
-    blas::Side side,
-    blas::Uplo uplo,
-    int64_t m, int64_t n,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
     std::complex<float> alpha,
     std::complex<float> const *A, int64_t lda,
     std::complex<float> const *B, int64_t ldb,
     std::complex<float> beta,
     std::complex<float>       *C, int64_t ldc );
 
-/// @ingroup hemm
-void hemm(
+/// @ingroup gemm
+void gemm(
     blas::Layout layout,
-    blas::Side side,
-    blas::Uplo uplo,
-    int64_t m, int64_t n,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
     std::complex<double> alpha,
     std::complex<double> const *A, int64_t lda,
     std::complex<double> const *B, int64_t ldb,
     std::complex<double> beta,
     std::complex<double>       *C, int64_t ldc );
 
+// Integer gemm: int8 x int8 and uint8 x int8, accumulated in int32,
+// with optional zero points for rows of op(A) and columns of op(B).
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int32_t alpha,
+    int8_t const *A, int64_t lda,
+    int8_t const *B, int64_t ldb,
+    int32_t beta,
+    int32_t      *C, int64_t ldc,
+    int32_t const *A_zero = nullptr,
+    int32_t const *B_zero = nullptr );
+
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int32_t alpha,
+    uint8_t const *A, int64_t lda,
+    int8_t  const *B, int64_t ldb,
+    int32_t beta,
+    int32_t      *C, int64_t ldc,
+    int32_t const *A_zero = nullptr,
+    int32_t const *B_zero = nullptr );
+
 // -----------------------------------------------------------------------------
-/// @ingroup her2k
-void her2k(
+/// @ingroup gemmt
+void gemmt(
     blas::Layout layout,
     blas::Uplo uplo,
-    blas::Op trans,
+    blas::Op transA,
+    blas::Op transB,
     int64_t n, int64_t k,
     float alpha,
     float const *A, int64_t lda,
@@ -876,11 +1110,12 @@ void her2k(
     float beta,
     float       *C, int64_t ldc );
 
-/// @ingroup her2k
-void her2k(
+/// @ingroup gemmt
+void gemmt(
     blas::Layout layout,
     blas::Uplo uplo,
-    blas::Op trans,
+    blas::Op transA,
+    blas::Op transB,
     int64_t n, int64_t k,
     double alpha,
     double const *A, int64_t lda,
@@ -888,37 +1123,137 @@ void her2k(
     double beta,
     double       *C, int64_t ldc );
 
-/// @ingroup her2k
-void her2k(
+/// @ingroup gemmt
+void gemmt(
     blas::Layout layout,
     blas::Uplo uplo,
-    blas::Op trans,
+    blas::Op transA,
+    blas::Op transB,
     int64_t n, int64_t k,
-    std::complex<float> alpha,  // note: complex
+    std::complex<float> alpha,
     std::complex<float> const *A, int64_t lda,
     std::complex<float> const *B, int64_t ldb,
-    float beta,   // note: real
+    std::complex<float> beta,
     std::complex<float>       *C, int64_t ldc );
 
-/// @ingroup her2k
-void her2k(
+/// @ingroup gemmt
+void gemmt(
     blas::Layout layout,
     blas::Uplo uplo,
-    blas::Op trans,
+    blas::Op transA,
+    blas::Op transB,
     int64_t n, int64_t k,
-    std::complex<double> alpha,  // note: complex
+    std::complex<double> alpha,
     std::complex<double> const *A, int64_t lda,
     std::complex<double> const *B, int64_t ldb,
-    double beta,  // note: real
+    std::complex<double> beta,
     std::complex<double>       *C, int64_t ldc );
 
 // -----------------------------------------------------------------------------
-/// @ingroup herk
-void herk(
+/// @ingroup hemm
+void hemm(
     blas::Layout layout,
+    blas::Side side,
     blas::Uplo uplo,
-    blas::Op trans,
-    int64_t n, int64_t k,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *A, int64_t lda,
+    float const *B, int64_t ldb,
+    float beta,
+    float       *C, int64_t ldc );
+
+/// @ingroup hemm
+void hemm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *A, int64_t lda,
+    double const *B, int64_t ldb,
+    double beta,
+    double       *C, int64_t ldc );
+
+/// @ingroup hemm
+void hemm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda,
+    std::complex<float> const *B, int64_t ldb,
+    std::complex<float> beta,
+    std::complex<float>       *C, int64_t ldc );
+
+/// @ingroup hemm
+void hemm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda,
+    std::complex<double> const *B, int64_t ldb,
+    std::complex<double> beta,
+    std::complex<double>       *C, int64_t ldc );
+
+// -----------------------------------------------------------------------------
+/// @ingroup her2k
+void her2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda,
+    float const *B, int64_t ldb,
+    float beta,
+    float       *C, int64_t ldc );
+
+/// @ingroup her2k
+void her2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda,
+    double const *B, int64_t ldb,
+    double beta,
+    double       *C, int64_t ldc );
+
+/// @ingroup her2k
+void her2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,  // note: complex
+    std::complex<float> const *A, int64_t lda,
+    std::complex<float> const *B, int64_t ldb,
+    float beta,   // note: real
+    std::complex<float>       *C, int64_t ldc );
+
+/// @ingroup her2k
+void her2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,  // note: complex
+    std::complex<double> const *A, int64_t lda,
+    std::complex<double> const *B, int64_t ldb,
+    double beta,  // note: real
+    std::complex<double>       *C, int64_t ldc );
+
+// -----------------------------------------------------------------------------
+/// @ingroup herk
+void herk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
     float alpha,
     float const *A, int64_t lda,
     float beta,
@@ -1213,6 +1548,9 @@ void trsm(
 // =============================================================================
 namespace batch {
 
+// Host batch routines take an optional schedule; see blas::batch::Schedule.
+// Schedule::Balanced helps batches that mix small and large problems.
+
 // -----------------------------------------------------------------------------
 // batch gemm
 void gemm(
@@ -1227,7 +1565,8 @@ void gemm(
     std::vector<float*>   const &Barray, std::vector<int64_t> const &lddb,
     std::vector<float >   const &beta,
     std::vector<float*>   const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                  std::vector<int64_t>       &info );
+    const size_t batch,                  std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void gemm(
     blas::Layout                layout,
@@ -1241,7 +1580,8 @@ void gemm(
     std::vector<double*>  const &Barray, std::vector<int64_t>  const &lddb,
     std::vector<double >  const &beta,
     std::vector<double*>  const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                  std::vector<int64_t>       &info );
+    const size_t batch,                  std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void gemm(
     blas::Layout                layout,
@@ -1255,7 +1595,8 @@ void gemm(
     std::vector< std::complex<float>* >   const &Barray, std::vector<int64_t> const &lddb,
     std::vector< std::complex<float>  >   const &beta,
     std::vector< std::complex<float>* >   const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                                  std::vector<int64_t>  &info );
+    const size_t batch,                                  std::vector<int64_t>  &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void gemm(
     blas::Layout                layout,
@@ -1269,7 +1610,8 @@ void gemm(
     std::vector< std::complex<double>* >   const &Barray, std::vector<int64_t> const &lddb,
     std::vector< std::complex<double>  >   const &beta,
     std::vector< std::complex<double>* >   const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                                   std::vector<int64_t>       &info );
+    const size_t batch,                                   std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 // -----------------------------------------------------------------------------
 // batch trsm
@@ -1284,7 +1626,8 @@ void trsm(
     std::vector<float >     const &alpha,
     std::vector<float*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<float*>     const &Barray, std::vector<int64_t> const &lddb,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void trsm(
     blas::Layout                   layout,
@@ -1297,7 +1640,8 @@ void trsm(
     std::vector<double >     const &alpha,
     std::vector<double*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<double*>     const &Barray, std::vector<int64_t> const &lddb,
-    const size_t batch,                     std::vector<int64_t>       &info );
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void trsm(
     blas::Layout                   layout,
@@ -1310,7 +1654,8 @@ void trsm(
     std::vector<std::complex<float> >     const &alpha,
     std::vector<std::complex<float>*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<std::complex<float>*>     const &Barray, std::vector<int64_t> const &lddb,
-    const size_t batch,                     std::vector<int64_t>       &info );
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void trsm(
     blas::Layout                   layout,
@@ -1323,7 +1668,8 @@ void trsm(
     std::vector<std::complex<double> >     const &alpha,
     std::vector<std::complex<double>*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<std::complex<double>*>     const &Barray, std::vector<int64_t> const &lddb,
-    const size_t batch,                     std::vector<int64_t>       &info );
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 // -----------------------------------------------------------------------------
 // batch trmm
@@ -1338,7 +1684,8 @@ void trmm(
     std::vector<float >     const &alpha,
     std::vector<float*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<float*>     const &Barray, std::vector<int64_t> const &lddb,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void trmm(
     blas::Layout                   layout,
@@ -1351,7 +1698,8 @@ void trmm(
     std::vector<double >     const &alpha,
     std::vector<double*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<double*>     const &Barray, std::vector<int64_t> const &lddb,
-    const size_t batch,                     std::vector<int64_t>       &info );
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void trmm(
     blas::Layout                   layout,
@@ -1364,7 +1712,8 @@ void trmm(
     std::vector<std::complex<float> >     const &alpha,
     std::vector<std::complex<float>*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<std::complex<float>*>     const &Barray, std::vector<int64_t> const &lddb,
-    const size_t batch,                     std::vector<int64_t>       &info );
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void trmm(
     blas::Layout                   layout,
@@ -1377,7 +1726,70 @@ void trmm(
     std::vector<std::complex<double> >     const &alpha,
     std::vector<std::complex<double>*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<std::complex<double>*>     const &Barray, std::vector<int64_t> const &lddb,
-    const size_t batch,                     std::vector<int64_t>       &info );
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
+
+// -----------------------------------------------------------------------------
+// batch gemmt
+void gemmt(
+    blas::Layout                   layout,
+    std::vector<blas::Uplo> const &uplo,
+    std::vector<blas::Op>   const &transA,
+    std::vector<blas::Op>   const &transB,
+    std::vector<int64_t>    const &n,
+    std::vector<int64_t>    const &k,
+    std::vector< float  > const &alpha,
+    std::vector< float* > const &Aarray, std::vector<int64_t> const &ldda,
+    std::vector< float* > const &Barray, std::vector<int64_t> const &lddb,
+    std::vector< float  > const &beta,
+    std::vector< float* > const &Carray, std::vector<int64_t> const &lddc,
+    const size_t batch, std::vector<int64_t> &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
+
+void gemmt(
+    blas::Layout                   layout,
+    std::vector<blas::Uplo> const &uplo,
+    std::vector<blas::Op>   const &transA,
+    std::vector<blas::Op>   const &transB,
+    std::vector<int64_t>    const &n,
+    std::vector<int64_t>    const &k,
+    std::vector< double  > const &alpha,
+    std::vector< double* > const &Aarray, std::vector<int64_t> const &ldda,
+    std::vector< double* > const &Barray, std::vector<int64_t> const &lddb,
+    std::vector< double  > const &beta,
+    std::vector< double* > const &Carray, std::vector<int64_t> const &lddc,
+    const size_t batch, std::vector<int64_t> &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
+
+void gemmt(
+    blas::Layout                   layout,
+    std::vector<blas::Uplo> const &uplo,
+    std::vector<blas::Op>   const &transA,
+    std::vector<blas::Op>   const &transB,
+    std::vector<int64_t>    const &n,
+    std::vector<int64_t>    const &k,
+    std::vector< std::complex<float>  > const &alpha,
+    std::vector< std::complex<float>* > const &Aarray, std::vector<int64_t> const &ldda,
+    std::vector< std::complex<float>* > const &Barray, std::vector<int64_t> const &lddb,
+    std::vector< std::complex<float>  > const &beta,
+    std::vector< std::complex<float>* > const &Carray, std::vector<int64_t> const &lddc,
+    const size_t batch, std::vector<int64_t> &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
+
+void gemmt(
+    blas::Layout                   layout,
+    std::vector<blas::Uplo> const &uplo,
+    std::vector<blas::Op>   const &transA,
+    std::vector<blas::Op>   const &transB,
+    std::vector<int64_t>    const &n,
+    std::vector<int64_t>    const &k,
+    std::vector< std::complex<double>  > const &alpha,
+    std::vector< std::complex<double>* > const &Aarray, std::vector<int64_t> const &ldda,
+    std::vector< std::complex<double>* > const &Barray, std::vector<int64_t> const &lddb,
+    std::vector< std::complex<double>  > const &beta,
+    std::vector< std::complex<double>* > const &Carray, std::vector<int64_t> const &lddc,
+    const size_t batch, std::vector<int64_t> &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 // -----------------------------------------------------------------------------
 // batch hemm
@@ -1392,7 +1804,8 @@ void hemm(
     std::vector<float*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<float >     const &beta,
     std::vector<float*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void hemm(
     blas::Layout                    layout,
@@ -1405,7 +1818,8 @@ void hemm(
     std::vector<double*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<double >     const &beta,
     std::vector<double*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void hemm(
     blas::Layout                    layout,
@@ -1418,7 +1832,8 @@ void hemm(
     std::vector<std::complex<float>*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<std::complex<float> >     const &beta,
     std::vector<std::complex<float>*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void hemm(
     blas::Layout                    layout,
@@ -1431,7 +1846,8 @@ void hemm(
     std::vector<std::complex<double>*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<std::complex<double> >     const &beta,
     std::vector<std::complex<double>*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 // -----------------------------------------------------------------------------
 // batch symm
@@ -1446,7 +1862,8 @@ void symm(
     std::vector<float*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<float >     const &beta,
     std::vector<float*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void symm(
     blas::Layout                    layout,
@@ -1459,7 +1876,8 @@ void symm(
     std::vector<double*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<double >     const &beta,
     std::vector<double*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void symm(
     blas::Layout                    layout,
@@ -1472,7 +1890,8 @@ void symm(
     std::vector<std::complex<float>*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<std::complex<float> >     const &beta,
     std::vector<std::complex<float>*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void symm(
     blas::Layout                    layout,
@@ -1485,7 +1904,8 @@ void symm(
     std::vector<std::complex<double>*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<std::complex<double> >     const &beta,
     std::vector<std::complex<double>*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 // -----------------------------------------------------------------------------
 // batch herk
@@ -1499,7 +1919,8 @@ void herk(
     std::vector<float*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<float >     const &beta,
     std::vector<float*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void herk(
     blas::Layout                    layout,
@@ -1511,7 +1932,8 @@ void herk(
     std::vector<double*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<double >     const &beta,
     std::vector<double*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                     std::vector<int64_t>       &info );
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void herk(
     blas::Layout                    layout,
@@ -1523,7 +1945,8 @@ void herk(
     std::vector<std::complex<float>*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<float >      const &beta,
     std::vector<std::complex<float>*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch, std::vector<int64_t>       &info );
+    const size_t batch, std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void herk(
     blas::Layout                    layout,
@@ -1535,7 +1958,8 @@ void herk(
     std::vector<std::complex<double>*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<double >     const &beta,
     std::vector<std::complex<double>*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch, std::vector<int64_t>       &info );
+    const size_t batch, std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 // -----------------------------------------------------------------------------
 // batch syrk
@@ -1549,7 +1973,8 @@ void syrk(
     std::vector<float*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<float >     const &beta,
     std::vector<float*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void syrk(
     blas::Layout                    layout,
@@ -1561,7 +1986,8 @@ void syrk(
     std::vector<double*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<double >     const &beta,
     std::vector<double*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                     std::vector<int64_t>       &info );
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void syrk(
     blas::Layout                    layout,
@@ -1573,7 +1999,8 @@ void syrk(
     std::vector<std::complex<float>*> const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<std::complex<float> > const &beta,
     std::vector<std::complex<float>*> const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch, std::vector<int64_t>       &info );
+    const size_t batch, std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void syrk(
     blas::Layout                    layout,
@@ -1585,7 +2012,8 @@ void syrk(
     std::vector<std::complex<double>*> const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<std::complex<double> > const &beta,
     std::vector<std::complex<double>*> const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch, std::vector<int64_t>       &info );
+    const size_t batch, std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 // -----------------------------------------------------------------------------
 // batch her2k
@@ -1600,7 +2028,8 @@ void her2k(
     std::vector<float*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<float >     const &beta,
     std::vector<float*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void her2k(
     blas::Layout                    layout,
@@ -1613,7 +2042,8 @@ void her2k(
     std::vector<double*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<double >     const &beta,
     std::vector<double*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                     std::vector<int64_t>       &info );
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void her2k(
     blas::Layout                    layout,
@@ -1626,7 +2056,8 @@ void her2k(
     std::vector<std::complex<float>*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<float >                   const &beta,
     std::vector<std::complex<float>*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch, std::vector<int64_t>       &info );
+    const size_t batch, std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void her2k(
     blas::Layout                    layout,
@@ -1639,7 +2070,8 @@ void her2k(
     std::vector<std::complex<double>*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<double >                   const &beta,
     std::vector<std::complex<double>*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch, std::vector<int64_t>       &info );
+    const size_t batch, std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 // -----------------------------------------------------------------------------
 // batch syr2k
@@ -1654,7 +2086,8 @@ void syr2k(
     std::vector<float*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<float >     const &beta,
     std::vector<float*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info );
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void syr2k(
     blas::Layout                    layout,
@@ -1667,7 +2100,8 @@ void syr2k(
     std::vector<double*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<double >     const &beta,
     std::vector<double*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                     std::vector<int64_t>       &info );
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void syr2k(
     blas::Layout                    layout,
@@ -1680,7 +2114,8 @@ void syr2k(
     std::vector<std::complex<float>*> const &Barray, std::vector<int64_t> const &lddb,
     std::vector<std::complex<float> > const &beta,
     std::vector<std::complex<float>*> const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch, std::vector<int64_t>       &info );
+    const size_t batch, std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
 
 void syr2k(
     blas::Layout                    layout,
@@ -1693,7 +2128,692 @@ void syr2k(
     std::vector<std::complex<double>*> const &Barray, std::vector<int64_t> const &lddb,
     std::vector<std::complex<double> > const &beta,
     std::vector<std::complex<double>*> const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch, std::vector<int64_t>       &info );
+    const size_t batch, std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule = blas::batch::Schedule::InOrder );
+
+// -----------------------------------------------------------------------------
+// Strided batch routines, with uniform arguments. Problem i uses the matrices
+// at A + i*strideA, B + i*strideB, and C + i*strideC, so no pointer arrays
+// are built. Strides are in elements.
+
+// -----------------------------------------------------------------------------
+// batch gemm, strided
+void gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float const *B, int64_t ldb, int64_t strideB,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double const *B, int64_t ldb, int64_t strideB,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float> const *B, int64_t ldb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double> const *B, int64_t ldb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+// batch hemm, strided
+void hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float const *B, int64_t ldb, int64_t strideB,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double const *B, int64_t ldb, int64_t strideB,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float> const *B, int64_t ldb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double> const *B, int64_t ldb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+// batch her2k, strided
+void her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float const *B, int64_t ldb, int64_t strideB,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double const *B, int64_t ldb, int64_t strideB,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float> const *B, int64_t ldb, int64_t strideB,
+    float beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double> const *B, int64_t ldb, int64_t strideB,
+    double beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+// batch herk, strided
+void herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    float beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    double beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+// batch symm, strided
+void symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float const *B, int64_t ldb, int64_t strideB,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double const *B, int64_t ldb, int64_t strideB,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float> const *B, int64_t ldb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double> const *B, int64_t ldb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+// batch syr2k, strided
+void syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float const *B, int64_t ldb, int64_t strideB,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double const *B, int64_t ldb, int64_t strideB,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float> const *B, int64_t ldb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double> const *B, int64_t ldb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+// batch syrk, strided
+void syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float> beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+void syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double> beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+// batch trmm, strided
+void trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float       *B, int64_t ldb, int64_t strideB,
+    size_t batch );
+
+void trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double       *B, int64_t ldb, int64_t strideB,
+    size_t batch );
+
+void trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float>       *B, int64_t ldb, int64_t strideB,
+    size_t batch );
+
+void trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double>       *B, int64_t ldb, int64_t strideB,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+// batch trsm, strided
+void trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float       *B, int64_t ldb, int64_t strideB,
+    size_t batch );
+
+void trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double       *B, int64_t ldb, int64_t strideB,
+    size_t batch );
+
+void trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float>       *B, int64_t ldb, int64_t strideB,
+    size_t batch );
+
+void trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double>       *B, int64_t ldb, int64_t strideB,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+// Compact batch format, for large batches of tiny matrices. Matrices are
+// interleaved in groups of compact_width<T>() consecutive matrices, so
+// element (i, j) of every matrix in a group is contiguous and fills one
+// 64-byte SIMD register (e.g., AVX-512). Within a group, the m-by-n
+// matrices are stored in the given layout with leading dimension ldac,
+// counting elements of one matrix. Group g starts at
+//     Ac + g * compact_size< T >( layout, m, n, ldac, compact_width< T >() ).
+// The last group is padded if batch is not a multiple of the width;
+// pack_compact sets padding to zero.
+
+/// @return number of matrices interleaved in the compact format.
+template <typename T>
+inline constexpr int64_t compact_width()
+{
+    return 64 / sizeof(T);
+}
+
+/// @return number of elements of type T to store batch m-by-n matrices
+/// in compact format, including padding.
+template <typename T>
+inline int64_t compact_size(
+    blas::Layout layout, int64_t m, int64_t n, int64_t ldac, size_t batch )
+{
+    int64_t width = compact_width< T >();
+    int64_t groups = (int64_t( batch ) + width - 1) / width;
+    return ldac * (layout == blas::Layout::ColMajor ? n : m) * width * groups;
+}
+
+// -----------------------------------------------------------------------------
+// batch compact, float
+void pack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    std::vector<float*> const &Aarray, int64_t lda,
+    float *Ac, int64_t ldac,
+    size_t batch );
+
+void unpack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    float const *Ac, int64_t ldac,
+    std::vector<float*> const &Aarray, int64_t lda,
+    size_t batch );
+
+void gemm_compact(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    float const *Ac, int64_t ldac,
+    float const *Bc, int64_t ldbc,
+    float beta,
+    float       *Cc, int64_t ldcc,
+    size_t batch );
+
+void trsm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *Ac, int64_t ldac,
+    float       *Bc, int64_t ldbc,
+    size_t batch );
+
+void trmm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *Ac, int64_t ldac,
+    float       *Bc, int64_t ldbc,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+// batch compact, double
+void pack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    std::vector<double*> const &Aarray, int64_t lda,
+    double *Ac, int64_t ldac,
+    size_t batch );
+
+void unpack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    double const *Ac, int64_t ldac,
+    std::vector<double*> const &Aarray, int64_t lda,
+    size_t batch );
+
+void gemm_compact(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    double alpha,
+    double const *Ac, int64_t ldac,
+    double const *Bc, int64_t ldbc,
+    double beta,
+    double       *Cc, int64_t ldcc,
+    size_t batch );
+
+void trsm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *Ac, int64_t ldac,
+    double       *Bc, int64_t ldbc,
+    size_t batch );
+
+void trmm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *Ac, int64_t ldac,
+    double       *Bc, int64_t ldbc,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+// batch compact, std::complex<float>
+void pack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    std::vector<std::complex<float>*> const &Aarray, int64_t lda,
+    std::complex<float> *Ac, int64_t ldac,
+    size_t batch );
+
+void unpack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    std::complex<float> const *Ac, int64_t ldac,
+    std::vector<std::complex<float>*> const &Aarray, int64_t lda,
+    size_t batch );
+
+void gemm_compact(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *Ac, int64_t ldac,
+    std::complex<float> const *Bc, int64_t ldbc,
+    std::complex<float> beta,
+    std::complex<float>       *Cc, int64_t ldcc,
+    size_t batch );
+
+void trsm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *Ac, int64_t ldac,
+    std::complex<float>       *Bc, int64_t ldbc,
+    size_t batch );
+
+void trmm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *Ac, int64_t ldac,
+    std::complex<float>       *Bc, int64_t ldbc,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+// batch compact, std::complex<double>
+void pack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    std::vector<std::complex<double>*> const &Aarray, int64_t lda,
+    std::complex<double> *Ac, int64_t ldac,
+    size_t batch );
+
+void unpack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    std::complex<double> const *Ac, int64_t ldac,
+    std::vector<std::complex<double>*> const &Aarray, int64_t lda,
+    size_t batch );
+
+void gemm_compact(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *Ac, int64_t ldac,
+    std::complex<double> const *Bc, int64_t ldbc,
+    std::complex<double> beta,
+    std::complex<double>       *Cc, int64_t ldcc,
+    size_t batch );
+
+void trsm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *Ac, int64_t ldac,
+    std::complex<double>       *Bc, int64_t ldbc,
+    size_t batch );
+
+void trmm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *Ac, int64_t ldac,
+    std::complex<double>       *Bc, int64_t ldbc,
+    size_t batch );
 
 }  // namespace batch
 }  // namespace blas
@@ -3,8 +3,11 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "tune.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -24,16 +27,35 @@ void axpy(
     float const *x, int64_t incx,
     float       *y, int64_t incy )
 {
+    blas_trace( "axpy", 's', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::saxpy, n )) {
+        axpy< float, float >( n, alpha, x, incx, y, incy );
+        return;
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::axpy_split( n, alpha, x, incx, y, incy );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            axpy< float, float >(
+                n,
+                alpha, x, incx, y, incy );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -50,16 +72,35 @@ void axpy(
     double const *x, int64_t incx,
     double       *y, int64_t incy )
 {
+    blas_trace( "axpy", 'd', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::daxpy, n )) {
+        axpy< double, double >( n, alpha, x, incx, y, incy );
+        return;
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::axpy_split( n, alpha, x, incx, y, incy );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            axpy< double, double >(
+                n,
+                alpha, x, incx, y, incy );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -76,16 +117,36 @@ void axpy(
     std::complex<float> const *x, int64_t incx,
     std::complex<float>       *y, int64_t incy )
 {
+    blas_trace( "axpy", 'c', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::caxpy, n )) {
+        axpy< std::complex<float>, std::complex<float> >(
+            n, alpha, x, incx, y, incy );
+        return;
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::axpy_split( n, alpha, x, incx, y, incy );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            axpy< std::complex<float>, std::complex<float> >(
+                n,
+                alpha, x, incx, y, incy );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -105,16 +166,36 @@ void axpy(
     std::complex<double> const *x, int64_t incx,
     std::complex<double>       *y, int64_t incy )
 {
+    blas_trace( "axpy", 'z', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::zaxpy, n )) {
+        axpy< std::complex<double>, std::complex<double> >(
+            n, alpha, x, incx, y, incy );
+        return;
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::axpy_split( n, alpha, x, incx, y, incy );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            axpy< std::complex<double>, std::complex<double> >(
+                n,
+                alpha, x, incx, y, incy );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -0,0 +1,848 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "trace.hh"
+
+#include <complex>
+#include <vector>
+
+namespace blas {
+namespace internal {
+namespace compact {
+
+// =============================================================================
+// Kernels for the compact batch format; see blas::batch::compact_width.
+// Each kernel works on one group of V interleaved matrices. Loops over the
+// V lanes are innermost with a compile-time trip count, and loads are
+// contiguous, so the compiler turns each lane loop into SIMD instructions.
+// Complex arithmetic is written out, since std::complex operator* and /
+// handle NaN and Inf specially, which prevents vectorization.
+// Kernels take column-major arguments; RowMajor is mapped to ColMajor by
+// the drivers below.
+
+//------------------------------------------------------------------------------
+template <typename T>
+inline T mul( T a, T b )
+{
+    return a * b;
+}
+
+template <typename real_t>
+inline std::complex<real_t> mul(
+    std::complex<real_t> a, std::complex<real_t> b )
+{
+    return std::complex<real_t>( real( a )*real( b ) - imag( a )*imag( b ),
+                                 real( a )*imag( b ) + imag( a )*real( b ) );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+inline T inv( T a )
+{
+    return 1 / a;
+}
+
+template <typename real_t>
+inline std::complex<real_t> inv( std::complex<real_t> a )
+{
+    real_t d = real( a )*real( a ) + imag( a )*imag( a );
+    return std::complex<real_t>( real( a ) / d, -imag( a ) / d );
+}
+
+//------------------------------------------------------------------------------
+/// @return conj( a ) if Conj, else a.
+template <bool Conj, typename T>
+inline T conj_if( T a )
+{
+    using blas::conj;
+    return Conj ? conj( a ) : a;
+}
+
+//------------------------------------------------------------------------------
+/// Accessor for op(A) in one group: element (i, j) of op(A) for lane v is
+/// A[ i*row + j*col + v ], conjugated if Conj.
+template <typename T>
+struct OpMatrix {
+    OpMatrix( blas::Op trans, T const* A_, int64_t lda, int V ):
+        A( A_ ),
+        row( trans == Op::NoTrans ? V : lda*V ),
+        col( trans == Op::NoTrans ? lda*V : V )
+    {}
+
+    T const* operator () ( int64_t i, int64_t j ) const
+    {
+        return &A[ i*row + j*col ];
+    }
+
+    T const* A;
+    int64_t row, col;
+};
+
+//------------------------------------------------------------------------------
+/// C = alpha op(A) op(B) + beta C for one group.
+template <int V, bool ConjA, bool ConjB, typename T>
+void gemm(
+    int64_t m, int64_t n, int64_t k,
+    T alpha, OpMatrix<T> const& A, OpMatrix<T> const& B,
+    T beta, T* C, int64_t ldc )
+{
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            T sum[ V ];
+            for (int v = 0; v < V; ++v)
+                sum[ v ] = 0;
+
+            T const* a = A( i, 0 );
+            T const* b = B( 0, j );
+            for (int64_t l = 0; l < k; ++l) {
+                for (int v = 0; v < V; ++v) {
+                    sum[ v ] += mul( conj_if<ConjA>( a[ v ] ),
+                                     conj_if<ConjB>( b[ v ] ) );
+                }
+                a += A.col;
+                b += B.row;
+            }
+
+            T* c = &C[ (i + j*ldc)*V ];
+            if (beta == T( 0 )) {
+                for (int v = 0; v < V; ++v)
+                    c[ v ] = mul( alpha, sum[ v ] );
+            }
+            else {
+                for (int v = 0; v < V; ++v)
+                    c[ v ] = mul( alpha, sum[ v ] ) + mul( beta, c[ v ] );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Solves op(A) X = alpha B (Left) or X op(A) = alpha B (Right)
+/// for one group, where op(A) is lower triangular if lower, else upper.
+template <int V, bool Conj, typename T>
+void trsm(
+    blas::Side side, bool lower, bool unit,
+    int64_t m, int64_t n,
+    T alpha, OpMatrix<T> const& A, T* B, int64_t ldb )
+{
+    auto b = [&]( int64_t i, int64_t j ) { return &B[ (i + j*ldb)*V ]; };
+
+    // x = x / a, or x = x * inv(a) with one inverse per lane
+    auto solve = [&]( T* x, T const* a ) {
+        if (! unit) {
+            for (int v = 0; v < V; ++v)
+                x[ v ] = mul( x[ v ], inv( conj_if<Conj>( a[ v ] ) ) );
+        }
+    };
+    // y -= a x
+    auto update = [&]( T* y, T const* a, T const* x ) {
+        for (int v = 0; v < V; ++v)
+            y[ v ] -= mul( conj_if<Conj>( a[ v ] ), x[ v ] );
+    };
+
+    for (int64_t j = 0; j < n; ++j)
+        for (int64_t i = 0; i < m; ++i)
+            for (int v = 0; v < V; ++v)
+                b( i, j )[ v ] = mul( alpha, b( i, j )[ v ] );
+
+    if (side == Side::Left) {
+        for (int64_t j = 0; j < n; ++j) {
+            if (lower) {
+                for (int64_t i = 0; i < m; ++i) {
+                    for (int64_t l = 0; l < i; ++l)
+                        update( b( i, j ), A( i, l ), b( l, j ) );
+                    solve( b( i, j ), A( i, i ) );
+                }
+            }
+            else {
+                for (int64_t i = m-1; i >= 0; --i) {
+                    for (int64_t l = i+1; l < m; ++l)
+                        update( b( i, j ), A( i, l ), b( l, j ) );
+                    solve( b( i, j ), A( i, i ) );
+                }
+            }
+        }
+    }
+    else {
+        for (int64_t i = 0; i < m; ++i) {
+            if (lower) {
+                for (int64_t j = n-1; j >= 0; --j) {
+                    for (int64_t l = j+1; l < n; ++l)
+                        update( b( i, j ), A( l, j ), b( i, l ) );
+                    solve( b( i, j ), A( j, j ) );
+                }
+            }
+            else {
+                for (int64_t j = 0; j < n; ++j) {
+                    for (int64_t l = 0; l < j; ++l)
+                        update( b( i, j ), A( l, j ), b( i, l ) );
+                    solve( b( i, j ), A( j, j ) );
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// B = alpha op(A) B (Left) or B = alpha B op(A) (Right) for one group,
+/// where op(A) is lower triangular if lower, else upper. Each entry is
+/// overwritten after the entries that depend on it.
+template <int V, bool Conj, typename T>
+void trmm(
+    blas::Side side, bool lower, bool unit,
+    int64_t m, int64_t n,
+    T alpha, OpMatrix<T> const& A, T* B, int64_t ldb )
+{
+    auto b = [&]( int64_t i, int64_t j ) { return &B[ (i + j*ldb)*V ]; };
+
+    // x = alpha (d x + sum), where d = op(A)(i, i)
+    auto finish = [&]( T* x, T const* a, T const* sum ) {
+        for (int v = 0; v < V; ++v) {
+            T d = (unit ? x[ v ] : mul( conj_if<Conj>( a[ v ] ), x[ v ] ));
+            x[ v ] = mul( alpha, d + sum[ v ] );
+        }
+    };
+    // sum += a x
+    auto update = [&]( T* sum, T const* a, T const* x ) {
+        for (int v = 0; v < V; ++v)
+            sum[ v ] += mul( conj_if<Conj>( a[ v ] ), x[ v ] );
+    };
+
+    T sum[ V ];
+    if (side == Side::Left) {
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t ii = 0; ii < m; ++ii) {
+                int64_t i = (lower ? m-1 - ii : ii);
+                for (int v = 0; v < V; ++v)
+                    sum[ v ] = 0;
+                int64_t l0 = (lower ? 0 : i+1);
+                int64_t l1 = (lower ? i : m);
+                for (int64_t l = l0; l < l1; ++l)
+                    update( sum, A( i, l ), b( l, j ) );
+                finish( b( i, j ), A( i, i ), sum );
+            }
+        }
+    }
+    else {
+        for (int64_t i = 0; i < m; ++i) {
+            for (int64_t jj = 0; jj < n; ++jj) {
+                int64_t j = (lower ? jj : n-1 - jj);
+                for (int v = 0; v < V; ++v)
+                    sum[ v ] = 0;
+                int64_t l0 = (lower ? j+1 : 0);
+                int64_t l1 = (lower ? n : j);
+                for (int64_t l = l0; l < l1; ++l)
+                    update( sum, A( l, j ), b( i, l ) );
+                finish( b( i, j ), A( j, j ), sum );
+            }
+        }
+    }
+}
+
+}  // namespace compact
+
+//------------------------------------------------------------------------------
+/// Copies batch matrices from pointer arrays to compact format
+/// (if pack), or back (if not pack). rows and cols are the storage
+/// dimensions, i.e., with RowMajor already swapped.
+template <typename T>
+void pack_compact(
+    bool pack,
+    int64_t rows, int64_t cols,
+    std::vector<T*> const& Aarray, int64_t lda,
+    T* Ac, int64_t ldac,
+    size_t batch )
+{
+    const int V = blas::batch::compact_width<T>();
+    blas_error_if( rows < 0 );
+    blas_error_if( cols < 0 );
+    blas_error_if( lda < rows );
+    blas_error_if( ldac < rows );
+    blas_error_if( Aarray.size() < batch );
+
+    int64_t groups = (int64_t( batch ) + V - 1) / V;
+    int64_t group_size = ldac * cols * V;
+
+    #pragma omp parallel for schedule(static)
+    for (int64_t g = 0; g < groups; ++g) {
+        T* Ag = Ac + g*group_size;
+        for (int v = 0; v < V; ++v) {
+            size_t s = size_t( g*V + v );
+            for (int64_t j = 0; j < cols; ++j) {
+                for (int64_t i = 0; i < rows; ++i) {
+                    T& ac = Ag[ (i + j*ldac)*V + v ];
+                    if (s >= batch) {
+                        if (pack)
+                            ac = 0;
+                    }
+                    else if (pack)
+                        ac = Aarray[ s ][ i + j*lda ];
+                    else
+                        Aarray[ s ][ i + j*lda ] = ac;
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void gemm_compact(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    T alpha,
+    T const* Ac, int64_t ldac,
+    T const* Bc, int64_t ldbc,
+    T beta,
+    T*       Cc, int64_t ldcc,
+    size_t batch )
+{
+    const int V = blas::batch::compact_width<T>();
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    if ((transA == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( ldac < m );
+    else
+        blas_error_if( ldac < k );
+
+    if ((transB == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( ldbc < k );
+    else
+        blas_error_if( ldbc < n );
+
+    if (layout == Layout::ColMajor)
+        blas_error_if( ldcc < m );
+    else
+        blas_error_if( ldcc < n );
+
+    if (layout == Layout::RowMajor) {
+        // swap transA <=> transB, m <=> n, B <=> A
+        std::swap( transA, transB );
+        std::swap( m, n );
+        std::swap( Ac, Bc );
+        std::swap( ldac, ldbc );
+    }
+
+    int64_t groups = (int64_t( batch ) + V - 1) / V;
+    int64_t group_A = ldac * (transA == Op::NoTrans ? k : m) * V;
+    int64_t group_B = ldbc * (transB == Op::NoTrans ? n : k) * V;
+    int64_t group_C = ldcc * n * V;
+    bool conjA = (transA == Op::ConjTrans);
+    bool conjB = (transB == Op::ConjTrans);
+
+    #pragma omp parallel for schedule(static)
+    for (int64_t g = 0; g < groups; ++g) {
+        compact::OpMatrix<T> A( transA, Ac + g*group_A, ldac, V );
+        compact::OpMatrix<T> B( transB, Bc + g*group_B, ldbc, V );
+        T* C = Cc + g*group_C;
+        if (conjA && conjB)
+            compact::gemm< V, true,  true  >( m, n, k, alpha, A, B, beta, C, ldcc );
+        else if (conjA)
+            compact::gemm< V, true,  false >( m, n, k, alpha, A, B, beta, C, ldcc );
+        else if (conjB)
+            compact::gemm< V, false, true  >( m, n, k, alpha, A, B, beta, C, ldcc );
+        else
+            compact::gemm< V, false, false >( m, n, k, alpha, A, B, beta, C, ldcc );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Driver for trsm_compact (if solve) and trmm_compact (if not solve).
+template <typename T>
+void trxm_compact(
+    bool solve,
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    T alpha,
+    T const* Ac, int64_t ldac,
+    T*       Bc, int64_t ldbc,
+    size_t batch )
+{
+    const int V = blas::batch::compact_width<T>();
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( side != Side::Left &&
+                   side != Side::Right );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( diag != Diag::NonUnit &&
+                   diag != Diag::Unit );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+
+    if (side == Side::Left)
+        blas_error_if( ldac < m );
+    else
+        blas_error_if( ldac < n );
+
+    if (layout == Layout::ColMajor)
+        blas_error_if( ldbc < m );
+    else
+        blas_error_if( ldbc < n );
+
+    if (layout == Layout::RowMajor) {
+        // swap lower <=> upper, left <=> right, m <=> n
+        side = (side == Side::Left ? Side::Right : Side::Left);
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+        std::swap( m, n );
+    }
+
+    int64_t groups = (int64_t( batch ) + V - 1) / V;
+    int64_t An = (side == Side::Left ? m : n);
+    int64_t group_A = ldac * An * V;
+    int64_t group_B = ldbc * n * V;
+    // op(A) is lower if A is lower and not transposed, or upper and transposed
+    bool lower = ((uplo == Uplo::Lower) == (trans == Op::NoTrans));
+    bool unit  = (diag == Diag::Unit);
+    bool conj  = (trans == Op::ConjTrans);
+
+    #pragma omp parallel for schedule(static)
+    for (int64_t g = 0; g < groups; ++g) {
+        compact::OpMatrix<T> A( trans, Ac + g*group_A, ldac, V );
+        T* B = Bc + g*group_B;
+        if (solve) {
+            if (conj)
+                compact::trsm< V, true  >( side, lower, unit, m, n, alpha, A, B, ldbc );
+            else
+                compact::trsm< V, false >( side, lower, unit, m, n, alpha, A, B, ldbc );
+        }
+        else {
+            if (conj)
+                compact::trmm< V, true  >( side, lower, unit, m, n, alpha, A, B, ldbc );
+            else
+                compact::trmm< V, false >( side, lower, unit, m, n, alpha, A, B, ldbc );
+        }
+    }
+}
+
+}  // namespace internal
+}  // namespace blas
+
+// =============================================================================
+// Overloaded wrappers for s, d, c, z precisions.
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::pack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    std::vector<float*> const &Aarray, int64_t lda,
+    float *Ac, int64_t ldac,
+    size_t batch )
+{
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    bool col = (layout == Layout::ColMajor);
+    blas::internal::pack_compact(
+        true, (col ? m : n), (col ? n : m), Aarray, lda, Ac, ldac, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::unpack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    float const *Ac, int64_t ldac,
+    std::vector<float*> const &Aarray, int64_t lda,
+    size_t batch )
+{
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    bool col = (layout == Layout::ColMajor);
+    // Ac is only read when unpacking
+    blas::internal::pack_compact(
+        false, (col ? m : n), (col ? n : m), Aarray, lda,
+        const_cast< float* >( Ac ), ldac, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::gemm_compact(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    float const *Ac, int64_t ldac,
+    float const *Bc, int64_t ldbc,
+    float beta,
+    float       *Cc, int64_t ldcc,
+    size_t batch )
+{
+    blas_trace( "batch_gemm_compact", 's', { layout, transA, transB },
+                { m, n, k }, batch );
+
+    blas::internal::gemm_compact(
+        layout, transA, transB, m, n, k,
+        alpha, Ac, ldac, Bc, ldbc, beta, Cc, ldcc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsm
+void blas::batch::trsm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *Ac, int64_t ldac,
+    float       *Bc, int64_t ldbc,
+    size_t batch )
+{
+    blas_trace( "batch_trsm_compact", 's', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::trxm_compact(
+        true, layout, side, uplo, trans, diag, m, n,
+        alpha, Ac, ldac, Bc, ldbc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trmm
+void blas::batch::trmm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *Ac, int64_t ldac,
+    float       *Bc, int64_t ldbc,
+    size_t batch )
+{
+    blas_trace( "batch_trmm_compact", 's', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::trxm_compact(
+        false, layout, side, uplo, trans, diag, m, n,
+        alpha, Ac, ldac, Bc, ldbc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::pack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    std::vector<double*> const &Aarray, int64_t lda,
+    double *Ac, int64_t ldac,
+    size_t batch )
+{
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    bool col = (layout == Layout::ColMajor);
+    blas::internal::pack_compact(
+        true, (col ? m : n), (col ? n : m), Aarray, lda, Ac, ldac, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::unpack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    double const *Ac, int64_t ldac,
+    std::vector<double*> const &Aarray, int64_t lda,
+    size_t batch )
+{
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    bool col = (layout == Layout::ColMajor);
+    // Ac is only read when unpacking
+    blas::internal::pack_compact(
+        false, (col ? m : n), (col ? n : m), Aarray, lda,
+        const_cast< double* >( Ac ), ldac, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::gemm_compact(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    double alpha,
+    double const *Ac, int64_t ldac,
+    double const *Bc, int64_t ldbc,
+    double beta,
+    double       *Cc, int64_t ldcc,
+    size_t batch )
+{
+    blas_trace( "batch_gemm_compact", 'd', { layout, transA, transB },
+                { m, n, k }, batch );
+
+    blas::internal::gemm_compact(
+        layout, transA, transB, m, n, k,
+        alpha, Ac, ldac, Bc, ldbc, beta, Cc, ldcc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsm
+void blas::batch::trsm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *Ac, int64_t ldac,
+    double       *Bc, int64_t ldbc,
+    size_t batch )
+{
+    blas_trace( "batch_trsm_compact", 'd', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::trxm_compact(
+        true, layout, side, uplo, trans, diag, m, n,
+        alpha, Ac, ldac, Bc, ldbc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trmm
+void blas::batch::trmm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *Ac, int64_t ldac,
+    double       *Bc, int64_t ldbc,
+    size_t batch )
+{
+    blas_trace( "batch_trmm_compact", 'd', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::trxm_compact(
+        false, layout, side, uplo, trans, diag, m, n,
+        alpha, Ac, ldac, Bc, ldbc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::pack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    std::vector<std::complex<float>*> const &Aarray, int64_t lda,
+    std::complex<float> *Ac, int64_t ldac,
+    size_t batch )
+{
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    bool col = (layout == Layout::ColMajor);
+    blas::internal::pack_compact(
+        true, (col ? m : n), (col ? n : m), Aarray, lda, Ac, ldac, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::unpack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    std::complex<float> const *Ac, int64_t ldac,
+    std::vector<std::complex<float>*> const &Aarray, int64_t lda,
+    size_t batch )
+{
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    bool col = (layout == Layout::ColMajor);
+    // Ac is only read when unpacking
+    blas::internal::pack_compact(
+        false, (col ? m : n), (col ? n : m), Aarray, lda,
+        const_cast< std::complex<float>* >( Ac ), ldac, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::gemm_compact(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *Ac, int64_t ldac,
+    std::complex<float> const *Bc, int64_t ldbc,
+    std::complex<float> beta,
+    std::complex<float>       *Cc, int64_t ldcc,
+    size_t batch )
+{
+    blas_trace( "batch_gemm_compact", 'c', { layout, transA, transB },
+                { m, n, k }, batch );
+
+    blas::internal::gemm_compact(
+        layout, transA, transB, m, n, k,
+        alpha, Ac, ldac, Bc, ldbc, beta, Cc, ldcc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsm
+void blas::batch::trsm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *Ac, int64_t ldac,
+    std::complex<float>       *Bc, int64_t ldbc,
+    size_t batch )
+{
+    blas_trace( "batch_trsm_compact", 'c', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::trxm_compact(
+        true, layout, side, uplo, trans, diag, m, n,
+        alpha, Ac, ldac, Bc, ldbc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trmm
+void blas::batch::trmm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *Ac, int64_t ldac,
+    std::complex<float>       *Bc, int64_t ldbc,
+    size_t batch )
+{
+    blas_trace( "batch_trmm_compact", 'c', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::trxm_compact(
+        false, layout, side, uplo, trans, diag, m, n,
+        alpha, Ac, ldac, Bc, ldbc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::pack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    std::vector<std::complex<double>*> const &Aarray, int64_t lda,
+    std::complex<double> *Ac, int64_t ldac,
+    size_t batch )
+{
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    bool col = (layout == Layout::ColMajor);
+    blas::internal::pack_compact(
+        true, (col ? m : n), (col ? n : m), Aarray, lda, Ac, ldac, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::unpack_compact(
+    blas::Layout layout,
+    int64_t m, int64_t n,
+    std::complex<double> const *Ac, int64_t ldac,
+    std::vector<std::complex<double>*> const &Aarray, int64_t lda,
+    size_t batch )
+{
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    bool col = (layout == Layout::ColMajor);
+    // Ac is only read when unpacking
+    blas::internal::pack_compact(
+        false, (col ? m : n), (col ? n : m), Aarray, lda,
+        const_cast< std::complex<double>* >( Ac ), ldac, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::gemm_compact(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *Ac, int64_t ldac,
+    std::complex<double> const *Bc, int64_t ldbc,
+    std::complex<double> beta,
+    std::complex<double>       *Cc, int64_t ldcc,
+    size_t batch )
+{
+    blas_trace( "batch_gemm_compact", 'z', { layout, transA, transB },
+                { m, n, k }, batch );
+
+    blas::internal::gemm_compact(
+        layout, transA, transB, m, n, k,
+        alpha, Ac, ldac, Bc, ldbc, beta, Cc, ldcc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsm
+void blas::batch::trsm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *Ac, int64_t ldac,
+    std::complex<double>       *Bc, int64_t ldbc,
+    size_t batch )
+{
+    blas_trace( "batch_trsm_compact", 'z', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::trxm_compact(
+        true, layout, side, uplo, trans, diag, m, n,
+        alpha, Ac, ldac, Bc, ldbc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trmm
+void blas::batch::trmm_compact(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *Ac, int64_t ldac,
+    std::complex<double>       *Bc, int64_t ldbc,
+    size_t batch )
+{
+    blas_trace( "batch_trmm_compact", 'z', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::trxm_compact(
+        false, layout, side, uplo, trans, diag, m, n,
+        alpha, Ac, ldac, Bc, ldbc, batch );
+}
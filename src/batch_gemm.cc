@@ -7,6 +7,112 @@
 #include <cstring>
 #include "blas/batch_common.hh"
 #include "blas.hh"
+#include "blas/flops.hh"
+#include "trace.hh"
+
+namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Computes each group of at least compact_width<T>() tiny problems with
+/// equal arguments in the compact format, with one set of packed buffers
+/// per group. Problems in invalid groups are left for the caller to check.
+/// @return packed, where packed[ i ] is true if problem i was computed,
+/// or empty if no problem was computed.
+template <typename T>
+std::vector<char> batch_gemm_compact(
+    blas::Layout                 layout,
+    std::vector<blas::Op> const &transA,
+    std::vector<blas::Op> const &transB,
+    std::vector<int64_t>  const &m,
+    std::vector<int64_t>  const &n,
+    std::vector<int64_t>  const &k,
+    std::vector<T >       const &alpha,
+    std::vector<T*>       const &Aarray, std::vector<int64_t> const &ldda,
+    std::vector<T*>       const &Barray, std::vector<int64_t> const &lddb,
+    std::vector<T >       const &beta,
+    std::vector<T*>       const &Carray, std::vector<int64_t> const &lddc,
+    const size_t batch, bool check )
+{
+    using blas::batch::extract;
+
+    const size_t width = blas::batch::compact_width<T>();
+    std::vector<char> packed;
+    if (batch < width)
+        return packed;
+
+    // uniform dimensions too large for the compact format
+    if ((m.size() == 1 && m[ 0 ] > blas::batch::compact_max_dim)
+        || (n.size() == 1 && n[ 0 ] > blas::batch::compact_max_dim)
+        || (k.size() == 1 && k[ 0 ] > blas::batch::compact_max_dim)) {
+        return packed;
+    }
+
+    std::vector< std::vector<size_t> > groups = blas::batch::gemm_groups(
+        transA, transB, m, n, k, alpha, ldda, lddb, beta, lddc, batch );
+
+    for (auto const& group : groups) {
+        size_t group_size = group.size();
+        if (group_size < width)
+            continue;
+
+        size_t i = group[ 0 ];
+        Op transA_ = extract<Op>(transA, i);
+        Op transB_ = extract<Op>(transB, i);
+        int64_t m_ = extract<int64_t>(m, i);
+        int64_t n_ = extract<int64_t>(n, i);
+        int64_t k_ = extract<int64_t>(k, i);
+        if (std::max( m_, std::max( n_, k_ ) ) > blas::batch::compact_max_dim
+            || (check && blas::batch::gemm_check_one(
+                             layout, transA, transB, m, n, k,
+                             ldda, lddb, lddc, i ) != 0)) {
+            continue;
+        }
+
+        std::vector<T*> Agroup( group_size ), Bgroup( group_size ),
+                        Cgroup( group_size );
+        if (packed.empty())
+            packed.assign( batch, false );
+        for (size_t j = 0; j < group_size; ++j) {
+            Agroup[ j ] = extract<T*>(Aarray, group[ j ]);
+            Bgroup[ j ] = extract<T*>(Barray, group[ j ]);
+            Cgroup[ j ] = extract<T*>(Carray, group[ j ]);
+            packed[ group[ j ] ] = true;
+        }
+
+        // op(A) is m-by-k, op(B) is k-by-n
+        int64_t Am = (transA_ == Op::NoTrans ? m_ : k_);
+        int64_t An = (transA_ == Op::NoTrans ? k_ : m_);
+        int64_t Bm = (transB_ == Op::NoTrans ? k_ : n_);
+        int64_t Bn = (transB_ == Op::NoTrans ? n_ : k_);
+        bool col = (layout == Layout::ColMajor);
+        int64_t ldac = col ? Am : An;
+        int64_t ldbc = col ? Bm : Bn;
+        int64_t ldcc = col ? m_ : n_;
+        std::vector<T> Ac( blas::batch::compact_size<T>( layout, Am, An, ldac, group_size ) );
+        std::vector<T> Bc( blas::batch::compact_size<T>( layout, Bm, Bn, ldbc, group_size ) );
+        std::vector<T> Cc( blas::batch::compact_size<T>( layout, m_, n_, ldcc, group_size ) );
+
+        blas::batch::pack_compact( layout, Am, An, Agroup, extract<int64_t>(ldda, i),
+                                   Ac.data(), ldac, group_size );
+        blas::batch::pack_compact( layout, Bm, Bn, Bgroup, extract<int64_t>(lddb, i),
+                                   Bc.data(), ldbc, group_size );
+        blas::batch::pack_compact( layout, m_, n_, Cgroup, extract<int64_t>(lddc, i),
+                                   Cc.data(), ldcc, group_size );
+        blas::batch::gemm_compact(
+            layout, transA_, transB_, m_, n_, k_,
+            extract<T>(alpha, i), Ac.data(), ldac,
+                                  Bc.data(), ldbc,
+            extract<T>(beta, i),  Cc.data(), ldcc, group_size );
+        blas::batch::unpack_compact( layout, m_, n_, Cc.data(), ldcc,
+                                     Cgroup, extract<int64_t>(lddc, i),
+                                     group_size );
+    }
+    return packed;
+}
+
+}  // namespace internal
+}  // namespace blas
 
 // -----------------------------------------------------------------------------
 /// @ingroup gemm
@@ -22,41 +128,68 @@ void blas::batch::gemm(
     std::vector<float*>   const &Barray, std::vector<int64_t> const &lddb,
     std::vector<float >   const &beta,
     std::vector<float*>   const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                  std::vector<int64_t>       &info )
+    const size_t batch,                  std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_gemm", 's', { layout, transA, transB }, { m, n, k },
+                batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::gemm_check<float>( layout, transA, transB,
-                                        m, n, k,
-                                        alpha, Aarray, ldda,
-                                               Barray, lddb,
-                                        beta,  Carray, lddc,
-                                        batch, info );
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::gemm_check_sizes<float>( layout, transA, transB,
+                                              m, n, k,
+                                              alpha, Aarray, ldda,
+                                                     Barray, lddb,
+                                              beta,  Carray, lddc,
+                                              batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Op transA_   = blas::batch::extract<Op>(transA, i);
-        Op transB_   = blas::batch::extract<Op>(transB, i);
-        int64_t m_   = blas::batch::extract<int64_t>(m, i);
-        int64_t n_   = blas::batch::extract<int64_t>(n, i);
-        int64_t k_   = blas::batch::extract<int64_t>(k, i);
-        int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-        int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-        float alpha_ = blas::batch::extract<float>(alpha, i);
-        float beta_  = blas::batch::extract<float>(beta, i);
-        float* dA_   = blas::batch::extract<float*>(Aarray, i);
-        float* dB_   = blas::batch::extract<float*>(Barray, i);
-        float* dC_   = blas::batch::extract<float*>(Carray, i);
-        blas::gemm(
-            layout, transA_, transB_, m_, n_, k_,
-            alpha_, dA_, lda_,
-                    dB_, ldb_,
-            beta_,  dC_, ldc_ );
-    }
+    // compute groups of tiny problems in the compact format
+    std::vector<char> packed = blas::internal::batch_gemm_compact(
+        layout, transA, transB, m, n, k, alpha, Aarray, ldda, Barray, lddb,
+        beta, Carray, lddc, batch, info.size() > 0 );
+
+    bool uniform = (m.size() == 1 && n.size() == 1 && k.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            if (! packed.empty() && packed[ i ])
+                return 0.0;
+            return blas::Gflop<float>::gemm( blas::batch::extract<int64_t>(m, i),
+                                             blas::batch::extract<int64_t>(n, i),
+                                             blas::batch::extract<int64_t>(k, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (! packed.empty() && packed[ i ])
+                return 0;  // computed in compact format
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::gemm_check_one(
+                                    layout, transA, transB, m, n, k, ldda, lddb, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Op transA_   = blas::batch::extract<Op>(transA, i);
+            Op transB_   = blas::batch::extract<Op>(transB, i);
+            int64_t m_   = blas::batch::extract<int64_t>(m, i);
+            int64_t n_   = blas::batch::extract<int64_t>(n, i);
+            int64_t k_   = blas::batch::extract<int64_t>(k, i);
+            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
+            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
+            float alpha_ = blas::batch::extract<float>(alpha, i);
+            float beta_  = blas::batch::extract<float>(beta, i);
+            float* dA_   = blas::batch::extract<float*>(Aarray, i);
+            float* dB_   = blas::batch::extract<float*>(Barray, i);
+            float* dC_   = blas::batch::extract<float*>(Carray, i);
+            blas::gemm(
+                layout, transA_, transB_, m_, n_, k_,
+                alpha_, dA_, lda_,
+                        dB_, ldb_,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
 
 // -----------------------------------------------------------------------------
@@ -73,42 +206,69 @@ void blas::batch::gemm(
     std::vector<double*>  const &Barray, std::vector<int64_t>  const &lddb,
     std::vector<double >  const &beta,
     std::vector<double*>  const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                  std::vector<int64_t>       &info )
+    const size_t batch,                  std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_gemm", 'd', { layout, transA, transB }, { m, n, k },
+                batch );
+
 
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::gemm_check<double>( layout, transA, transB,
-                                         m, n, k,
-                                         alpha, Aarray, ldda,
-                                                Barray, lddb,
-                                         beta,  Carray, lddc,
-                                         batch, info );
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::gemm_check_sizes<double>( layout, transA, transB,
+                                               m, n, k,
+                                               alpha, Aarray, ldda,
+                                                      Barray, lddb,
+                                               beta,  Carray, lddc,
+                                               batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Op transA_    = blas::batch::extract<Op>(transA, i);
-        Op transB_    = blas::batch::extract<Op>(transB, i);
-        int64_t m_    = blas::batch::extract<int64_t>(m, i);
-        int64_t n_    = blas::batch::extract<int64_t>(n, i);
-        int64_t k_    = blas::batch::extract<int64_t>(k, i);
-        int64_t lda_  = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldb_  = blas::batch::extract<int64_t>(lddb, i);
-        int64_t ldc_  = blas::batch::extract<int64_t>(lddc, i);
-        double alpha_ = blas::batch::extract<double>(alpha, i);
-        double beta_  = blas::batch::extract<double>(beta, i);
-        double* dA_   = blas::batch::extract<double*>(Aarray, i);
-        double* dB_   = blas::batch::extract<double*>(Barray, i);
-        double* dC_   = blas::batch::extract<double*>(Carray, i);
-        blas::gemm(
-            layout, transA_, transB_, m_, n_, k_,
-            alpha_, dA_, lda_,
-                    dB_, ldb_,
-            beta_,  dC_, ldc_ );
-    }
+    // compute groups of tiny problems in the compact format
+    std::vector<char> packed = blas::internal::batch_gemm_compact(
+        layout, transA, transB, m, n, k, alpha, Aarray, ldda, Barray, lddb,
+        beta, Carray, lddc, batch, info.size() > 0 );
+
+    bool uniform = (m.size() == 1 && n.size() == 1 && k.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            if (! packed.empty() && packed[ i ])
+                return 0.0;
+            return blas::Gflop<double>::gemm( blas::batch::extract<int64_t>(m, i),
+                                              blas::batch::extract<int64_t>(n, i),
+                                              blas::batch::extract<int64_t>(k, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (! packed.empty() && packed[ i ])
+                return 0;  // computed in compact format
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::gemm_check_one(
+                                    layout, transA, transB, m, n, k, ldda, lddb, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Op transA_    = blas::batch::extract<Op>(transA, i);
+            Op transB_    = blas::batch::extract<Op>(transB, i);
+            int64_t m_    = blas::batch::extract<int64_t>(m, i);
+            int64_t n_    = blas::batch::extract<int64_t>(n, i);
+            int64_t k_    = blas::batch::extract<int64_t>(k, i);
+            int64_t lda_  = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldb_  = blas::batch::extract<int64_t>(lddb, i);
+            int64_t ldc_  = blas::batch::extract<int64_t>(lddc, i);
+            double alpha_ = blas::batch::extract<double>(alpha, i);
+            double beta_  = blas::batch::extract<double>(beta, i);
+            double* dA_   = blas::batch::extract<double*>(Aarray, i);
+            double* dB_   = blas::batch::extract<double*>(Barray, i);
+            double* dC_   = blas::batch::extract<double*>(Carray, i);
+            blas::gemm(
+                layout, transA_, transB_, m_, n_, k_,
+                alpha_, dA_, lda_,
+                        dB_, ldb_,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
 
 // -----------------------------------------------------------------------------
@@ -125,42 +285,69 @@ void blas::batch::gemm(
     std::vector< std::complex<float>* >   const &Barray, std::vector<int64_t> const &lddb,
     std::vector< std::complex<float>  >   const &beta,
     std::vector< std::complex<float>* >   const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                                  std::vector<int64_t>  &info )
+    const size_t batch,                                  std::vector<int64_t>  &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_gemm", 'c', { layout, transA, transB }, { m, n, k },
+                batch );
+
 
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::gemm_check< std::complex<float> >( layout, transA, transB,
-                                        m, n, k,
-                                        alpha, Aarray, ldda,
-                                               Barray, lddb,
-                                        beta,  Carray, lddc,
-                                        batch, info );
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::gemm_check_sizes< std::complex<float> >( layout, transA, transB,
+                                              m, n, k,
+                                              alpha, Aarray, ldda,
+                                                     Barray, lddb,
+                                              beta,  Carray, lddc,
+                                              batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Op transA_    = blas::batch::extract<Op>(transA, i);
-        Op transB_    = blas::batch::extract<Op>(transB, i);
-        int64_t m_    = blas::batch::extract<int64_t>(m, i);
-        int64_t n_    = blas::batch::extract<int64_t>(n, i);
-        int64_t k_    = blas::batch::extract<int64_t>(k, i);
-        int64_t lda_  = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldb_  = blas::batch::extract<int64_t>(lddb, i);
-        int64_t ldc_  = blas::batch::extract<int64_t>(lddc, i);
-        std::complex<float> alpha_ = blas::batch::extract<std::complex<float> >(alpha, i);
-        std::complex<float> beta_  = blas::batch::extract<std::complex<float> >(beta, i);
-        std::complex<float>* dA_   = blas::batch::extract<std::complex<float>*>(Aarray, i);
-        std::complex<float>* dB_   = blas::batch::extract<std::complex<float>*>(Barray, i);
-        std::complex<float>* dC_   = blas::batch::extract<std::complex<float>*>(Carray, i);
-        blas::gemm(
-            layout, transA_, transB_, m_, n_, k_,
-            alpha_, dA_, lda_,
-                    dB_, ldb_,
-            beta_,  dC_, ldc_ );
-    }
+    // compute groups of tiny problems in the compact format
+    std::vector<char> packed = blas::internal::batch_gemm_compact(
+        layout, transA, transB, m, n, k, alpha, Aarray, ldda, Barray, lddb,
+        beta, Carray, lddc, batch, info.size() > 0 );
+
+    bool uniform = (m.size() == 1 && n.size() == 1 && k.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            if (! packed.empty() && packed[ i ])
+                return 0.0;
+            return blas::Gflop<std::complex<float>>::gemm( blas::batch::extract<int64_t>(m, i),
+                                                           blas::batch::extract<int64_t>(n, i),
+                                                           blas::batch::extract<int64_t>(k, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (! packed.empty() && packed[ i ])
+                return 0;  // computed in compact format
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::gemm_check_one(
+                                    layout, transA, transB, m, n, k, ldda, lddb, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Op transA_    = blas::batch::extract<Op>(transA, i);
+            Op transB_    = blas::batch::extract<Op>(transB, i);
+            int64_t m_    = blas::batch::extract<int64_t>(m, i);
+            int64_t n_    = blas::batch::extract<int64_t>(n, i);
+            int64_t k_    = blas::batch::extract<int64_t>(k, i);
+            int64_t lda_  = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldb_  = blas::batch::extract<int64_t>(lddb, i);
+            int64_t ldc_  = blas::batch::extract<int64_t>(lddc, i);
+            std::complex<float> alpha_ = blas::batch::extract<std::complex<float> >(alpha, i);
+            std::complex<float> beta_  = blas::batch::extract<std::complex<float> >(beta, i);
+            std::complex<float>* dA_   = blas::batch::extract<std::complex<float>*>(Aarray, i);
+            std::complex<float>* dB_   = blas::batch::extract<std::complex<float>*>(Barray, i);
+            std::complex<float>* dC_   = blas::batch::extract<std::complex<float>*>(Carray, i);
+            blas::gemm(
+                layout, transA_, transB_, m_, n_, k_,
+                alpha_, dA_, lda_,
+                        dB_, ldb_,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
 
 // -----------------------------------------------------------------------------
@@ -177,40 +364,67 @@ void blas::batch::gemm(
     std::vector< std::complex<double>* >   const &Barray, std::vector<int64_t> const &lddb,
     std::vector< std::complex<double>  >   const &beta,
     std::vector< std::complex<double>* >   const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                                   std::vector<int64_t>       &info )
+    const size_t batch,                                   std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_gemm", 'z', { layout, transA, transB }, { m, n, k },
+                batch );
+
 
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::gemm_check< std::complex<double> >( layout, transA, transB,
-                                        m, n, k,
-                                        alpha, Aarray, ldda,
-                                               Barray, lddb,
-                                        beta,  Carray, lddc,
-                                        batch, info );
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::gemm_check_sizes< std::complex<double> >( layout, transA, transB,
+                                              m, n, k,
+                                              alpha, Aarray, ldda,
+                                                     Barray, lddb,
+                                              beta,  Carray, lddc,
+                                              batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Op transA_    = blas::batch::extract<Op>(transA, i);
-        Op transB_    = blas::batch::extract<Op>(transB, i);
-        int64_t m_    = blas::batch::extract<int64_t>(m, i);
-        int64_t n_    = blas::batch::extract<int64_t>(n, i);
-        int64_t k_    = blas::batch::extract<int64_t>(k, i);
-        int64_t lda_  = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldb_  = blas::batch::extract<int64_t>(lddb, i);
-        int64_t ldc_  = blas::batch::extract<int64_t>(lddc, i);
-        std::complex<double> alpha_ = blas::batch::extract<std::complex<double> >(alpha, i);
-        std::complex<double> beta_  = blas::batch::extract<std::complex<double> >(beta, i);
-        std::complex<double>* dA_   = blas::batch::extract<std::complex<double>*>(Aarray, i);
-        std::complex<double>* dB_   = blas::batch::extract<std::complex<double>*>(Barray, i);
-        std::complex<double>* dC_   = blas::batch::extract<std::complex<double>*>(Carray, i);
-        blas::gemm(
-            layout, transA_, transB_, m_, n_, k_,
-            alpha_, dA_, lda_,
-                    dB_, ldb_,
-            beta_,  dC_, ldc_ );
-     }
+    // compute groups of tiny problems in the compact format
+    std::vector<char> packed = blas::internal::batch_gemm_compact(
+        layout, transA, transB, m, n, k, alpha, Aarray, ldda, Barray, lddb,
+        beta, Carray, lddc, batch, info.size() > 0 );
+
+    bool uniform = (m.size() == 1 && n.size() == 1 && k.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            if (! packed.empty() && packed[ i ])
+                return 0.0;
+            return blas::Gflop<std::complex<double>>::gemm( blas::batch::extract<int64_t>(m, i),
+                                                            blas::batch::extract<int64_t>(n, i),
+                                                            blas::batch::extract<int64_t>(k, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (! packed.empty() && packed[ i ])
+                return 0;  // computed in compact format
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::gemm_check_one(
+                                    layout, transA, transB, m, n, k, ldda, lddb, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Op transA_    = blas::batch::extract<Op>(transA, i);
+            Op transB_    = blas::batch::extract<Op>(transB, i);
+            int64_t m_    = blas::batch::extract<int64_t>(m, i);
+            int64_t n_    = blas::batch::extract<int64_t>(n, i);
+            int64_t k_    = blas::batch::extract<int64_t>(k, i);
+            int64_t lda_  = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldb_  = blas::batch::extract<int64_t>(lddb, i);
+            int64_t ldc_  = blas::batch::extract<int64_t>(lddc, i);
+            std::complex<double> alpha_ = blas::batch::extract<std::complex<double> >(alpha, i);
+            std::complex<double> beta_  = blas::batch::extract<std::complex<double> >(beta, i);
+            std::complex<double>* dA_   = blas::batch::extract<std::complex<double>*>(Aarray, i);
+            std::complex<double>* dB_   = blas::batch::extract<std::complex<double>*>(Barray, i);
+            std::complex<double>* dC_   = blas::batch::extract<std::complex<double>*>(Carray, i);
+            blas::gemm(
+                layout, transA_, transB_, m_, n_, k_,
+                alpha_, dA_, lda_,
+                        dB_, ldb_,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
@@ -7,6 +7,8 @@
 #include <cstring>
 #include "blas/batch_common.hh"
 #include "blas.hh"
+#include "blas/flops.hh"
+#include "trace.hh"
 
 // -----------------------------------------------------------------------------
 /// @ingroup hemm
@@ -21,41 +23,58 @@ void blas::batch::hemm(
     std::vector<float*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<float >     const &beta,
     std::vector<float*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info )
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_hemm", 's', { layout, side, uplo }, { m, n }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::hemm_check<float>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::hemm_check_sizes<float>(
                         layout, side, uplo,
                         m, n,
                         alpha, Aarray, ldda,
                                Barray, lddb,
                         beta,  Carray, lddc,
-                        batch, info );
+                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Side side_   = blas::batch::extract<Side>(side, i);
-        Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-        int64_t m_   = blas::batch::extract<int64_t>(m, i);
-        int64_t n_   = blas::batch::extract<int64_t>(n, i);
-        int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-        int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-        float alpha_ = blas::batch::extract<float>(alpha, i);
-        float beta_  = blas::batch::extract<float>(beta, i);
-        float* dA_   = blas::batch::extract<float*>(Aarray, i);
-        float* dB_   = blas::batch::extract<float*>(Barray, i);
-        float* dC_   = blas::batch::extract<float*>(Carray, i);
-        blas::hemm(
-            layout, side_, uplo_, m_, n_,
-            alpha_, dA_, lda_,
-                    dB_, ldb_,
-            beta_,  dC_, ldc_ );
-    }
+    bool uniform = (side.size() == 1 && m.size() == 1 && n.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            return blas::Gflop<float>::hemm( blas::batch::extract<Side>(side, i),
+                                             blas::batch::extract<int64_t>(m, i),
+                                             blas::batch::extract<int64_t>(n, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::hemm_check_one(
+                                    layout, side, uplo, m, n, ldda, lddb, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Side side_   = blas::batch::extract<Side>(side, i);
+            Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+            int64_t m_   = blas::batch::extract<int64_t>(m, i);
+            int64_t n_   = blas::batch::extract<int64_t>(n, i);
+            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
+            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
+            float alpha_ = blas::batch::extract<float>(alpha, i);
+            float beta_  = blas::batch::extract<float>(beta, i);
+            float* dA_   = blas::batch::extract<float*>(Aarray, i);
+            float* dB_   = blas::batch::extract<float*>(Barray, i);
+            float* dC_   = blas::batch::extract<float*>(Carray, i);
+            blas::hemm(
+                layout, side_, uplo_, m_, n_,
+                alpha_, dA_, lda_,
+                        dB_, ldb_,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
 
 // -----------------------------------------------------------------------------
@@ -71,41 +90,58 @@ void blas::batch::hemm(
     std::vector<double*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<double >     const &beta,
     std::vector<double*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                     std::vector<int64_t>       &info )
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_hemm", 'd', { layout, side, uplo }, { m, n }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::hemm_check<double>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::hemm_check_sizes<double>(
                         layout, side, uplo,
                         m, n,
                         alpha, Aarray, ldda,
                                Barray, lddb,
                         beta,  Carray, lddc,
-                        batch, info );
+                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Side side_   = blas::batch::extract<Side>(side, i);
-        Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-        int64_t m_   = blas::batch::extract<int64_t>(m, i);
-        int64_t n_   = blas::batch::extract<int64_t>(n, i);
-        int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-        int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-        double alpha_ = blas::batch::extract<double>(alpha, i);
-        double beta_  = blas::batch::extract<double>(beta, i);
-        double* dA_   = blas::batch::extract<double*>(Aarray, i);
-        double* dB_   = blas::batch::extract<double*>(Barray, i);
-        double* dC_   = blas::batch::extract<double*>(Carray, i);
-        blas::hemm(
-            layout, side_, uplo_, m_, n_,
-            alpha_, dA_, lda_,
-                    dB_, ldb_,
-            beta_,  dC_, ldc_ );
-    }
+    bool uniform = (side.size() == 1 && m.size() == 1 && n.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            return blas::Gflop<double>::hemm( blas::batch::extract<Side>(side, i),
+                                              blas::batch::extract<int64_t>(m, i),
+                                              blas::batch::extract<int64_t>(n, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::hemm_check_one(
+                                    layout, side, uplo, m, n, ldda, lddb, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Side side_   = blas::batch::extract<Side>(side, i);
+            Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+            int64_t m_   = blas::batch::extract<int64_t>(m, i);
+            int64_t n_   = blas::batch::extract<int64_t>(n, i);
+            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
+            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
+            double alpha_ = blas::batch::extract<double>(alpha, i);
+            double beta_  = blas::batch::extract<double>(beta, i);
+            double* dA_   = blas::batch::extract<double*>(Aarray, i);
+            double* dB_   = blas::batch::extract<double*>(Barray, i);
+            double* dC_   = blas::batch::extract<double*>(Carray, i);
+            blas::hemm(
+                layout, side_, uplo_, m_, n_,
+                alpha_, dA_, lda_,
+                        dB_, ldb_,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
 
 // -----------------------------------------------------------------------------
@@ -121,41 +157,58 @@ void blas::batch::hemm(
     std::vector<std::complex<float>*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<std::complex<float> >     const &beta,
     std::vector<std::complex<float>*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                                  std::vector<int64_t>       &info )
+    const size_t batch,                                  std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_hemm", 'c', { layout, side, uplo }, { m, n }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::hemm_check<std::complex<float>>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::hemm_check_sizes<std::complex<float>>(
                         layout, side, uplo,
                         m, n,
                         alpha, Aarray, ldda,
                                Barray, lddb,
                         beta,  Carray, lddc,
-                        batch, info );
+                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Side side_   = blas::batch::extract<Side>(side, i);
-        Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-        int64_t m_   = blas::batch::extract<int64_t>(m, i);
-        int64_t n_   = blas::batch::extract<int64_t>(n, i);
-        int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-        int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-        std::complex<float> alpha_ = blas::batch::extract<std::complex<float>>(alpha, i);
-        std::complex<float> beta_  = blas::batch::extract<std::complex<float>>(beta, i);
-        std::complex<float>* dA_   = blas::batch::extract<std::complex<float>*>(Aarray, i);
-        std::complex<float>* dB_   = blas::batch::extract<std::complex<float>*>(Barray, i);
-        std::complex<float>* dC_   = blas::batch::extract<std::complex<float>*>(Carray, i);
-        blas::hemm(
-            layout, side_, uplo_, m_, n_,
-            alpha_, dA_, lda_ ,
-                    dB_, ldb_ ,
-            beta_,  dC_, ldc_ );
-    }
+    bool uniform = (side.size() == 1 && m.size() == 1 && n.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            return blas::Gflop<std::complex<float>>::hemm( blas::batch::extract<Side>(side, i),
+                                                           blas::batch::extract<int64_t>(m, i),
+                                                           blas::batch::extract<int64_t>(n, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::hemm_check_one(
+                                    layout, side, uplo, m, n, ldda, lddb, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Side side_   = blas::batch::extract<Side>(side, i);
+            Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+            int64_t m_   = blas::batch::extract<int64_t>(m, i);
+            int64_t n_   = blas::batch::extract<int64_t>(n, i);
+            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
+            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
+            std::complex<float> alpha_ = blas::batch::extract<std::complex<float>>(alpha, i);
+            std::complex<float> beta_  = blas::batch::extract<std::complex<float>>(beta, i);
+            std::complex<float>* dA_   = blas::batch::extract<std::complex<float>*>(Aarray, i);
+            std::complex<float>* dB_   = blas::batch::extract<std::complex<float>*>(Barray, i);
+            std::complex<float>* dC_   = blas::batch::extract<std::complex<float>*>(Carray, i);
+            blas::hemm(
+                layout, side_, uplo_, m_, n_,
+                alpha_, dA_, lda_ ,
+                        dB_, ldb_ ,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
 
 // -----------------------------------------------------------------------------
@@ -171,39 +224,56 @@ void blas::batch::hemm(
     std::vector<std::complex<double>*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<std::complex<double> >     const &beta,
     std::vector<std::complex<double>*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                                   std::vector<int64_t>       &info )
+    const size_t batch,                                   std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_hemm", 'z', { layout, side, uplo }, { m, n }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::hemm_check<std::complex<double>>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::hemm_check_sizes<std::complex<double>>(
                         layout, side, uplo,
                         m, n,
                         alpha, Aarray, ldda,
                                Barray, lddb,
                         beta,  Carray, lddc,
-                        batch, info );
+                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Side side_   = blas::batch::extract<Side>(side, i);
-        Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-        int64_t m_   = blas::batch::extract<int64_t>(m, i);
-        int64_t n_   = blas::batch::extract<int64_t>(n, i);
-        int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-        int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-        std::complex<double> alpha_ = blas::batch::extract<std::complex<double>>(alpha, i);
-        std::complex<double> beta_  = blas::batch::extract<std::complex<double>>(beta, i);
-        std::complex<double>* dA_   = blas::batch::extract<std::complex<double>*>(Aarray, i);
-        std::complex<double>* dB_   = blas::batch::extract<std::complex<double>*>(Barray, i);
-        std::complex<double>* dC_   = blas::batch::extract<std::complex<double>*>(Carray, i);
-        blas::hemm(
-            layout, side_, uplo_, m_, n_,
-            alpha_, dA_, lda_ ,
-                    dB_, ldb_ ,
-            beta_,  dC_, ldc_ );
-    }
+    bool uniform = (side.size() == 1 && m.size() == 1 && n.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            return blas::Gflop<std::complex<double>>::hemm( blas::batch::extract<Side>(side, i),
+                                                            blas::batch::extract<int64_t>(m, i),
+                                                            blas::batch::extract<int64_t>(n, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::hemm_check_one(
+                                    layout, side, uplo, m, n, ldda, lddb, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Side side_   = blas::batch::extract<Side>(side, i);
+            Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+            int64_t m_   = blas::batch::extract<int64_t>(m, i);
+            int64_t n_   = blas::batch::extract<int64_t>(n, i);
+            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
+            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
+            std::complex<double> alpha_ = blas::batch::extract<std::complex<double>>(alpha, i);
+            std::complex<double> beta_  = blas::batch::extract<std::complex<double>>(beta, i);
+            std::complex<double>* dA_   = blas::batch::extract<std::complex<double>*>(Aarray, i);
+            std::complex<double>* dB_   = blas::batch::extract<std::complex<double>*>(Barray, i);
+            std::complex<double>* dC_   = blas::batch::extract<std::complex<double>*>(Carray, i);
+            blas::hemm(
+                layout, side_, uplo_, m_, n_,
+                alpha_, dA_, lda_ ,
+                        dB_, ldb_ ,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
@@ -7,6 +7,8 @@
 #include <cstring>
 #include "blas/batch_common.hh"
 #include "blas.hh"
+#include "blas/flops.hh"
+#include "trace.hh"
 
 // -----------------------------------------------------------------------------
 /// @ingroup herk
@@ -20,37 +22,53 @@ void blas::batch::herk(
     std::vector<float*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<float >     const &beta,
     std::vector<float*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info )
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_herk", 's', { layout, uplo, trans }, { n, k }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::herk_check<float, float>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::herk_check_sizes<float, float>(
                         layout, uplo, trans,
                         n, k,
                         alpha, Aarray, ldda,
                         beta,  Carray, lddc,
-                        batch, info );
+                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-        Op   trans_  = blas::batch::extract<Op>(trans, i);
-        int64_t n_   = blas::batch::extract<int64_t>(n, i);
-        int64_t k_   = blas::batch::extract<int64_t>(k, i);
-        int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-        float alpha_ = blas::batch::extract<float>(alpha, i);
-        float beta_  = blas::batch::extract<float>(beta, i);
-        float* dA_   = blas::batch::extract<float*>(Aarray, i);
-        float* dC_   = blas::batch::extract<float*>(Carray, i);
-        blas::herk(
-            layout, uplo_, trans_, n_, k_,
-            alpha_, dA_, lda_ ,
-            beta_,  dC_, ldc_ );
-    }
+    bool uniform = (n.size() == 1 && k.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            return blas::Gflop<float>::herk( blas::batch::extract<int64_t>(n, i),
+                                             blas::batch::extract<int64_t>(k, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::herk_check_one(
+                                    layout, uplo, trans, n, k, ldda, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+            Op   trans_  = blas::batch::extract<Op>(trans, i);
+            int64_t n_   = blas::batch::extract<int64_t>(n, i);
+            int64_t k_   = blas::batch::extract<int64_t>(k, i);
+            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
+            float alpha_ = blas::batch::extract<float>(alpha, i);
+            float beta_  = blas::batch::extract<float>(beta, i);
+            float* dA_   = blas::batch::extract<float*>(Aarray, i);
+            float* dC_   = blas::batch::extract<float*>(Carray, i);
+            blas::herk(
+                layout, uplo_, trans_, n_, k_,
+                alpha_, dA_, lda_ ,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
 
 // -----------------------------------------------------------------------------
@@ -65,37 +83,53 @@ void blas::batch::herk(
     std::vector<double*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<double >     const &beta,
     std::vector<double*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                     std::vector<int64_t>       &info )
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_herk", 'd', { layout, uplo, trans }, { n, k }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::herk_check<double, double>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::herk_check_sizes<double, double>(
                         layout, uplo, trans,
                         n, k,
                         alpha, Aarray, ldda,
                         beta,  Carray, lddc,
-                        batch, info );
+                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-        Op   trans_  = blas::batch::extract<Op>(trans, i);
-        int64_t n_   = blas::batch::extract<int64_t>(n, i);
-        int64_t k_   = blas::batch::extract<int64_t>(k, i);
-        int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-        double alpha_ = blas::batch::extract<double>(alpha, i);
-        double beta_  = blas::batch::extract<double>(beta, i);
-        double* dA_   = blas::batch::extract<double*>(Aarray, i);
-        double* dC_   = blas::batch::extract<double*>(Carray, i);
-        blas::herk(
-            layout, uplo_, trans_, n_, k_,
-            alpha_, dA_, lda_ ,
-            beta_,  dC_, ldc_ );
-    }
+    bool uniform = (n.size() == 1 && k.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            return blas::Gflop<double>::herk( blas::batch::extract<int64_t>(n, i),
+                                              blas::batch::extract<int64_t>(k, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::herk_check_one(
+                                    layout, uplo, trans, n, k, ldda, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+            Op   trans_  = blas::batch::extract<Op>(trans, i);
+            int64_t n_   = blas::batch::extract<int64_t>(n, i);
+            int64_t k_   = blas::batch::extract<int64_t>(k, i);
+            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
+            double alpha_ = blas::batch::extract<double>(alpha, i);
+            double beta_  = blas::batch::extract<double>(beta, i);
+            double* dA_   = blas::batch::extract<double*>(Aarray, i);
+            double* dC_   = blas::batch::extract<double*>(Carray, i);
+            blas::herk(
+                layout, uplo_, trans_, n_, k_,
+                alpha_, dA_, lda_ ,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
 
 // -----------------------------------------------------------------------------
@@ -110,37 +144,53 @@ void blas::batch::herk(
     std::vector<std::complex<float>*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<float >      const &beta,
     std::vector<std::complex<float>*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                                  std::vector<int64_t>       &info )
+    const size_t batch,                                  std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_herk", 's', { layout, uplo, trans }, { n, k }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::herk_check<std::complex<float>, float>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::herk_check_sizes<std::complex<float>, float>(
                         layout, uplo, trans,
                         n, k,
                         alpha, Aarray, ldda,
                         beta,  Carray, lddc,
-                        batch, info );
+                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-        Op   trans_  = blas::batch::extract<Op>(trans, i);
-        int64_t n_   = blas::batch::extract<int64_t>(n, i);
-        int64_t k_   = blas::batch::extract<int64_t>(k, i);
-        int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-        float alpha_ = blas::batch::extract<float>(alpha, i);
-        float beta_  = blas::batch::extract<float>(beta, i);
-        std::complex<float>* dA_   = blas::batch::extract<std::complex<float>*>(Aarray, i);
-        std::complex<float>* dC_   = blas::batch::extract<std::complex<float>*>(Carray, i);
-        blas::herk(
-            layout, uplo_, trans_, n_, k_,
-            alpha_, dA_, lda_ ,
-            beta_,  dC_, ldc_ );
-    }
+    bool uniform = (n.size() == 1 && k.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            return blas::Gflop<std::complex<float>>::herk( blas::batch::extract<int64_t>(n, i),
+                                                           blas::batch::extract<int64_t>(k, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::herk_check_one(
+                                    layout, uplo, trans, n, k, ldda, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+            Op   trans_  = blas::batch::extract<Op>(trans, i);
+            int64_t n_   = blas::batch::extract<int64_t>(n, i);
+            int64_t k_   = blas::batch::extract<int64_t>(k, i);
+            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
+            float alpha_ = blas::batch::extract<float>(alpha, i);
+            float beta_  = blas::batch::extract<float>(beta, i);
+            std::complex<float>* dA_   = blas::batch::extract<std::complex<float>*>(Aarray, i);
+            std::complex<float>* dC_   = blas::batch::extract<std::complex<float>*>(Carray, i);
+            blas::herk(
+                layout, uplo_, trans_, n_, k_,
+                alpha_, dA_, lda_ ,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
 
 // -----------------------------------------------------------------------------
@@ -155,35 +205,51 @@ void blas::batch::herk(
     std::vector<std::complex<double>*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<double >     const &beta,
     std::vector<std::complex<double>*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                                   std::vector<int64_t>       &info )
+    const size_t batch,                                   std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_herk", 'd', { layout, uplo, trans }, { n, k }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::herk_check<std::complex<double>, double>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::herk_check_sizes<std::complex<double>, double>(
                         layout, uplo, trans,
                         n, k,
                         alpha, Aarray, ldda,
                         beta,  Carray, lddc,
-                        batch, info );
+                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-        Op   trans_  = blas::batch::extract<Op>(trans, i);
-        int64_t n_   = blas::batch::extract<int64_t>(n, i);
-        int64_t k_   = blas::batch::extract<int64_t>(k, i);
-        int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-        double alpha_ = blas::batch::extract<double>(alpha, i);
-        double beta_  = blas::batch::extract<double>(beta, i);
-        std::complex<double>* dA_   = blas::batch::extract<std::complex<double>*>(Aarray, i);
-        std::complex<double>* dC_   = blas::batch::extract<std::complex<double>*>(Carray, i);
-        blas::herk(
-            layout, uplo_, trans_, n_, k_,
-            alpha_, dA_, lda_ ,
-            beta_,  dC_, ldc_ );
-    }
+    bool uniform = (n.size() == 1 && k.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            return blas::Gflop<std::complex<double>>::herk( blas::batch::extract<int64_t>(n, i),
+                                                            blas::batch::extract<int64_t>(k, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::herk_check_one(
+                                    layout, uplo, trans, n, k, ldda, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+            Op   trans_  = blas::batch::extract<Op>(trans, i);
+            int64_t n_   = blas::batch::extract<int64_t>(n, i);
+            int64_t k_   = blas::batch::extract<int64_t>(k, i);
+            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
+            double alpha_ = blas::batch::extract<double>(alpha, i);
+            double beta_  = blas::batch::extract<double>(beta, i);
+            std::complex<double>* dA_   = blas::batch::extract<std::complex<double>*>(Aarray, i);
+            std::complex<double>* dC_   = blas::batch::extract<std::complex<double>*>(Carray, i);
+            blas::herk(
+                layout, uplo_, trans_, n_, k_,
+                alpha_, dA_, lda_ ,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
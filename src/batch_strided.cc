@@ -0,0 +1,944 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "trace.hh"
+
+namespace blas {
+namespace internal {
+
+// -----------------------------------------------------------------------------
+// Runs problem( i ) for each problem in a strided batch. Arguments are the
+// same for every problem, so problem 0 runs first, outside the parallel
+// region: it checks the arguments for the whole batch, throwing before any
+// other problem runs, and lets the vendor BLAS use all threads.
+template <typename Problem>
+void strided_batch( size_t batch, Problem problem )
+{
+    if (batch == 0)
+        return;
+
+    problem( 0 );
+
+    #pragma omp parallel for schedule(dynamic)
+    for (size_t i = 1; i < batch; ++i) {
+        problem( int64_t( i ) );
+    }
+}
+
+}  // namespace internal
+}  // namespace blas
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float const *B, int64_t ldb, int64_t strideB,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_gemm_strided", 's', { layout, transA, transB },
+                { m, n, k }, batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::gemm(
+            layout, transA, transB, m, n, k,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double const *B, int64_t ldb, int64_t strideB,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_gemm_strided", 'd', { layout, transA, transB },
+                { m, n, k }, batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::gemm(
+            layout, transA, transB, m, n, k,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float> const *B, int64_t ldb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_gemm_strided", 'c', { layout, transA, transB },
+                { m, n, k }, batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::gemm(
+            layout, transA, transB, m, n, k,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double> const *B, int64_t ldb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_gemm_strided", 'z', { layout, transA, transB },
+                { m, n, k }, batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::gemm(
+            layout, transA, transB, m, n, k,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup hemm
+void blas::batch::hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float const *B, int64_t ldb, int64_t strideB,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_hemm_strided", 's', { layout, side, uplo }, { m, n },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::hemm(
+            layout, side, uplo, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup hemm
+void blas::batch::hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double const *B, int64_t ldb, int64_t strideB,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_hemm_strided", 'd', { layout, side, uplo }, { m, n },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::hemm(
+            layout, side, uplo, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup hemm
+void blas::batch::hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float> const *B, int64_t ldb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_hemm_strided", 'c', { layout, side, uplo }, { m, n },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::hemm(
+            layout, side, uplo, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup hemm
+void blas::batch::hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double> const *B, int64_t ldb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_hemm_strided", 'z', { layout, side, uplo }, { m, n },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::hemm(
+            layout, side, uplo, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup her2k
+void blas::batch::her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float const *B, int64_t ldb, int64_t strideB,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_her2k_strided", 's', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::her2k(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup her2k
+void blas::batch::her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double const *B, int64_t ldb, int64_t strideB,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_her2k_strided", 'd', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::her2k(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup her2k
+void blas::batch::her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float> const *B, int64_t ldb, int64_t strideB,
+    float beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_her2k_strided", 'c', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::her2k(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup her2k
+void blas::batch::her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double> const *B, int64_t ldb, int64_t strideB,
+    double beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_her2k_strided", 'z', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::her2k(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup herk
+void blas::batch::herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_herk_strided", 's', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::herk(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup herk
+void blas::batch::herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_herk_strided", 'd', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::herk(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup herk
+void blas::batch::herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    float beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_herk_strided", 's', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::herk(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup herk
+void blas::batch::herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    double beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_herk_strided", 'd', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::herk(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup symm
+void blas::batch::symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float const *B, int64_t ldb, int64_t strideB,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_symm_strided", 's', { layout, side, uplo }, { m, n },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::symm(
+            layout, side, uplo, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup symm
+void blas::batch::symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double const *B, int64_t ldb, int64_t strideB,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_symm_strided", 'd', { layout, side, uplo }, { m, n },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::symm(
+            layout, side, uplo, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup symm
+void blas::batch::symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float> const *B, int64_t ldb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_symm_strided", 'c', { layout, side, uplo }, { m, n },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::symm(
+            layout, side, uplo, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup symm
+void blas::batch::symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double> const *B, int64_t ldb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_symm_strided", 'z', { layout, side, uplo }, { m, n },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::symm(
+            layout, side, uplo, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syr2k
+void blas::batch::syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float const *B, int64_t ldb, int64_t strideB,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_syr2k_strided", 's', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::syr2k(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syr2k
+void blas::batch::syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double const *B, int64_t ldb, int64_t strideB,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_syr2k_strided", 'd', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::syr2k(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syr2k
+void blas::batch::syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float> const *B, int64_t ldb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_syr2k_strided", 'c', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::syr2k(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syr2k
+void blas::batch::syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double> const *B, int64_t ldb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_syr2k_strided", 'z', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::syr2k(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syrk
+void blas::batch::syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float beta,
+    float       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_syrk_strided", 's', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::syrk(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syrk
+void blas::batch::syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double beta,
+    double       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_syrk_strided", 'd', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::syrk(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syrk
+void blas::batch::syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float> beta,
+    std::complex<float>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_syrk_strided", 'c', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::syrk(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syrk
+void blas::batch::syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double> beta,
+    std::complex<double>       *C, int64_t ldc, int64_t strideC,
+    size_t batch )
+{
+    blas_trace( "batch_syrk_strided", 'z', { layout, uplo, trans }, { n, k },
+                batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::syrk(
+            layout, uplo, trans, n, k,
+            alpha, A + i*strideA, lda,
+            beta,  C + i*strideC, ldc );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trmm
+void blas::batch::trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float       *B, int64_t ldb, int64_t strideB,
+    size_t batch )
+{
+    blas_trace( "batch_trmm_strided", 's', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::trmm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trmm
+void blas::batch::trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double       *B, int64_t ldb, int64_t strideB,
+    size_t batch )
+{
+    blas_trace( "batch_trmm_strided", 'd', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::trmm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trmm
+void blas::batch::trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float>       *B, int64_t ldb, int64_t strideB,
+    size_t batch )
+{
+    blas_trace( "batch_trmm_strided", 'c', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::trmm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trmm
+void blas::batch::trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double>       *B, int64_t ldb, int64_t strideB,
+    size_t batch )
+{
+    blas_trace( "batch_trmm_strided", 'z', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::trmm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsm
+void blas::batch::trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *A, int64_t lda, int64_t strideA,
+    float       *B, int64_t ldb, int64_t strideB,
+    size_t batch )
+{
+    blas_trace( "batch_trsm_strided", 's', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::trsm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsm
+void blas::batch::trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *A, int64_t lda, int64_t strideA,
+    double       *B, int64_t ldb, int64_t strideB,
+    size_t batch )
+{
+    blas_trace( "batch_trsm_strided", 'd', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::trsm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsm
+void blas::batch::trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda, int64_t strideA,
+    std::complex<float>       *B, int64_t ldb, int64_t strideB,
+    size_t batch )
+{
+    blas_trace( "batch_trsm_strided", 'c', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::trsm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsm
+void blas::batch::trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda, int64_t strideA,
+    std::complex<double>       *B, int64_t ldb, int64_t strideB,
+    size_t batch )
+{
+    blas_trace( "batch_trsm_strided", 'z', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
+    blas::internal::strided_batch( batch, [&]( int64_t i ) {
+        blas::trsm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, A + i*strideA, lda,
+                   B + i*strideB, ldb );
+    } );
+}
@@ -7,6 +7,8 @@
 #include <cstring>
 #include "blas/batch_common.hh"
 #include "blas.hh"
+#include "blas/flops.hh"
+#include "trace.hh"
 
 // -----------------------------------------------------------------------------
 /// @ingroup syr2k
@@ -21,41 +23,57 @@ void blas::batch::syr2k(
     std::vector<float*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<float >     const &beta,
     std::vector<float*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                    std::vector<int64_t>       &info )
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_syr2k", 's', { layout, uplo, trans }, { n, k }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::syr2k_check<float>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::syr2k_check_sizes<float>(
                         layout, uplo, trans,
                         n, k,
                         alpha, Aarray, ldda,
                                Barray, lddb,
                         beta,  Carray, lddc,
-                        batch, info );
+                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-        Op   trans_  = blas::batch::extract<Op>(trans, i);
-        int64_t n_   = blas::batch::extract<int64_t>(n, i);
-        int64_t k_   = blas::batch::extract<int64_t>(k, i);
-        int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-        int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-        float alpha_ = blas::batch::extract<float>(alpha, i);
-        float beta_  = blas::batch::extract<float>(beta, i);
-        float* dA_   = blas::batch::extract<float*>(Aarray, i);
-        float* dB_   = blas::batch::extract<float*>(Barray, i);
-        float* dC_   = blas::batch::extract<float*>(Carray, i);
-        blas::syr2k(
-            layout, uplo_, trans_, n_, k_,
-            alpha_, dA_, lda_ ,
-                    dB_, ldb_ ,
-            beta_,  dC_, ldc_ );
-    }
+    bool uniform = (n.size() == 1 && k.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            return blas::Gflop<float>::syr2k( blas::batch::extract<int64_t>(n, i),
+                                              blas::batch::extract<int64_t>(k, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::syr2k_check_one(
+                                    layout, uplo, trans, n, k, ldda, lddb, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+            Op   trans_  = blas::batch::extract<Op>(trans, i);
+            int64_t n_   = blas::batch::extract<int64_t>(n, i);
+            int64_t k_   = blas::batch::extract<int64_t>(k, i);
+            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
+            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
+            float alpha_ = blas::batch::extract<float>(alpha, i);
+            float beta_  = blas::batch::extract<float>(beta, i);
+            float* dA_   = blas::batch::extract<float*>(Aarray, i);
+            float* dB_   = blas::batch::extract<float*>(Barray, i);
+            float* dC_   = blas::batch::extract<float*>(Carray, i);
+            blas::syr2k(
+                layout, uplo_, trans_, n_, k_,
+                alpha_, dA_, lda_ ,
+                        dB_, ldb_ ,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
 
 // -----------------------------------------------------------------------------
@@ -71,41 +89,57 @@ void blas::batch::syr2k(
     std::vector<double*>     const &Barray, std::vector<int64_t> const &lddb,
     std::vector<double >     const &beta,
     std::vector<double*>     const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                     std::vector<int64_t>       &info )
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_syr2k", 'd', { layout, uplo, trans }, { n, k }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::syr2k_check<double>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::syr2k_check_sizes<double>(
                         layout, uplo, trans,
                         n, k,
                         alpha, Aarray, ldda,
                                Barray, lddb,
                         beta,  Carray, lddc,
-                        batch, info );
+                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-        Op   trans_  = blas::batch::extract<Op>(trans, i);
-        int64_t n_   = blas::batch::extract<int64_t>(n, i);
-        int64_t k_   = blas::batch::extract<int64_t>(k, i);
-        int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-        int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-        double alpha_ = blas::batch::extract<double>(alpha, i);
-        double beta_  = blas::batch::extract<double>(beta, i);
-        double* dA_   = blas::batch::extract<double*>(Aarray, i);
-        double* dB_   = blas::batch::extract<double*>(Barray, i);
-        double* dC_   = blas::batch::extract<double*>(Carray, i);
-        blas::syr2k(
-            layout, uplo_, trans_, n_, k_,
-            alpha_, dA_, lda_ ,
-                    dB_, ldb_ ,
-            beta_,  dC_, ldc_ );
-    }
+    bool uniform = (n.size() == 1 && k.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            return blas::Gflop<double>::syr2k( blas::batch::extract<int64_t>(n, i),
+                                               blas::batch::extract<int64_t>(k, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::syr2k_check_one(
+                                    layout, uplo, trans, n, k, ldda, lddb, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+            Op   trans_  = blas::batch::extract<Op>(trans, i);
+            int64_t n_   = blas::batch::extract<int64_t>(n, i);
+            int64_t k_   = blas::batch::extract<int64_t>(k, i);
+            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
+            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
+            double alpha_ = blas::batch::extract<double>(alpha, i);
+            double beta_  = blas::batch::extract<double>(beta, i);
+            double* dA_   = blas::batch::extract<double*>(Aarray, i);
+            double* dB_   = blas::batch::extract<double*>(Barray, i);
+            double* dC_   = blas::batch::extract<double*>(Carray, i);
+            blas::syr2k(
+                layout, uplo_, trans_, n_, k_,
+                alpha_, dA_, lda_ ,
+                        dB_, ldb_ ,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
 
 // -----------------------------------------------------------------------------
@@ -121,41 +155,57 @@ void blas::batch::syr2k(
     std::vector<std::complex<float>*> const &Barray, std::vector<int64_t> const &lddb,
     std::vector<std::complex<float> > const &beta,
     std::vector<std::complex<float>*> const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                              std::vector<int64_t>       &info )
+    const size_t batch,                              std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_syr2k", 'c', { layout, uplo, trans }, { n, k }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::syr2k_check<std::complex<float>>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::syr2k_check_sizes<std::complex<float>>(
                         layout, uplo, trans,
                         n, k,
                         alpha, Aarray, ldda,
                                Barray, lddb,
                         beta,  Carray, lddc,
-                        batch, info );
+                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-        Op   trans_  = blas::batch::extract<Op>(trans, i);
-        int64_t n_   = blas::batch::extract<int64_t>(n, i);
-        int64_t k_   = blas::batch::extract<int64_t>(k, i);
-        int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-        int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-        std::complex<float> alpha_ = blas::batch::extract<std::complex<float>>(alpha, i);
-        std::complex<float> beta_  = blas::batch::extract<std::complex<float>>(beta, i);
-        std::complex<float>* dA_   = blas::batch::extract<std::complex<float>*>(Aarray, i);
-        std::complex<float>* dB_   = blas::batch::extract<std::complex<float>*>(Barray, i);
-        std::complex<float>* dC_   = blas::batch::extract<std::complex<float>*>(Carray, i);
-        blas::syr2k(
-            layout, uplo_, trans_, n_, k_,
-            alpha_, dA_, lda_ ,
-                    dB_, ldb_ ,
-            beta_,  dC_, ldc_ );
-    }
+    bool uniform = (n.size() == 1 && k.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            return blas::Gflop<std::complex<float>>::syr2k( blas::batch::extract<int64_t>(n, i),
+                                                            blas::batch::extract<int64_t>(k, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::syr2k_check_one(
+                                    layout, uplo, trans, n, k, ldda, lddb, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+            Op   trans_  = blas::batch::extract<Op>(trans, i);
+            int64_t n_   = blas::batch::extract<int64_t>(n, i);
+            int64_t k_   = blas::batch::extract<int64_t>(k, i);
+            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
+            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
+            std::complex<float> alpha_ = blas::batch::extract<std::complex<float>>(alpha, i);
+            std::complex<float> beta_  = blas::batch::extract<std::complex<float>>(beta, i);
+            std::complex<float>* dA_   = blas::batch::extract<std::complex<float>*>(Aarray, i);
+            std::complex<float>* dB_   = blas::batch::extract<std::complex<float>*>(Barray, i);
+            std::complex<float>* dC_   = blas::batch::extract<std::complex<float>*>(Carray, i);
+            blas::syr2k(
+                layout, uplo_, trans_, n_, k_,
+                alpha_, dA_, lda_ ,
+                        dB_, ldb_ ,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
 
 // -----------------------------------------------------------------------------
@@ -171,39 +221,55 @@ void blas::batch::syr2k(
     std::vector<std::complex<double>*> const &Barray, std::vector<int64_t> const &lddb,
     std::vector<std::complex<double> > const &beta,
     std::vector<std::complex<double>*> const &Carray, std::vector<int64_t> const &lddc,
-    const size_t batch,                               std::vector<int64_t>       &info )
+    const size_t batch,                               std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_syr2k", 'z', { layout, uplo, trans }, { n, k }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::syr2k_check<std::complex<double>>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::syr2k_check_sizes<std::complex<double>>(
                         layout, uplo, trans,
                         n, k,
                         alpha, Aarray, ldda,
                                Barray, lddb,
                         beta,  Carray, lddc,
-                        batch, info );
+                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-        Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-        Op   trans_  = blas::batch::extract<Op>(trans, i);
-        int64_t n_   = blas::batch::extract<int64_t>(n, i);
-        int64_t k_   = blas::batch::extract<int64_t>(k, i);
-        int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-        int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-        int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-        std::complex<double> alpha_ = blas::batch::extract<std::complex<double>>(alpha, i);
-        std::complex<double> beta_  = blas::batch::extract<std::complex<double>>(beta, i);
-        std::complex<double>* dA_   = blas::batch::extract<std::complex<double>*>(Aarray, i);
-        std::complex<double>* dB_   = blas::batch::extract<std::complex<double>*>(Barray, i);
-        std::complex<double>* dC_   = blas::batch::extract<std::complex<double>*>(Carray, i);
-        blas::syr2k(
-            layout, uplo_, trans_, n_, k_,
-            alpha_, dA_, lda_ ,
-                    dB_, ldb_ ,
-            beta_,  dC_, ldc_ );
-    }
+    bool uniform = (n.size() == 1 && k.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            return blas::Gflop<std::complex<double>>::syr2k( blas::batch::extract<int64_t>(n, i),
+                                                             blas::batch::extract<int64_t>(k, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::syr2k_check_one(
+                                    layout, uplo, trans, n, k, ldda, lddb, lddc, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+            Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+            Op   trans_  = blas::batch::extract<Op>(trans, i);
+            int64_t n_   = blas::batch::extract<int64_t>(n, i);
+            int64_t k_   = blas::batch::extract<int64_t>(k, i);
+            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+            int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
+            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
+            std::complex<double> alpha_ = blas::batch::extract<std::complex<double>>(alpha, i);
+            std::complex<double> beta_  = blas::batch::extract<std::complex<double>>(beta, i);
+            std::complex<double>* dA_   = blas::batch::extract<std::complex<double>*>(Aarray, i);
+            std::complex<double>* dB_   = blas::batch::extract<std::complex<double>*>(Barray, i);
+            std::complex<double>* dC_   = blas::batch::extract<std::complex<double>*>(Carray, i);
+            blas::syr2k(
+                layout, uplo_, trans_, n_, k_,
+                alpha_, dA_, lda_ ,
+                        dB_, ldb_ ,
+                beta_,  dC_, ldc_ );
+            return 0;
+        } );
 }
@@ -7,6 +7,97 @@
 #include <cstring>
 #include "blas/batch_common.hh"
 #include "blas.hh"
+#include "blas/flops.hh"
+#include "trace.hh"
+
+namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Computes each group of at least compact_width<T>() tiny problems with
+/// equal arguments in the compact format, with one set of packed buffers
+/// per group. Problems in invalid groups are left for the caller to check.
+/// @return packed, where packed[ i ] is true if problem i was computed,
+/// or empty if no problem was computed.
+template <typename T>
+std::vector<char> batch_trsm_compact(
+    blas::Layout                   layout,
+    std::vector<blas::Side> const &side,
+    std::vector<blas::Uplo> const &uplo,
+    std::vector<blas::Op>   const &trans,
+    std::vector<blas::Diag> const &diag,
+    std::vector<int64_t>    const &m,
+    std::vector<int64_t>    const &n,
+    std::vector<T >         const &alpha,
+    std::vector<T*>         const &Aarray, std::vector<int64_t> const &ldda,
+    std::vector<T*>         const &Barray, std::vector<int64_t> const &lddb,
+    const size_t batch, bool check )
+{
+    using blas::batch::extract;
+
+    const size_t width = blas::batch::compact_width<T>();
+    std::vector<char> packed;
+    if (batch < width)
+        return packed;
+
+    // uniform dimensions too large for the compact format
+    if ((m.size() == 1 && m[ 0 ] > blas::batch::compact_max_dim)
+        || (n.size() == 1 && n[ 0 ] > blas::batch::compact_max_dim)) {
+        return packed;
+    }
+
+    std::vector< std::vector<size_t> > groups = blas::batch::trsm_groups(
+        side, uplo, trans, diag, m, n, alpha, ldda, lddb, batch );
+
+    for (auto const& group : groups) {
+        size_t group_size = group.size();
+        if (group_size < width)
+            continue;
+
+        size_t i = group[ 0 ];
+        Side side_ = extract<Side>(side, i);
+        int64_t m_ = extract<int64_t>(m, i);
+        int64_t n_ = extract<int64_t>(n, i);
+        if (std::max( m_, n_ ) > blas::batch::compact_max_dim
+            || (check && blas::batch::trsm_check_one(
+                             layout, side, uplo, trans, diag, m, n,
+                             ldda, lddb, i ) != 0)) {
+            continue;
+        }
+
+        std::vector<T*> Agroup( group_size ), Bgroup( group_size );
+        if (packed.empty())
+            packed.assign( batch, false );
+        for (size_t j = 0; j < group_size; ++j) {
+            Agroup[ j ] = extract<T*>(Aarray, group[ j ]);
+            Bgroup[ j ] = extract<T*>(Barray, group[ j ]);
+            packed[ group[ j ] ] = true;
+        }
+
+        // A is square, B is m-by-n
+        int64_t An = (side_ == Side::Left ? m_ : n_);
+        int64_t ldbc = (layout == Layout::ColMajor ? m_ : n_);
+        std::vector<T> Ac( blas::batch::compact_size<T>( layout, An, An, An, group_size ) );
+        std::vector<T> Bc( blas::batch::compact_size<T>( layout, m_, n_, ldbc, group_size ) );
+
+        blas::batch::pack_compact( layout, An, An, Agroup, extract<int64_t>(ldda, i),
+                                   Ac.data(), An, group_size );
+        blas::batch::pack_compact( layout, m_, n_, Bgroup, extract<int64_t>(lddb, i),
+                                   Bc.data(), ldbc, group_size );
+        blas::batch::trsm_compact(
+            layout, side_, extract<Uplo>(uplo, i), extract<Op>(trans, i),
+            extract<Diag>(diag, i), m_, n_,
+            extract<T>(alpha, i), Ac.data(), An,
+                                  Bc.data(), ldbc, group_size );
+        blas::batch::unpack_compact( layout, m_, n_, Bc.data(), ldbc,
+                                     Bgroup, extract<int64_t>(lddb, i),
+                                     group_size );
+    }
+    return packed;
+}
+
+}  // namespace internal
+}  // namespace blas
 
 // -----------------------------------------------------------------------------
 /// @ingroup trsm
@@ -21,37 +112,64 @@ void blas::batch::trsm(
     std::vector<float >     const &alpha,
     std::vector<float*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<float*>     const &Barray, std::vector<int64_t> const &lddb,
-    const size_t batch,                    std::vector<int64_t>       &info )
+    const size_t batch,                    std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_trsm", 's', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::trsm_check<float>( layout, side, uplo, trans, diag,
-                                        m, n,
-                                        alpha, Aarray, ldda,
-                                               Barray, lddb,
-                                        batch, info );
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::trsm_check_sizes<float>( layout, side, uplo, trans, diag,
+                                              m, n,
+                                              alpha, Aarray, ldda,
+                                                     Barray, lddb,
+                                              batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-       Side side_   = blas::batch::extract<Side>(side, i);
-       Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-       Op   trans_  = blas::batch::extract<Op>(trans, i);
-       Diag diag_   = blas::batch::extract<Diag>(diag, i);
-       int64_t m_   = blas::batch::extract<int64_t>(m, i);
-       int64_t n_   = blas::batch::extract<int64_t>(n, i);
-       int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-       int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-       float alpha_ = blas::batch::extract<float>(alpha, i);
-       float* dA_   = blas::batch::extract<float*>(Aarray, i);
-       float* dB_   = blas::batch::extract<float*>(Barray, i);
-       blas::trsm(
-           layout, side_, uplo_, trans_, diag_, m_, n_,
-           alpha_, dA_, lda_,
-                   dB_, ldb_ );
-    }
+    // compute groups of tiny problems in the compact format
+    std::vector<char> packed = blas::internal::batch_trsm_compact(
+        layout, side, uplo, trans, diag, m, n, alpha, Aarray, ldda, Barray, lddb,
+        batch, info.size() > 0 );
+
+    bool uniform = (side.size() == 1 && m.size() == 1 && n.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            if (! packed.empty() && packed[ i ])
+                return 0.0;
+            return blas::Gflop<float>::trsm( blas::batch::extract<Side>(side, i),
+                                             blas::batch::extract<int64_t>(m, i),
+                                             blas::batch::extract<int64_t>(n, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (! packed.empty() && packed[ i ])
+                return 0;  // computed in compact format
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::trsm_check_one(
+                                    layout, side, uplo, trans, diag, m, n, ldda, lddb, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+           Side side_   = blas::batch::extract<Side>(side, i);
+           Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+           Op   trans_  = blas::batch::extract<Op>(trans, i);
+           Diag diag_   = blas::batch::extract<Diag>(diag, i);
+           int64_t m_   = blas::batch::extract<int64_t>(m, i);
+           int64_t n_   = blas::batch::extract<int64_t>(n, i);
+           int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+           int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
+           float alpha_ = blas::batch::extract<float>(alpha, i);
+           float* dA_   = blas::batch::extract<float*>(Aarray, i);
+           float* dB_   = blas::batch::extract<float*>(Barray, i);
+           blas::trsm(
+               layout, side_, uplo_, trans_, diag_, m_, n_,
+               alpha_, dA_, lda_,
+                       dB_, ldb_ );
+            return 0;
+        } );
 }
 
 
@@ -68,37 +186,64 @@ void blas::batch::trsm(
     std::vector<double >     const &alpha,
     std::vector<double*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<double*>     const &Barray, std::vector<int64_t> const &lddb,
-    const size_t batch,                     std::vector<int64_t>       &info )
+    const size_t batch,                     std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_trsm", 'd', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::trsm_check<double>( layout, side, uplo, trans, diag,
-                                         m, n,
-                                         alpha, Aarray, ldda,
-                                                Barray, lddb,
-                                         batch, info );
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::trsm_check_sizes<double>( layout, side, uplo, trans, diag,
+                                               m, n,
+                                               alpha, Aarray, ldda,
+                                                      Barray, lddb,
+                                               batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-       Side side_   = blas::batch::extract<Side>(side, i);
-       Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-       Op   trans_  = blas::batch::extract<Op>(trans, i);
-       Diag diag_   = blas::batch::extract<Diag>(diag, i);
-       int64_t m_   = blas::batch::extract<int64_t>(m, i);
-       int64_t n_   = blas::batch::extract<int64_t>(n, i);
-       int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-       int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-       double alpha_ = blas::batch::extract<double>(alpha, i);
-       double* dA_   = blas::batch::extract<double*>(Aarray, i);
-       double* dB_   = blas::batch::extract<double*>(Barray, i);
-       blas::trsm(
-           layout, side_, uplo_, trans_, diag_, m_, n_,
-           alpha_, dA_, lda_,
-                   dB_, ldb_ );
-    }
+    // compute groups of tiny problems in the compact format
+    std::vector<char> packed = blas::internal::batch_trsm_compact(
+        layout, side, uplo, trans, diag, m, n, alpha, Aarray, ldda, Barray, lddb,
+        batch, info.size() > 0 );
+
+    bool uniform = (side.size() == 1 && m.size() == 1 && n.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            if (! packed.empty() && packed[ i ])
+                return 0.0;
+            return blas::Gflop<double>::trsm( blas::batch::extract<Side>(side, i),
+                                              blas::batch::extract<int64_t>(m, i),
+                                              blas::batch::extract<int64_t>(n, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (! packed.empty() && packed[ i ])
+                return 0;  // computed in compact format
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::trsm_check_one(
+                                    layout, side, uplo, trans, diag, m, n, ldda, lddb, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+           Side side_   = blas::batch::extract<Side>(side, i);
+           Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+           Op   trans_  = blas::batch::extract<Op>(trans, i);
+           Diag diag_   = blas::batch::extract<Diag>(diag, i);
+           int64_t m_   = blas::batch::extract<int64_t>(m, i);
+           int64_t n_   = blas::batch::extract<int64_t>(n, i);
+           int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+           int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
+           double alpha_ = blas::batch::extract<double>(alpha, i);
+           double* dA_   = blas::batch::extract<double*>(Aarray, i);
+           double* dB_   = blas::batch::extract<double*>(Barray, i);
+           blas::trsm(
+               layout, side_, uplo_, trans_, diag_, m_, n_,
+               alpha_, dA_, lda_,
+                       dB_, ldb_ );
+            return 0;
+        } );
 }
 
 
@@ -115,38 +260,65 @@ void blas::batch::trsm(
     std::vector<std::complex<float> >     const &alpha,
     std::vector<std::complex<float>*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<std::complex<float>*>     const &Barray, std::vector<int64_t> const &lddb,
-    const size_t batch,                                  std::vector<int64_t>       &info )
+    const size_t batch,                                  std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_trsm", 'c', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::trsm_check<std::complex<float>>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::trsm_check_sizes<std::complex<float>>(
                                         layout, side, uplo, trans, diag,
                                         m, n,
                                         alpha, Aarray, ldda,
                                                Barray, lddb,
-                                        batch, info );
+                                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-       Side side_   = blas::batch::extract<Side>(side, i);
-       Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-       Op   trans_  = blas::batch::extract<Op>(trans, i);
-       Diag diag_   = blas::batch::extract<Diag>(diag, i);
-       int64_t m_   = blas::batch::extract<int64_t>(m, i);
-       int64_t n_   = blas::batch::extract<int64_t>(n, i);
-       int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-       int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-       std::complex<float> alpha_ = blas::batch::extract<std::complex<float> >(alpha, i);
-       std::complex<float>* dA_   = blas::batch::extract<std::complex<float>*>(Aarray, i);
-       std::complex<float>* dB_   = blas::batch::extract<std::complex<float>*>(Barray, i);
-       blas::trsm(
-           layout, side_, uplo_, trans_, diag_, m_, n_,
-           alpha_, dA_, lda_,
-                   dB_, ldb_ );
-    }
+    // compute groups of tiny problems in the compact format
+    std::vector<char> packed = blas::internal::batch_trsm_compact(
+        layout, side, uplo, trans, diag, m, n, alpha, Aarray, ldda, Barray, lddb,
+        batch, info.size() > 0 );
+
+    bool uniform = (side.size() == 1 && m.size() == 1 && n.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            if (! packed.empty() && packed[ i ])
+                return 0.0;
+            return blas::Gflop<std::complex<float>>::trsm( blas::batch::extract<Side>(side, i),
+                                                           blas::batch::extract<int64_t>(m, i),
+                                                           blas::batch::extract<int64_t>(n, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (! packed.empty() && packed[ i ])
+                return 0;  // computed in compact format
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::trsm_check_one(
+                                    layout, side, uplo, trans, diag, m, n, ldda, lddb, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+           Side side_   = blas::batch::extract<Side>(side, i);
+           Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+           Op   trans_  = blas::batch::extract<Op>(trans, i);
+           Diag diag_   = blas::batch::extract<Diag>(diag, i);
+           int64_t m_   = blas::batch::extract<int64_t>(m, i);
+           int64_t n_   = blas::batch::extract<int64_t>(n, i);
+           int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+           int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
+           std::complex<float> alpha_ = blas::batch::extract<std::complex<float> >(alpha, i);
+           std::complex<float>* dA_   = blas::batch::extract<std::complex<float>*>(Aarray, i);
+           std::complex<float>* dB_   = blas::batch::extract<std::complex<float>*>(Barray, i);
+           blas::trsm(
+               layout, side_, uplo_, trans_, diag_, m_, n_,
+               alpha_, dA_, lda_,
+                       dB_, ldb_ );
+            return 0;
+        } );
 }
 
 
@@ -163,36 +335,63 @@ void blas::batch::trsm(
     std::vector<std::complex<double> >     const &alpha,
     std::vector<std::complex<double>*>     const &Aarray, std::vector<int64_t> const &ldda,
     std::vector<std::complex<double>*>     const &Barray, std::vector<int64_t> const &lddb,
-    const size_t batch,                                   std::vector<int64_t>       &info )
+    const size_t batch,                                   std::vector<int64_t>       &info,
+    blas::batch::Schedule schedule )
 {
+    blas_trace( "batch_trsm", 'z', { layout, side, uplo, trans, diag },
+                { m, n }, batch );
+
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
     if (info.size() > 0) {
-        // perform error checking
-        blas::batch::trsm_check<std::complex<double>>(
+        // check argument vector sizes; each problem is checked as it runs
+        blas::batch::trsm_check_sizes<std::complex<double>>(
                                         layout, side, uplo, trans, diag,
                                         m, n,
                                         alpha, Aarray, ldda,
                                                Barray, lddb,
-                                        batch, info );
+                                        batch );
     }
 
-    #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < batch; ++i) {
-       Side side_   = blas::batch::extract<Side>(side, i);
-       Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
-       Op   trans_  = blas::batch::extract<Op>(trans, i);
-       Diag diag_   = blas::batch::extract<Diag>(diag, i);
-       int64_t m_   = blas::batch::extract<int64_t>(m, i);
-       int64_t n_   = blas::batch::extract<int64_t>(n, i);
-       int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-       int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-       std::complex<double> alpha_ = blas::batch::extract<std::complex<double> >(alpha, i);
-       std::complex<double>* dA_   = blas::batch::extract<std::complex<double>*>(Aarray, i);
-       std::complex<double>* dB_   = blas::batch::extract<std::complex<double>*>(Barray, i);
-       blas::trsm(
-           layout, side_, uplo_, trans_, diag_, m_, n_,
-           alpha_, dA_, lda_,
-                   dB_, ldb_ );
-    }
+    // compute groups of tiny problems in the compact format
+    std::vector<char> packed = blas::internal::batch_trsm_compact(
+        layout, side, uplo, trans, diag, m, n, alpha, Aarray, ldda, Barray, lddb,
+        batch, info.size() > 0 );
+
+    bool uniform = (side.size() == 1 && m.size() == 1 && n.size() == 1);
+    blas::batch::schedule_batch(
+        batch, schedule, uniform, info,
+        [&]( size_t i ) {
+            if (! packed.empty() && packed[ i ])
+                return 0.0;
+            return blas::Gflop<std::complex<double>>::trsm( blas::batch::extract<Side>(side, i),
+                                                            blas::batch::extract<int64_t>(m, i),
+                                                            blas::batch::extract<int64_t>(n, i) );
+        },
+        [&]( size_t i ) -> int64_t {
+            if (! packed.empty() && packed[ i ])
+                return 0;  // computed in compact format
+            if (info.size() > 0) {
+                int64_t info_ = blas::batch::trsm_check_one(
+                                    layout, side, uplo, trans, diag, m, n, ldda, lddb, i );
+                if (info_ != 0)
+                    return info_;  // skip invalid problem
+            }
+           Side side_   = blas::batch::extract<Side>(side, i);
+           Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
+           Op   trans_  = blas::batch::extract<Op>(trans, i);
+           Diag diag_   = blas::batch::extract<Diag>(diag, i);
+           int64_t m_   = blas::batch::extract<int64_t>(m, i);
+           int64_t n_   = blas::batch::extract<int64_t>(n, i);
+           int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
+           int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
+           std::complex<double> alpha_ = blas::batch::extract<std::complex<double> >(alpha, i);
+           std::complex<double>* dA_   = blas::batch::extract<std::complex<double>*>(Aarray, i);
+           std::complex<double>* dB_   = blas::batch::extract<std::complex<double>*>(Barray, i);
+           blas::trsm(
+               layout, side_, uplo_, trans_, diag_, m_, n_,
+               alpha_, dA_, lda_,
+                       dB_, ldb_ );
+            return 0;
+        } );
 }
@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -20,6 +22,8 @@ void copy(
     float const *x, int64_t incx,
     float       *y, int64_t incy )
 {
+    blas_trace( "copy", 's', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
@@ -27,9 +31,18 @@ void copy(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::copy_split( n, x, incx, y, incy );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            copy< float, float >( n, x, incx, y, incy );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -45,6 +58,8 @@ void copy(
     double const *x, int64_t incx,
     double       *y, int64_t incy )
 {
+    blas_trace( "copy", 'd', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
@@ -52,9 +67,18 @@ void copy(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::copy_split( n, x, incx, y, incy );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            copy< double, double >( n, x, incx, y, incy );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -70,6 +94,8 @@ void copy(
     std::complex<float> const *x, int64_t incx,
     std::complex<float>       *y, int64_t incy )
 {
+    blas_trace( "copy", 'c', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
@@ -77,9 +103,19 @@ void copy(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::copy_split( n, x, incx, y, incy );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            copy< std::complex<float>, std::complex<float> >(
+                n, x, incx, y, incy );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -97,6 +133,8 @@ void copy(
     std::complex<double> const *x, int64_t incx,
     std::complex<double>       *y, int64_t incy )
 {
+    blas_trace( "copy", 'z', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
@@ -104,9 +142,19 @@ void copy(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::copy_split( n, x, incx, y, incy );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            copy< std::complex<double>, std::complex<double> >(
+                n, x, incx, y, incy );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -1175,6 +1175,110 @@ void batch_zgemm(
             batch_size ) );
 }
 
+// -----------------------------------------------------------------------------
+// batch sgemm, strided
+void batch_sgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    float alpha,
+    float const *dA, device_blas_int ldda, int64_t strideA,
+    float const *dB, device_blas_int lddb, int64_t strideB,
+    float beta,
+    float       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size)
+{
+    blas_dev_call(
+        cublasSgemmStridedBatched(
+            queue.handle(),
+            op2cublas(transA), op2cublas(transB),
+            m, n, k,
+            &alpha,
+            dA, ldda, strideA,
+            dB, lddb, strideB,
+            &beta,
+            dC, lddc, strideC,
+            batch_size ) );
+}
+
+// -----------------------------------------------------------------------------
+// batch dgemm, strided
+void batch_dgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    double alpha,
+    double const *dA, device_blas_int ldda, int64_t strideA,
+    double const *dB, device_blas_int lddb, int64_t strideB,
+    double beta,
+    double       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size)
+{
+    blas_dev_call(
+        cublasDgemmStridedBatched(
+            queue.handle(),
+            op2cublas(transA), op2cublas(transB),
+            m, n, k,
+            &alpha,
+            dA, ldda, strideA,
+            dB, lddb, strideB,
+            &beta,
+            dC, lddc, strideC,
+            batch_size ) );
+}
+
+// -----------------------------------------------------------------------------
+// batch cgemm, strided
+void batch_cgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, device_blas_int ldda, int64_t strideA,
+    std::complex<float> const *dB, device_blas_int lddb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size)
+{
+    blas_dev_call(
+        cublasCgemmStridedBatched(
+            queue.handle(),
+            op2cublas(transA), op2cublas(transB),
+            m, n, k,
+            (cuComplex*) &alpha,
+            (cuComplex const*) dA, ldda, strideA,
+            (cuComplex const*) dB, lddb, strideB,
+            (cuComplex*) &beta,
+            (cuComplex*) dC, lddc, strideC,
+            batch_size ) );
+}
+
+// -----------------------------------------------------------------------------
+// batch zgemm, strided
+void batch_zgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, device_blas_int ldda, int64_t strideA,
+    std::complex<double> const *dB, device_blas_int lddb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size)
+{
+    blas_dev_call(
+        cublasZgemmStridedBatched(
+            queue.handle(),
+            op2cublas(transA), op2cublas(transB),
+            m, n, k,
+            (cuDoubleComplex*) &alpha,
+            (cuDoubleComplex const*) dA, ldda, strideA,
+            (cuDoubleComplex const*) dB, lddb, strideB,
+            (cuDoubleComplex*) &beta,
+            (cuDoubleComplex*) dC, lddc, strideC,
+            batch_size ) );
+}
+
 // -----------------------------------------------------------------------------
 // batch strsm
 void batch_strsm(
@@ -6,6 +6,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -21,6 +22,8 @@ void blas::axpy(
     float *dy, int64_t incdy,
     blas::Queue& queue)
 {
+    blas_trace( "axpy", 's', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );       // standard BLAS returns, doesn't fail
     blas_error_if( incdx == 0 );  // standard BLAS returns, doesn't fail
@@ -53,6 +56,8 @@ void blas::axpy(
     double *dy, int64_t incdy,
     blas::Queue& queue)
 {
+    blas_trace( "axpy", 'd', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );       // standard BLAS returns, doesn't fail
     blas_error_if( incdx == 0 );  // standard BLAS returns, doesn't fail
@@ -85,6 +90,8 @@ void blas::axpy(
     std::complex<float> *dy, int64_t incdy,
     blas::Queue& queue)
 {
+    blas_trace( "axpy", 'c', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );       // standard BLAS returns, doesn't fail
     blas_error_if( incdx == 0 );  // standard BLAS returns, doesn't fail
@@ -117,6 +124,8 @@ void blas::axpy(
     std::complex<double> *dy, int64_t incdy,
     blas::Queue& queue)
 {
+    blas_trace( "axpy", 'z', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );       // standard BLAS returns, doesn't fail
     blas_error_if( incdx == 0 );  // standard BLAS returns, doesn't fail
@@ -7,10 +7,87 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 #include <cstring>
 
+namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Variable-size batch gemm: groups problems with equal arguments, and runs
+/// each group of 2 or more problems through the fixed-size batched path.
+/// One stream per group, up to the queue's fork size.
+/// Arguments are assumed checked.
+template <typename T>
+void batch_gemm_grouped(
+    blas::Layout                 layout,
+    std::vector<blas::Op> const &transA,
+    std::vector<blas::Op> const &transB,
+    std::vector<int64_t>  const &m,
+    std::vector<int64_t>  const &n,
+    std::vector<int64_t>  const &k,
+    std::vector<T >       const &alpha,
+    std::vector<T*>       const &Aarray, std::vector<int64_t> const &ldda,
+    std::vector<T*>       const &Barray, std::vector<int64_t> const &lddb,
+    std::vector<T >       const &beta,
+    std::vector<T*>       const &Carray, std::vector<int64_t> const &lddc,
+    const size_t batch,
+    blas::Queue &queue )
+{
+    using blas::batch::extract;
+
+    std::vector< std::vector<size_t> > groups = blas::batch::gemm_groups(
+        transA, transB, m, n, k, alpha, ldda, lddb, beta, lddc, batch );
+
+    std::vector<int64_t> info_none;
+    queue.fork( groups.size() );
+    for (auto const& group : groups) {
+        size_t i = group[ 0 ];
+        size_t group_size = group.size();
+        if (group_size == 1) {
+            blas::gemm(
+                layout, extract<Op>(transA, i), extract<Op>(transB, i),
+                extract<int64_t>(m, i), extract<int64_t>(n, i),
+                extract<int64_t>(k, i),
+                extract<T>(alpha, i), extract<T*>(Aarray, i),
+                                      extract<int64_t>(ldda, i),
+                                      extract<T*>(Barray, i),
+                                      extract<int64_t>(lddb, i),
+                extract<T>(beta, i),  extract<T*>(Carray, i),
+                                      extract<int64_t>(lddc, i), queue );
+        }
+        else {
+            std::vector<T*> Agroup( group_size ), Bgroup( group_size ),
+                            Cgroup( group_size );
+            for (size_t j = 0; j < group_size; ++j) {
+                Agroup[ j ] = extract<T*>(Aarray, group[ j ]);
+                Bgroup[ j ] = extract<T*>(Barray, group[ j ]);
+                Cgroup[ j ] = extract<T*>(Carray, group[ j ]);
+            }
+            blas::batch::gemm(
+                layout,
+                std::vector<blas::Op>( 1, extract<Op>(transA, i) ),
+                std::vector<blas::Op>( 1, extract<Op>(transB, i) ),
+                std::vector<int64_t>( 1, extract<int64_t>(m, i) ),
+                std::vector<int64_t>( 1, extract<int64_t>(n, i) ),
+                std::vector<int64_t>( 1, extract<int64_t>(k, i) ),
+                std::vector<T>( 1, extract<T>(alpha, i) ),
+                Agroup, std::vector<int64_t>( 1, extract<int64_t>(ldda, i) ),
+                Bgroup, std::vector<int64_t>( 1, extract<int64_t>(lddb, i) ),
+                std::vector<T>( 1, extract<T>(beta, i) ),
+                Cgroup, std::vector<int64_t>( 1, extract<int64_t>(lddc, i) ),
+                group_size, info_none, queue );
+        }
+        queue.revolve();
+    }
+    queue.join();
+}
+
+}  // namespace internal
+}  // namespace blas
+
 // -----------------------------------------------------------------------------
 /// @ingroup gemm
 void blas::batch::gemm(
@@ -28,6 +105,9 @@ void blas::batch::gemm(
     const size_t batch,                  std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_gemm", 's', { layout, transA, transB }, { m, n, k },
+                batch, queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -71,17 +151,17 @@ void blas::batch::gemm(
 
         size_t batch_limit = queue.get_batch_limit();
         float **dAarray, **dBarray, **dCarray;
-        dAarray = (float**)queue.get_dev_ptr_array();
-        dBarray = dAarray + batch_limit;
-        dCarray = dBarray + batch_limit;
 
         for (size_t ib = 0; ib < batch; ib += batch_limit) {
             size_t ibatch = std::min( batch_limit, batch-ib );
 
-            // copy Aarray, Barray, and Carray to device
-            device_setvector<float*>(ibatch, (float**)&Aarray[ib], 1, dAarray, 1, queue);
-            device_setvector<float*>(ibatch, (float**)&Barray[ib], 1, dBarray, 1, queue);
-            device_setvector<float*>(ibatch, (float**)&Carray[ib], 1, dCarray, 1, queue);
+            // copy pointer arrays to device, overlapping the previous kernel
+            dAarray = (float**) queue.set_dev_ptr_arrays(
+                          ibatch, (void* const*) &Aarray[ ib ],
+                                  (void* const*) &Barray[ ib ],
+                                  (void* const*) &Carray[ ib ] );
+            dBarray = dAarray + batch_limit;
+            dCarray = dBarray + batch_limit;
 
             if (layout == Layout::RowMajor) {
                 // swap transA <=> transB, m <=> n, B <=> A
@@ -103,29 +183,10 @@ void blas::batch::gemm(
         }
     }
     else {
-        queue.fork();
-        for (size_t i = 0; i < batch; ++i) {
-            blas::Op transA_ = blas::batch::extract<Op>(transA, i);
-            blas::Op transB_ = blas::batch::extract<Op>(transB, i);
-            int64_t m_   = blas::batch::extract<int64_t>(m, i);
-            int64_t n_   = blas::batch::extract<int64_t>(n, i);
-            int64_t k_   = blas::batch::extract<int64_t>(k, i);
-            int64_t lda_ = blas::batch::extract<int64_t>(ldda, i);
-            int64_t ldb_ = blas::batch::extract<int64_t>(lddb, i);
-            int64_t ldc_ = blas::batch::extract<int64_t>(lddc, i);
-            float alpha_ = blas::batch::extract<float>(alpha, i);
-            float beta_  = blas::batch::extract<float>(beta, i);
-            float* dA_   = blas::batch::extract<float*>(Aarray, i);
-            float* dB_   = blas::batch::extract<float*>(Barray, i);
-            float* dC_   = blas::batch::extract<float*>(Carray, i);
-            blas::gemm(
-                layout, transA_, transB_, m_, n_, k_,
-                alpha_, dA_, lda_,
-                        dB_, ldb_,
-                beta_,  dC_, ldc_, queue );
-            queue.revolve();
-        }
-        queue.join();
+        blas::internal::batch_gemm_grouped(
+            layout, transA, transB, m, n, k,
+            alpha, Aarray, ldda, Barray, lddb, beta, Carray, lddc,
+            batch, queue );
     }
 }
 
@@ -146,6 +207,9 @@ void blas::batch::gemm(
     const size_t batch,                  std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_gemm", 'd', { layout, transA, transB }, { m, n, k },
+                batch, queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -188,17 +252,17 @@ void blas::batch::gemm(
 
         size_t batch_limit = queue.get_batch_limit();
         double **dAarray, **dBarray, **dCarray;
-        dAarray = (double**)queue.get_dev_ptr_array();
-        dBarray = dAarray + batch_limit;
-        dCarray = dBarray + batch_limit;
 
         for (size_t ib = 0; ib < batch; ib += batch_limit) {
             size_t ibatch = std::min( batch_limit, batch-ib );
 
-            // copy Aarray, Barray, and Carray to device
-            device_setvector<double*>(ibatch, (double**)&Aarray[ib], 1, dAarray, 1, queue);
-            device_setvector<double*>(ibatch, (double**)&Barray[ib], 1, dBarray, 1, queue);
-            device_setvector<double*>(ibatch, (double**)&Carray[ib], 1, dCarray, 1, queue);
+            // copy pointer arrays to device, overlapping the previous kernel
+            dAarray = (double**) queue.set_dev_ptr_arrays(
+                          ibatch, (void* const*) &Aarray[ ib ],
+                                  (void* const*) &Barray[ ib ],
+                                  (void* const*) &Carray[ ib ] );
+            dBarray = dAarray + batch_limit;
+            dCarray = dBarray + batch_limit;
 
             if (layout == Layout::RowMajor) {
                 // swap transA <=> transB, m <=> n, B <=> A
@@ -220,29 +284,10 @@ void blas::batch::gemm(
         }
     }
     else {
-        queue.fork();
-        for (size_t i = 0; i < batch; ++i) {
-            blas::Op transA_ = blas::batch::extract<Op>(transA, i);
-            blas::Op transB_ = blas::batch::extract<Op>(transB, i);
-            int64_t m_    = blas::batch::extract<int64_t>(m, i);
-            int64_t n_    = blas::batch::extract<int64_t>(n, i);
-            int64_t k_    = blas::batch::extract<int64_t>(k, i);
-            int64_t lda_  = blas::batch::extract<int64_t>(ldda, i);
-            int64_t ldb_  = blas::batch::extract<int64_t>(lddb, i);
-            int64_t ldc_  = blas::batch::extract<int64_t>(lddc, i);
-            double alpha_ = blas::batch::extract<double>(alpha, i);
-            double beta_  = blas::batch::extract<double>(beta, i);
-            double* dA_   = blas::batch::extract<double*>(Aarray, i);
-            double* dB_   = blas::batch::extract<double*>(Barray, i);
-            double* dC_   = blas::batch::extract<double*>(Carray, i);
-            blas::gemm(
-                layout, transA_, transB_, m_, n_, k_,
-                alpha_, dA_, lda_,
-                        dB_, ldb_,
-                beta_,  dC_, ldc_, queue );
-            queue.revolve();
-        }
-        queue.join();
+        blas::internal::batch_gemm_grouped(
+            layout, transA, transB, m, n, k,
+            alpha, Aarray, ldda, Barray, lddb, beta, Carray, lddc,
+            batch, queue );
     }
 }
 
@@ -263,6 +308,9 @@ void blas::batch::gemm(
     const size_t batch,                                  std::vector<int64_t>  &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_gemm", 'c', { layout, transA, transB }, { m, n, k },
+                batch, queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -306,17 +354,17 @@ void blas::batch::gemm(
 
         size_t batch_limit = queue.get_batch_limit();
         std::complex<float> **dAarray, **dBarray, **dCarray;
-        dAarray = (std::complex<float> **)queue.get_dev_ptr_array();
-        dBarray = dAarray + batch_limit;
-        dCarray = dBarray + batch_limit;
 
         for (size_t ib = 0; ib < batch; ib += batch_limit) {
             size_t ibatch = std::min( batch_limit, batch-ib );
 
-            // copy Aarray, Barray, and Carray to device
-            device_setvector< std::complex<float> *>(ibatch, (std::complex<float>**)&Aarray[ib], 1, dAarray, 1, queue);
-            device_setvector< std::complex<float> *>(ibatch, (std::complex<float>**)&Barray[ib], 1, dBarray, 1, queue);
-            device_setvector< std::complex<float> *>(ibatch, (std::complex<float>**)&Carray[ib], 1, dCarray, 1, queue);
+            // copy pointer arrays to device, overlapping the previous kernel
+            dAarray = (std::complex<float>**) queue.set_dev_ptr_arrays(
+                          ibatch, (void* const*) &Aarray[ ib ],
+                                  (void* const*) &Barray[ ib ],
+                                  (void* const*) &Carray[ ib ] );
+            dBarray = dAarray + batch_limit;
+            dCarray = dBarray + batch_limit;
 
             if (layout == Layout::RowMajor) {
                 // swap transA <=> transB, m <=> n, B <=> A
@@ -338,29 +386,10 @@ void blas::batch::gemm(
         }
     }
     else {
-        queue.fork();
-        for (size_t i = 0; i < batch; ++i) {
-            blas::Op transA_ = blas::batch::extract<Op>(transA, i);
-            blas::Op transB_ = blas::batch::extract<Op>(transB, i);
-            int64_t m_    = blas::batch::extract<int64_t>(m, i);
-            int64_t n_    = blas::batch::extract<int64_t>(n, i);
-            int64_t k_    = blas::batch::extract<int64_t>(k, i);
-            int64_t lda_  = blas::batch::extract<int64_t>(ldda, i);
-            int64_t ldb_  = blas::batch::extract<int64_t>(lddb, i);
-            int64_t ldc_  = blas::batch::extract<int64_t>(lddc, i);
-            std::complex<float> alpha_ = blas::batch::extract<std::complex<float> >(alpha, i);
-            std::complex<float> beta_  = blas::batch::extract<std::complex<float> >(beta, i);
-            std::complex<float>* dA_   = blas::batch::extract<std::complex<float>*>(Aarray, i);
-            std::complex<float>* dB_   = blas::batch::extract<std::complex<float>*>(Barray, i);
-            std::complex<float>* dC_   = blas::batch::extract<std::complex<float>*>(Carray, i);
-            blas::gemm(
-                layout, transA_, transB_, m_, n_, k_,
-                alpha_, dA_, lda_,
-                        dB_, ldb_,
-                beta_,  dC_, ldc_, queue );
-            queue.revolve();
-        }
-        queue.join();
+        blas::internal::batch_gemm_grouped(
+            layout, transA, transB, m, n, k,
+            alpha, Aarray, ldda, Barray, lddb, beta, Carray, lddc,
+            batch, queue );
     }
 }
 
@@ -381,6 +410,9 @@ void blas::batch::gemm(
     const size_t batch,                                   std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_gemm", 'z', { layout, transA, transB }, { m, n, k },
+                batch, queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -424,17 +456,17 @@ void blas::batch::gemm(
 
         size_t batch_limit = queue.get_batch_limit();
         std::complex<double> **dAarray, **dBarray, **dCarray;
-        dAarray = (std::complex<double> **)queue.get_dev_ptr_array();
-        dBarray = dAarray + batch_limit;
-        dCarray = dBarray + batch_limit;
 
         for (size_t ib = 0; ib < batch; ib += batch_limit) {
             size_t ibatch = std::min( batch_limit, batch-ib );
 
-            // copy Aarray, Barray, and Carray to device
-            device_setvector< std::complex<double> *>(ibatch, (std::complex<double>**)&Aarray[ib], 1, dAarray, 1, queue);
-            device_setvector< std::complex<double> *>(ibatch, (std::complex<double>**)&Barray[ib], 1, dBarray, 1, queue);
-            device_setvector< std::complex<double> *>(ibatch, (std::complex<double>**)&Carray[ib], 1, dCarray, 1, queue);
+            // copy pointer arrays to device, overlapping the previous kernel
+            dAarray = (std::complex<double>**) queue.set_dev_ptr_arrays(
+                          ibatch, (void* const*) &Aarray[ ib ],
+                                  (void* const*) &Barray[ ib ],
+                                  (void* const*) &Carray[ ib ] );
+            dBarray = dAarray + batch_limit;
+            dCarray = dBarray + batch_limit;
 
             if (layout == Layout::RowMajor) {
                 // swap transA <=> transB, m <=> n, B <=> A
@@ -456,29 +488,10 @@ void blas::batch::gemm(
         }
     }
     else {
-        queue.fork();
-        for (size_t i = 0; i < batch; ++i) {
-            blas::Op transA_ = blas::batch::extract<Op>(transA, i);
-            blas::Op transB_ = blas::batch::extract<Op>(transB, i);
-            int64_t m_    = blas::batch::extract<int64_t>(m, i);
-            int64_t n_    = blas::batch::extract<int64_t>(n, i);
-            int64_t k_    = blas::batch::extract<int64_t>(k, i);
-            int64_t lda_  = blas::batch::extract<int64_t>(ldda, i);
-            int64_t ldb_  = blas::batch::extract<int64_t>(lddb, i);
-            int64_t ldc_  = blas::batch::extract<int64_t>(lddc, i);
-            std::complex<double> alpha_ = blas::batch::extract<std::complex<double> >(alpha, i);
-            std::complex<double> beta_  = blas::batch::extract<std::complex<double> >(beta, i);
-            std::complex<double>* dA_   = blas::batch::extract<std::complex<double>*>(Aarray, i);
-            std::complex<double>* dB_   = blas::batch::extract<std::complex<double>*>(Barray, i);
-            std::complex<double>* dC_   = blas::batch::extract<std::complex<double>*>(Carray, i);
-            blas::gemm(
-                layout, transA_, transB_, m_, n_, k_,
-                alpha_, dA_, lda_,
-                        dB_, ldb_,
-                beta_,  dC_, ldc_, queue );
-            queue.revolve();
-        }
-        queue.join();
+        blas::internal::batch_gemm_grouped(
+            layout, transA, transB, m, n, k,
+            alpha, Aarray, ldda, Barray, lddb, beta, Carray, lddc,
+            batch, queue );
     }
 }
 
@@ -500,6 +513,9 @@ void blas::batch::gemm(
     std::vector<size_t>   const &group_size, std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_gemm", 's', { layout, transA, transB }, { m, n, k },
+                internal::trace_batch( group_size ), queue );
+
     size_t batch_size = 0;
     size_t group_count = group_size.size();
     if (group_count == 0)
@@ -551,7 +567,7 @@ void blas::batch::gemm(
 
     // if we have one group only, no need to fork
     if (group_count > 1)
-        queue.fork();
+        queue.fork( group_count );
 
     for (size_t ig = 0; ig < group_count; ig++) {
         // extract params for the current group
@@ -566,17 +582,16 @@ void blas::batch::gemm(
         device_blas_int lddc_   = (device_blas_int) lddc[ ig ];
 
         // each group is submitted to a different stream using strides of batch_limit
-        // first, get the device pointer array for the current stream
-        dAarray = (float**)queue.get_dev_ptr_array();
-        dBarray = dAarray + batch_limit;
-        dCarray = dBarray + batch_limit;
         for (size_t ib = 0; ib < batch; ib += batch_limit) {
             size_t ibatch = std::min( batch_limit, batch-ib );
 
-            // copy Aarray, Barray, and Carray to device
-            device_setvector<float*>(ibatch, (float**)&Aarray[ processed+ib ], 1, dAarray, 1, queue);
-            device_setvector<float*>(ibatch, (float**)&Barray[ processed+ib ], 1, dBarray, 1, queue);
-            device_setvector<float*>(ibatch, (float**)&Carray[ processed+ib ], 1, dCarray, 1, queue);
+            // copy pointer arrays to device, overlapping the previous kernel
+            dAarray = (float**) queue.set_dev_ptr_arrays(
+                          ibatch, (void* const*) &Aarray[ processed+ib ],
+                                  (void* const*) &Barray[ processed+ib ],
+                                  (void* const*) &Carray[ processed+ib ] );
+            dBarray = dAarray + batch_limit;
+            dCarray = dBarray + batch_limit;
 
             if (layout == Layout::RowMajor) {
                 // swap transA <=> transB, m <=> n, B <=> A
@@ -624,6 +639,9 @@ void blas::batch::gemm(
     std::vector<size_t>   const &group_size, std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_gemm", 'd', { layout, transA, transB }, { m, n, k },
+                internal::trace_batch( group_size ), queue );
+
     size_t batch_size = 0;
     size_t group_count = group_size.size();
     if (group_count == 0)
@@ -675,7 +693,7 @@ void blas::batch::gemm(
 
     // if we have one group only, no need to fork
     if (group_count > 1)
-        queue.fork();
+        queue.fork( group_count );
 
     for (size_t ig = 0; ig < group_count; ig++) {
         // extract params for the current group
@@ -690,17 +708,16 @@ void blas::batch::gemm(
         device_blas_int lddc_   = (device_blas_int) lddc[ ig ];
 
         // each group is submitted to a different stream using strides of batch_limit
-        // first, get the device pointer array for the current stream
-        dAarray = (double**)queue.get_dev_ptr_array();
-        dBarray = dAarray + batch_limit;
-        dCarray = dBarray + batch_limit;
         for (size_t ib = 0; ib < batch; ib += batch_limit) {
             size_t ibatch = std::min( batch_limit, batch-ib );
 
-            // copy Aarray, Barray, and Carray to device
-            device_setvector<double*>(ibatch, (double**)&Aarray[ processed+ib ], 1, dAarray, 1, queue);
-            device_setvector<double*>(ibatch, (double**)&Barray[ processed+ib ], 1, dBarray, 1, queue);
-            device_setvector<double*>(ibatch, (double**)&Carray[ processed+ib ], 1, dCarray, 1, queue);
+            // copy pointer arrays to device, overlapping the previous kernel
+            dAarray = (double**) queue.set_dev_ptr_arrays(
+                          ibatch, (void* const*) &Aarray[ processed+ib ],
+                                  (void* const*) &Barray[ processed+ib ],
+                                  (void* const*) &Carray[ processed+ib ] );
+            dBarray = dAarray + batch_limit;
+            dCarray = dBarray + batch_limit;
 
             if (layout == Layout::RowMajor) {
                 // swap transA <=> transB, m <=> n, B <=> A
@@ -748,6 +765,9 @@ void blas::batch::gemm(
     std::vector<size_t>   const &group_size, std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_gemm", 'c', { layout, transA, transB }, { m, n, k },
+                internal::trace_batch( group_size ), queue );
+
     size_t batch_size = 0;
     size_t group_count = group_size.size();
     if (group_count == 0)
@@ -799,7 +819,7 @@ void blas::batch::gemm(
 
     // if we have one group only, no need to fork
     if (group_count > 1)
-        queue.fork();
+        queue.fork( group_count );
 
     for (size_t ig = 0; ig < group_count; ig++) {
         // extract params for the current group
@@ -814,17 +834,16 @@ void blas::batch::gemm(
         device_blas_int lddc_   = (device_blas_int) lddc[ ig ];
 
         // each group is submitted to a different stream using strides of batch_limit
-        // first, get the device pointer array for the current stream
-        dAarray = (std::complex<float>**)queue.get_dev_ptr_array();
-        dBarray = dAarray + batch_limit;
-        dCarray = dBarray + batch_limit;
         for (size_t ib = 0; ib < batch; ib += batch_limit) {
             size_t ibatch = std::min( batch_limit, batch-ib );
 
-            // copy Aarray, Barray, and Carray to device
-            device_setvector<std::complex<float>*>(ibatch, (std::complex<float>**)&Aarray[ processed+ib ], 1, dAarray, 1, queue);
-            device_setvector<std::complex<float>*>(ibatch, (std::complex<float>**)&Barray[ processed+ib ], 1, dBarray, 1, queue);
-            device_setvector<std::complex<float>*>(ibatch, (std::complex<float>**)&Carray[ processed+ib ], 1, dCarray, 1, queue);
+            // copy pointer arrays to device, overlapping the previous kernel
+            dAarray = (std::complex<float>**) queue.set_dev_ptr_arrays(
+                          ibatch, (void* const*) &Aarray[ processed+ib ],
+                                  (void* const*) &Barray[ processed+ib ],
+                                  (void* const*) &Carray[ processed+ib ] );
+            dBarray = dAarray + batch_limit;
+            dCarray = dBarray + batch_limit;
 
             if (layout == Layout::RowMajor) {
                 // swap transA <=> transB, m <=> n, B <=> A
@@ -872,6 +891,9 @@ void blas::batch::gemm(
     std::vector<size_t>   const &group_size, std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_gemm", 'z', { layout, transA, transB }, { m, n, k },
+                internal::trace_batch( group_size ), queue );
+
     size_t batch_size = 0;
     size_t group_count = group_size.size();
     if (group_count == 0)
@@ -923,7 +945,7 @@ void blas::batch::gemm(
 
     // if we have one group only, no need to fork
     if (group_count > 1)
-        queue.fork();
+        queue.fork( group_count );
 
     for (size_t ig = 0; ig < group_count; ig++) {
         // extract params for the current group
@@ -938,17 +960,16 @@ void blas::batch::gemm(
         device_blas_int lddc_   = (device_blas_int) lddc[ ig ];
 
         // each group is submitted to a different stream using strides of batch_limit
-        // first, get the device pointer array for the current stream
-        dAarray = (std::complex<double>**)queue.get_dev_ptr_array();
-        dBarray = dAarray + batch_limit;
-        dCarray = dBarray + batch_limit;
         for (size_t ib = 0; ib < batch; ib += batch_limit) {
             size_t ibatch = std::min( batch_limit, batch-ib );
 
-            // copy Aarray, Barray, and Carray to device
-            device_setvector<std::complex<double>*>(ibatch, (std::complex<double>**)&Aarray[ processed+ib ], 1, dAarray, 1, queue);
-            device_setvector<std::complex<double>*>(ibatch, (std::complex<double>**)&Barray[ processed+ib ], 1, dBarray, 1, queue);
-            device_setvector<std::complex<double>*>(ibatch, (std::complex<double>**)&Carray[ processed+ib ], 1, dCarray, 1, queue);
+            // copy pointer arrays to device, overlapping the previous kernel
+            dAarray = (std::complex<double>**) queue.set_dev_ptr_arrays(
+                          ibatch, (void* const*) &Aarray[ processed+ib ],
+                                  (void* const*) &Barray[ processed+ib ],
+                                  (void* const*) &Carray[ processed+ib ] );
+            dBarray = dAarray + batch_limit;
+            dCarray = dBarray + batch_limit;
 
             if (layout == Layout::RowMajor) {
                 // swap transA <=> transB, m <=> n, B <=> A
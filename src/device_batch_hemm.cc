@@ -7,6 +7,7 @@
 #include <cstring>
 #include "blas/batch_common.hh"
 #include "blas/device_blas.hh"
+#include "trace.hh"
 
 // -----------------------------------------------------------------------------
 /// @ingroup hemm
@@ -24,6 +25,9 @@ void blas::batch::hemm(
     const size_t batch,                    std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_hemm", 's', { layout, side, uplo }, { m, n }, batch,
+                queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -42,7 +46,7 @@ void blas::batch::hemm(
     blas::set_device( queue.device() );
     #endif
 
-    queue.fork();
+    queue.fork( batch );
     for (size_t i = 0; i < batch; ++i) {
         Side side_   = blas::batch::extract<Side>(side, i);
         Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
@@ -82,6 +86,9 @@ void blas::batch::hemm(
     const size_t batch,                    std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_hemm", 'd', { layout, side, uplo }, { m, n }, batch,
+                queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -100,7 +107,7 @@ void blas::batch::hemm(
     blas::set_device( queue.device() );
     #endif
 
-    queue.fork();
+    queue.fork( batch );
     for (size_t i = 0; i < batch; ++i) {
         Side side_   = blas::batch::extract<Side>(side, i);
         Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
@@ -140,6 +147,9 @@ void blas::batch::hemm(
     const size_t batch,                    std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_hemm", 'c', { layout, side, uplo }, { m, n }, batch,
+                queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -158,7 +168,7 @@ void blas::batch::hemm(
     blas::set_device( queue.device() );
     #endif
 
-    queue.fork();
+    queue.fork( batch );
     for (size_t i = 0; i < batch; ++i) {
         Side side_   = blas::batch::extract<Side>(side, i);
         Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
@@ -198,6 +208,9 @@ void blas::batch::hemm(
     const size_t batch,                    std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_hemm", 'z', { layout, side, uplo }, { m, n }, batch,
+                queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -216,7 +229,7 @@ void blas::batch::hemm(
     blas::set_device( queue.device() );
     #endif
 
-    queue.fork();
+    queue.fork( batch );
     for (size_t i = 0; i < batch; ++i) {
         Side side_   = blas::batch::extract<Side>(side, i);
         Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
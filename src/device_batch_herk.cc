@@ -7,6 +7,7 @@
 #include <cstring>
 #include "blas/batch_common.hh"
 #include "blas/device_blas.hh"
+#include "trace.hh"
 
 // -----------------------------------------------------------------------------
 /// @ingroup herk
@@ -23,6 +24,9 @@ void blas::batch::herk(
     const size_t batch,                    std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_herk", 's', { layout, uplo, trans }, { n, k }, batch,
+                queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -40,7 +44,7 @@ void blas::batch::herk(
     blas::set_device( queue.device() );
     #endif
 
-    queue.fork();
+    queue.fork( batch );
     for (size_t i = 0; i < batch; ++i) {
         Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
         Op   trans_  = blas::batch::extract<Op>(trans, i);
@@ -76,6 +80,9 @@ void blas::batch::herk(
     const size_t batch,                     std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_herk", 'd', { layout, uplo, trans }, { n, k }, batch,
+                queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -93,7 +100,7 @@ void blas::batch::herk(
     blas::set_device( queue.device() );
     #endif
 
-    queue.fork();
+    queue.fork( batch );
     for (size_t i = 0; i < batch; ++i) {
         Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
         Op   trans_  = blas::batch::extract<Op>(trans, i);
@@ -129,6 +136,9 @@ void blas::batch::herk(
     const size_t batch, std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_herk", 's', { layout, uplo, trans }, { n, k }, batch,
+                queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -146,7 +156,7 @@ void blas::batch::herk(
     blas::set_device( queue.device() );
     #endif
 
-    queue.fork();
+    queue.fork( batch );
     for (size_t i = 0; i < batch; ++i) {
         Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
         Op   trans_  = blas::batch::extract<Op>(trans, i);
@@ -182,6 +192,9 @@ void blas::batch::herk(
     const size_t batch, std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_herk", 'd', { layout, uplo, trans }, { n, k }, batch,
+                queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -199,7 +212,7 @@ void blas::batch::herk(
     blas::set_device( queue.device() );
     #endif
 
-    queue.fork();
+    queue.fork( batch );
     for (size_t i = 0; i < batch; ++i) {
         Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
         Op   trans_  = blas::batch::extract<Op>(trans, i);
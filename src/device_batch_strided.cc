@@ -0,0 +1,1170 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas/device_blas.hh"
+
+#include "device_internal.hh"
+#include "trace.hh"
+
+#include <limits>
+
+namespace blas {
+namespace internal {
+
+// -----------------------------------------------------------------------------
+// Checks arguments of a strided batch gemm, as for a single gemm.
+void gemm_strided_check(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int64_t ldda, int64_t lddb, int64_t lddc,
+    size_t batch )
+{
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    if ((transA == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( ldda < m );
+    else
+        blas_error_if( ldda < k );
+
+    if ((transB == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( lddb < k );
+    else
+        blas_error_if( lddb < n );
+
+    if (layout == Layout::ColMajor)
+        blas_error_if( lddc < m );
+    else
+        blas_error_if( lddc < n );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(device_blas_int)) {
+        blas_error_if( m     > std::numeric_limits<device_blas_int>::max() );
+        blas_error_if( n     > std::numeric_limits<device_blas_int>::max() );
+        blas_error_if( k     > std::numeric_limits<device_blas_int>::max() );
+        blas_error_if( ldda  > std::numeric_limits<device_blas_int>::max() );
+        blas_error_if( lddb  > std::numeric_limits<device_blas_int>::max() );
+        blas_error_if( lddc  > std::numeric_limits<device_blas_int>::max() );
+    }
+    blas_error_if( batch > size_t( std::numeric_limits<device_blas_int>::max() ) );
+}
+
+// -----------------------------------------------------------------------------
+// Runs problem( i ) for each problem in a strided batch, on parallel
+// streams. Problem 0 runs first, on the main stream: arguments are the
+// same for every problem, so it checks them for the whole batch.
+template <typename Problem>
+void strided_batch( size_t batch, blas::Queue& queue, Problem problem )
+{
+    if (batch == 0)
+        return;
+
+    problem( 0 );
+
+    queue.fork( batch - 1 );
+    for (size_t i = 1; i < batch; ++i) {
+        problem( int64_t( i ) );
+        queue.revolve();
+    }
+    queue.join();
+}
+
+}  // namespace internal
+}  // namespace blas
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float const *dB, int64_t lddb, int64_t strideB,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_gemm_strided", 's', { layout, transA, transB },
+                { m, n, k }, batch, queue );
+
+    blas::internal::gemm_strided_check(
+        layout, transA, transB, m, n, k, ldda, lddb, lddc, batch );
+
+    // quick return
+    if (batch == 0)
+        return;
+
+    device_blas_int m_      = (device_blas_int) m;
+    device_blas_int n_      = (device_blas_int) n;
+    device_blas_int k_      = (device_blas_int) k;
+    device_blas_int ldda_   = (device_blas_int) ldda;
+    device_blas_int lddb_   = (device_blas_int) lddb;
+    device_blas_int lddc_   = (device_blas_int) lddc;
+    device_blas_int batch_  = (device_blas_int) batch;
+
+    #ifndef BLAS_HAVE_ONEMKL
+    blas::set_device( queue.device() );
+    #endif
+    if (layout == Layout::RowMajor) {
+        // swap transA <=> transB, m <=> n, B <=> A
+        device::batch_sgemm_strided(
+                queue, transB, transA,
+                n_, m_, k_,
+                alpha, dB, lddb_, strideB, dA, ldda_, strideA,
+                beta,  dC, lddc_, strideC, batch_ );
+    }
+    else {
+        device::batch_sgemm_strided(
+                queue, transA, transB,
+                m_, n_, k_,
+                alpha, dA, ldda_, strideA, dB, lddb_, strideB,
+                beta,  dC, lddc_, strideC, batch_ );
+    }
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double const *dB, int64_t lddb, int64_t strideB,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_gemm_strided", 'd', { layout, transA, transB },
+                { m, n, k }, batch, queue );
+
+    blas::internal::gemm_strided_check(
+        layout, transA, transB, m, n, k, ldda, lddb, lddc, batch );
+
+    // quick return
+    if (batch == 0)
+        return;
+
+    device_blas_int m_      = (device_blas_int) m;
+    device_blas_int n_      = (device_blas_int) n;
+    device_blas_int k_      = (device_blas_int) k;
+    device_blas_int ldda_   = (device_blas_int) ldda;
+    device_blas_int lddb_   = (device_blas_int) lddb;
+    device_blas_int lddc_   = (device_blas_int) lddc;
+    device_blas_int batch_  = (device_blas_int) batch;
+
+    #ifndef BLAS_HAVE_ONEMKL
+    blas::set_device( queue.device() );
+    #endif
+    if (layout == Layout::RowMajor) {
+        // swap transA <=> transB, m <=> n, B <=> A
+        device::batch_dgemm_strided(
+                queue, transB, transA,
+                n_, m_, k_,
+                alpha, dB, lddb_, strideB, dA, ldda_, strideA,
+                beta,  dC, lddc_, strideC, batch_ );
+    }
+    else {
+        device::batch_dgemm_strided(
+                queue, transA, transB,
+                m_, n_, k_,
+                alpha, dA, ldda_, strideA, dB, lddb_, strideB,
+                beta,  dC, lddc_, strideC, batch_ );
+    }
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_gemm_strided", 'c', { layout, transA, transB },
+                { m, n, k }, batch, queue );
+
+    blas::internal::gemm_strided_check(
+        layout, transA, transB, m, n, k, ldda, lddb, lddc, batch );
+
+    // quick return
+    if (batch == 0)
+        return;
+
+    device_blas_int m_      = (device_blas_int) m;
+    device_blas_int n_      = (device_blas_int) n;
+    device_blas_int k_      = (device_blas_int) k;
+    device_blas_int ldda_   = (device_blas_int) ldda;
+    device_blas_int lddb_   = (device_blas_int) lddb;
+    device_blas_int lddc_   = (device_blas_int) lddc;
+    device_blas_int batch_  = (device_blas_int) batch;
+
+    #ifndef BLAS_HAVE_ONEMKL
+    blas::set_device( queue.device() );
+    #endif
+    if (layout == Layout::RowMajor) {
+        // swap transA <=> transB, m <=> n, B <=> A
+        device::batch_cgemm_strided(
+                queue, transB, transA,
+                n_, m_, k_,
+                alpha, dB, lddb_, strideB, dA, ldda_, strideA,
+                beta,  dC, lddc_, strideC, batch_ );
+    }
+    else {
+        device::batch_cgemm_strided(
+                queue, transA, transB,
+                m_, n_, k_,
+                alpha, dA, ldda_, strideA, dB, lddb_, strideB,
+                beta,  dC, lddc_, strideC, batch_ );
+    }
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemm
+void blas::batch::gemm_strided(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_gemm_strided", 'z', { layout, transA, transB },
+                { m, n, k }, batch, queue );
+
+    blas::internal::gemm_strided_check(
+        layout, transA, transB, m, n, k, ldda, lddb, lddc, batch );
+
+    // quick return
+    if (batch == 0)
+        return;
+
+    device_blas_int m_      = (device_blas_int) m;
+    device_blas_int n_      = (device_blas_int) n;
+    device_blas_int k_      = (device_blas_int) k;
+    device_blas_int ldda_   = (device_blas_int) ldda;
+    device_blas_int lddb_   = (device_blas_int) lddb;
+    device_blas_int lddc_   = (device_blas_int) lddc;
+    device_blas_int batch_  = (device_blas_int) batch;
+
+    #ifndef BLAS_HAVE_ONEMKL
+    blas::set_device( queue.device() );
+    #endif
+    if (layout == Layout::RowMajor) {
+        // swap transA <=> transB, m <=> n, B <=> A
+        device::batch_zgemm_strided(
+                queue, transB, transA,
+                n_, m_, k_,
+                alpha, dB, lddb_, strideB, dA, ldda_, strideA,
+                beta,  dC, lddc_, strideC, batch_ );
+    }
+    else {
+        device::batch_zgemm_strided(
+                queue, transA, transB,
+                m_, n_, k_,
+                alpha, dA, ldda_, strideA, dB, lddb_, strideB,
+                beta,  dC, lddc_, strideC, batch_ );
+    }
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup hemm
+void blas::batch::hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float const *dB, int64_t lddb, int64_t strideB,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_hemm_strided", 's', { layout, side, uplo }, { m, n },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::hemm(
+            layout, side, uplo, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup hemm
+void blas::batch::hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double const *dB, int64_t lddb, int64_t strideB,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_hemm_strided", 'd', { layout, side, uplo }, { m, n },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::hemm(
+            layout, side, uplo, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup hemm
+void blas::batch::hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_hemm_strided", 'c', { layout, side, uplo }, { m, n },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::hemm(
+            layout, side, uplo, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup hemm
+void blas::batch::hemm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_hemm_strided", 'z', { layout, side, uplo }, { m, n },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::hemm(
+            layout, side, uplo, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup her2k
+void blas::batch::her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float const *dB, int64_t lddb, int64_t strideB,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_her2k_strided", 's', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::her2k(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup her2k
+void blas::batch::her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double const *dB, int64_t lddb, int64_t strideB,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_her2k_strided", 'd', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::her2k(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup her2k
+void blas::batch::her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float> const *dB, int64_t lddb, int64_t strideB,
+    float beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_her2k_strided", 'c', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::her2k(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup her2k
+void blas::batch::her2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double> const *dB, int64_t lddb, int64_t strideB,
+    double beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_her2k_strided", 'z', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::her2k(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup herk
+void blas::batch::herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_herk_strided", 's', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::herk(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup herk
+void blas::batch::herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_herk_strided", 'd', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::herk(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup herk
+void blas::batch::herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    float beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_herk_strided", 's', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::herk(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup herk
+void blas::batch::herk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    double beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_herk_strided", 'd', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::herk(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup symm
+void blas::batch::symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float const *dB, int64_t lddb, int64_t strideB,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_symm_strided", 's', { layout, side, uplo }, { m, n },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::symm(
+            layout, side, uplo, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup symm
+void blas::batch::symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double const *dB, int64_t lddb, int64_t strideB,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_symm_strided", 'd', { layout, side, uplo }, { m, n },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::symm(
+            layout, side, uplo, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup symm
+void blas::batch::symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_symm_strided", 'c', { layout, side, uplo }, { m, n },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::symm(
+            layout, side, uplo, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup symm
+void blas::batch::symm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_symm_strided", 'z', { layout, side, uplo }, { m, n },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::symm(
+            layout, side, uplo, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syr2k
+void blas::batch::syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float const *dB, int64_t lddb, int64_t strideB,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_syr2k_strided", 's', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::syr2k(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syr2k
+void blas::batch::syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double const *dB, int64_t lddb, int64_t strideB,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_syr2k_strided", 'd', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::syr2k(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syr2k
+void blas::batch::syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_syr2k_strided", 'c', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::syr2k(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syr2k
+void blas::batch::syr2k_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double> const *dB, int64_t lddb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_syr2k_strided", 'z', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::syr2k(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syrk
+void blas::batch::syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float beta,
+    float       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_syrk_strided", 's', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::syrk(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syrk
+void blas::batch::syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double beta,
+    double       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_syrk_strided", 'd', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::syrk(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syrk
+void blas::batch::syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float> beta,
+    std::complex<float>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_syrk_strided", 'c', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::syrk(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup syrk
+void blas::batch::syrk_strided(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double> beta,
+    std::complex<double>       *dC, int64_t lddc, int64_t strideC,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_syrk_strided", 'z', { layout, uplo, trans }, { n, k },
+                batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::syrk(
+            layout, uplo, trans, n, k,
+            alpha, dA + i*strideA, ldda,
+            beta,  dC + i*strideC, lddc,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trmm
+void blas::batch::trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_trmm_strided", 's', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::trmm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trmm
+void blas::batch::trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_trmm_strided", 'd', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::trmm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trmm
+void blas::batch::trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float>       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_trmm_strided", 'c', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::trmm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trmm
+void blas::batch::trmm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double>       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_trmm_strided", 'z', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::trmm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsm
+void blas::batch::trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const *dA, int64_t ldda, int64_t strideA,
+    float       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_trsm_strided", 's', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::trsm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsm
+void blas::batch::trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const *dA, int64_t ldda, int64_t strideA,
+    double       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_trsm_strided", 'd', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::trsm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsm
+void blas::batch::trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<float>       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_trsm_strided", 'c', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::trsm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            queue );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsm
+void blas::batch::trsm_strided(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda, int64_t strideA,
+    std::complex<double>       *dB, int64_t lddb, int64_t strideB,
+    size_t batch,
+    blas::Queue &queue )
+{
+    blas_trace( "batch_trsm_strided", 'z', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
+    blas::internal::strided_batch( batch, queue, [&]( int64_t i ) {
+        blas::trsm(
+            layout, side, uplo, trans, diag, m, n,
+            alpha, dA + i*strideA, ldda,
+                   dB + i*strideB, lddb,
+            queue );
+    } );
+}
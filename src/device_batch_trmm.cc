@@ -7,6 +7,7 @@
 #include <cstring>
 #include "blas/batch_common.hh"
 #include "blas/device_blas.hh"
+#include "trace.hh"
 
 // -----------------------------------------------------------------------------
 /// @ingroup trmm
@@ -24,6 +25,9 @@ void blas::batch::trmm(
     const size_t batch,                    std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_trmm", 's', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -48,7 +52,7 @@ void blas::batch::trmm(
     #endif
 
     if (fork)
-        queue.fork();
+        queue.fork( batch );
     for (size_t i = 0; i < batch; ++i) {
         Side side_   = blas::batch::extract<Side>(side, i);
         Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
@@ -89,6 +93,9 @@ void blas::batch::trmm(
     const size_t batch,                     std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_trmm", 'd', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -113,7 +120,7 @@ void blas::batch::trmm(
     #endif
 
     if (fork)
-        queue.fork();
+        queue.fork( batch );
     for (size_t i = 0; i < batch; ++i) {
         Side side_   = blas::batch::extract<Side>(side, i);
         Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
@@ -154,6 +161,9 @@ void blas::batch::trmm(
     const size_t batch,                     std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_trmm", 'c', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -178,7 +188,7 @@ void blas::batch::trmm(
     #endif
 
     if (fork)
-        queue.fork();
+        queue.fork( batch );
     for (size_t i = 0; i < batch; ++i) {
         Side side_   = blas::batch::extract<Side>(side, i);
         Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
@@ -218,6 +228,9 @@ void blas::batch::trmm(
     const size_t batch,                     std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_trmm", 'z', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -242,7 +255,7 @@ void blas::batch::trmm(
     #endif
 
     if (fork)
-        queue.fork();
+        queue.fork( batch );
     for (size_t i = 0; i < batch; ++i) {
         Side side_   = blas::batch::extract<Side>(side, i);
         Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
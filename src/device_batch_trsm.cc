@@ -7,6 +7,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 #include <cstring>
@@ -27,6 +28,9 @@ void blas::batch::trsm(
     const size_t batch,                    std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_trsm", 's', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -76,15 +80,16 @@ void blas::batch::trsm(
 
         size_t batch_limit = queue.get_batch_limit();
         float **dAarray, **dBarray;
-        dAarray = (float**)queue.get_dev_ptr_array();
-        dBarray = dAarray + batch_limit;
 
         for (size_t ib = 0; ib < batch; ib += batch_limit) {
             size_t ibatch = std::min( batch_limit, batch-ib );
 
-            // copy pointer array(s) to device
-            device_setvector<float*>(ibatch, (float**)&Aarray[ib], 1, dAarray, 1, queue);
-            device_setvector<float*>(ibatch, (float**)&Barray[ib], 1, dBarray, 1, queue);
+            // copy pointer arrays to device, overlapping the previous kernel
+            dAarray = (float**) queue.set_dev_ptr_arrays(
+                          ibatch, (void* const*) &Aarray[ ib ],
+                                  (void* const*) &Barray[ ib ],
+                                  nullptr );
+            dBarray = dAarray + batch_limit;
 
             device::batch_strsm( queue,
                                 side_, uplo_, trans_, diag_,
@@ -94,7 +99,8 @@ void blas::batch::trsm(
         }
     }
     else {
-        queue.fork();
+        // one stream per problem, up to the queue's fork size
+        queue.fork( batch );
         for (size_t i = 0; i < batch; ++i) {
             Side side_   = blas::batch::extract<Side>(side, i);
             Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
@@ -134,6 +140,9 @@ void blas::batch::trsm(
     const size_t batch,                     std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_trsm", 'd', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -183,15 +192,16 @@ void blas::batch::trsm(
 
         size_t batch_limit = queue.get_batch_limit();
         double **dAarray, **dBarray;
-        dAarray = (double**)queue.get_dev_ptr_array();
-        dBarray = dAarray + batch_limit;
 
         for (size_t ib = 0; ib < batch; ib += batch_limit) {
             size_t ibatch = std::min( batch_limit, batch-ib );
 
-            // copy pointer array(s) to device
-            device_setvector<double*>(ibatch, (double**)&Aarray[ib], 1, dAarray, 1, queue);
-            device_setvector<double*>(ibatch, (double**)&Barray[ib], 1, dBarray, 1, queue);
+            // copy pointer arrays to device, overlapping the previous kernel
+            dAarray = (double**) queue.set_dev_ptr_arrays(
+                          ibatch, (void* const*) &Aarray[ ib ],
+                                  (void* const*) &Barray[ ib ],
+                                  nullptr );
+            dBarray = dAarray + batch_limit;
 
             device::batch_dtrsm( queue,
                                 side_, uplo_, trans_, diag_,
@@ -201,7 +211,8 @@ void blas::batch::trsm(
         }
     }
     else {
-        queue.fork();
+        // one stream per problem, up to the queue's fork size
+        queue.fork( batch );
         for (size_t i = 0; i < batch; ++i) {
             Side side_   = blas::batch::extract<Side>(side, i);
             Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
@@ -241,6 +252,9 @@ void blas::batch::trsm(
     const size_t batch,                     std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_trsm", 'c', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -290,15 +304,16 @@ void blas::batch::trsm(
 
         size_t batch_limit = queue.get_batch_limit();
         std::complex<float> **dAarray, **dBarray;
-        dAarray = (std::complex<float>**)queue.get_dev_ptr_array();
-        dBarray = dAarray + batch_limit;
 
         for (size_t ib = 0; ib < batch; ib += batch_limit) {
             size_t ibatch = std::min( batch_limit, batch-ib );
 
-            // copy pointer array(s) to device
-            device_setvector< std::complex<float>* >(ibatch, (std::complex<float>**)&Aarray[ib], 1, dAarray, 1, queue);
-            device_setvector< std::complex<float>* >(ibatch, (std::complex<float>**)&Barray[ib], 1, dBarray, 1, queue);
+            // copy pointer arrays to device, overlapping the previous kernel
+            dAarray = (std::complex<float>**) queue.set_dev_ptr_arrays(
+                          ibatch, (void* const*) &Aarray[ ib ],
+                                  (void* const*) &Barray[ ib ],
+                                  nullptr );
+            dBarray = dAarray + batch_limit;
 
             device::batch_ctrsm( queue,
                                 side_, uplo_, trans_, diag_,
@@ -308,7 +323,8 @@ void blas::batch::trsm(
         }
     }
     else {
-        queue.fork();
+        // one stream per problem, up to the queue's fork size
+        queue.fork( batch );
         for (size_t i = 0; i < batch; ++i) {
             Side side_   = blas::batch::extract<Side>(side, i);
             Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
@@ -348,6 +364,9 @@ void blas::batch::trsm(
     const size_t batch,                     std::vector<int64_t>       &info,
     blas::Queue &queue )
 {
+    blas_trace( "batch_trsm", 'z', { layout, side, uplo, trans, diag },
+                { m, n }, batch, queue );
+
     blas_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
     blas_error_if( batch < 0 );
     blas_error_if( !(info.size() == 0 || info.size() == 1 || info.size() == batch) );
@@ -397,15 +416,16 @@ void blas::batch::trsm(
 
         size_t batch_limit = queue.get_batch_limit();
         std::complex<double> **dAarray, **dBarray;
-        dAarray = (std::complex<double>**)queue.get_dev_ptr_array();
-        dBarray = dAarray + batch_limit;
 
         for (size_t ib = 0; ib < batch; ib += batch_limit) {
             size_t ibatch = std::min( batch_limit, batch-ib );
 
-            // copy pointer array(s) to device
-            device_setvector< std::complex<double>* >(ibatch, (std::complex<double>**)&Aarray[ib], 1, dAarray, 1, queue);
-            device_setvector< std::complex<double>* >(ibatch, (std::complex<double>**)&Barray[ib], 1, dBarray, 1, queue);
+            // copy pointer arrays to device, overlapping the previous kernel
+            dAarray = (std::complex<double>**) queue.set_dev_ptr_arrays(
+                          ibatch, (void* const*) &Aarray[ ib ],
+                                  (void* const*) &Barray[ ib ],
+                                  nullptr );
+            dBarray = dAarray + batch_limit;
 
             device::batch_ztrsm( queue,
                                 side_, uplo_, trans_, diag_,
@@ -415,7 +435,8 @@ void blas::batch::trsm(
         }
     }
     else {
-        queue.fork();
+        // one stream per problem, up to the queue's fork size
+        queue.fork( batch );
         for (size_t i = 0; i < batch; ++i) {
             Side side_   = blas::batch::extract<Side>(side, i);
             Uplo uplo_   = blas::batch::extract<Uplo>(uplo, i);
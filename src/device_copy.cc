@@ -6,6 +6,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -20,6 +21,8 @@ void blas::copy(
     float *dy, int64_t incdy,
     blas::Queue &queue )
 {
+    blas_trace( "copy", 's', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );
     blas_error_if( incdx == 0 );
@@ -54,6 +57,8 @@ void blas::copy(
     double *dy, int64_t incdy,
     blas::Queue &queue )
 {
+    blas_trace( "copy", 'd', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );
     blas_error_if( incdx == 0 );
@@ -88,6 +93,8 @@ void blas::copy(
     std::complex<float> *dy, int64_t incdy,
     blas::Queue &queue )
 {
+    blas_trace( "copy", 'c', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );
     blas_error_if( incdx == 0 );
@@ -122,6 +129,8 @@ void blas::copy(
     std::complex<double> *dy, int64_t incdy,
     blas::Queue &queue )
 {
+    blas_trace( "copy", 'z', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );
     blas_error_if( incdx == 0 );
@@ -6,6 +6,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -26,6 +27,8 @@ void blas::gemm(
     float       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "gemm", 's', { layout, transA, transB }, { m, n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -105,6 +108,8 @@ void blas::gemm(
     double       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "gemm", 'd', { layout, transA, transB }, { m, n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -197,6 +202,8 @@ void blas::gemm(
     std::complex<float>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "gemm", 'c', { layout, transA, transB }, { m, n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -288,6 +295,8 @@ void blas::gemm(
     std::complex<double>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "gemm", 'z', { layout, transA, transB }, { m, n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -0,0 +1,307 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas/device_blas.hh"
+
+#include "device_internal.hh"
+#include "trace.hh"
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Column-major gemmt on the diagonal nb-by-nb blocks of C.
+/// Each column of a diagonal block, restricted to its rows in the uplo
+/// triangle, is split into pieces whose lengths are powers of 2, and all
+/// pieces of the same length, across all blocks, are one fixed-size
+/// batched gemm. This takes at most log2( nb ) + 1 batched calls for all
+/// diagonal blocks, instead of one gemm per column. A queue created with
+/// batch size 0 has no space for pointer arrays, so then each column is
+/// one gemm.
+///
+template <typename scalar_t>
+void gemmt_diag_blocks(
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k, int64_t nb,
+    scalar_t alpha,
+    scalar_t const *dA, int64_t ldda,
+    scalar_t const *dB, int64_t lddb,
+    scalar_t beta,
+    scalar_t       *dC, int64_t lddc,
+    blas::Queue &queue )
+{
+    // offsets of row i of op(A) and column j of op(B)
+    int64_t a_row = (transA == Op::NoTrans ? 1 : ldda);
+    int64_t b_col = (transB == Op::NoTrans ? lddb : 1);
+
+    if (queue.get_batch_limit() == 0) {
+        for (int64_t j0 = 0; j0 < n; j0 += nb) {
+            int64_t jb = std::min( nb, n - j0 );
+            for (int64_t j = j0; j < j0 + jb; ++j) {
+                int64_t i_begin = (uplo == Uplo::Lower ? j  : j0);
+                int64_t rows    = (uplo == Uplo::Lower ? j0 + jb - j
+                                                       : j - j0 + 1);
+                blas::gemm( Layout::ColMajor, transA, transB, rows, 1, k,
+                            alpha, &dA[ i_begin*a_row ], ldda,
+                                   &dB[ j*b_col ], lddb,
+                            beta,  &dC[ i_begin + j*lddc ], lddc, queue );
+            }
+        }
+        return;
+    }
+
+    std::vector<scalar_t*> Aarray, Barray, Carray;
+    std::vector<int64_t> info( 0 );
+    for (int64_t len = 1; len <= nb; len *= 2) {
+        Aarray.clear();
+        Barray.clear();
+        Carray.clear();
+        for (int64_t j0 = 0; j0 < n; j0 += nb) {
+            int64_t jb = std::min( nb, n - j0 );
+            for (int64_t j = j0; j < j0 + jb; ++j) {
+                // rows [ i_begin, i_begin + rows ) of column j
+                int64_t i_begin = (uplo == Uplo::Lower ? j  : j0);
+                int64_t rows    = (uplo == Uplo::Lower ? j0 + jb - j
+                                                       : j - j0 + 1);
+                if (rows & len) {
+                    // pieces longer than len come first
+                    int64_t i = i_begin + (rows & ~(2*len - 1));
+                    Aarray.push_back( const_cast<scalar_t*>( &dA[ i*a_row ] ) );
+                    Barray.push_back( const_cast<scalar_t*>( &dB[ j*b_col ] ) );
+                    Carray.push_back( &dC[ i + j*lddc ] );
+                }
+            }
+        }
+        size_t batch = Carray.size();
+        if (batch > 0) {
+            blas::batch::gemm( Layout::ColMajor, { transA }, { transB },
+                               { len }, { 1 }, { k },
+                               { alpha }, Aarray, { ldda }, Barray, { lddb },
+                               { beta },  Carray, { lddc },
+                               batch, info, queue );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Column-major gemmt on the device, as recursive gemm calls, since cuBLAS,
+/// rocBLAS, and oneMKL lack a common gemmt. Halves C, at a multiple of nb,
+/// until blocks are at most nb wide; each off-diagonal quadrant is one gemm.
+/// The diagonal blocks are left for gemmt_diag_blocks.
+///
+template <typename scalar_t>
+void gemmt_recursive(
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k, int64_t nb,
+    scalar_t alpha,
+    scalar_t const *dA, int64_t ldda,
+    scalar_t const *dB, int64_t lddb,
+    scalar_t beta,
+    scalar_t       *dC, int64_t lddc,
+    blas::Queue &queue )
+{
+    if (n <= nb)
+        return;
+
+    // offsets of row i of op(A) and column j of op(B)
+    int64_t a_row = (transA == Op::NoTrans ? 1 : ldda);
+    int64_t b_col = (transB == Op::NoTrans ? lddb : 1);
+
+    int64_t n1 = ((n + nb - 1) / nb / 2) * nb;
+    int64_t n2 = n - n1;
+    gemmt_recursive( uplo, transA, transB, n1, k, nb,
+                     alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue );
+    gemmt_recursive( uplo, transA, transB, n2, k, nb,
+                     alpha, &dA[ n1*a_row ], ldda,
+                            &dB[ n1*b_col ], lddb,
+                     beta,  &dC[ n1 + n1*lddc ], lddc, queue );
+    if (uplo == Uplo::Lower) {
+        // C21 = alpha op(A)_2 op(B)_1 + beta C21
+        blas::gemm( Layout::ColMajor, transA, transB, n2, n1, k,
+                    alpha, &dA[ n1*a_row ], ldda,
+                           dB, lddb,
+                    beta,  &dC[ n1 ], lddc, queue );
+    }
+    else {
+        // C12 = alpha op(A)_1 op(B)_2 + beta C12
+        blas::gemm( Layout::ColMajor, transA, transB, n1, n2, k,
+                    alpha, dA, ldda,
+                           &dB[ n1*b_col ], lddb,
+                    beta,  &dC[ n1*lddc ], lddc, queue );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Checks arguments and converts row-major to column-major, then calls
+/// gemmt_recursive and gemmt_diag_blocks.
+///
+template <typename scalar_t>
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    scalar_t alpha,
+    scalar_t const *dA, int64_t ldda,
+    scalar_t const *dB, int64_t lddb,
+    scalar_t beta,
+    scalar_t       *dC, int64_t lddc,
+    blas::Queue &queue )
+{
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    if ((transA == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( ldda < n );
+    else
+        blas_error_if( ldda < k );
+
+    if ((transB == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( lddb < k );
+    else
+        blas_error_if( lddb < n );
+
+    blas_error_if( lddc < n );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(device_blas_int)) {
+        blas_error_if( n    > std::numeric_limits<device_blas_int>::max() );
+        blas_error_if( k    > std::numeric_limits<device_blas_int>::max() );
+        blas_error_if( ldda > std::numeric_limits<device_blas_int>::max() );
+        blas_error_if( lddb > std::numeric_limits<device_blas_int>::max() );
+        blas_error_if( lddc > std::numeric_limits<device_blas_int>::max() );
+    }
+
+    if (n == 0)
+        return;
+
+    const int64_t nb = 128;
+
+    if (layout == Layout::RowMajor) {
+        // C^T = op(B)^T op(A)^T; swap lower <=> upper, A <=> B
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+        std::swap( transA, transB );
+        std::swap( dA, dB );
+        std::swap( ldda, lddb );
+    }
+    gemmt_recursive( uplo, transA, transB, n, k, nb,
+                     alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue );
+    gemmt_diag_blocks( uplo, transA, transB, n, k, nb,
+                       alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue );
+}
+
+}  // namespace internal
+}  // namespace blas
+
+// =============================================================================
+// Overloaded wrappers for s, d, c, z precisions.
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemmt
+void blas::gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *dA, int64_t ldda,
+    float const *dB, int64_t lddb,
+    float beta,
+    float       *dC, int64_t lddc,
+    blas::Queue &queue )
+{
+    blas_trace( "gemmt", 's', { layout, uplo, transA, transB }, { n, k },
+                queue );
+
+    internal::gemmt( layout, uplo, transA, transB, n, k,
+                     alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemmt
+void blas::gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *dA, int64_t ldda,
+    double const *dB, int64_t lddb,
+    double beta,
+    double       *dC, int64_t lddc,
+    blas::Queue &queue )
+{
+    blas_trace( "gemmt", 'd', { layout, uplo, transA, transB }, { n, k },
+                queue );
+
+    internal::gemmt( layout, uplo, transA, transB, n, k,
+                     alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemmt
+void blas::gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, int64_t ldda,
+    std::complex<float> const *dB, int64_t lddb,
+    std::complex<float> beta,
+    std::complex<float>       *dC, int64_t lddc,
+    blas::Queue &queue )
+{
+    blas_trace( "gemmt", 'c', { layout, uplo, transA, transB }, { n, k },
+                queue );
+
+    internal::gemmt( layout, uplo, transA, transB, n, k,
+                     alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemmt
+void blas::gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, int64_t ldda,
+    std::complex<double> const *dB, int64_t lddb,
+    std::complex<double> beta,
+    std::complex<double>       *dC, int64_t lddc,
+    blas::Queue &queue )
+{
+    blas_trace( "gemmt", 'z', { layout, uplo, transA, transB }, { n, k },
+                queue );
+
+    internal::gemmt( layout, uplo, transA, transB, n, k,
+                     alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue );
+}
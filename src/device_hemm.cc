@@ -6,6 +6,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -26,6 +27,8 @@ void blas::hemm(
     float       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "hemm", 's', { layout, side, uplo }, { m, n }, queue );
+
     blas::symm( layout, side, uplo, m, n, alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue );
 }
 
@@ -43,6 +46,8 @@ void blas::hemm(
     double       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "hemm", 'd', { layout, side, uplo }, { m, n }, queue );
+
     symm( layout, side, uplo, m, n, alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue);
 }
 
@@ -60,6 +65,8 @@ void blas::hemm(
     std::complex<float>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "hemm", 'c', { layout, side, uplo }, { m, n }, queue );
+
     typedef long long lld;
 
     // check arguments
@@ -133,6 +140,8 @@ void blas::hemm(
     std::complex<double>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "hemm", 'z', { layout, side, uplo }, { m, n }, queue );
+
     typedef long long lld;
 
     // check arguments
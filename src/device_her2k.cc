@@ -6,6 +6,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -26,6 +27,8 @@ void blas::her2k(
     float       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "her2k", 's', { layout, uplo, trans }, { n, k }, queue );
+
     syr2k( layout, uplo, trans, n, k, alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue);
 }
 
@@ -43,6 +46,8 @@ void blas::her2k(
     double       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "her2k", 'd', { layout, uplo, trans }, { n, k }, queue );
+
     syr2k( layout, uplo, trans, n, k, alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue);
 }
 
@@ -60,6 +65,8 @@ void blas::her2k(
     std::complex<float>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "her2k", 'c', { layout, uplo, trans }, { n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -127,6 +134,8 @@ void blas::her2k(
     std::complex<double>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "her2k", 'z', { layout, uplo, trans }, { n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -6,6 +6,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -25,6 +26,8 @@ void blas::herk(
     float       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "herk", 's', { layout, uplo, trans }, { n, k }, queue );
+
     blas::syrk( layout, uplo, trans, n, k, alpha, dA, ldda, beta, dC, lddc, queue );
 }
 
@@ -41,6 +44,8 @@ void blas::herk(
     double       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "herk", 'd', { layout, uplo, trans }, { n, k }, queue );
+
     blas::syrk( layout, uplo, trans, n, k, alpha, dA, ldda, beta, dC, lddc, queue );
 }
 
@@ -57,6 +62,8 @@ void blas::herk(
     std::complex<float>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "herk", 's', { layout, uplo, trans }, { n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -118,6 +125,8 @@ void blas::herk(
     std::complex<double>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "herk", 'd', { layout, uplo, trans }, { n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
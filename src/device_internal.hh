@@ -500,6 +500,52 @@ void batch_zgemm(
     std::complex<double>** dCarray, device_blas_int lddc,
     device_blas_int batch_size);
 
+// -----------------------------------------------------------------------------
+// batch gemm, strided
+void batch_sgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    float alpha,
+    float const *dA, device_blas_int ldda, int64_t strideA,
+    float const *dB, device_blas_int lddb, int64_t strideB,
+    float beta,
+    float       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size);
+
+void batch_dgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    double alpha,
+    double const *dA, device_blas_int ldda, int64_t strideA,
+    double const *dB, device_blas_int lddb, int64_t strideB,
+    double beta,
+    double       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size);
+
+void batch_cgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, device_blas_int ldda, int64_t strideA,
+    std::complex<float> const *dB, device_blas_int lddb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size);
+
+void batch_zgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, device_blas_int ldda, int64_t strideA,
+    std::complex<double> const *dB, device_blas_int lddb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size);
+
 // -----------------------------------------------------------------------------
 // batch trsm
 void batch_strsm(
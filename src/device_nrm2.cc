@@ -6,6 +6,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -20,6 +21,8 @@ void blas::nrm2(
     float *result,
     blas::Queue& queue)
 {
+    blas_trace( "nrm2", 's', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );       // standard BLAS returns, doesn't fail
     blas_error_if( incdx <= 0 );  // standard BLAS returns, doesn't fail
@@ -48,6 +51,8 @@ void blas::nrm2(
     double *result,
     blas::Queue& queue)
 {
+    blas_trace( "nrm2", 'd', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );       // standard BLAS returns, doesn't fail
     blas_error_if( incdx <= 0 );  // standard BLAS returns, doesn't fail
@@ -76,6 +81,8 @@ void blas::nrm2(
     float *result,
     blas::Queue& queue)
 {
+    blas_trace( "nrm2", 'c', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );       // standard BLAS returns, doesn't fail
     blas_error_if( incdx <= 0 );  // standard BLAS returns, doesn't fail
@@ -104,6 +111,8 @@ void blas::nrm2(
     double *result,
     blas::Queue& queue)
 {
+    blas_trace( "nrm2", 'z', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );       // standard BLAS returns, doesn't fail
     blas_error_if( incdx <= 0 );  // standard BLAS returns, doesn't fail
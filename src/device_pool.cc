@@ -0,0 +1,231 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas/device.hh"
+
+#include <algorithm>
+#include <map>
+
+namespace blas {
+namespace internal {
+
+//==============================================================================
+/// Cache of device memory for a Queue.
+///
+/// Each cached block records the stream that freed it. Work on one stream
+/// runs in order, so that stream can reuse the block at once. Other streams
+/// can reuse it only after the queue's sync, fork, or join has ordered the
+/// freeing stream's work before theirs; then the block is marked ready.
+///
+class QueuePool
+{
+public:
+    /// stream value of a cached block that any stream can reuse.
+    static const int ready = -1;
+
+    struct Block {
+        char*  ptr;
+        size_t bytes;
+        int    stream;
+    };
+
+    //--------------------
+    /// @return bytes rounded up to a size class: 512 bytes minimum, then
+    /// 4 classes per power of 2, so at most 25% of a block is unused.
+    static size_t size_class( size_t bytes )
+    {
+        const size_t min_class = 512;
+        if (bytes <= min_class)
+            return min_class;
+
+        size_t pow2 = min_class;
+        while (pow2 < bytes - pow2)  // pow2 < bytes <= 2*pow2
+            pow2 *= 2;
+        size_t step = pow2 / 4;
+        return ((bytes + step - 1) / step) * step;
+    }
+
+    //--------------------
+    /// @return a cached block of exactly bytes usable by stream,
+    /// or nullptr if there is none.
+    char* take( size_t bytes, int stream )
+    {
+        auto range = cached.equal_range( bytes );
+        for (auto iter = range.first; iter != range.second; ++iter) {
+            if (iter->second.stream == stream
+                || iter->second.stream == ready) {
+                char* ptr = iter->second.ptr;
+                cached.erase( iter );
+                stats.bytes_cached -= bytes;
+                return ptr;
+            }
+        }
+        return nullptr;
+    }
+
+    //--------------------
+    /// Marks all cached blocks as ready for any stream.
+    void mark_ready()
+    {
+        for (auto& item : cached)
+            item.second.stream = ready;
+    }
+
+    //--------------------
+    /// Records ptr as in use, updating statistics.
+    void add_in_use( char* ptr, size_t bytes )
+    {
+        in_use[ ptr ] = bytes;
+        stats.bytes_in_use += bytes;
+        stats.high_water = std::max( stats.high_water,
+                                     stats.bytes_in_use + stats.bytes_cached );
+    }
+
+    // size class => cached block
+    std::multimap< size_t, Block > cached;
+
+    // pointer => size class of blocks held by callers
+    std::map< char*, size_t > in_use;
+
+    PoolStats stats;
+};
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Creates an empty pool. Called by constructors before work_resize.
+void Queue::pool_create()
+{
+    pool_ = new internal::QueuePool;
+}
+
+//------------------------------------------------------------------------------
+/// Marks cached blocks as ready for any stream. Called after sync, fork,
+/// and join, which order work on all streams after the blocks were freed.
+void Queue::pool_mark_ready()
+{
+    pool_->mark_ready();
+}
+
+//------------------------------------------------------------------------------
+/// Frees all blocks, cached or in use, and deletes the pool.
+/// Called by the destructor after the streams are synchronized.
+void Queue::pool_release()
+{
+    if (pool_ == nullptr)
+        return;
+
+    for (auto& item : pool_->cached)
+        device_free( item.second.ptr, *this );
+    for (auto& item : pool_->in_use)
+        device_free( item.first, *this );
+    delete pool_;
+    pool_ = nullptr;
+}
+
+//------------------------------------------------------------------------------
+/// @return index of the current stream for the pool:
+/// 0 for the default stream, 1 + i for parallel stream i.
+int Queue::pool_stream() const
+{
+    if (fork_levels_.empty())
+        return 0;
+    return 1 + int( current_stream_index_ );
+}
+
+//------------------------------------------------------------------------------
+/// Allocates bytes from the pool, reusing a cached block if one of the same
+/// size class is usable by the current stream. Otherwise allocates a new
+/// block with device_malloc; if that fails, frees the ready cached blocks
+/// and tries again.
+void* Queue::pool_malloc_bytes( size_t bytes )
+{
+    internal::QueuePool& pool = *pool_;
+    size_t size = internal::QueuePool::size_class( bytes );
+
+    pool.stats.allocs += 1;
+    char* ptr = pool.take( size, pool_stream() );
+    if (ptr != nullptr) {
+        pool.stats.hits += 1;
+    }
+    else {
+        try {
+            ptr = device_malloc<char>( size, *this );
+        }
+        catch (blas::Error const&) {
+            pool_trim( 0 );
+            ptr = device_malloc<char>( size, *this );
+        }
+        pool.stats.device_allocs += 1;
+    }
+    pool.add_in_use( ptr, size );
+    return ptr;
+}
+
+//------------------------------------------------------------------------------
+/// Returns memory from pool_malloc to the pool. Work already submitted to
+/// the current stream may still use it; it is reused only in stream order.
+/// If other streams use ptr, sync, fork, or join before freeing it.
+void Queue::pool_free( void* ptr )
+{
+    if (ptr == nullptr)
+        return;
+
+    internal::QueuePool& pool = *pool_;
+    auto iter = pool.in_use.find( (char*) ptr );
+    blas_error_if_msg( iter == pool.in_use.end(),
+                       "pointer not allocated by pool_malloc" );
+    size_t size = iter->second;
+    pool.in_use.erase( iter );
+
+    internal::QueuePool::Block block = { (char*) ptr, size, pool_stream() };
+    pool.cached.insert( std::make_pair( size, block ) );
+    pool.stats.frees += 1;
+    pool.stats.bytes_in_use -= size;
+    pool.stats.bytes_cached += size;
+}
+
+//------------------------------------------------------------------------------
+/// Frees cached blocks with device_free, largest first, until at most
+/// bytes_to_keep bytes are cached. Only blocks ready for any stream are
+/// freed; call sync first to make all cached blocks ready.
+void Queue::pool_trim( size_t bytes_to_keep )
+{
+    internal::QueuePool& pool = *pool_;
+    auto iter = pool.cached.end();
+    while (pool.stats.bytes_cached > bytes_to_keep
+           && iter != pool.cached.begin()) {
+        --iter;
+        if (iter->second.stream == internal::QueuePool::ready) {
+            device_free( iter->second.ptr, *this );
+            pool.stats.device_frees += 1;
+            pool.stats.bytes_cached -= iter->second.bytes;
+            iter = pool.cached.erase( iter );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return statistics of the pool.
+PoolStats Queue::pool_stats() const
+{
+    return pool_->stats;
+}
+
+//------------------------------------------------------------------------------
+/// Resets counters of the pool to zero, and the high-water mark to the
+/// bytes currently in use and cached.
+void Queue::pool_reset_stats()
+{
+    PoolStats& stats = pool_->stats;
+    stats.allocs        = 0;
+    stats.hits          = 0;
+    stats.frees         = 0;
+    stats.device_allocs = 0;
+    stats.device_frees  = 0;
+    stats.high_water    = stats.bytes_in_use + stats.bytes_cached;
+}
+
+}  // namespace blas
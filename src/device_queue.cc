@@ -5,6 +5,18 @@
 
 #include "blas/device.hh"
 
+#include <algorithm>
+
+#if ! defined(BLAS_HAVE_CUBLAS) && ! defined(BLAS_HAVE_ROCBLAS) && ! defined(BLAS_HAVE_ONEMKL)
+    #include <condition_variable>
+    #include <deque>
+    #include <exception>
+    #include <memory>
+    #include <mutex>
+    #include <set>
+    #include <thread>
+#endif
+
 namespace blas {
 
 // =============================================================================
@@ -135,6 +147,185 @@ void stream_wait_event( hipStream_t stream, hipEvent_t event, unsigned int flags
     blas_dev_call( hipStreamWaitEvent( stream, event, flags ) );
 }
 
+// =============================================================================
+// Host backend streams, run by worker threads.
+#elif ! defined(BLAS_HAVE_ONEMKL)
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+struct HostStream::State {
+    std::mutex mutex;
+    std::condition_variable task_ready;  // notifies worker
+    std::condition_variable done;        // notifies sync
+    std::deque< std::function<void ()> > tasks;
+    bool busy = false;                   // worker is running a task
+    bool stop = false;                   // destructor was called
+    std::exception_ptr error;            // first exception from a task
+    std::thread worker;
+    std::thread::id worker_id;           // set with worker, under mutex
+};
+
+//------------------------------------------------------------------------------
+/// Host streams that exist, so freeing memory can wait for all of them.
+struct StreamRegistry {
+    std::mutex mutex;
+    std::set< HostStream* > streams;
+};
+
+/// @return the registry of host streams.
+StreamRegistry& stream_registry()
+{
+    static StreamRegistry registry;
+    return registry;
+}
+
+//------------------------------------------------------------------------------
+HostStream::HostStream()
+    : state_( new State )
+{
+    StreamRegistry& registry = stream_registry();
+    std::lock_guard< std::mutex > lock( registry.mutex );
+    registry.streams.insert( this );
+}
+
+//------------------------------------------------------------------------------
+/// Finishes queued tasks, then stops the worker thread.
+HostStream::~HostStream()
+{
+    {
+        StreamRegistry& registry = stream_registry();
+        std::lock_guard< std::mutex > lock( registry.mutex );
+        registry.streams.erase( this );
+    }
+    {
+        std::lock_guard< std::mutex > lock( state_->mutex );
+        state_->stop = true;
+    }
+    state_->task_ready.notify_one();
+    if (state_->worker.joinable())
+        state_->worker.join();
+}
+
+//------------------------------------------------------------------------------
+void HostStream::submit( std::function<void ()> task )
+{
+    State* state = state_.get();
+    {
+        std::lock_guard< std::mutex > lock( state->mutex );
+        state->tasks.push_back( std::move( task ) );
+
+        if (! state->worker.joinable()) {
+            state->worker = std::thread( [state]() {
+                std::unique_lock< std::mutex > lock( state->mutex );
+                while (true) {
+                    state->task_ready.wait( lock, [state]() {
+                        return state->stop || ! state->tasks.empty();
+                    } );
+                    if (state->tasks.empty())
+                        break;  // stop, with no tasks left
+
+                    std::function<void ()> next = std::move( state->tasks.front() );
+                    state->tasks.pop_front();
+                    state->busy = true;
+                    lock.unlock();
+                    try {
+                        next();
+                    }
+                    catch (...) {
+                        lock.lock();
+                        if (! state->error)
+                            state->error = std::current_exception();
+                        lock.unlock();
+                    }
+                    lock.lock();
+                    state->busy = false;
+                    if (state->tasks.empty())
+                        state->done.notify_all();
+                }
+            } );
+            state->worker_id = state->worker.get_id();
+        }
+    }
+    state->task_ready.notify_one();
+}
+
+//------------------------------------------------------------------------------
+void HostStream::sync()
+{
+    std::unique_lock< std::mutex > lock( state_->mutex );
+    state_->done.wait( lock, [this]() {
+        return state_->tasks.empty() && ! state_->busy;
+    } );
+    if (state_->error) {
+        std::exception_ptr error = state_->error;
+        state_->error = nullptr;
+        std::rethrow_exception( error );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Waits until all tasks submitted to every host stream are done, as
+/// cudaFree waits for the device. Unlike sync, exceptions from tasks are left
+/// for each stream's own sync. A stream's own worker does not wait for itself.
+/// The streams are copied under the registry lock, then waited on after
+/// releasing it, so tasks that create or destroy streams cannot deadlock;
+/// sharing each stream's state keeps it valid if the stream is destroyed.
+void HostStream::sync_all()
+{
+    std::vector< std::shared_ptr< State > > states;
+    {
+        StreamRegistry& registry = stream_registry();
+        std::lock_guard< std::mutex > registry_lock( registry.mutex );
+        states.reserve( registry.streams.size() );
+        for (HostStream* stream : registry.streams)
+            states.push_back( stream->state_ );
+    }
+    for (auto const& state : states) {
+        std::unique_lock< std::mutex > lock( state->mutex );
+        if (state->worker_id == std::this_thread::get_id())
+            continue;
+        state->done.wait( lock, [state]() {
+            return state->tasks.empty() && ! state->busy;
+        } );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Host equivalent of an event: set when the stream reaches it.
+struct HostEvent {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+};
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @return new event, set after the tasks currently in stream finish.
+std::shared_ptr< internal::HostEvent > event_record(
+    internal::HostStream& stream )
+{
+    std::shared_ptr< internal::HostEvent > event( new internal::HostEvent );
+    stream.submit( [event]() {
+        std::lock_guard< std::mutex > lock( event->mutex );
+        event->done = true;
+        event->cv.notify_all();
+    } );
+    return event;
+}
+
+// -----------------------------------------------------------------------------
+/// Makes later tasks in stream wait for event.
+void stream_wait_event(
+    internal::HostStream& stream, std::shared_ptr< internal::HostEvent > event )
+{
+    stream.submit( [event]() {
+        std::unique_lock< std::mutex > lock( event->mutex );
+        event->cv.wait( lock, [&event]() { return event->done; } );
+    } );
+}
+
 #endif
 
 // =============================================================================
@@ -144,9 +335,14 @@ void stream_wait_event( hipStream_t stream, hipEvent_t event, unsigned int flags
 // -----------------------------------------------------------------------------
 /// Default constructor.
 Queue::Queue()
-  : work_( nullptr ),
-    lwork_( 0 )
+  : pool_( nullptr ),
+    work_( nullptr ),
+    lwork_( 0 ),
+    fork_size_( 0 ),
+    first_stream_index_( 0 )
 {
+    pool_create();
+
     #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
         // get the currently set device ID
         get_device( &device_ );
@@ -160,25 +356,24 @@ Queue::Queue()
         num_active_streams_   = 1;
         current_stream_index_ = 0;
 
-        // create parallel streams
-        for (size_t i = 0; i < DEV_QUEUE_FORK_SIZE; ++i) {
-            stream_create( &parallel_streams_[ i ] );
-        }
-
-        // create default and parallel events
+        // create default event
         event_create( &default_event_ );
-        for (size_t i = 0; i < DEV_QUEUE_FORK_SIZE; ++i) {
-            event_create(&parallel_events_[ i ]);
-        }
 
-        // compute workspace for pointer arrays in the queue
-        // fork size + 1 (def. stream), each need 3 pointer arrays
+        // create parallel streams and events, and workspace for pointer arrays
         // Must be after creating streams since work_resize syncs.
-        size_t lwork = 3 * batch_limit_ * ( DEV_QUEUE_FORK_SIZE + 1 );
-        work_resize<void*>( lwork );
+        set_fork_size( DEV_QUEUE_FORK_SIZE );
 
     #elif defined(BLAS_HAVE_ONEMKL)
         throw blas::Error( "a sycl queue is required to create a blas::Queue object ", __func__ );
+
+    #else
+        device_ = 0;
+        batch_limit_ = DEV_QUEUE_DEFAULT_BATCH_LIMIT;
+        current_stream_       = &default_stream_;
+        num_active_streams_   = 1;
+        current_stream_index_ = 0;
+
+        set_fork_size( DEV_QUEUE_FORK_SIZE );
     #endif
 }
 
@@ -186,9 +381,14 @@ Queue::Queue()
 /// Constructor with device and batch init.
 // todo: merge with default constructor.
 Queue::Queue( blas::Device device, int64_t batch_size )
-  : work_( nullptr ),
-    lwork_( 0 )
+  : pool_( nullptr ),
+    work_( nullptr ),
+    lwork_( 0 ),
+    fork_size_( 0 ),
+    first_stream_index_( 0 )
 {
+    pool_create();
+
     #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
         device_ = device;
         batch_limit_ = batch_size;
@@ -200,22 +400,12 @@ Queue::Queue( blas::Device device, int64_t batch_size )
         num_active_streams_   = 1;
         current_stream_index_ = 0;
 
-        // create parallel streams
-        for (size_t i = 0; i < DEV_QUEUE_FORK_SIZE; ++i) {
-            stream_create(&parallel_streams_[ i ]);
-        }
-
-        // create default and parallel events
+        // create default event
         event_create( &default_event_ );
-        for (size_t i = 0; i < DEV_QUEUE_FORK_SIZE; ++i) {
-            event_create( &parallel_events_[ i ] );
-        }
 
-        // compute workspace for pointer arrays in the queue
-        // fork size + 1 (def. stream), each need 3 pointer arrays
+        // create parallel streams and events, and workspace for pointer arrays
         // Must be after creating streams since work_resize syncs.
-        size_t lwork = 3 * batch_limit_ * ( DEV_QUEUE_FORK_SIZE + 1 );
-        work_resize<void*>( lwork );
+        set_fork_size( DEV_QUEUE_FORK_SIZE );
 
     #elif defined(BLAS_HAVE_ONEMKL)
         std::vector<cl::sycl::device> devices;
@@ -245,6 +435,16 @@ Queue::Queue( blas::Device device, int64_t batch_size )
 
         num_active_streams_   = 1;
         current_stream_index_ = 0;
+
+    #else
+        set_device( device );  // checks device
+        device_ = device;
+        batch_limit_ = batch_size;
+        current_stream_       = &default_stream_;
+        num_active_streams_   = 1;
+        current_stream_index_ = 0;
+
+        set_fork_size( DEV_QUEUE_FORK_SIZE );
     #endif
 }
 
@@ -254,24 +454,38 @@ Queue::~Queue()
 {
     try {
         #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
-            device_free( work_ );
+            // frees work_ and other pool memory
+            sync();
+            ptr_arrays_release();
+            pool_release();
             handle_destroy( handle_ );
             stream_destroy( default_stream_ );
 
             // destroy parallel streams
-            for (size_t i = 0; i < DEV_QUEUE_FORK_SIZE; ++i) {
+            for (size_t i = 0; i < parallel_streams_.size(); ++i) {
                 stream_destroy( parallel_streams_[ i ] );
             }
 
             // destroy events
             event_destroy( default_event_ );
-            for (size_t i = 0; i < DEV_QUEUE_FORK_SIZE; ++i) {
+            for (size_t i = 0; i < parallel_events_.size(); ++i) {
                 event_destroy( parallel_events_[ i ] );
             }
 
         #elif defined(BLAS_HAVE_ONEMKL)
-            device_free( work_, *this );
+            sync();
+            pool_release();
             delete default_stream_;
+
+        #else
+            // finish tasks that may use pool memory, including work_;
+            // streams stop in their destructors
+            default_stream_.sync();
+            for (size_t i = 0; i < parallel_streams_.size(); ++i) {
+                parallel_streams_[ i ]->sync();
+            }
+            ptr_arrays_release();
+            pool_release();
         #endif
     }
     catch (...) {
@@ -287,11 +501,11 @@ void Queue::sync()
     #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
         // in default mode, sync with default stream
         // otherwise, sync against the parallel streams
-        if (current_stream_ == &default_stream_) {
+        if (fork_levels_.empty()) {
             stream_synchronize( default_stream_ );
         }
         else {
-            for (size_t i = 0; i < DEV_QUEUE_FORK_SIZE; ++i) {
+            for (size_t i = 0; i < parallel_streams_.size(); ++i) {
                 stream_synchronize( parallel_streams_[ i ] );
             }
         }
@@ -299,102 +513,243 @@ void Queue::sync()
     #elif defined(BLAS_HAVE_ONEMKL)
         // todo: see wait_and_throw()
         default_stream_->wait();
+
+    #else
+        // in default mode, sync with default stream, then also with the
+        // parallel streams, since join leaves errors from their tasks there;
+        // rethrow the first error after all streams are done
+        std::exception_ptr error;
+        if (fork_levels_.empty()) {
+            try {
+                default_stream_.sync();
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+        }
+        for (size_t i = 0; i < parallel_streams_.size(); ++i) {
+            try {
+                parallel_streams_[ i ]->sync();
+            }
+            catch (...) {
+                if (! error)
+                    error = std::current_exception();
+            }
+        }
+        if (error)
+            std::rethrow_exception( error );
     #endif
+
+    pool_mark_ready();
 }
 
 // -----------------------------------------------------------------------------
 /// Get device array pointer for the current stream.
 void**  Queue::get_dev_ptr_array()
 {
-    #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+    #if ! defined(BLAS_HAVE_ONEMKL)
         void** dev_ptr_array_ = (void**) work_;
 
-        // in default (join) mode, return dev_ptr_array with no offset
-        if (current_stream_ == &default_stream_)
-            return dev_ptr_array_;
+        // in default (join) mode, use the first buffer of the default stream;
+        // in fork mode, the first buffer of the current parallel stream
+        size_t slot = (current_stream_ == &default_stream_)
+                    ? 0 : current_stream_index_ + 1;
+
+        // the next set_dev_ptr_arrays orders later uploads to this buffer
+        // after the kernels using it
+        ptr_array_last_[ slot ] = 0;
 
-        // in fork mode, return dev_ptr_array_ + offset
-        size_t offset = (current_stream_index_ + 1) * 3 * batch_limit_;
+        size_t offset = slot * 2 * 3 * batch_limit_;
         return (dev_ptr_array_ + offset);
 
-    #else // includes BLAS_HAVE_ONEMKL
+    #else
         void** dev_ptr_array_ = (void**) work_;
         return dev_ptr_array_;
     #endif
 }
 
 // -----------------------------------------------------------------------------
-/// Forks the kernel launches assigned to this queue to parallel streams.
-/// This function is not nested (you must join after each fork).
-void Queue::fork()
+/// Sets the number of parallel streams that fork can use, creating streams
+/// as needed and growing the workspace to have pointer arrays for each.
+/// Streams are kept if fork_size shrinks. Cannot be called in fork mode.
+void Queue::set_fork_size( size_t fork_size )
 {
-    #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
-        // check if queue is already in fork mode
-        if (current_stream_ != &default_stream_)
-            return;
+    blas_error_if( fork_size < 1 );
+    blas_error_if_msg( ! fork_levels_.empty(),
+                       "cannot set fork size in fork mode" );
+
+    fork_size_ = fork_size;
+
+    // todo: fork-join is disabled for sycl
+    #if ! defined(BLAS_HAVE_ONEMKL)
+        parallel_streams_resize( fork_size_ );
+    #endif
+}
 
-        // make sure dependencies are respected
-        event_record(default_event_, default_stream_);
-        for (size_t i = 0; i < DEV_QUEUE_FORK_SIZE; ++i) {
-            stream_wait_event( parallel_streams_[i], default_event_, 0 );
+// -----------------------------------------------------------------------------
+/// Creates parallel streams up to nstreams, and grows the workspace to have
+/// pointer arrays for each. Streams are never removed. Growing the
+/// workspace in fork mode syncs.
+void Queue::parallel_streams_resize( size_t nstreams )
+{
+    #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+        size_t old_size = parallel_streams_.size();
+        if (nstreams > old_size) {
+            blas::set_device( device_ );
+            parallel_streams_.resize( nstreams );
+            parallel_events_ .resize( nstreams );
+            for (size_t i = old_size; i < nstreams; ++i) {
+                stream_create( &parallel_streams_[ i ] );
+                event_create( &parallel_events_[ i ] );
+            }
         }
 
-        // assign current stream
-        current_stream_index_ = 0;
-        num_active_streams_   = DEV_QUEUE_FORK_SIZE;
-        current_stream_       = &parallel_streams_[ current_stream_index_ ];
+    #elif ! defined(BLAS_HAVE_ONEMKL)
+        while (parallel_streams_.size() < nstreams) {
+            parallel_streams_.emplace_back( new internal::HostStream );
+        }
+    #endif
 
-        // assign cublas handle to current stream
-        handle_set_stream( handle_, *current_stream_ );
+    #if ! defined(BLAS_HAVE_ONEMKL)
+        // compute workspace for pointer arrays in the queue
+        // nstreams + 1 (def. stream), each need 2 buffers of 3 pointer arrays
+        nstreams = parallel_streams_.size();
+        work_resize<void*>( 2 * 3 * batch_limit_ * (nstreams + 1) );
+        ptr_arrays_resize( nstreams );
+    #endif
+}
 
-    #elif defined(BLAS_HAVE_ONEMKL)
+// -----------------------------------------------------------------------------
+/// Forks the kernel launches assigned to this queue to nstreams parallel
+/// streams, at most fork_size(), which wait for work already submitted to
+/// the current stream. Forks can be nested: a fork in fork mode starts from
+/// the current parallel stream, and its join returns to that stream. A nested
+/// fork uses the streams after those of the enclosing fork, creating them on
+/// first use, so work it launches is not queued behind the enclosing fork's
+/// other streams.
+void Queue::fork( size_t nstreams )
+{
+    #if defined(BLAS_HAVE_ONEMKL)
         // todo: see possible implementations for sycl
         return;
+
+    #else
+        nstreams = std::max( size_t( 1 ), std::min( nstreams, fork_size_ ) );
+        bool top_level = fork_levels_.empty();
+        ForkLevel level = { current_stream_index_, num_active_streams_,
+                            first_stream_index_ };
+        size_t first = top_level ? 0
+                     : first_stream_index_ + num_active_streams_;
+        fork_levels_.push_back( level );
+        parallel_streams_resize( first + nstreams );
+
+        #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+            // make sure dependencies are respected
+            auto& event = top_level ? default_event_
+                                    : parallel_events_[ current_stream_index_ ];
+            event_record( event, *current_stream_ );
+            for (size_t i = first; i < first + nstreams; ++i) {
+                stream_wait_event( parallel_streams_[ i ], event, 0 );
+            }
+
+            // assign current stream
+            first_stream_index_   = first;
+            current_stream_index_ = first;
+            num_active_streams_   = nstreams;
+            current_stream_       = &parallel_streams_[ current_stream_index_ ];
+
+            // assign cublas handle to current stream
+            handle_set_stream( handle_, *current_stream_ );
+
+        #else
+            // make sure dependencies are respected
+            auto event = event_record( *current_stream_ );
+            for (size_t i = first; i < first + nstreams; ++i) {
+                stream_wait_event( *parallel_streams_[ i ], event );
+            }
+
+            first_stream_index_   = first;
+            current_stream_index_ = first;
+            num_active_streams_   = nstreams;
+            current_stream_       = parallel_streams_[ current_stream_index_ ].get();
+        #endif
+
+        // blocks freed on the default stream are ordered before all streams
+        if (top_level)
+            pool_mark_ready();
     #endif
 }
 
 // -----------------------------------------------------------------------------
-/// Switch executions on this queue back from parallel streams to the default
-/// stream. This function is not nested (you must join after each fork).
+/// Switch executions on this queue back from the parallel streams of the
+/// innermost fork to the stream that was current before it; that stream
+/// waits for work on the parallel streams.
 void Queue::join()
 {
-    #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+    #if defined(BLAS_HAVE_ONEMKL)
+         // todo: see possible implementations for sycl
+        return;
+
+    #else
         // check if queue is already joined
-        if (current_stream_ == &default_stream_)
+        if (fork_levels_.empty())
             return;
 
-        // make sure dependencies are respected
-        for (size_t i = 0; i < DEV_QUEUE_FORK_SIZE; ++i) {
-            event_record( parallel_events_[i], parallel_streams_[i] );
-            stream_wait_event( default_stream_, parallel_events_[i], 0 );
-        }
+        size_t first    = first_stream_index_;
+        size_t nstreams = num_active_streams_;
+        ForkLevel level = fork_levels_.back();
+        fork_levels_.pop_back();
+        current_stream_index_ = level.stream_index;
+        num_active_streams_   = level.num_active_streams;
+        first_stream_index_   = level.first_stream_index;
 
-        // assign current stream
-        current_stream_index_ = 0;
-        num_active_streams_   = 1;
-        current_stream_       = &default_stream_;
+        #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+            current_stream_ = fork_levels_.empty()
+                            ? &default_stream_
+                            : &parallel_streams_[ current_stream_index_ ];
+
+            // make sure dependencies are respected
+            for (size_t i = first; i < first + nstreams; ++i) {
+                event_record( parallel_events_[i], parallel_streams_[i] );
+                stream_wait_event( *current_stream_, parallel_events_[i], 0 );
+            }
 
-        // assign current stream to blas handle
-        handle_set_stream( handle_, *current_stream_ );
+            // assign current stream to blas handle
+            handle_set_stream( handle_, *current_stream_ );
 
-    #elif defined(BLAS_HAVE_ONEMKL)
-         // todo: see possible implementations for sycl
-        return;
+        #else
+            current_stream_ = fork_levels_.empty()
+                            ? &default_stream_
+                            : parallel_streams_[ current_stream_index_ ].get();
+
+            // make sure dependencies are respected
+            for (size_t i = first; i < first + nstreams; ++i) {
+                stream_wait_event( *current_stream_,
+                                   event_record( *parallel_streams_[ i ] ) );
+            }
+        #endif
+
+        // blocks freed on parallel streams are ordered before the default
+        // stream; in a nested join, they stay with their streams
+        if (fork_levels_.empty())
+            pool_mark_ready();
     #endif
 }
 
 // -----------------------------------------------------------------------------
-/// In fork mode, switch execution to the next-in-line stream.
-/// In join mode, no effect.
+/// In fork mode, switch execution to the next-in-line stream of the
+/// innermost fork. In join mode, no effect.
 void Queue::revolve()
 {
     #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
         // return if not in fork mode
-        if (current_stream_ == &default_stream_)
+        if (fork_levels_.empty())
             return;
 
         // choose the next-in-line stream
-        current_stream_index_ = (current_stream_index_ + 1) % num_active_streams_;
+        current_stream_index_ = first_stream_index_
+            + (current_stream_index_ - first_stream_index_ + 1)
+              % num_active_streams_;
         current_stream_       = &parallel_streams_[ current_stream_index_ ];
 
         // assign current stream to blas handle
@@ -403,6 +758,356 @@ void Queue::revolve()
     #elif defined(BLAS_HAVE_ONEMKL)
          // todo: see possible implementations for sycl
         return;
+
+    #else
+        if (fork_levels_.empty())
+            return;
+
+        current_stream_index_ = first_stream_index_
+            + (current_stream_index_ - first_stream_index_ + 1)
+              % num_active_streams_;
+        current_stream_       = parallel_streams_[ current_stream_index_ ].get();
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// Adds pointer-array buffers for the default stream and nstreams parallel
+/// streams; their staging buffers and upload streams are created on first use.
+void Queue::ptr_arrays_resize( size_t nstreams )
+{
+    size_t nslots = nstreams + 1;
+    if (ptr_array_last_.size() >= nslots)
+        return;
+
+    ptr_array_last_.resize( nslots, -1 );
+    ptr_array_staging_.resize( nslots, nullptr );
+    while (ptr_array_buffers_.size() < 2*nslots) {
+        ptr_array_buffers_.emplace_back( new PtrArrayBuffer );
+    }
+    #if ! defined(BLAS_HAVE_ONEMKL)
+        upload_streams_.resize( nslots );
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// Waits for uploads, then frees staging buffers and upload streams.
+/// Called by the destructor after the streams are synchronized.
+void Queue::ptr_arrays_release()
+{
+    for (size_t slot = 0; slot < ptr_array_staging_.size(); ++slot) {
+        if (ptr_array_staging_[ slot ] == nullptr)
+            continue;
+
+        #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+            stream_synchronize( upload_streams_[ slot ] );
+            stream_destroy( upload_streams_[ slot ] );
+        #elif ! defined(BLAS_HAVE_ONEMKL)
+            upload_streams_[ slot ]->sync();
+            upload_streams_[ slot ].reset();
+        #endif
+        device_free_pinned( ptr_array_staging_[ slot ], *this );
+        ptr_array_staging_[ slot ] = nullptr;
+    }
+}
+
+// -----------------------------------------------------------------------------
+/// Copies count pointers from each host pointer array Aarray, Barray, and
+/// Carray (if not null) to device pointer arrays for the current stream.
+/// Each stream alternates between 2 buffers. Pointers go through a pinned
+/// staging buffer, and are uploaded on a separate stream, which waits only
+/// for kernels that used the same buffer 2 calls ago. So the upload for one
+/// chunk of a batch overlaps the kernel for the previous chunk.
+/// The current stream waits for the upload.
+///
+/// @return device pointer arrays: Aarray at [0], Barray at [batch_limit],
+/// Carray at [2*batch_limit]. They are valid for kernels launched on the
+/// current stream until the next call but one for this stream.
+///
+void** Queue::set_dev_ptr_arrays(
+    size_t count,
+    void* const* Aarray,
+    void* const* Barray,
+    void* const* Carray )
+{
+    blas_error_if( count > batch_limit_ );
+    void* const* src[ 3 ] = { Aarray, Barray, Carray };
+
+    #if defined(BLAS_HAVE_ONEMKL)
+        // todo: fork-join is disabled for sycl; copy on the queue
+        void** dev_ptr_array = get_dev_ptr_array();
+        for (int j = 0; j < 3; ++j) {
+            if (src[ j ] != nullptr) {
+                device_memcpy<void*>( dev_ptr_array + j*batch_limit_,
+                                      src[ j ], count, *this );
+            }
+        }
+        return dev_ptr_array;
+
+    #else
+        size_t slot = fork_levels_.empty() ? 0 : current_stream_index_ + 1;
+        int last = ptr_array_last_[ slot ];
+        int next = (last == 0 ? 1 : 0);
+        size_t size = 3 * batch_limit_;
+        size_t offset = (2*slot + next) * size;
+        void** dev_ptr_array = (void**) work_ + offset;
+        PtrArrayBuffer& buffer = *ptr_array_buffers_[ 2*slot + next ];
+
+        if (ptr_array_staging_[ slot ] == nullptr) {
+            ptr_array_staging_[ slot ]
+                = device_malloc_pinned<void*>( 2 * size, *this );
+            #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+                blas::set_device( device_ );
+                stream_create( &upload_streams_[ slot ] );
+            #else
+                upload_streams_[ slot ].reset( new internal::HostStream );
+            #endif
+        }
+        void** staging = ptr_array_staging_[ slot ] + next * size;
+
+        // Records event on stream; for GPUs, creates it on first use.
+        #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+            auto record_on = [this]( Event& event, decltype(*current_stream_) stream ) {
+                if (event.event_ == nullptr) {
+                    event_create( &event.event_ );
+                    event.device_ = device_;
+                }
+                event_record( event.event_, stream );
+            };
+            auto& upload_stream = upload_streams_[ slot ];
+        #else
+            auto record_on = []( Event& event, internal::HostStream& stream ) {
+                event.event_ = event_record( stream );
+            };
+            auto& upload_stream = *upload_streams_[ slot ];
+        #endif
+
+        // kernels using the last buffer were launched since the last call
+        if (last >= 0)
+            record_on( ptr_array_buffers_[ 2*slot + last ]->used, *current_stream_ );
+        ptr_array_last_[ slot ] = next;
+
+        // wait on the host for the upload from this staging buffer
+        // 2 calls ago, then fill it
+        buffer.uploaded.sync();
+        for (int j = 0; j < 3; ++j) {
+            if (src[ j ] != nullptr)
+                std::copy( src[ j ], src[ j ] + count, staging + j*batch_limit_ );
+        }
+
+        // upload after kernels using this buffer 2 calls ago;
+        // the current stream waits for the upload
+        #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+            if (buffer.used.event_ != nullptr)
+                stream_wait_event( upload_stream, buffer.used.event_, 0 );
+            for (int j = 0; j < 3; ++j) {
+                if (src[ j ] != nullptr) {
+                    #if defined(BLAS_HAVE_CUBLAS)
+                        blas_dev_call(
+                            cudaMemcpyAsync(
+                                dev_ptr_array + j*batch_limit_,
+                                staging + j*batch_limit_,
+                                count * sizeof(void*),
+                                cudaMemcpyHostToDevice, upload_stream ) );
+                    #else
+                        blas_dev_call(
+                            hipMemcpyAsync(
+                                dev_ptr_array + j*batch_limit_,
+                                staging + j*batch_limit_,
+                                count * sizeof(void*),
+                                hipMemcpyHostToDevice, upload_stream ) );
+                    #endif
+                }
+            }
+            record_on( buffer.uploaded, upload_stream );
+            stream_wait_event( *current_stream_, buffer.uploaded.event_, 0 );
+
+        #else
+            if (buffer.used.event_ != nullptr)
+                stream_wait_event( upload_stream, buffer.used.event_ );
+            upload_stream.submit( [=]() {
+                for (int j = 0; j < 3; ++j) {
+                    if (src[ j ] != nullptr) {
+                        std::copy( staging + j*batch_limit_,
+                                   staging + j*batch_limit_ + count,
+                                   dev_ptr_array + j*batch_limit_ );
+                    }
+                }
+                internal::host_copy_latency();
+            } );
+            record_on( buffer.uploaded, upload_stream );
+            stream_wait_event( *current_stream_, buffer.uploaded.event_ );
+        #endif
+
+        return dev_ptr_array;
+    #endif
+}
+
+// =============================================================================
+
+/** event member functions **/
+
+// -----------------------------------------------------------------------------
+/// Creates an event. It is complete until recorded.
+Event::Event()
+{
+    #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+        event_  = nullptr;
+        device_ = -1;
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+Event::~Event()
+{
+    try {
+        #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+            if (event_ != nullptr) {
+                blas::set_device( device_ );
+                event_destroy( event_ );
+            }
+        #endif
+    }
+    catch (...) {
+        // Destructors can't leak exceptions.
+    }
+}
+
+// -----------------------------------------------------------------------------
+/// @return true if all work before the last record of this event is done,
+/// or if the event was never recorded. Does not wait.
+bool Event::query() const
+{
+    #if defined(BLAS_HAVE_CUBLAS)
+        if (event_ == nullptr)
+            return true;
+        cudaError_t err = cudaEventQuery( event_ );
+        if (err == cudaErrorNotReady)
+            return false;
+        blas_dev_call( err );
+        return true;
+
+    #elif defined(BLAS_HAVE_ROCBLAS)
+        if (event_ == nullptr)
+            return true;
+        hipError_t err = hipEventQuery( event_ );
+        if (err == hipErrorNotReady)
+            return false;
+        blas_dev_call( err );
+        return true;
+
+    #elif defined(BLAS_HAVE_ONEMKL)
+        auto status = event_.get_info<
+            cl::sycl::info::event::command_execution_status >();
+        return status == cl::sycl::info::event_command_status::complete;
+
+    #else
+        if (event_ == nullptr)
+            return true;
+        std::lock_guard< std::mutex > lock( event_->mutex );
+        return event_->done;
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// Waits on the host until all work before the last record of this event
+/// is done.
+void Event::sync()
+{
+    #if defined(BLAS_HAVE_CUBLAS)
+        if (event_ != nullptr)
+            blas_dev_call( cudaEventSynchronize( event_ ) );
+
+    #elif defined(BLAS_HAVE_ROCBLAS)
+        if (event_ != nullptr)
+            blas_dev_call( hipEventSynchronize( event_ ) );
+
+    #elif defined(BLAS_HAVE_ONEMKL)
+        blas_dev_call( event_.wait() );
+
+    #else
+        if (event_ != nullptr) {
+            std::unique_lock< std::mutex > lock( event_->mutex );
+            event_->cv.wait( lock, [this]() { return event_->done; } );
+        }
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// Records event after all work submitted to this queue so far.
+/// Later work on any queue can wait for it with Queue::wait.
+/// In fork mode, the event follows work on all parallel streams.
+void Queue::record( Event& event )
+{
+    #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+        // events are tied to a device
+        blas::set_device( device_ );
+        if (event.event_ != nullptr && event.device_ != device_) {
+            event_destroy( event.event_ );
+            event.event_ = nullptr;
+        }
+        if (event.event_ == nullptr) {
+            event_create( &event.event_ );
+            event.device_ = device_;
+        }
+
+        // in fork mode, gather parallel streams onto the default stream
+        if (! fork_levels_.empty()) {
+            for (size_t i = 0; i < parallel_streams_.size(); ++i) {
+                event_record( parallel_events_[i], parallel_streams_[i] );
+                stream_wait_event( default_stream_, parallel_events_[i], 0 );
+            }
+        }
+        event_record( event.event_, default_stream_ );
+
+    #elif defined(BLAS_HAVE_ONEMKL)
+        event.event_ = default_stream_->ext_oneapi_submit_barrier();
+
+    #else
+        if (! fork_levels_.empty()) {
+            for (size_t i = 0; i < parallel_streams_.size(); ++i) {
+                stream_wait_event( default_stream_,
+                                   event_record( *parallel_streams_[ i ] ) );
+            }
+        }
+        event.event_ = event_record( default_stream_ );
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// Makes work submitted to this queue after this call wait until event is
+/// complete, without blocking the host. Uses the event's last record;
+/// if never recorded, has no effect.
+/// In fork mode, all parallel streams wait.
+void Queue::wait( Event const& event )
+{
+    #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+        if (event.event_ == nullptr)
+            return;
+
+        if (current_stream_ == &default_stream_) {
+            stream_wait_event( default_stream_, event.event_, 0 );
+        }
+        else {
+            for (size_t i = 0; i < parallel_streams_.size(); ++i) {
+                stream_wait_event( parallel_streams_[i], event.event_, 0 );
+            }
+        }
+
+    #elif defined(BLAS_HAVE_ONEMKL)
+        default_stream_->ext_oneapi_submit_barrier( { event.event_ } );
+
+    #else
+        if (event.event_ == nullptr)
+            return;
+
+        if (current_stream_ == &default_stream_) {
+            stream_wait_event( default_stream_, event.event_ );
+        }
+        else {
+            for (size_t i = 0; i < parallel_streams_.size(); ++i) {
+                stream_wait_event( *parallel_streams_[ i ], event.event_ );
+            }
+        }
     #endif
 }
 
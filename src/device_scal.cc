@@ -6,6 +6,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -20,6 +21,8 @@ void blas::scal(
     float *dx, int64_t incdx,
     blas::Queue& queue)
 {
+    blas_trace( "scal", 's', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );       // standard BLAS returns, doesn't fail
     blas_error_if( incdx <= 0 );  // standard BLAS returns, doesn't fail
@@ -48,6 +51,8 @@ void blas::scal(
     double *dx, int64_t incdx,
     blas::Queue& queue)
 {
+    blas_trace( "scal", 'd', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );       // standard BLAS returns, doesn't fail
     blas_error_if( incdx <= 0 );  // standard BLAS returns, doesn't fail
@@ -76,6 +81,8 @@ void blas::scal(
     std::complex<float> *dx, int64_t incdx,
     blas::Queue& queue)
 {
+    blas_trace( "scal", 'c', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );       // standard BLAS returns, doesn't fail
     blas_error_if( incdx <= 0 );  // standard BLAS returns, doesn't fail
@@ -104,6 +111,8 @@ void blas::scal(
     std::complex<double> *dx, int64_t incdx,
     blas::Queue& queue)
 {
+    blas_trace( "scal", 'z', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );       // standard BLAS returns, doesn't fail
     blas_error_if( incdx <= 0 );  // standard BLAS returns, doesn't fail
@@ -6,6 +6,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -20,6 +21,8 @@ void blas::swap(
     float *dy, int64_t incdy,
     blas::Queue &queue )
 {
+    blas_trace( "swap", 's', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );
     blas_error_if( incdx == 0 );
@@ -55,6 +58,8 @@ void blas::swap(
     double *dy, int64_t incdy,
     blas::Queue &queue )
 {
+    blas_trace( "swap", 'd', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );
     blas_error_if( incdx == 0 );
@@ -90,6 +95,8 @@ void blas::swap(
     std::complex<float> *dy, int64_t incdy,
     blas::Queue &queue )
 {
+    blas_trace( "swap", 'c', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );
     blas_error_if( incdx == 0 );
@@ -125,6 +132,8 @@ void blas::swap(
     std::complex<double> *dy, int64_t incdy,
     blas::Queue &queue )
 {
+    blas_trace( "swap", 'z', {}, { n }, queue );
+
     // check arguments
     blas_error_if( n < 0 );
     blas_error_if( incdx == 0 );
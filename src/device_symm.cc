@@ -6,6 +6,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -26,6 +27,8 @@ void blas::symm(
     float       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "symm", 's', { layout, side, uplo }, { m, n }, queue );
+
     typedef long long lld;
 
     // check arguments
@@ -99,6 +102,8 @@ void blas::symm(
     double       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "symm", 'd', { layout, side, uplo }, { m, n }, queue );
+
     typedef long long lld;
 
     // check arguments
@@ -172,6 +177,8 @@ void blas::symm(
     std::complex<float>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "symm", 'c', { layout, side, uplo }, { m, n }, queue );
+
     typedef long long lld;
 
     // check arguments
@@ -245,6 +252,8 @@ void blas::symm(
     std::complex<double>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "symm", 'z', { layout, side, uplo }, { m, n }, queue );
+
     typedef long long lld;
 
     // check arguments
@@ -6,6 +6,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -26,6 +27,8 @@ void blas::syr2k(
     float       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "syr2k", 's', { layout, uplo, trans }, { n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -95,6 +98,8 @@ void blas::syr2k(
     double       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "syr2k", 'd', { layout, uplo, trans }, { n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -164,6 +169,8 @@ void blas::syr2k(
     std::complex<float>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "syr2k", 'c', { layout, uplo, trans }, { n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -232,6 +239,8 @@ void blas::syr2k(
     std::complex<double>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "syr2k", 'z', { layout, uplo, trans }, { n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -6,6 +6,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -25,6 +26,8 @@ void blas::syrk(
     float       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "syrk", 's', { layout, uplo, trans }, { n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -87,6 +90,8 @@ void blas::syrk(
     double       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "syrk", 'd', { layout, uplo, trans }, { n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -149,6 +154,8 @@ void blas::syrk(
     std::complex<float>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "syrk", 'c', { layout, uplo, trans }, { n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -210,6 +217,8 @@ void blas::syrk(
     std::complex<double>       *dC, int64_t lddc,
     blas::Queue &queue )
 {
+    blas_trace( "syrk", 'z', { layout, uplo, trans }, { n, k }, queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -6,6 +6,7 @@
 #include "blas/device_blas.hh"
 
 #include "device_internal.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -27,6 +28,9 @@ void blas::trsm(
     float       *dB, int64_t lddb,
     blas::Queue &queue )
 {
+    blas_trace( "trsm", 's', { layout, side, uplo, trans, diag }, { m, n },
+                queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -98,6 +102,9 @@ void blas::trsm(
     double       *dB, int64_t lddb,
     blas::Queue  &queue )
 {
+    blas_trace( "trsm", 'd', { layout, side, uplo, trans, diag }, { m, n },
+                queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -169,6 +176,9 @@ void blas::trsm(
     std::complex<float>       *dB, int64_t lddb,
     blas::Queue  &queue )
 {
+    blas_trace( "trsm", 'c', { layout, side, uplo, trans, diag }, { m, n },
+                queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -240,6 +250,9 @@ void blas::trsm(
     std::complex<double>       *dB, int64_t lddb,
     blas::Queue  &queue )
 {
+    blas_trace( "trsm", 'z', { layout, side, uplo, trans, diag }, { m, n },
+                queue );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
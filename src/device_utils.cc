@@ -7,6 +7,18 @@
 
 #include "device_internal.hh"
 
+#if ! defined(BLAS_HAVE_CUBLAS) && ! defined(BLAS_HAVE_ROCBLAS) && ! defined(BLAS_HAVE_ONEMKL)
+    #include <algorithm>
+    #include <chrono>
+    #include <cstdlib>
+    #include <cstring>
+    #include <map>
+    #include <memory>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+#endif
+
 namespace blas {
 
 // -----------------------------------------------------------------------------
@@ -25,7 +37,8 @@ void set_device( blas::Device device )
         throw blas::Error( "unsupported function for sycl backend", __func__ );
 
     #else
-        throw blas::Error( "device BLAS not available", __func__ );
+        // host backend has one device, the host
+        blas_error_if_msg( device != 0, "invalid device %d", device );
     #endif
 }
 
@@ -49,12 +62,12 @@ void get_device( blas::Device *device )
         throw blas::Error( "unsupported function for sycl backend", __func__ );
 
     #else
-        throw blas::Error( "device BLAS not available", __func__ );
+        (*device) = 0;
     #endif
 }
 
 // -----------------------------------------------------------------------------
-// @return number of GPU devices
+// @return number of GPU devices; 1 for the host backend
 device_blas_int get_device_count()
 {
     device_blas_int dev_count = 0;
@@ -79,7 +92,8 @@ device_blas_int get_device_count()
     }
 
     #else
-        // return dev_count = 0
+        // host backend has one device, the host
+        dev_count = 1;
     #endif
 
     return dev_count;
@@ -116,6 +130,158 @@ void enumerate_devices(std::vector<cl::sycl::device> &devices)
 }
 #endif
 
+#if ! defined(BLAS_HAVE_CUBLAS) && ! defined(BLAS_HAVE_ROCBLAS) && ! defined(BLAS_HAVE_ONEMKL)
+namespace internal {
+
+// =============================================================================
+// Host backend memory. Device and pinned memory are host memory, recorded
+// in a registry so copies can tell them from other (pageable) host memory
+// and follow the CUDA rules for pageable memory: a copy from pageable
+// memory is staged when it is issued, so the source can be reused at once,
+// and a copy to pageable memory waits for the queue and completes before
+// returning. Copies between device or pinned memory are asynchronous.
+
+//------------------------------------------------------------------------------
+/// Allocations from host_malloc, mapping start address to size.
+struct HostRegistry {
+    std::mutex mutex;
+    std::map< char const*, size_t > allocations;
+};
+
+/// @return the registry of host_malloc allocations.
+HostRegistry& host_registry()
+{
+    static HostRegistry registry;
+    return registry;
+}
+
+//------------------------------------------------------------------------------
+/// @return true if ptr is inside memory from host_malloc.
+bool host_is_registered( void const* ptr )
+{
+    HostRegistry& registry = host_registry();
+    std::lock_guard< std::mutex > lock( registry.mutex );
+
+    char const* p = (char const*) ptr;
+    auto iter = registry.allocations.upper_bound( p );
+    if (iter == registry.allocations.begin())
+        return false;
+    --iter;
+    return p < iter->first + iter->second;
+}
+
+//------------------------------------------------------------------------------
+/// Allocates bytes of device or pinned memory for the host backend.
+void* host_malloc( size_t bytes )
+{
+    // allocate at least 1 byte so each allocation has a unique address
+    bytes = std::max( bytes, size_t( 1 ) );
+    void* ptr = std::malloc( bytes );
+    blas_error_if_msg( ptr == nullptr, "failed to allocate %lld bytes",
+                       (long long) bytes );
+
+    HostRegistry& registry = host_registry();
+    std::lock_guard< std::mutex > lock( registry.mutex );
+    registry.allocations[ (char const*) ptr ] = bytes;
+    return ptr;
+}
+
+//------------------------------------------------------------------------------
+/// Frees memory from host_malloc.
+void host_free( void* ptr )
+{
+    if (ptr == nullptr)
+        return;
+
+    HostRegistry& registry = host_registry();
+    {
+        std::lock_guard< std::mutex > lock( registry.mutex );
+        registry.allocations.erase( (char const*) ptr );
+    }
+    std::free( ptr );
+}
+
+//------------------------------------------------------------------------------
+/// Simulates the latency of a copy between host and device memory, to
+/// measure how well copies overlap computation: sleeps for the number of
+/// microseconds in the environment variable BLASPP_HOST_COPY_LATENCY,
+/// if it is set.
+void host_copy_latency()
+{
+    static const long latency = []() {
+        char const* env = std::getenv( "BLASPP_HOST_COPY_LATENCY" );
+        return (env != nullptr ? std::atol( env ) : 0L);
+    }();
+    if (latency > 0)
+        std::this_thread::sleep_for( std::chrono::microseconds( latency ) );
+}
+
+//------------------------------------------------------------------------------
+/// Sets bytes of memory to value, asynchronously on the queue's stream.
+void host_memset( void* ptr, int value, size_t bytes, Queue& queue )
+{
+    queue.stream().submit( [=]() {
+        std::memset( ptr, value, bytes );
+    } );
+}
+
+//------------------------------------------------------------------------------
+/// Copies a width-by-height array of bytes; see device_memcpy_2d.
+/// Pitches are ignored if height == 1.
+void host_memcpy_2d(
+    void*       dst, size_t dst_pitch,
+    void const* src, size_t src_pitch,
+    size_t width, size_t height, Queue& queue )
+{
+    if (width == 0 || height == 0)
+        return;
+
+    auto copy = []( char* dst_, size_t dst_pitch_,
+                    char const* src_, size_t src_pitch_,
+                    size_t width_, size_t height_ )
+    {
+        for (size_t i = 0; i < height_; ++i) {
+            std::memcpy( dst_ + i*dst_pitch_, src_ + i*src_pitch_, width_ );
+        }
+    };
+
+    bool src_registered = host_is_registered( src );
+    bool dst_registered = host_is_registered( dst );
+    if (src_registered && dst_registered) {
+        // device or pinned to device or pinned: asynchronous
+        queue.stream().submit( [=]() {
+            copy( (char*) dst, dst_pitch, (char const*) src, src_pitch,
+                  width, height );
+            host_copy_latency();
+        } );
+    }
+    else if (dst_registered) {
+        // pageable to device: stage the source now, copy asynchronously
+        std::shared_ptr< std::vector<char> > staged(
+            new std::vector<char>( width * height ) );
+        copy( staged->data(), width, (char const*) src, src_pitch,
+              width, height );
+        queue.stream().submit( [=]() {
+            copy( (char*) dst, dst_pitch, staged->data(), width,
+                  width, height );
+            host_copy_latency();
+        } );
+    }
+    else {
+        // device to pageable: wait for the queue, then copy now;
+        // pageable to pageable: copy now
+        if (src_registered) {
+            queue.stream().sync();
+            host_copy_latency();
+        }
+        copy( (char*) dst, dst_pitch, (char const*) src, src_pitch,
+              width, height );
+    }
+}
+
+}  // namespace internal
+#endif
+
 // -----------------------------------------------------------------------------
 /// free a device pointer
 void device_free( void* ptr )
@@ -133,7 +299,9 @@ void device_free( void* ptr )
         throw blas::Error( "unsupported function for sycl backend", __func__ );
 
     #else
-        throw blas::Error( "device BLAS not available", __func__ );
+        // like cudaFree, wait for tasks on any stream that may use ptr
+        internal::HostStream::sync_all();
+        internal::host_free( ptr );
     #endif
 }
 
@@ -154,6 +322,11 @@ void device_free( void* ptr, blas::Queue &queue )
     #elif defined(BLAS_HAVE_ONEMKL)
        blas_dev_call(
            sycl::free( ptr, queue.stream() ) );
+
+    #else
+        // like cudaFree, wait for tasks that may use ptr
+        queue.sync();
+        internal::host_free( ptr );
     #endif
 }
 
@@ -173,7 +346,9 @@ void device_free_pinned( void* ptr )
         throw blas::Error( "unsupported function for sycl backend", __func__ );
 
     #else
-        throw blas::Error( "device BLAS not available", __func__ );
+        // like cudaFreeHost, wait for tasks on any stream that may use ptr
+        internal::HostStream::sync_all();
+        internal::host_free( ptr );
     #endif
 }
 
@@ -194,7 +369,8 @@ void device_free_pinned( void* ptr,  blas::Queue &queue )
             sycl::free( ptr, queue.stream() ) );
 
     #else
-        throw blas::Error( "device BLAS not available", __func__ );
+        queue.sync();
+        internal::host_free( ptr );
     #endif
 }
 
@@ -0,0 +1,851 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Refer to the linked routines, not the table, in BLAS_dgemm, etc.
+#define BLAS_DISPATCH_NO_REDIRECT
+#include "dispatch.hh"
+#include "blas.hh"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if ! defined(_WIN32)
+    #include <dlfcn.h>
+#endif
+
+namespace blas {
+namespace internal {
+
+//==============================================================================
+// Template backend: adapters with the Fortran interface of each routine,
+// calling the template implementations in BLAS++ on column-major data.
+
+//------------------------------------------------------------------------------
+/// Type in the Fortran interface for T, e.g., blas_complex_float for
+/// std::complex<float>. The complex types have the same layout.
+template <typename T> struct fortran_type_ { using type = T; };
+
+template <> struct fortran_type_< std::complex<float> > {
+    using type = blas_complex_float;
+};
+
+template <> struct fortran_type_< std::complex<double> > {
+    using type = blas_complex_double;
+};
+
+template <typename T>
+using fortran_t = typename fortran_type_<T>::type;
+
+/// Return type in the Fortran interface for T, which is double for float
+/// with the f2c convention.
+template <typename T> struct fortran_return_ { using type = fortran_t<T>; };
+
+template <> struct fortran_return_< float > {
+    using type = blas_float_return;
+};
+
+template <typename T>
+using fortran_return_t = typename fortran_return_<T>::type;
+
+// -----------------------------------------------------------------------------
+// Level 1
+
+template <typename T>
+void template_axpy(
+    blas_int const* n, fortran_t<T> const* alpha,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T>*       y, blas_int const* incy )
+{
+    blas::axpy<T, T>( *n, *(T const*) alpha, (T const*) x, *incx,
+                      (T*) y, *incy );
+}
+
+template <typename T>
+void template_scal(
+    blas_int const* n, fortran_t<T> const* alpha,
+    fortran_t<T>* x, blas_int const* incx )
+{
+    blas::scal<T>( *n, *(T const*) alpha, (T*) x, *incx );
+}
+
+template <typename T>
+void template_copy(
+    blas_int const* n,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T>*       y, blas_int const* incy )
+{
+    blas::copy<T, T>( *n, (T const*) x, *incx, (T*) y, *incy );
+}
+
+template <typename T>
+void template_swap(
+    blas_int const* n,
+    fortran_t<T>* x, blas_int const* incx,
+    fortran_t<T>* y, blas_int const* incy )
+{
+    blas::swap<T, T>( *n, (T*) x, *incx, (T*) y, *incy );
+}
+
+#ifdef BLAS_COMPLEX_RETURN_ARGUMENT
+
+template <typename T>
+void template_dot(
+    fortran_t<T>* result, blas_int const* n,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T> const* y, blas_int const* incy )
+{
+    *(T*) result = blas::dot<T, T>( *n, (T const*) x, *incx,
+                                        (T const*) y, *incy );
+}
+
+template <typename T>
+void template_dotu(
+    fortran_t<T>* result, blas_int const* n,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T> const* y, blas_int const* incy )
+{
+    *(T*) result = blas::dotu<T, T>( *n, (T const*) x, *incx,
+                                         (T const*) y, *incy );
+}
+
+// Real dot returns its value in either convention.
+template <typename T>
+fortran_return_t<T> template_dot(
+    blas_int const* n,
+    T const* x, blas_int const* incx,
+    T const* y, blas_int const* incy )
+{
+    return blas::dot<T, T>( *n, x, *incx, y, *incy );
+}
+
+#else
+
+template <typename T>
+fortran_return_t<T> template_dot(
+    blas_int const* n,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T> const* y, blas_int const* incy )
+{
+    T result = blas::dot<T, T>( *n, (T const*) x, *incx,
+                                    (T const*) y, *incy );
+    return *(fortran_return_t<T>*) &result;
+}
+
+template <typename T>
+fortran_return_t<T> template_dotu(
+    blas_int const* n,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T> const* y, blas_int const* incy )
+{
+    T result = blas::dotu<T, T>( *n, (T const*) x, *incx,
+                                     (T const*) y, *incy );
+    return *(fortran_return_t<T>*) &result;
+}
+
+#endif
+
+template <typename T>
+fortran_return_t< real_type<T> > template_nrm2(
+    blas_int const* n, fortran_t<T> const* x, blas_int const* incx )
+{
+    return blas::nrm2<T>( *n, (T const*) x, *incx );
+}
+
+template <typename T>
+fortran_return_t< real_type<T> > template_asum(
+    blas_int const* n, fortran_t<T> const* x, blas_int const* incx )
+{
+    return blas::asum<T>( *n, (T const*) x, *incx );
+}
+
+/// Fortran returns a 1-based index, or 0 if n < 1.
+template <typename T>
+blas_int template_iamax(
+    blas_int const* n, fortran_t<T> const* x, blas_int const* incx )
+{
+    if (*n < 1 || *incx < 1)
+        return 0;
+    return blas_int( blas::iamax<T>( *n, (T const*) x, *incx ) + 1 );
+}
+
+/// Real rotg.
+template <typename T>
+void template_rotg( T* a, T* b, T* c, T* s )
+{
+    blas::rotg<T, T>( a, b, c, s );
+}
+
+/// Complex rotg; b is input only.
+template <typename T>
+void template_rotg(
+    fortran_t<T>* a, fortran_t<T> const* b,
+    real_type<T>* c, fortran_t<T>* s )
+{
+    using real_t = real_type<T>;
+    blas::rotg<real_t, real_t>( (T*) a, (T*) b, c, (T*) s );
+}
+
+/// rot with sine of type T.
+template <typename T>
+void template_rot(
+    blas_int const* n,
+    fortran_t<T>* x, blas_int const* incx,
+    fortran_t<T>* y, blas_int const* incy,
+    real_type<T> const* c, fortran_t<T> const* s )
+{
+    blas::rot<T, T>( *n, (T*) x, *incx, (T*) y, *incy,
+                     *c, *(T const*) s );
+}
+
+/// Complex rot with real sine (csrot, zdrot).
+template <typename T>
+void template_csrot(
+    blas_int const* n,
+    fortran_t<T>* x, blas_int const* incx,
+    fortran_t<T>* y, blas_int const* incy,
+    real_type<T> const* c, real_type<T> const* s )
+{
+    blas::rot<T, T>( *n, (T*) x, *incx, (T*) y, *incy, *c, *s );
+}
+
+template <typename T>
+void template_rotmg( T* d1, T* d2, T* x1, T const* y1, T* param )
+{
+    blas::rotmg<T>( d1, d2, x1, *y1, param );
+}
+
+template <typename T>
+void template_rotm(
+    blas_int const* n,
+    T* x, blas_int const* incx,
+    T* y, blas_int const* incy,
+    T const* param )
+{
+    blas::rotm<T, T>( *n, x, *incx, y, *incy, param );
+}
+
+// -----------------------------------------------------------------------------
+// Level 2
+
+template <typename T>
+void template_gemv(
+    char const* trans, blas_int const* m, blas_int const* n,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T> const* beta,
+    fortran_t<T>*       y, blas_int const* incy )
+{
+    blas::gemv<T, T, T>( Layout::ColMajor, char2op( *trans ), *m, *n,
+                         *(T const*) alpha, (T const*) A, *lda,
+                         (T const*) x, *incx,
+                         *(T const*) beta, (T*) y, *incy );
+}
+
+template <typename T>
+void template_gbmv(
+    char const* trans, blas_int const* m, blas_int const* n,
+    blas_int const* kl, blas_int const* ku,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T> const* beta,
+    fortran_t<T>*       y, blas_int const* incy )
+{
+    blas::gbmv<T, T, T>( Layout::ColMajor, char2op( *trans ), *m, *n,
+                         *kl, *ku, *(T const*) alpha, (T const*) A, *lda,
+                         (T const*) x, *incx,
+                         *(T const*) beta, (T*) y, *incy );
+}
+
+template <typename T>
+void template_ger(
+    blas_int const* m, blas_int const* n,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T> const* y, blas_int const* incy,
+    fortran_t<T>*       A, blas_int const* lda )
+{
+    blas::ger<T, T, T>( Layout::ColMajor, *m, *n, *(T const*) alpha,
+                        (T const*) x, *incx, (T const*) y, *incy,
+                        (T*) A, *lda );
+}
+
+template <typename T>
+void template_geru(
+    blas_int const* m, blas_int const* n,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T> const* y, blas_int const* incy,
+    fortran_t<T>*       A, blas_int const* lda )
+{
+    blas::geru<T, T, T>( Layout::ColMajor, *m, *n, *(T const*) alpha,
+                         (T const*) x, *incx, (T const*) y, *incy,
+                         (T*) A, *lda );
+}
+
+template <typename T>
+void template_symv(
+    char const* uplo, blas_int const* n,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T> const* beta,
+    fortran_t<T>*       y, blas_int const* incy )
+{
+    blas::symv<T, T, T>( Layout::ColMajor, char2uplo( *uplo ), *n,
+                         *(T const*) alpha, (T const*) A, *lda,
+                         (T const*) x, *incx,
+                         *(T const*) beta, (T*) y, *incy );
+}
+
+template <typename T>
+void template_hemv(
+    char const* uplo, blas_int const* n,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T> const* beta,
+    fortran_t<T>*       y, blas_int const* incy )
+{
+    blas::hemv<T, T, T>( Layout::ColMajor, char2uplo( *uplo ), *n,
+                         *(T const*) alpha, (T const*) A, *lda,
+                         (T const*) x, *incx,
+                         *(T const*) beta, (T*) y, *incy );
+}
+
+template <typename T>
+void template_sbmv(
+    char const* uplo, blas_int const* n, blas_int const* k,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T> const* beta,
+    fortran_t<T>*       y, blas_int const* incy )
+{
+    blas::sbmv<T, T, T>( Layout::ColMajor, char2uplo( *uplo ), *n, *k,
+                         *(T const*) alpha, (T const*) A, *lda,
+                         (T const*) x, *incx,
+                         *(T const*) beta, (T*) y, *incy );
+}
+
+template <typename T>
+void template_hbmv(
+    char const* uplo, blas_int const* n, blas_int const* k,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T> const* beta,
+    fortran_t<T>*       y, blas_int const* incy )
+{
+    blas::hbmv<T, T, T>( Layout::ColMajor, char2uplo( *uplo ), *n, *k,
+                         *(T const*) alpha, (T const*) A, *lda,
+                         (T const*) x, *incx,
+                         *(T const*) beta, (T*) y, *incy );
+}
+
+template <typename T>
+void template_syr(
+    char const* uplo, blas_int const* n,
+    T const* alpha,
+    T const* x, blas_int const* incx,
+    T*       A, blas_int const* lda )
+{
+    blas::syr<T, T>( Layout::ColMajor, char2uplo( *uplo ), *n,
+                     *alpha, x, *incx, A, *lda );
+}
+
+template <typename T>
+void template_her(
+    char const* uplo, blas_int const* n,
+    real_type<T> const* alpha,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T>*       A, blas_int const* lda )
+{
+    blas::her<T, T>( Layout::ColMajor, char2uplo( *uplo ), *n,
+                     *alpha, (T const*) x, *incx, (T*) A, *lda );
+}
+
+template <typename T>
+void template_syr2(
+    char const* uplo, blas_int const* n,
+    T const* alpha,
+    T const* x, blas_int const* incx,
+    T const* y, blas_int const* incy,
+    T*       A, blas_int const* lda )
+{
+    blas::syr2<T, T, T>( Layout::ColMajor, char2uplo( *uplo ), *n,
+                         *alpha, x, *incx, y, *incy, A, *lda );
+}
+
+template <typename T>
+void template_her2(
+    char const* uplo, blas_int const* n,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* x, blas_int const* incx,
+    fortran_t<T> const* y, blas_int const* incy,
+    fortran_t<T>*       A, blas_int const* lda )
+{
+    blas::her2<T, T, T>( Layout::ColMajor, char2uplo( *uplo ), *n,
+                         *(T const*) alpha, (T const*) x, *incx,
+                         (T const*) y, *incy, (T*) A, *lda );
+}
+
+template <typename T>
+void template_trmv(
+    char const* uplo, char const* trans, char const* diag,
+    blas_int const* n,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T>*       x, blas_int const* incx )
+{
+    blas::trmv<T, T>( Layout::ColMajor, char2uplo( *uplo ),
+                      char2op( *trans ), char2diag( *diag ), *n,
+                      (T const*) A, *lda, (T*) x, *incx );
+}
+
+template <typename T>
+void template_trsv(
+    char const* uplo, char const* trans, char const* diag,
+    blas_int const* n,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T>*       x, blas_int const* incx )
+{
+    blas::trsv<T, T>( Layout::ColMajor, char2uplo( *uplo ),
+                      char2op( *trans ), char2diag( *diag ), *n,
+                      (T const*) A, *lda, (T*) x, *incx );
+}
+
+template <typename T>
+void template_tbmv(
+    char const* uplo, char const* trans, char const* diag,
+    blas_int const* n, blas_int const* k,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T>*       x, blas_int const* incx )
+{
+    blas::tbmv<T, T>( Layout::ColMajor, char2uplo( *uplo ),
+                      char2op( *trans ), char2diag( *diag ), *n, *k,
+                      (T const*) A, *lda, (T*) x, *incx );
+}
+
+template <typename T>
+void template_tbsv(
+    char const* uplo, char const* trans, char const* diag,
+    blas_int const* n, blas_int const* k,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T>*       x, blas_int const* incx )
+{
+    blas::tbsv<T, T>( Layout::ColMajor, char2uplo( *uplo ),
+                      char2op( *trans ), char2diag( *diag ), *n, *k,
+                      (T const*) A, *lda, (T*) x, *incx );
+}
+
+// -----------------------------------------------------------------------------
+// Level 3
+
+template <typename T>
+void template_gemm(
+    char const* transA, char const* transB,
+    blas_int const* m, blas_int const* n, blas_int const* k,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T> const* B, blas_int const* ldb,
+    fortran_t<T> const* beta,
+    fortran_t<T>*       C, blas_int const* ldc )
+{
+    blas::gemm<T, T, T>( Layout::ColMajor, char2op( *transA ),
+                         char2op( *transB ), *m, *n, *k,
+                         *(T const*) alpha, (T const*) A, *lda,
+                         (T const*) B, *ldb,
+                         *(T const*) beta, (T*) C, *ldc );
+}
+
+template <typename T>
+void template_gemmt(
+    char const* uplo, char const* transA, char const* transB,
+    blas_int const* n, blas_int const* k,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T> const* B, blas_int const* ldb,
+    fortran_t<T> const* beta,
+    fortran_t<T>*       C, blas_int const* ldc )
+{
+    blas::gemmt<T, T, T>( Layout::ColMajor, char2uplo( *uplo ),
+                          char2op( *transA ), char2op( *transB ), *n, *k,
+                          *(T const*) alpha, (T const*) A, *lda,
+                          (T const*) B, *ldb,
+                          *(T const*) beta, (T*) C, *ldc );
+}
+
+template <typename T>
+void template_symm(
+    char const* side, char const* uplo,
+    blas_int const* m, blas_int const* n,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T> const* B, blas_int const* ldb,
+    fortran_t<T> const* beta,
+    fortran_t<T>*       C, blas_int const* ldc )
+{
+    blas::symm<T, T, T>( Layout::ColMajor, char2side( *side ),
+                         char2uplo( *uplo ), *m, *n,
+                         *(T const*) alpha, (T const*) A, *lda,
+                         (T const*) B, *ldb,
+                         *(T const*) beta, (T*) C, *ldc );
+}
+
+template <typename T>
+void template_hemm(
+    char const* side, char const* uplo,
+    blas_int const* m, blas_int const* n,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T> const* B, blas_int const* ldb,
+    fortran_t<T> const* beta,
+    fortran_t<T>*       C, blas_int const* ldc )
+{
+    blas::hemm<T, T, T>( Layout::ColMajor, char2side( *side ),
+                         char2uplo( *uplo ), *m, *n,
+                         *(T const*) alpha, (T const*) A, *lda,
+                         (T const*) B, *ldb,
+                         *(T const*) beta, (T*) C, *ldc );
+}
+
+template <typename T>
+void template_syrk(
+    char const* uplo, char const* trans,
+    blas_int const* n, blas_int const* k,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T> const* beta,
+    fortran_t<T>*       C, blas_int const* ldc )
+{
+    blas::syrk<T, T>( Layout::ColMajor, char2uplo( *uplo ),
+                      char2op( *trans ), *n, *k,
+                      *(T const*) alpha, (T const*) A, *lda,
+                      *(T const*) beta, (T*) C, *ldc );
+}
+
+template <typename T>
+void template_herk(
+    char const* uplo, char const* trans,
+    blas_int const* n, blas_int const* k,
+    real_type<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    real_type<T> const* beta,
+    fortran_t<T>*       C, blas_int const* ldc )
+{
+    blas::herk<T, T>( Layout::ColMajor, char2uplo( *uplo ),
+                      char2op( *trans ), *n, *k,
+                      *alpha, (T const*) A, *lda, *beta, (T*) C, *ldc );
+}
+
+template <typename T>
+void template_syr2k(
+    char const* uplo, char const* trans,
+    blas_int const* n, blas_int const* k,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T> const* B, blas_int const* ldb,
+    fortran_t<T> const* beta,
+    fortran_t<T>*       C, blas_int const* ldc )
+{
+    blas::syr2k<T, T, T>( Layout::ColMajor, char2uplo( *uplo ),
+                          char2op( *trans ), *n, *k,
+                          *(T const*) alpha, (T const*) A, *lda,
+                          (T const*) B, *ldb,
+                          *(T const*) beta, (T*) C, *ldc );
+}
+
+template <typename T>
+void template_her2k(
+    char const* uplo, char const* trans,
+    blas_int const* n, blas_int const* k,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T> const* B, blas_int const* ldb,
+    real_type<T> const* beta,
+    fortran_t<T>*       C, blas_int const* ldc )
+{
+    blas::her2k<T, T, T>( Layout::ColMajor, char2uplo( *uplo ),
+                          char2op( *trans ), *n, *k,
+                          *(T const*) alpha, (T const*) A, *lda,
+                          (T const*) B, *ldb,
+                          *beta, (T*) C, *ldc );
+}
+
+template <typename T>
+void template_trmm(
+    char const* side, char const* uplo, char const* trans, char const* diag,
+    blas_int const* m, blas_int const* n,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T>*       B, blas_int const* ldb )
+{
+    blas::trmm<T, T>( Layout::ColMajor, char2side( *side ),
+                      char2uplo( *uplo ), char2op( *trans ),
+                      char2diag( *diag ), *m, *n,
+                      *(T const*) alpha, (T const*) A, *lda, (T*) B, *ldb );
+}
+
+template <typename T>
+void template_trsm(
+    char const* side, char const* uplo, char const* trans, char const* diag,
+    blas_int const* m, blas_int const* n,
+    fortran_t<T> const* alpha,
+    fortran_t<T> const* A, blas_int const* lda,
+    fortran_t<T>*       B, blas_int const* ldb )
+{
+    blas::trsm<T, T>( Layout::ColMajor, char2side( *side ),
+                      char2uplo( *uplo ), char2op( *trans ),
+                      char2diag( *diag ), *m, *n,
+                      *(T const*) alpha, (T const*) A, *lda, (T*) B, *ldb );
+}
+
+//==============================================================================
+// Dispatch table
+
+/// Table used by the wrappers, initially the linked routines.
+DispatchTable dispatch_table = {
+    #define BLAS_DISPATCH_LINKED( name, family, adapter ) \
+        &BLAS_##name,
+
+    BLAS_DISPATCH_ROUTINES( BLAS_DISPATCH_LINKED )
+
+    #undef BLAS_DISPATCH_LINKED
+};
+
+namespace {
+
+#define BLAS_DISPATCH_STR_( x ) #x
+#define BLAS_DISPATCH_STR( x ) BLAS_DISPATCH_STR_( x )
+
+/// Generic function pointer, to store routines of any type.
+typedef void (*function_t)();
+
+struct Routine {
+    char const* name;       ///< BLAS name, e.g., "dgemm"
+    char const* family;     ///< BLAS++ name for all precisions, e.g., "gemm"
+    char const* symbol;     ///< mangled name, e.g., "dgemm_"
+    function_t  linked;     ///< routine linked with BLAS++
+    function_t  templated;  ///< template adapter
+};
+
+/// Routines in the order of the table. Casting the adapter to the type of
+/// the linked routine checks that its interface matches.
+const Routine routines[] = {
+    #define BLAS_DISPATCH_ROUTINE( name, family, adapter ) \
+        { #name, #family, BLAS_DISPATCH_STR( BLAS_##name ), \
+          reinterpret_cast< function_t >( &BLAS_##name ), \
+          reinterpret_cast< function_t >( \
+              static_cast< decltype( &BLAS_##name ) >( &adapter ) ) },
+
+    BLAS_DISPATCH_ROUTINES( BLAS_DISPATCH_ROUTINE )
+
+    #undef BLAS_DISPATCH_ROUTINE
+};
+
+const size_t num_routines = sizeof(routines) / sizeof(routines[ 0 ]);
+
+/// Sets the table entry for routines[ index ] to func.
+void set_routine( size_t index, function_t func )
+{
+    size_t i = 0;
+    #define BLAS_DISPATCH_SET( name, family, adapter ) \
+        if (index == i++) { \
+            dispatch_table.name \
+                = reinterpret_cast< decltype( &BLAS_##name ) >( func ); \
+            return; \
+        }
+
+    BLAS_DISPATCH_ROUTINES( BLAS_DISPATCH_SET )
+
+    #undef BLAS_DISPATCH_SET
+}
+
+/// Guards backend names and libraries, and changes to the table.
+std::mutex backend_mutex;
+
+/// Backend of each routine, as given to set_backend.
+std::vector< std::string > backend_names( num_routines, "default" );
+
+/// Libraries loaded by dlopen, by file name. They are never closed,
+/// since the table may point into them.
+std::map< std::string, void* > libraries;
+
+//------------------------------------------------------------------------------
+/// @return file name of library, for the short names openblas, mkl, blis.
+std::string library_file( std::string const& library )
+{
+    #if defined(__APPLE__)
+        const std::string suffix = ".dylib";
+    #else
+        const std::string suffix = ".so";
+    #endif
+
+    if (library == "openblas")
+        return "libopenblas" + suffix;
+    else if (library == "mkl")
+        return "libmkl_rt" + suffix;
+    else if (library == "blis")
+        return "libblis" + suffix;
+    else
+        return library;
+}
+
+//------------------------------------------------------------------------------
+/// @return routines[ index ] from library, loading the library if needed.
+/// Throws Error if the library or routine is not found.
+function_t find_routine( std::string const& library, size_t index )
+{
+    if (library == "default")
+        return routines[ index ].linked;
+    if (library == "template")
+        return routines[ index ].templated;
+
+    #if defined(_WIN32)
+        blas_error_if_msg( true, "loading %s: dlopen is not available",
+                           library.c_str() );
+        return nullptr;
+    #else
+        std::string file = library_file( library );
+        void*& handle = libraries[ file ];
+        if (handle == nullptr) {
+            handle = dlopen( file.c_str(), RTLD_NOW | RTLD_LOCAL );
+            if (handle == nullptr) {
+                libraries.erase( file );
+                blas_error_if_msg( true, "%s", dlerror() );
+            }
+        }
+        void* func = dlsym( handle, routines[ index ].symbol );
+        blas_error_if_msg( func == nullptr, "%s not found in %s",
+                           routines[ index ].symbol, file.c_str() );
+        return reinterpret_cast< function_t >( func );
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// @return true if routine names routines[ index ]: either all routines,
+/// if routine is empty, its name (dgemm), or its BLAS++ family (gemm
+/// matches sgemm, dgemm, cgemm, zgemm; rot matches srot, csrot, etc.).
+bool routine_matches( std::string const& routine, size_t index )
+{
+    return routine.empty()
+           || routine == routines[ index ].name
+           || routine == routines[ index ].family;
+}
+
+//------------------------------------------------------------------------------
+/// Sets backends from environment variables. BLASPP_BACKEND sets all
+/// routines; then BLASPP_BACKEND_GEMM sets the gemm family (sgemm, dgemm,
+/// cgemm, zgemm), and BLASPP_BACKEND_DGEMM sets only dgemm, etc.
+/// Since this runs as the library is loaded, errors are printed, leaving
+/// the linked routines in place.
+bool set_backend_from_env()
+{
+    auto set_from = [] ( std::string const& var, std::string const& routine ) {
+        char const* value = std::getenv( var.c_str() );
+        if (value == nullptr || value[ 0 ] == '\0')
+            return;
+        try {
+            set_backend( value, routine );
+        }
+        catch (blas::Error const& ex) {
+            fprintf( stderr, "BLAS++: %s=%s: %s\n",
+                     var.c_str(), value, ex.what() );
+        }
+    };
+
+    auto upper = [] ( std::string str ) {
+        for (auto& c : str)
+            c = char( std::toupper( c ) );
+        return str;
+    };
+
+    set_from( "BLASPP_BACKEND", "" );
+    for (size_t i = 0; i < num_routines; ++i) {
+        set_from( "BLASPP_BACKEND_" + upper( routines[ i ].family ),
+                  routines[ i ].name );
+        set_from( "BLASPP_BACKEND_" + upper( routines[ i ].name ),
+                  routines[ i ].name );
+    }
+    return true;
+}
+
+const bool backend_from_env = set_backend_from_env();
+
+}  // namespace
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Sets the library providing native BLAS routines called by BLAS++.
+///
+/// @param[in] library
+///     - "default":  routines linked with BLAS++.
+///     - "template": template implementations in BLAS++.
+///     - "openblas", "mkl", "blis": libopenblas.so, libmkl_rt.so,
+///       libblis.so, loaded with dlopen.
+///     - otherwise, the file name or path of a library to load with dlopen.
+///     The library must use the same integer size (blas_int) and calling
+///     conventions as the linked BLAS.
+///
+/// @param[in] routine
+///     BLAS routine to set, e.g., "dgemm"; or "gemm" for all precisions;
+///     or empty for all routines. Default empty.
+///
+/// The BLASPP_BACKEND environment variable sets the library for all
+/// routines when BLAS++ is loaded. BLASPP_BACKEND_GEMM,
+/// BLASPP_BACKEND_DGEMM, etc., override it for individual routines.
+///
+/// Changing backends while other threads call BLAS++ is not safe.
+/// Throws Error if the library cannot be loaded or lacks a routine;
+/// then no routine is changed.
+///
+void set_backend( std::string const& library, std::string const& routine )
+{
+    using namespace internal;
+
+    std::lock_guard< std::mutex > lock( backend_mutex );
+
+    // Find all routines first, so an error leaves the table unchanged.
+    std::vector< size_t > indices;
+    std::vector< function_t > funcs;
+    for (size_t i = 0; i < num_routines; ++i) {
+        if (routine_matches( routine, i )) {
+            indices.push_back( i );
+            funcs.push_back( find_routine( library, i ) );
+        }
+    }
+    blas_error_if_msg( indices.empty(), "unknown BLAS routine %s",
+                       routine.c_str() );
+
+    for (size_t j = 0; j < indices.size(); ++j) {
+        set_routine( indices[ j ], funcs[ j ] );
+        backend_names[ indices[ j ] ] = library;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return library providing the given BLAS routine, e.g., "dgemm",
+/// as set by set_backend.
+///
+std::string get_backend( std::string const& routine )
+{
+    using namespace internal;
+
+    std::lock_guard< std::mutex > lock( backend_mutex );
+    for (size_t i = 0; i < num_routines; ++i) {
+        if (routine == routines[ i ].name)
+            return backend_names[ i ];
+    }
+    blas_error_if_msg( true, "unknown BLAS routine %s", routine.c_str() );
+    return "";
+}
+
+}  // namespace blas
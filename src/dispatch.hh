@@ -0,0 +1,450 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_DISPATCH_HH
+#define BLAS_DISPATCH_HH
+
+// Dispatch table of native BLAS routines.
+//
+// The wrappers call the native BLAS through BLAS_dgemm, etc. After this
+// header, those macros refer to function pointers in dispatch_table instead
+// of the routines linked with BLAS++, so each call costs one indirect
+// branch. The table starts with the linked routines; set_backend and the
+// BLASPP_BACKEND environment variables replace entries with routines
+// loaded from another library by dlopen, or with the template
+// implementations in BLAS++ (see dispatch.cc).
+
+#include "blas/fortran.h"
+
+//------------------------------------------------------------------------------
+// X( routine, BLAS++ routine, template adapter ) for each routine in
+// blas/fortran.h. The BLAS++ routine names the family for set_backend,
+// e.g., gemm for sgemm, ..., zgemm; rot for srot, csrot, etc.
+#define BLAS_DISPATCH_ROUTINES( X ) \
+    X( saxpy,   axpy,   template_axpy< float > )                 \
+    X( daxpy,   axpy,   template_axpy< double > )                \
+    X( caxpy,   axpy,   template_axpy< std::complex<float> > )   \
+    X( zaxpy,   axpy,   template_axpy< std::complex<double> > )  \
+    X( sscal,   scal,   template_scal< float > )                 \
+    X( dscal,   scal,   template_scal< double > )                \
+    X( cscal,   scal,   template_scal< std::complex<float> > )   \
+    X( zscal,   scal,   template_scal< std::complex<double> > )  \
+    X( scopy,   copy,   template_copy< float > )                 \
+    X( dcopy,   copy,   template_copy< double > )                \
+    X( ccopy,   copy,   template_copy< std::complex<float> > )   \
+    X( zcopy,   copy,   template_copy< std::complex<double> > )  \
+    X( sswap,   swap,   template_swap< float > )                 \
+    X( dswap,   swap,   template_swap< double > )                \
+    X( cswap,   swap,   template_swap< std::complex<float> > )   \
+    X( zswap,   swap,   template_swap< std::complex<double> > )  \
+    X( sdot,    dot,    template_dot< float > )                  \
+    X( ddot,    dot,    template_dot< double > )                 \
+    X( cdotc,   dot,    template_dot< std::complex<float> > )    \
+    X( zdotc,   dot,    template_dot< std::complex<double> > )   \
+    X( cdotu,   dotu,   template_dotu< std::complex<float> > )   \
+    X( zdotu,   dotu,   template_dotu< std::complex<double> > )  \
+    X( snrm2,   nrm2,   template_nrm2< float > )                 \
+    X( dnrm2,   nrm2,   template_nrm2< double > )                \
+    X( scnrm2,  nrm2,   template_nrm2< std::complex<float> > )   \
+    X( dznrm2,  nrm2,   template_nrm2< std::complex<double> > )  \
+    X( sasum,   asum,   template_asum< float > )                 \
+    X( dasum,   asum,   template_asum< double > )                \
+    X( scasum,  asum,   template_asum< std::complex<float> > )   \
+    X( dzasum,  asum,   template_asum< std::complex<double> > )  \
+    X( isamax,  iamax,  template_iamax< float > )                \
+    X( idamax,  iamax,  template_iamax< double > )               \
+    X( icamax,  iamax,  template_iamax< std::complex<float> > )  \
+    X( izamax,  iamax,  template_iamax< std::complex<double> > ) \
+    X( srotg,   rotg,   template_rotg< float > )                 \
+    X( drotg,   rotg,   template_rotg< double > )                \
+    X( crotg,   rotg,   template_rotg< std::complex<float> > )   \
+    X( zrotg,   rotg,   template_rotg< std::complex<double> > )  \
+    X( srot,    rot,    template_rot< float > )                  \
+    X( drot,    rot,    template_rot< double > )                 \
+    X( csrot,   rot,    template_csrot< std::complex<float> > )  \
+    X( zdrot,   rot,    template_csrot< std::complex<double> > ) \
+    X( crot,    rot,    template_rot< std::complex<float> > )    \
+    X( zrot,    rot,    template_rot< std::complex<double> > )   \
+    X( srotmg,  rotmg,  template_rotmg< float > )                \
+    X( drotmg,  rotmg,  template_rotmg< double > )               \
+    X( srotm,   rotm,   template_rotm< float > )                 \
+    X( drotm,   rotm,   template_rotm< double > )                \
+    X( sgemv,   gemv,   template_gemv< float > )                 \
+    X( dgemv,   gemv,   template_gemv< double > )                \
+    X( cgemv,   gemv,   template_gemv< std::complex<float> > )   \
+    X( zgemv,   gemv,   template_gemv< std::complex<double> > )  \
+    X( sgbmv,   gbmv,   template_gbmv< float > )                 \
+    X( dgbmv,   gbmv,   template_gbmv< double > )                \
+    X( cgbmv,   gbmv,   template_gbmv< std::complex<float> > )   \
+    X( zgbmv,   gbmv,   template_gbmv< std::complex<double> > )  \
+    X( sger,    ger,    template_ger< float > )                  \
+    X( dger,    ger,    template_ger< double > )                 \
+    X( cgerc,   ger,    template_ger< std::complex<float> > )    \
+    X( zgerc,   ger,    template_ger< std::complex<double> > )   \
+    X( cgeru,   geru,   template_geru< std::complex<float> > )   \
+    X( zgeru,   geru,   template_geru< std::complex<double> > )  \
+    X( ssymv,   symv,   template_symv< float > )                 \
+    X( dsymv,   symv,   template_symv< double > )                \
+    X( chemv,   hemv,   template_hemv< std::complex<float> > )   \
+    X( zhemv,   hemv,   template_hemv< std::complex<double> > )  \
+    X( ssbmv,   sbmv,   template_sbmv< float > )                 \
+    X( dsbmv,   sbmv,   template_sbmv< double > )                \
+    X( chbmv,   hbmv,   template_hbmv< std::complex<float> > )   \
+    X( zhbmv,   hbmv,   template_hbmv< std::complex<double> > )  \
+    X( ssyr,    syr,    template_syr< float > )                  \
+    X( dsyr,    syr,    template_syr< double > )                 \
+    X( cher,    her,    template_her< std::complex<float> > )    \
+    X( zher,    her,    template_her< std::complex<double> > )   \
+    X( ssyr2,   syr2,   template_syr2< float > )                 \
+    X( dsyr2,   syr2,   template_syr2< double > )                \
+    X( cher2,   her2,   template_her2< std::complex<float> > )   \
+    X( zher2,   her2,   template_her2< std::complex<double> > )  \
+    X( strmv,   trmv,   template_trmv< float > )                 \
+    X( dtrmv,   trmv,   template_trmv< double > )                \
+    X( ctrmv,   trmv,   template_trmv< std::complex<float> > )   \
+    X( ztrmv,   trmv,   template_trmv< std::complex<double> > )  \
+    X( strsv,   trsv,   template_trsv< float > )                 \
+    X( dtrsv,   trsv,   template_trsv< double > )                \
+    X( ctrsv,   trsv,   template_trsv< std::complex<float> > )   \
+    X( ztrsv,   trsv,   template_trsv< std::complex<double> > )  \
+    X( stbmv,   tbmv,   template_tbmv< float > )                 \
+    X( dtbmv,   tbmv,   template_tbmv< double > )                \
+    X( ctbmv,   tbmv,   template_tbmv< std::complex<float> > )   \
+    X( ztbmv,   tbmv,   template_tbmv< std::complex<double> > )  \
+    X( stbsv,   tbsv,   template_tbsv< float > )                 \
+    X( dtbsv,   tbsv,   template_tbsv< double > )                \
+    X( ctbsv,   tbsv,   template_tbsv< std::complex<float> > )   \
+    X( ztbsv,   tbsv,   template_tbsv< std::complex<double> > )  \
+    X( sgemm,   gemm,   template_gemm< float > )                 \
+    X( dgemm,   gemm,   template_gemm< double > )                \
+    X( cgemm,   gemm,   template_gemm< std::complex<float> > )   \
+    X( zgemm,   gemm,   template_gemm< std::complex<double> > )  \
+    X( ssymm,   symm,   template_symm< float > )                 \
+    X( dsymm,   symm,   template_symm< double > )                \
+    X( csymm,   symm,   template_symm< std::complex<float> > )   \
+    X( zsymm,   symm,   template_symm< std::complex<double> > )  \
+    X( chemm,   hemm,   template_hemm< std::complex<float> > )   \
+    X( zhemm,   hemm,   template_hemm< std::complex<double> > )  \
+    X( ssyrk,   syrk,   template_syrk< float > )                 \
+    X( dsyrk,   syrk,   template_syrk< double > )                \
+    X( csyrk,   syrk,   template_syrk< std::complex<float> > )   \
+    X( zsyrk,   syrk,   template_syrk< std::complex<double> > )  \
+    X( cherk,   herk,   template_herk< std::complex<float> > )   \
+    X( zherk,   herk,   template_herk< std::complex<double> > )  \
+    X( ssyr2k,  syr2k,  template_syr2k< float > )                \
+    X( dsyr2k,  syr2k,  template_syr2k< double > )               \
+    X( csyr2k,  syr2k,  template_syr2k< std::complex<float> > )  \
+    X( zsyr2k,  syr2k,  template_syr2k< std::complex<double> > ) \
+    X( cher2k,  her2k,  template_her2k< std::complex<float> > )  \
+    X( zher2k,  her2k,  template_her2k< std::complex<double> > ) \
+    X( strmm,   trmm,   template_trmm< float > )                 \
+    X( dtrmm,   trmm,   template_trmm< double > )                \
+    X( ctrmm,   trmm,   template_trmm< std::complex<float> > )   \
+    X( ztrmm,   trmm,   template_trmm< std::complex<double> > )  \
+    X( strsm,   trsm,   template_trsm< float > )                 \
+    X( dtrsm,   trsm,   template_trsm< double > )                \
+    X( ctrsm,   trsm,   template_trsm< std::complex<float> > )   \
+    X( ztrsm,   trsm,   template_trsm< std::complex<double> > )  \
+    BLAS_DISPATCH_GEMMT( X )
+
+// gemmt is not in reference BLAS, so its entries exist only if the
+// linked BLAS has it.
+#ifdef BLAS_HAVE_GEMMT
+    #define BLAS_DISPATCH_GEMMT( X ) \
+        X( sgemmt,  gemmt,  template_gemmt< float > )                \
+        X( dgemmt,  gemmt,  template_gemmt< double > )               \
+        X( cgemmt,  gemmt,  template_gemmt< std::complex<float> > )  \
+        X( zgemmt,  gemmt,  template_gemmt< std::complex<double> > )
+#else
+    #define BLAS_DISPATCH_GEMMT( X )
+#endif
+
+namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Pointers to native BLAS routines, with the types in blas/fortran.h.
+struct DispatchTable {
+    #define BLAS_DISPATCH_MEMBER( name, family, adapter ) \
+        decltype( &BLAS_##name ) name;
+
+    BLAS_DISPATCH_ROUTINES( BLAS_DISPATCH_MEMBER )
+
+    #undef BLAS_DISPATCH_MEMBER
+};
+
+extern DispatchTable dispatch_table;
+
+}  // namespace internal
+}  // namespace blas
+
+//------------------------------------------------------------------------------
+// Redirect the wrappers' calls through the table. dispatch.cc defines
+// BLAS_DISPATCH_NO_REDIRECT to refer to the linked routines.
+#ifndef BLAS_DISPATCH_NO_REDIRECT
+
+#undef  BLAS_saxpy
+#define BLAS_saxpy blas::internal::dispatch_table.saxpy
+#undef  BLAS_daxpy
+#define BLAS_daxpy blas::internal::dispatch_table.daxpy
+#undef  BLAS_caxpy
+#define BLAS_caxpy blas::internal::dispatch_table.caxpy
+#undef  BLAS_zaxpy
+#define BLAS_zaxpy blas::internal::dispatch_table.zaxpy
+#undef  BLAS_sscal
+#define BLAS_sscal blas::internal::dispatch_table.sscal
+#undef  BLAS_dscal
+#define BLAS_dscal blas::internal::dispatch_table.dscal
+#undef  BLAS_cscal
+#define BLAS_cscal blas::internal::dispatch_table.cscal
+#undef  BLAS_zscal
+#define BLAS_zscal blas::internal::dispatch_table.zscal
+#undef  BLAS_scopy
+#define BLAS_scopy blas::internal::dispatch_table.scopy
+#undef  BLAS_dcopy
+#define BLAS_dcopy blas::internal::dispatch_table.dcopy
+#undef  BLAS_ccopy
+#define BLAS_ccopy blas::internal::dispatch_table.ccopy
+#undef  BLAS_zcopy
+#define BLAS_zcopy blas::internal::dispatch_table.zcopy
+#undef  BLAS_sswap
+#define BLAS_sswap blas::internal::dispatch_table.sswap
+#undef  BLAS_dswap
+#define BLAS_dswap blas::internal::dispatch_table.dswap
+#undef  BLAS_cswap
+#define BLAS_cswap blas::internal::dispatch_table.cswap
+#undef  BLAS_zswap
+#define BLAS_zswap blas::internal::dispatch_table.zswap
+#undef  BLAS_sdot
+#define BLAS_sdot blas::internal::dispatch_table.sdot
+#undef  BLAS_ddot
+#define BLAS_ddot blas::internal::dispatch_table.ddot
+#undef  BLAS_cdotc
+#define BLAS_cdotc blas::internal::dispatch_table.cdotc
+#undef  BLAS_zdotc
+#define BLAS_zdotc blas::internal::dispatch_table.zdotc
+#undef  BLAS_cdotu
+#define BLAS_cdotu blas::internal::dispatch_table.cdotu
+#undef  BLAS_zdotu
+#define BLAS_zdotu blas::internal::dispatch_table.zdotu
+#undef  BLAS_snrm2
+#define BLAS_snrm2 blas::internal::dispatch_table.snrm2
+#undef  BLAS_dnrm2
+#define BLAS_dnrm2 blas::internal::dispatch_table.dnrm2
+#undef  BLAS_scnrm2
+#define BLAS_scnrm2 blas::internal::dispatch_table.scnrm2
+#undef  BLAS_dznrm2
+#define BLAS_dznrm2 blas::internal::dispatch_table.dznrm2
+#undef  BLAS_sasum
+#define BLAS_sasum blas::internal::dispatch_table.sasum
+#undef  BLAS_dasum
+#define BLAS_dasum blas::internal::dispatch_table.dasum
+#undef  BLAS_scasum
+#define BLAS_scasum blas::internal::dispatch_table.scasum
+#undef  BLAS_dzasum
+#define BLAS_dzasum blas::internal::dispatch_table.dzasum
+#undef  BLAS_isamax
+#define BLAS_isamax blas::internal::dispatch_table.isamax
+#undef  BLAS_idamax
+#define BLAS_idamax blas::internal::dispatch_table.idamax
+#undef  BLAS_icamax
+#define BLAS_icamax blas::internal::dispatch_table.icamax
+#undef  BLAS_izamax
+#define BLAS_izamax blas::internal::dispatch_table.izamax
+#undef  BLAS_srotg
+#define BLAS_srotg blas::internal::dispatch_table.srotg
+#undef  BLAS_drotg
+#define BLAS_drotg blas::internal::dispatch_table.drotg
+#undef  BLAS_crotg
+#define BLAS_crotg blas::internal::dispatch_table.crotg
+#undef  BLAS_zrotg
+#define BLAS_zrotg blas::internal::dispatch_table.zrotg
+#undef  BLAS_srot
+#define BLAS_srot blas::internal::dispatch_table.srot
+#undef  BLAS_drot
+#define BLAS_drot blas::internal::dispatch_table.drot
+#undef  BLAS_csrot
+#define BLAS_csrot blas::internal::dispatch_table.csrot
+#undef  BLAS_zdrot
+#define BLAS_zdrot blas::internal::dispatch_table.zdrot
+#undef  BLAS_crot
+#define BLAS_crot blas::internal::dispatch_table.crot
+#undef  BLAS_zrot
+#define BLAS_zrot blas::internal::dispatch_table.zrot
+#undef  BLAS_srotmg
+#define BLAS_srotmg blas::internal::dispatch_table.srotmg
+#undef  BLAS_drotmg
+#define BLAS_drotmg blas::internal::dispatch_table.drotmg
+#undef  BLAS_srotm
+#define BLAS_srotm blas::internal::dispatch_table.srotm
+#undef  BLAS_drotm
+#define BLAS_drotm blas::internal::dispatch_table.drotm
+#undef  BLAS_sgemv
+#define BLAS_sgemv blas::internal::dispatch_table.sgemv
+#undef  BLAS_dgemv
+#define BLAS_dgemv blas::internal::dispatch_table.dgemv
+#undef  BLAS_cgemv
+#define BLAS_cgemv blas::internal::dispatch_table.cgemv
+#undef  BLAS_zgemv
+#define BLAS_zgemv blas::internal::dispatch_table.zgemv
+#undef  BLAS_sgbmv
+#define BLAS_sgbmv blas::internal::dispatch_table.sgbmv
+#undef  BLAS_dgbmv
+#define BLAS_dgbmv blas::internal::dispatch_table.dgbmv
+#undef  BLAS_cgbmv
+#define BLAS_cgbmv blas::internal::dispatch_table.cgbmv
+#undef  BLAS_zgbmv
+#define BLAS_zgbmv blas::internal::dispatch_table.zgbmv
+#undef  BLAS_sger
+#define BLAS_sger blas::internal::dispatch_table.sger
+#undef  BLAS_dger
+#define BLAS_dger blas::internal::dispatch_table.dger
+#undef  BLAS_cgerc
+#define BLAS_cgerc blas::internal::dispatch_table.cgerc
+#undef  BLAS_zgerc
+#define BLAS_zgerc blas::internal::dispatch_table.zgerc
+#undef  BLAS_cgeru
+#define BLAS_cgeru blas::internal::dispatch_table.cgeru
+#undef  BLAS_zgeru
+#define BLAS_zgeru blas::internal::dispatch_table.zgeru
+#undef  BLAS_ssymv
+#define BLAS_ssymv blas::internal::dispatch_table.ssymv
+#undef  BLAS_dsymv
+#define BLAS_dsymv blas::internal::dispatch_table.dsymv
+#undef  BLAS_chemv
+#define BLAS_chemv blas::internal::dispatch_table.chemv
+#undef  BLAS_zhemv
+#define BLAS_zhemv blas::internal::dispatch_table.zhemv
+#undef  BLAS_ssbmv
+#define BLAS_ssbmv blas::internal::dispatch_table.ssbmv
+#undef  BLAS_dsbmv
+#define BLAS_dsbmv blas::internal::dispatch_table.dsbmv
+#undef  BLAS_chbmv
+#define BLAS_chbmv blas::internal::dispatch_table.chbmv
+#undef  BLAS_zhbmv
+#define BLAS_zhbmv blas::internal::dispatch_table.zhbmv
+#undef  BLAS_ssyr
+#define BLAS_ssyr blas::internal::dispatch_table.ssyr
+#undef  BLAS_dsyr
+#define BLAS_dsyr blas::internal::dispatch_table.dsyr
+#undef  BLAS_cher
+#define BLAS_cher blas::internal::dispatch_table.cher
+#undef  BLAS_zher
+#define BLAS_zher blas::internal::dispatch_table.zher
+#undef  BLAS_ssyr2
+#define BLAS_ssyr2 blas::internal::dispatch_table.ssyr2
+#undef  BLAS_dsyr2
+#define BLAS_dsyr2 blas::internal::dispatch_table.dsyr2
+#undef  BLAS_cher2
+#define BLAS_cher2 blas::internal::dispatch_table.cher2
+#undef  BLAS_zher2
+#define BLAS_zher2 blas::internal::dispatch_table.zher2
+#undef  BLAS_strmv
+#define BLAS_strmv blas::internal::dispatch_table.strmv
+#undef  BLAS_dtrmv
+#define BLAS_dtrmv blas::internal::dispatch_table.dtrmv
+#undef  BLAS_ctrmv
+#define BLAS_ctrmv blas::internal::dispatch_table.ctrmv
+#undef  BLAS_ztrmv
+#define BLAS_ztrmv blas::internal::dispatch_table.ztrmv
+#undef  BLAS_strsv
+#define BLAS_strsv blas::internal::dispatch_table.strsv
+#undef  BLAS_dtrsv
+#define BLAS_dtrsv blas::internal::dispatch_table.dtrsv
+#undef  BLAS_ctrsv
+#define BLAS_ctrsv blas::internal::dispatch_table.ctrsv
+#undef  BLAS_ztrsv
+#define BLAS_ztrsv blas::internal::dispatch_table.ztrsv
+#undef  BLAS_stbmv
+#define BLAS_stbmv blas::internal::dispatch_table.stbmv
+#undef  BLAS_dtbmv
+#define BLAS_dtbmv blas::internal::dispatch_table.dtbmv
+#undef  BLAS_ctbmv
+#define BLAS_ctbmv blas::internal::dispatch_table.ctbmv
+#undef  BLAS_ztbmv
+#define BLAS_ztbmv blas::internal::dispatch_table.ztbmv
+#undef  BLAS_stbsv
+#define BLAS_stbsv blas::internal::dispatch_table.stbsv
+#undef  BLAS_dtbsv
+#define BLAS_dtbsv blas::internal::dispatch_table.dtbsv
+#undef  BLAS_ctbsv
+#define BLAS_ctbsv blas::internal::dispatch_table.ctbsv
+#undef  BLAS_ztbsv
+#define BLAS_ztbsv blas::internal::dispatch_table.ztbsv
+#undef  BLAS_sgemm
+#define BLAS_sgemm blas::internal::dispatch_table.sgemm
+#undef  BLAS_dgemm
+#define BLAS_dgemm blas::internal::dispatch_table.dgemm
+#undef  BLAS_cgemm
+#define BLAS_cgemm blas::internal::dispatch_table.cgemm
+#undef  BLAS_zgemm
+#define BLAS_zgemm blas::internal::dispatch_table.zgemm
+#undef  BLAS_ssymm
+#define BLAS_ssymm blas::internal::dispatch_table.ssymm
+#undef  BLAS_dsymm
+#define BLAS_dsymm blas::internal::dispatch_table.dsymm
+#undef  BLAS_csymm
+#define BLAS_csymm blas::internal::dispatch_table.csymm
+#undef  BLAS_zsymm
+#define BLAS_zsymm blas::internal::dispatch_table.zsymm
+#undef  BLAS_chemm
+#define BLAS_chemm blas::internal::dispatch_table.chemm
+#undef  BLAS_zhemm
+#define BLAS_zhemm blas::internal::dispatch_table.zhemm
+#undef  BLAS_ssyrk
+#define BLAS_ssyrk blas::internal::dispatch_table.ssyrk
+#undef  BLAS_dsyrk
+#define BLAS_dsyrk blas::internal::dispatch_table.dsyrk
+#undef  BLAS_csyrk
+#define BLAS_csyrk blas::internal::dispatch_table.csyrk
+#undef  BLAS_zsyrk
+#define BLAS_zsyrk blas::internal::dispatch_table.zsyrk
+#undef  BLAS_cherk
+#define BLAS_cherk blas::internal::dispatch_table.cherk
+#undef  BLAS_zherk
+#define BLAS_zherk blas::internal::dispatch_table.zherk
+#undef  BLAS_ssyr2k
+#define BLAS_ssyr2k blas::internal::dispatch_table.ssyr2k
+#undef  BLAS_dsyr2k
+#define BLAS_dsyr2k blas::internal::dispatch_table.dsyr2k
+#undef  BLAS_csyr2k
+#define BLAS_csyr2k blas::internal::dispatch_table.csyr2k
+#undef  BLAS_zsyr2k
+#define BLAS_zsyr2k blas::internal::dispatch_table.zsyr2k
+#undef  BLAS_cher2k
+#define BLAS_cher2k blas::internal::dispatch_table.cher2k
+#undef  BLAS_zher2k
+#define BLAS_zher2k blas::internal::dispatch_table.zher2k
+#undef  BLAS_strmm
+#define BLAS_strmm blas::internal::dispatch_table.strmm
+#undef  BLAS_dtrmm
+#define BLAS_dtrmm blas::internal::dispatch_table.dtrmm
+#undef  BLAS_ctrmm
+#define BLAS_ctrmm blas::internal::dispatch_table.ctrmm
+#undef  BLAS_ztrmm
+#define BLAS_ztrmm blas::internal::dispatch_table.ztrmm
+#undef  BLAS_strsm
+#define BLAS_strsm blas::internal::dispatch_table.strsm
+#undef  BLAS_dtrsm
+#define BLAS_dtrsm blas::internal::dispatch_table.dtrsm
+#undef  BLAS_ctrsm
+#define BLAS_ctrsm blas::internal::dispatch_table.ctrsm
+#undef  BLAS_ztrsm
+#define BLAS_ztrsm blas::internal::dispatch_table.ztrsm
+
+#ifdef BLAS_HAVE_GEMMT
+    #undef  BLAS_sgemmt
+    #define BLAS_sgemmt blas::internal::dispatch_table.sgemmt
+    #undef  BLAS_dgemmt
+    #define BLAS_dgemmt blas::internal::dispatch_table.dgemmt
+    #undef  BLAS_cgemmt
+    #define BLAS_cgemmt blas::internal::dispatch_table.cgemmt
+    #undef  BLAS_zgemmt
+    #define BLAS_zgemmt blas::internal::dispatch_table.zgemmt
+#endif
+
+#endif  // BLAS_DISPATCH_NO_REDIRECT
+
+#endif        //  #ifndef BLAS_DISPATCH_HH
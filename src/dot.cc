@@ -3,8 +3,11 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "tune.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -21,16 +24,30 @@ float dot(
     float const *x, int64_t incx,
     float const *y, int64_t incy )
 {
+    blas_trace( "dot", 's', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::sdot, n )) {
+        return dot< float, float >( n, x, incx, y, incy );
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            return internal::dot_split( n, x, incx, y, incy );
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            return dot< float, float >( n, x, incx, y, incy );
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -46,16 +63,30 @@ double dot(
     double const *x, int64_t incx,
     double const *y, int64_t incy )
 {
+    blas_trace( "dot", 'd', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::ddot, n )) {
+        return dot< double, double >( n, x, incx, y, incy );
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            return internal::dot_split( n, x, incx, y, incy );
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            return dot< double, double >( n, x, incx, y, incy );
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -71,16 +102,32 @@ std::complex<float> dot(
     std::complex<float> const *x, int64_t incx,
     std::complex<float> const *y, int64_t incy )
 {
+    blas_trace( "dot", 'c', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::cdotc, n )) {
+        return dot< std::complex<float>, std::complex<float> >(
+            n, x, incx, y, incy );
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            return internal::dot_split( n, x, incx, y, incy );
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            return dot< std::complex<float>, std::complex<float> >(
+                n, x, incx, y, incy );
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -111,16 +158,32 @@ std::complex<double> dot(
     std::complex<double> const *x, int64_t incx,
     std::complex<double> const *y, int64_t incy )
 {
+    blas_trace( "dot", 'z', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::zdotc, n )) {
+        return dot< std::complex<double>, std::complex<double> >(
+            n, x, incx, y, incy );
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            return internal::dot_split( n, x, incx, y, incy );
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            return dot< std::complex<double>, std::complex<double> >(
+                n, x, incx, y, incy );
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -154,6 +217,8 @@ float dotu(
     float const *x, int64_t incx,
     float const *y, int64_t incy )
 {
+    blas_trace( "dotu", 's', {}, { n } );
+
     return dot( n, x, incx, y, incy );
 }
 
@@ -164,6 +229,8 @@ double dotu(
     double const *x, int64_t incx,
     double const *y, int64_t incy )
 {
+    blas_trace( "dotu", 'd', {}, { n } );
+
     return dot( n, x, incx, y, incy );
 }
 
@@ -174,6 +241,8 @@ std::complex<float> dotu(
     std::complex<float> const *x, int64_t incx,
     std::complex<float> const *y, int64_t incy )
 {
+    blas_trace( "dotu", 'c', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
@@ -181,9 +250,17 @@ std::complex<float> dotu(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            return internal::dotu_split( n, x, incx, y, incy );
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            return dotu< std::complex<float>, std::complex<float> >(
+                n, x, incx, y, incy );
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -214,6 +291,8 @@ std::complex<double> dotu(
     std::complex<double> const *x, int64_t incx,
     std::complex<double> const *y, int64_t incy )
 {
+    blas_trace( "dotu", 'z', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
@@ -221,9 +300,17 @@ std::complex<double> dotu(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            return internal::dotu_split( n, x, incx, y, incy );
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            return dotu< std::complex<double>, std::complex<double> >(
+                n, x, incx, y, incy );
+        }
     }
 
     blas_int n_    = (blas_int) n;
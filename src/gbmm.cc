@@ -0,0 +1,101 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "dispatch.hh"
+#include "blas.hh"
+#include "trace.hh"
+
+#include <limits>
+
+namespace blas {
+
+// =============================================================================
+// Overloaded wrappers for s, d, c, z precisions.
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbmm
+void gbmm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int64_t kl, int64_t ku,
+    float alpha,
+    float const *A, int64_t lda,
+    float const *B, int64_t ldb,
+    float beta,
+    float       *C, int64_t ldc )
+{
+    blas_trace( "gbmm", 's', { layout, transA, transB }, { m, n, k, kl, ku } );
+
+    gbmm< float, float, float >(
+        layout, transA, transB, m, n, k, kl, ku,
+        alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbmm
+void gbmm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int64_t kl, int64_t ku,
+    double alpha,
+    double const *A, int64_t lda,
+    double const *B, int64_t ldb,
+    double beta,
+    double       *C, int64_t ldc )
+{
+    blas_trace( "gbmm", 'd', { layout, transA, transB }, { m, n, k, kl, ku } );
+
+    gbmm< double, double, double >(
+        layout, transA, transB, m, n, k, kl, ku,
+        alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbmm
+void gbmm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int64_t kl, int64_t ku,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda,
+    std::complex<float> const *B, int64_t ldb,
+    std::complex<float> beta,
+    std::complex<float>       *C, int64_t ldc )
+{
+    blas_trace( "gbmm", 'c', { layout, transA, transB }, { m, n, k, kl, ku } );
+
+    gbmm< std::complex<float>, std::complex<float>, std::complex<float> >(
+        layout, transA, transB, m, n, k, kl, ku,
+        alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbmm
+void gbmm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int64_t kl, int64_t ku,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda,
+    std::complex<double> const *B, int64_t ldb,
+    std::complex<double> beta,
+    std::complex<double>       *C, int64_t ldc )
+{
+    blas_trace( "gbmm", 'z', { layout, transA, transB }, { m, n, k, kl, ku } );
+
+    gbmm< std::complex<double>, std::complex<double>, std::complex<double> >(
+        layout, transA, transB, m, n, k, kl, ku,
+        alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+}  // namespace blas
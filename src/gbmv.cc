@@ -0,0 +1,344 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "dispatch.hh"
+#include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
+
+#include <limits>
+
+namespace blas {
+
+// =============================================================================
+// Overloaded wrappers for s, d, c, z precisions.
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbmv
+void gbmv(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    int64_t kl, int64_t ku,
+    float alpha,
+    float const *A, int64_t lda,
+    float const *x, int64_t incx,
+    float beta,
+    float       *y, int64_t incy )
+{
+    blas_trace( "gbmv", 's', { layout, trans }, { m, n, kl, ku } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( kl < 0 );
+    blas_error_if( ku < 0 );
+    blas_error_if( lda < kl + ku + 1 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(blas_int)) {
+        // band matrices are not split, so if any dimension, leading dimension,
+        // or increment overflows, use the int64_t template implementation
+        if (internal::split_needed( { m, n, lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            gbmv< float, float, float >(
+                layout, trans, m, n, kl, ku,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
+    }
+
+    blas_int m_    = (blas_int) m;
+    blas_int n_    = (blas_int) n;
+    blas_int kl_   = (blas_int) kl;
+    blas_int ku_   = (blas_int) ku;
+    blas_int lda_  = (blas_int) lda;
+    blas_int incx_ = (blas_int) incx;
+    blas_int incy_ = (blas_int) incy;
+
+    if (layout == Layout::RowMajor) {
+        // A => A^T; A^T => A; A^H => A,
+        // where A^T has ku sub-diagonals and kl super-diagonals
+        std::swap( m_, n_ );
+        std::swap( kl_, ku_ );
+        trans = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
+    }
+
+    char trans_ = op2char( trans );
+    BLAS_sgbmv( &trans_, &m_, &n_, &kl_, &ku_,
+                &alpha, A, &lda_, x, &incx_, &beta, y, &incy_ );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbmv
+void gbmv(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    int64_t kl, int64_t ku,
+    double alpha,
+    double const *A, int64_t lda,
+    double const *x, int64_t incx,
+    double beta,
+    double       *y, int64_t incy )
+{
+    blas_trace( "gbmv", 'd', { layout, trans }, { m, n, kl, ku } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( kl < 0 );
+    blas_error_if( ku < 0 );
+    blas_error_if( lda < kl + ku + 1 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(blas_int)) {
+        // band matrices are not split, so if any dimension, leading dimension,
+        // or increment overflows, use the int64_t template implementation
+        if (internal::split_needed( { m, n, lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            gbmv< double, double, double >(
+                layout, trans, m, n, kl, ku,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
+    }
+
+    blas_int m_    = (blas_int) m;
+    blas_int n_    = (blas_int) n;
+    blas_int kl_   = (blas_int) kl;
+    blas_int ku_   = (blas_int) ku;
+    blas_int lda_  = (blas_int) lda;
+    blas_int incx_ = (blas_int) incx;
+    blas_int incy_ = (blas_int) incy;
+
+    if (layout == Layout::RowMajor) {
+        // A => A^T; A^T => A; A^H => A,
+        // where A^T has ku sub-diagonals and kl super-diagonals
+        std::swap( m_, n_ );
+        std::swap( kl_, ku_ );
+        trans = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
+    }
+
+    char trans_ = op2char( trans );
+    BLAS_dgbmv( &trans_, &m_, &n_, &kl_, &ku_,
+                &alpha, A, &lda_, x, &incx_, &beta, y, &incy_ );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbmv
+void gbmv(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    int64_t kl, int64_t ku,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda,
+    std::complex<float> const *x, int64_t incx,
+    std::complex<float> beta,
+    std::complex<float>       *y, int64_t incy )
+{
+    blas_trace( "gbmv", 'c', { layout, trans }, { m, n, kl, ku } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( kl < 0 );
+    blas_error_if( ku < 0 );
+    blas_error_if( lda < kl + ku + 1 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(blas_int)) {
+        // band matrices are not split, so if any dimension, leading dimension,
+        // or increment overflows, use the int64_t template implementation
+        if (internal::split_needed( { m, n, lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            gbmv< std::complex<float>, std::complex<float>,
+                  std::complex<float> >(
+                layout, trans, m, n, kl, ku,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
+    }
+
+    blas_int m_    = (blas_int) m;
+    blas_int n_    = (blas_int) n;
+    blas_int kl_   = (blas_int) kl;
+    blas_int ku_   = (blas_int) ku;
+    blas_int lda_  = (blas_int) lda;
+    blas_int incx_ = (blas_int) incx;
+    blas_int incy_ = (blas_int) incy;
+
+    // if x2=x, then it isn't modified
+    std::complex<float> *x2 = const_cast< std::complex<float>* >( x );
+    Op trans2 = trans;
+    if (layout == Layout::RowMajor) {
+        // conjugate alpha, beta, x (in x2), and y (in-place)
+        if (trans == Op::ConjTrans) {
+            alpha = conj( alpha );
+            beta  = conj( beta );
+
+            x2 = new std::complex<float>[m];
+            int64_t ix = (incx > 0 ? 0 : (-m + 1)*incx);
+            for (int64_t i = 0; i < m; ++i) {
+                x2[i] = conj( x[ix] );
+                ix += incx;
+            }
+            incx_ = 1;
+
+            int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+            for (int64_t i = 0; i < n; ++i) {
+                y[iy] = conj( y[iy] );
+                iy += incy;
+            }
+        }
+        // A => A^T; A^T => A; A^H => A + conj,
+        // where A^T has ku sub-diagonals and kl super-diagonals
+        std::swap( m_, n_ );
+        std::swap( kl_, ku_ );
+        trans2 = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
+    }
+
+    char trans_ = op2char( trans2 );
+    BLAS_cgbmv( &trans_, &m_, &n_, &kl_, &ku_,
+                (blas_complex_float*) &alpha,
+                (blas_complex_float*) A, &lda_,
+                (blas_complex_float*) x2, &incx_,
+                (blas_complex_float*) &beta,
+                (blas_complex_float*) y, &incy_ );
+
+    if (layout == Layout::RowMajor && trans == Op::ConjTrans) {
+        // y = conj( y )
+        int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+        for (int64_t i = 0; i < n; ++i) {
+            y[iy] = conj( y[iy] );
+            iy += incy;
+        }
+        delete[] x2;
+    }
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbmv
+void gbmv(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    int64_t kl, int64_t ku,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda,
+    std::complex<double> const *x, int64_t incx,
+    std::complex<double> beta,
+    std::complex<double>       *y, int64_t incy )
+{
+    blas_trace( "gbmv", 'z', { layout, trans }, { m, n, kl, ku } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( kl < 0 );
+    blas_error_if( ku < 0 );
+    blas_error_if( lda < kl + ku + 1 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(blas_int)) {
+        // band matrices are not split, so if any dimension, leading dimension,
+        // or increment overflows, use the int64_t template implementation
+        if (internal::split_needed( { m, n, lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            gbmv< std::complex<double>, std::complex<double>,
+                  std::complex<double> >(
+                layout, trans, m, n, kl, ku,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
+    }
+
+    blas_int m_    = (blas_int) m;
+    blas_int n_    = (blas_int) n;
+    blas_int kl_   = (blas_int) kl;
+    blas_int ku_   = (blas_int) ku;
+    blas_int lda_  = (blas_int) lda;
+    blas_int incx_ = (blas_int) incx;
+    blas_int incy_ = (blas_int) incy;
+
+    // if x2=x, then it isn't modified
+    std::complex<double> *x2 = const_cast< std::complex<double>* >( x );
+    Op trans2 = trans;
+    if (layout == Layout::RowMajor) {
+        // conjugate alpha, beta, x (in x2), and y (in-place)
+        if (trans == Op::ConjTrans) {
+            alpha = conj( alpha );
+            beta  = conj( beta );
+
+            x2 = new std::complex<double>[m];
+            int64_t ix = (incx > 0 ? 0 : (-m + 1)*incx);
+            for (int64_t i = 0; i < m; ++i) {
+                x2[i] = conj( x[ix] );
+                ix += incx;
+            }
+            incx_ = 1;
+
+            int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+            for (int64_t i = 0; i < n; ++i) {
+                y[iy] = conj( y[iy] );
+                iy += incy;
+            }
+        }
+        // A => A^T; A^T => A; A^H => A + conj,
+        // where A^T has ku sub-diagonals and kl super-diagonals
+        std::swap( m_, n_ );
+        std::swap( kl_, ku_ );
+        trans2 = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
+    }
+
+    char trans_ = op2char( trans2 );
+    BLAS_zgbmv( &trans_, &m_, &n_, &kl_, &ku_,
+                (blas_complex_double*) &alpha,
+                (blas_complex_double*) A, &lda_,
+                (blas_complex_double*) x2, &incx_,
+                (blas_complex_double*) &beta,
+                (blas_complex_double*) y, &incy_ );
+
+    if (layout == Layout::RowMajor && trans == Op::ConjTrans) {
+        // y = conj( y )
+        int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+        for (int64_t i = 0; i < n; ++i) {
+            y[iy] = conj( y[iy] );
+            iy += incy;
+        }
+        delete[] x2;
+    }
+}
+
+}  // namespace blas
@@ -3,8 +3,11 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "tune.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -26,6 +29,8 @@ void gemm(
     float beta,
     float       *C, int64_t ldc )
 {
+    blas_trace( "gemm", 's', { layout, transA, transB }, { m, n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -54,14 +59,31 @@ void gemm(
     else
         blas_error_if( ldc < n );
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::sgemm, double( m ) * n * k )) {
+        gemm< float, float, float >(
+            layout, transA, transB, m, n, k,
+            alpha, A, lda, B, ldb, beta, C, ldc );
+        return;
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n, k } )) {
+            internal::gemm_split( layout, transA, transB, m, n, k, alpha,
+                                  A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            gemm< float, float, float >(
+                layout, transA, transB, m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
@@ -97,6 +119,8 @@ void gemm(
     double beta,
     double       *C, int64_t ldc )
 {
+    blas_trace( "gemm", 'd', { layout, transA, transB }, { m, n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -137,14 +161,31 @@ void gemm(
         blas_error_if( ldc < n );
     }
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::dgemm, double( m ) * n * k )) {
+        gemm< double, double, double >(
+            layout, transA, transB, m, n, k,
+            alpha, A, lda, B, ldb, beta, C, ldc );
+        return;
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n, k } )) {
+            internal::gemm_split( layout, transA, transB, m, n, k, alpha,
+                                  A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            gemm< double, double, double >(
+                layout, transA, transB, m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
@@ -180,6 +221,8 @@ void gemm(
     std::complex<float> beta,
     std::complex<float>       *C, int64_t ldc )
 {
+    blas_trace( "gemm", 'c', { layout, transA, transB }, { m, n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -220,14 +263,32 @@ void gemm(
         blas_error_if( ldc < n );
     }
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::cgemm, double( m ) * n * k )) {
+        gemm< std::complex<float>, std::complex<float>, std::complex<float> >(
+            layout, transA, transB, m, n, k,
+            alpha, A, lda, B, ldb, beta, C, ldc );
+        return;
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n, k } )) {
+            internal::gemm_split( layout, transA, transB, m, n, k, alpha,
+                                  A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            gemm< std::complex<float>, std::complex<float>,
+                  std::complex<float> >(
+                layout, transA, transB, m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
@@ -271,6 +332,8 @@ void gemm(
     std::complex<double> beta,
     std::complex<double>       *C, int64_t ldc )
 {
+    blas_trace( "gemm", 'z', { layout, transA, transB }, { m, n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -311,14 +374,33 @@ void gemm(
         blas_error_if( ldc < n );
     }
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::zgemm, double( m ) * n * k )) {
+        gemm< std::complex<double>, std::complex<double>,
+              std::complex<double> >(
+            layout, transA, transB, m, n, k,
+            alpha, A, lda, B, ldb, beta, C, ldc );
+        return;
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n, k } )) {
+            internal::gemm_split( layout, transA, transB, m, n, k, alpha,
+                                  A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            gemm< std::complex<double>, std::complex<double>,
+                  std::complex<double> >(
+                layout, transA, transB, m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
@@ -349,4 +431,181 @@ void gemm(
     }
 }
 
+// =============================================================================
+// Integer gemm with int32 accumulation, for quantized data.
+// There is no vendor routine, so these use the packed engine in
+// gemm_kernel.hh, which widens 8-bit A and B to int32 only as it packs
+// them into cache-sized panels; memory traffic stays at 1 byte per element.
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Read-only view of op(X) - zero, where X is a column-major integer matrix.
+/// If zero is not null, it holds the zero point for each row of op(X)
+/// if zero_rows, else for each column of op(X). Since X is real,
+/// Op::ConjTrans is the same as Op::Trans.
+template <typename TX>
+class ZeroPointMatrix
+{
+public:
+    ZeroPointMatrix( blas::Op op, TX const* X, int64_t ldx,
+                     int32_t const* zero, bool zero_rows ):
+        op_( op ),
+        X_( X ),
+        ldx_( ldx ),
+        zero_( zero ),
+        zero_rows_( zero_rows )
+    {}
+
+    int32_t operator()( int64_t i, int64_t j ) const
+    {
+        int32_t x = (op_ == Op::NoTrans ? X_[ i + j*ldx_ ] : X_[ j + i*ldx_ ]);
+        if (zero_)
+            x -= zero_[ zero_rows_ ? i : j ];
+        return x;
+    }
+
+private:
+    blas::Op op_;
+    TX const* X_;
+    int64_t ldx_;
+    int32_t const* zero_;
+    bool zero_rows_;
+};
+
+//------------------------------------------------------------------------------
+/// Integer gemm for any 8-bit TA and TB; see blas::gemm below.
+template <typename TA, typename TB>
+void gemm_int32(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int32_t alpha,
+    TA const *A, int64_t lda,
+    TB const *B, int64_t ldb,
+    int32_t beta,
+    int32_t      *C, int64_t ldc,
+    int32_t const *A_zero,
+    int32_t const *B_zero )
+{
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    if ((transA == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( lda < m );
+    else
+        blas_error_if( lda < k );
+
+    if ((transB == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( ldb < k );
+    else
+        blas_error_if( ldb < n );
+
+    if (layout == Layout::ColMajor)
+        blas_error_if( ldc < m );
+    else
+        blas_error_if( ldc < n );
+
+    if (layout == Layout::RowMajor) {
+        // swap transA <=> transB, m <=> n, B <=> A, including zero points
+        return gemm_int32( Layout::ColMajor, transB, transA, n, m, k,
+                           alpha, B, ldb, A, lda, beta, C, ldc,
+                           B_zero, A_zero );
+    }
+
+    // quick return
+    if (m == 0 || n == 0)
+        return;
+
+    // alpha == zero or k == 0: C = beta C
+    if (alpha == 0 || k == 0) {
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < m; ++i) {
+                C[ i + j*ldc ] = (beta == 0 ? 0 : beta * C[ i + j*ldc ]);
+            }
+        }
+        return;
+    }
+
+    gemm_blocked(
+        m, n, k, alpha,
+        ZeroPointMatrix<TA>( transA, A, lda, A_zero, true ),
+        ZeroPointMatrix<TB>( transB, B, ldb, B_zero, false ),
+        beta, C, ldc );
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// Integer matrix-matrix multiply for quantized data:
+/// \[
+///     C = \alpha (op(A) - a_0 1^T) (op(B) - 1 b_0^T) + \beta C,
+/// \]
+/// where A and B are 8-bit integers, C is int32, and $a_0$ and $b_0$ are
+/// optional zero points for each row of op(A) and each column of op(B).
+/// Products are accumulated exactly in int32; the caller must ensure the
+/// result doesn't overflow, which holds for any 8-bit data if k <= 33,000.
+/// Arguments are as for the floating point gemm, plus:
+///
+/// @param[in] A_zero
+///     If not null, the m zero points $a_0$ of the rows of op(A).
+///
+/// @param[in] B_zero
+///     If not null, the n zero points $b_0$ of the columns of op(B).
+///
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int32_t alpha,
+    int8_t const *A, int64_t lda,
+    int8_t const *B, int64_t ldb,
+    int32_t beta,
+    int32_t      *C, int64_t ldc,
+    int32_t const *A_zero,
+    int32_t const *B_zero )
+{
+    blas_trace( "gemm", 'i', { layout, transA, transB }, { m, n, k } );
+
+    internal::gemm_int32( layout, transA, transB, m, n, k,
+                          alpha, A, lda, B, ldb, beta, C, ldc,
+                          A_zero, B_zero );
+}
+
+// -----------------------------------------------------------------------------
+/// Integer matrix-matrix multiply with unsigned A; see above.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int32_t alpha,
+    uint8_t const *A, int64_t lda,
+    int8_t  const *B, int64_t ldb,
+    int32_t beta,
+    int32_t      *C, int64_t ldc,
+    int32_t const *A_zero,
+    int32_t const *B_zero )
+{
+    blas_trace( "gemm", 'i', { layout, transA, transB }, { m, n, k } );
+
+    internal::gemm_int32( layout, transA, transB, m, n, k,
+                          alpha, A, lda, B, ldb, beta, C, ldc,
+                          A_zero, B_zero );
+}
+
 }  // namespace blas
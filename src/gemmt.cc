@@ -0,0 +1,423 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "dispatch.hh"
+#include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// gemmt for BLAS libraries that lack it, built on gemm.
+/// For each nb-wide block column of C, one gemm updates the part below
+/// (Lower) or above (Upper) the diagonal block. The diagonal block is
+/// computed by gemm into a workspace, and only its triangle is merged
+/// into C. This does n*nb*k/2 extra flops, against n^2*k/2 for gemm.
+template <typename scalar_t>
+void gemmt_blocked(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    scalar_t alpha,
+    scalar_t const *A, int64_t lda,
+    scalar_t const *B, int64_t ldb,
+    scalar_t beta,
+    scalar_t       *C, int64_t ldc )
+{
+    // constants
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+    const int64_t nb = 256;
+
+    if (layout == Layout::RowMajor) {
+        // C^T = op(B)^T op(A)^T, in the other triangle
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+        std::swap( transA, transB );
+        std::swap( A, B );
+        std::swap( lda, ldb );
+    }
+
+    if (n == 0)
+        return;
+
+    int64_t nb_ = std::min( nb, n );
+    std::vector<scalar_t> W( size_t(nb_)*nb_ );
+    for (int64_t j = 0; j < n; j += nb) {
+        int64_t jb = std::min( nb, n - j );
+
+        // rows j : j+jb of op(A) and columns j : j+jb of op(B)
+        scalar_t const* Aj = (transA == Op::NoTrans ? &A[ j ] : &A[ j*lda ]);
+        scalar_t const* Bj = (transB == Op::NoTrans ? &B[ j*ldb ] : &B[ j ]);
+
+        // diagonal block
+        gemm( Layout::ColMajor, transA, transB, jb, jb, k,
+              one, Aj, lda, Bj, ldb, zero, W.data(), jb );
+        for (int64_t jj = 0; jj < jb; ++jj) {
+            int64_t i_begin = (uplo == Uplo::Lower ? jj : 0);
+            int64_t i_end   = (uplo == Uplo::Lower ? jb : jj + 1);
+            for (int64_t ii = i_begin; ii < i_end; ++ii) {
+                scalar_t& c = C[ (j + ii) + (j + jj)*ldc ];
+                c = (beta == zero
+                     ? alpha*W[ ii + jj*jb ]
+                     : alpha*W[ ii + jj*jb ] + beta*c);
+            }
+        }
+
+        // off-diagonal part of block column
+        if (uplo == Uplo::Lower && j + jb < n) {
+            int64_t i = j + jb;
+            scalar_t const* Ai = (transA == Op::NoTrans ? &A[ i ] : &A[ i*lda ]);
+            gemm( Layout::ColMajor, transA, transB, n - i, jb, k,
+                  alpha, Ai, lda, Bj, ldb, beta, &C[ i + j*ldc ], ldc );
+        }
+        else if (uplo == Uplo::Upper && j > 0) {
+            gemm( Layout::ColMajor, transA, transB, j, jb, k,
+                  alpha, A, lda, Bj, ldb, beta, &C[ j*ldc ], ldc );
+        }
+    }
+}
+
+}  // namespace internal
+
+// =============================================================================
+// Overloaded wrappers for s, d, c, z precisions.
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemmt
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda,
+    float const *B, int64_t ldb,
+    float beta,
+    float       *C, int64_t ldc )
+{
+    blas_trace( "gemmt", 's', { layout, uplo, transA, transB }, { n, k } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    if ((transA == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( lda < n );
+    else
+        blas_error_if( lda < k );
+
+    if ((transB == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( ldb < k );
+    else
+        blas_error_if( ldb < n );
+
+    blas_error_if( ldc < n );
+
+    #ifdef BLAS_HAVE_GEMMT
+        // dimensions and leading dimensions that overflow the native BLAS
+        // integer type go to the fallback, whose gemm handles them
+        if (! internal::split_needed( { n, k, lda, ldb, ldc } )) {
+            blas_int n_   = (blas_int) n;
+            blas_int k_   = (blas_int) k;
+            blas_int lda_ = (blas_int) lda;
+            blas_int ldb_ = (blas_int) ldb;
+            blas_int ldc_ = (blas_int) ldc;
+
+            char transA_ = op2char( transA );
+            char transB_ = op2char( transB );
+            if (layout == Layout::RowMajor) {
+                // swap lower <=> upper, transA <=> transB, B <=> A
+                char uplo_ = uplo2char( uplo == Uplo::Lower ? Uplo::Upper
+                                                            : Uplo::Lower );
+                BLAS_sgemmt( &uplo_, &transB_, &transA_, &n_, &k_,
+                             &alpha,
+                             B, &ldb_,
+                             A, &lda_,
+                             &beta,
+                             C, &ldc_ );
+            }
+            else {
+                char uplo_ = uplo2char( uplo );
+                BLAS_sgemmt( &uplo_, &transA_, &transB_, &n_, &k_,
+                             &alpha,
+                             A, &lda_,
+                             B, &ldb_,
+                             &beta,
+                             C, &ldc_ );
+            }
+            return;
+        }
+    #endif
+
+    internal::gemmt_blocked( layout, uplo, transA, transB, n, k,
+                             alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemmt
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda,
+    double const *B, int64_t ldb,
+    double beta,
+    double       *C, int64_t ldc )
+{
+    blas_trace( "gemmt", 'd', { layout, uplo, transA, transB }, { n, k } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    if ((transA == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( lda < n );
+    else
+        blas_error_if( lda < k );
+
+    if ((transB == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( ldb < k );
+    else
+        blas_error_if( ldb < n );
+
+    blas_error_if( ldc < n );
+
+    #ifdef BLAS_HAVE_GEMMT
+        // dimensions and leading dimensions that overflow the native BLAS
+        // integer type go to the fallback, whose gemm handles them
+        if (! internal::split_needed( { n, k, lda, ldb, ldc } )) {
+            blas_int n_   = (blas_int) n;
+            blas_int k_   = (blas_int) k;
+            blas_int lda_ = (blas_int) lda;
+            blas_int ldb_ = (blas_int) ldb;
+            blas_int ldc_ = (blas_int) ldc;
+
+            char transA_ = op2char( transA );
+            char transB_ = op2char( transB );
+            if (layout == Layout::RowMajor) {
+                // swap lower <=> upper, transA <=> transB, B <=> A
+                char uplo_ = uplo2char( uplo == Uplo::Lower ? Uplo::Upper
+                                                            : Uplo::Lower );
+                BLAS_dgemmt( &uplo_, &transB_, &transA_, &n_, &k_,
+                             &alpha,
+                             B, &ldb_,
+                             A, &lda_,
+                             &beta,
+                             C, &ldc_ );
+            }
+            else {
+                char uplo_ = uplo2char( uplo );
+                BLAS_dgemmt( &uplo_, &transA_, &transB_, &n_, &k_,
+                             &alpha,
+                             A, &lda_,
+                             B, &ldb_,
+                             &beta,
+                             C, &ldc_ );
+            }
+            return;
+        }
+    #endif
+
+    internal::gemmt_blocked( layout, uplo, transA, transB, n, k,
+                             alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemmt
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda,
+    std::complex<float> const *B, int64_t ldb,
+    std::complex<float> beta,
+    std::complex<float>       *C, int64_t ldc )
+{
+    blas_trace( "gemmt", 'c', { layout, uplo, transA, transB }, { n, k } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    if ((transA == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( lda < n );
+    else
+        blas_error_if( lda < k );
+
+    if ((transB == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( ldb < k );
+    else
+        blas_error_if( ldb < n );
+
+    blas_error_if( ldc < n );
+
+    #ifdef BLAS_HAVE_GEMMT
+        // dimensions and leading dimensions that overflow the native BLAS
+        // integer type go to the fallback, whose gemm handles them
+        if (! internal::split_needed( { n, k, lda, ldb, ldc } )) {
+            blas_int n_   = (blas_int) n;
+            blas_int k_   = (blas_int) k;
+            blas_int lda_ = (blas_int) lda;
+            blas_int ldb_ = (blas_int) ldb;
+            blas_int ldc_ = (blas_int) ldc;
+
+            char transA_ = op2char( transA );
+            char transB_ = op2char( transB );
+            if (layout == Layout::RowMajor) {
+                // swap lower <=> upper, transA <=> transB, B <=> A
+                char uplo_ = uplo2char( uplo == Uplo::Lower ? Uplo::Upper
+                                                            : Uplo::Lower );
+                BLAS_cgemmt( &uplo_, &transB_, &transA_, &n_, &k_,
+                             (blas_complex_float *) &alpha,
+                             (blas_complex_float *) B, &ldb_,
+                             (blas_complex_float *) A, &lda_,
+                             (blas_complex_float *) &beta,
+                             (blas_complex_float*) C, &ldc_ );
+            }
+            else {
+                char uplo_ = uplo2char( uplo );
+                BLAS_cgemmt( &uplo_, &transA_, &transB_, &n_, &k_,
+                             (blas_complex_float *) &alpha,
+                             (blas_complex_float *) A, &lda_,
+                             (blas_complex_float *) B, &ldb_,
+                             (blas_complex_float *) &beta,
+                             (blas_complex_float*) C, &ldc_ );
+            }
+            return;
+        }
+    #endif
+
+    internal::gemmt_blocked( layout, uplo, transA, transB, n, k,
+                             alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gemmt
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda,
+    std::complex<double> const *B, int64_t ldb,
+    std::complex<double> beta,
+    std::complex<double>       *C, int64_t ldc )
+{
+    blas_trace( "gemmt", 'z', { layout, uplo, transA, transB }, { n, k } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    if ((transA == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( lda < n );
+    else
+        blas_error_if( lda < k );
+
+    if ((transB == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( ldb < k );
+    else
+        blas_error_if( ldb < n );
+
+    blas_error_if( ldc < n );
+
+    #ifdef BLAS_HAVE_GEMMT
+        // dimensions and leading dimensions that overflow the native BLAS
+        // integer type go to the fallback, whose gemm handles them
+        if (! internal::split_needed( { n, k, lda, ldb, ldc } )) {
+            blas_int n_   = (blas_int) n;
+            blas_int k_   = (blas_int) k;
+            blas_int lda_ = (blas_int) lda;
+            blas_int ldb_ = (blas_int) ldb;
+            blas_int ldc_ = (blas_int) ldc;
+
+            char transA_ = op2char( transA );
+            char transB_ = op2char( transB );
+            if (layout == Layout::RowMajor) {
+                // swap lower <=> upper, transA <=> transB, B <=> A
+                char uplo_ = uplo2char( uplo == Uplo::Lower ? Uplo::Upper
+                                                            : Uplo::Lower );
+                BLAS_zgemmt( &uplo_, &transB_, &transA_, &n_, &k_,
+                             (blas_complex_double *) &alpha,
+                             (blas_complex_double *) B, &ldb_,
+                             (blas_complex_double *) A, &lda_,
+                             (blas_complex_double *) &beta,
+                             (blas_complex_double*) C, &ldc_ );
+            }
+            else {
+                char uplo_ = uplo2char( uplo );
+                BLAS_zgemmt( &uplo_, &transA_, &transB_, &n_, &k_,
+                             (blas_complex_double *) &alpha,
+                             (blas_complex_double *) A, &lda_,
+                             (blas_complex_double *) B, &ldb_,
+                             (blas_complex_double *) &beta,
+                             (blas_complex_double*) C, &ldc_ );
+            }
+            return;
+        }
+    #endif
+
+    internal::gemmt_blocked( layout, uplo, transA, transB, n, k,
+                             alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+}  // namespace blas
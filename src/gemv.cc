@@ -3,8 +3,11 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "tune.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -25,6 +28,8 @@ void gemv(
     float beta,
     float       *y, int64_t incy )
 {
+    blas_trace( "gemv", 's', { layout, trans }, { m, n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -42,13 +47,31 @@ void gemv(
     blas_error_if( incx == 0 );
     blas_error_if( incy == 0 );
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::sgemv, double( m ) * n )) {
+        gemv< float, float, float >(
+            layout, trans, m, n, alpha, A, lda, x, incx, beta, y, incy );
+        return;
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::gemv_split( layout, trans, m, n, alpha, A, lda, x, incx,
+                                  beta, y, incy );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            gemv< float, float, float >(
+                layout, trans, m, n,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
     }
 
     blas_int m_    = (blas_int) m;
@@ -80,6 +103,8 @@ void gemv(
     double beta,
     double       *y, int64_t incy )
 {
+    blas_trace( "gemv", 'd', { layout, trans }, { m, n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -97,13 +122,31 @@ void gemv(
     blas_error_if( incx == 0 );
     blas_error_if( incy == 0 );
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::dgemv, double( m ) * n )) {
+        gemv< double, double, double >(
+            layout, trans, m, n, alpha, A, lda, x, incx, beta, y, incy );
+        return;
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::gemv_split( layout, trans, m, n, alpha, A, lda, x, incx,
+                                  beta, y, incy );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            gemv< double, double, double >(
+                layout, trans, m, n,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
     }
 
     blas_int m_    = (blas_int) m;
@@ -135,6 +178,8 @@ void gemv(
     std::complex<float> beta,
     std::complex<float>       *y, int64_t incy )
 {
+    blas_trace( "gemv", 'c', { layout, trans }, { m, n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -152,13 +197,32 @@ void gemv(
     blas_error_if( incx == 0 );
     blas_error_if( incy == 0 );
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::cgemv, double( m ) * n )) {
+        gemv< std::complex<float>, std::complex<float>, std::complex<float> >(
+            layout, trans, m, n, alpha, A, lda, x, incx, beta, y, incy );
+        return;
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::gemv_split( layout, trans, m, n, alpha, A, lda, x, incx,
+                                  beta, y, incy );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            gemv< std::complex<float>, std::complex<float>,
+                  std::complex<float> >(
+                layout, trans, m, n,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
     }
 
     blas_int m_    = (blas_int) m;
@@ -226,6 +290,8 @@ void gemv(
     std::complex<double> beta,
     std::complex<double>       *y, int64_t incy )
 {
+    blas_trace( "gemv", 'z', { layout, trans }, { m, n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -243,13 +309,33 @@ void gemv(
     blas_error_if( incx == 0 );
     blas_error_if( incy == 0 );
 
+    // small problems are faster in the template; see tune.hh
+    if (internal::use_template( internal::Tune::zgemv, double( m ) * n )) {
+        gemv< std::complex<double>, std::complex<double>,
+              std::complex<double> >(
+            layout, trans, m, n, alpha, A, lda, x, incx, beta, y, incy );
+        return;
+    }
+
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::gemv_split( layout, trans, m, n, alpha, A, lda, x, incx,
+                                  beta, y, incy );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            gemv< std::complex<double>, std::complex<double>,
+                  std::complex<double> >(
+                layout, trans, m, n,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
     }
 
     blas_int m_    = (blas_int) m;
@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -23,6 +25,8 @@ void geru(
     float const *y, int64_t incy,
     float       *A, int64_t lda )
 {
+    blas_trace( "geru", 's', { layout }, { m, n } );
+
     ger( layout, m, n, alpha, x, incx, y, incy, A, lda );
 }
 
@@ -36,6 +40,8 @@ void geru(
     double const *y, int64_t incy,
     double       *A, int64_t lda )
 {
+    blas_trace( "geru", 'd', { layout }, { m, n } );
+
     ger( layout, m, n, alpha, x, incx, y, incy, A, lda );
 }
 
@@ -49,6 +55,8 @@ void geru(
     std::complex<float> const *y, int64_t incy,
     std::complex<float>       *A, int64_t lda )
 {
+    blas_trace( "geru", 'c', { layout }, { m, n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -64,11 +72,23 @@ void geru(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::geru_split( layout, m, n, alpha, x, incx, y, incy,
+                                  A, lda );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            geru< std::complex<float>, std::complex<float>,
+                  std::complex<float> >(
+                layout, m, n,
+                alpha, x, incx, y, incy, A, lda );
+            return;
+        }
     }
 
     blas_int m_    = (blas_int) m;
@@ -104,6 +124,8 @@ void geru(
     std::complex<double> const *y, int64_t incy,
     std::complex<double>       *A, int64_t lda )
 {
+    blas_trace( "geru", 'z', { layout }, { m, n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -119,11 +141,23 @@ void geru(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::geru_split( layout, m, n, alpha, x, incx, y, incy,
+                                  A, lda );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            geru< std::complex<double>, std::complex<double>,
+                  std::complex<double> >(
+                layout, m, n,
+                alpha, x, incx, y, incy, A, lda );
+            return;
+        }
     }
 
     blas_int m_    = (blas_int) m;
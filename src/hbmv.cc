@@ -0,0 +1,230 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "dispatch.hh"
+#include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
+
+#include <limits>
+
+namespace blas {
+
+// =============================================================================
+// Overloaded wrappers for s, d, c, z precisions.
+
+// -----------------------------------------------------------------------------
+/// @ingroup hbmv
+void hbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda,
+    float const *x, int64_t incx,
+    float beta,
+    float       *y, int64_t incy )
+{
+    blas_trace( "hbmv", 's', { layout, uplo }, { n, k } );
+
+    sbmv( layout, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup hbmv
+void hbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda,
+    double const *x, int64_t incx,
+    double beta,
+    double       *y, int64_t incy )
+{
+    blas_trace( "hbmv", 'd', { layout, uplo }, { n, k } );
+
+    sbmv( layout, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup hbmv
+void hbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda,
+    std::complex<float> const *x, int64_t incx,
+    std::complex<float> beta,
+    std::complex<float>       *y, int64_t incy )
+{
+    blas_trace( "hbmv", 'c', { layout, uplo }, { n, k } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Upper &&
+                   uplo != Uplo::Lower );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( lda < k + 1 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(blas_int)) {
+        // band matrices are not split, so if any dimension, leading dimension,
+        // or increment overflows, use the int64_t template implementation
+        if (internal::split_needed( { n, lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            hbmv< std::complex<float>, std::complex<float>,
+                  std::complex<float> >(
+                layout, uplo, n, k,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
+    }
+
+    blas_int n_    = (blas_int) n;
+    blas_int k_    = (blas_int) k;
+    blas_int lda_  = (blas_int) lda;
+    blas_int incx_ = (blas_int) incx;
+    blas_int incy_ = (blas_int) incy;
+
+    // if x2=x, then it isn't modified
+    std::complex<float> *x2 = const_cast< std::complex<float>* >( x );
+    if (layout == Layout::RowMajor) {
+        // swap lower <=> upper
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+
+        // conjugate alpha, beta, x (in x2), and y (in-place)
+        alpha = conj( alpha );
+        beta  = conj( beta );
+
+        x2 = new std::complex<float>[n];
+        int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
+        for (int64_t i = 0; i < n; ++i) {
+            x2[i] = conj( x[ix] );
+            ix += incx;
+        }
+        incx_ = 1;
+
+        int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+        for (int64_t i = 0; i < n; ++i) {
+            y[iy] = conj( y[iy] );
+            iy += incy;
+        }
+    }
+
+    char uplo_ = uplo2char( uplo );
+    BLAS_chbmv( &uplo_, &n_, &k_,
+                (blas_complex_float*) &alpha,
+                (blas_complex_float*) A, &lda_,
+                (blas_complex_float*) x2, &incx_,
+                (blas_complex_float*) &beta,
+                (blas_complex_float*) y, &incy_ );
+
+    if (layout == Layout::RowMajor) {
+        delete[] x2;
+        // y = conj( y )
+        int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+        for (int64_t i = 0; i < n; ++i) {
+            y[iy] = conj( y[iy] );
+            iy += incy;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup hbmv
+void hbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const *A, int64_t lda,
+    std::complex<double> const *x, int64_t incx,
+    std::complex<double> beta,
+    std::complex<double>       *y, int64_t incy )
+{
+    blas_trace( "hbmv", 'z', { layout, uplo }, { n, k } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Upper &&
+                   uplo != Uplo::Lower );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( lda < k + 1 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(blas_int)) {
+        // band matrices are not split, so if any dimension, leading dimension,
+        // or increment overflows, use the int64_t template implementation
+        if (internal::split_needed( { n, lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            hbmv< std::complex<double>, std::complex<double>,
+                  std::complex<double> >(
+                layout, uplo, n, k,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
+    }
+
+    blas_int n_    = (blas_int) n;
+    blas_int k_    = (blas_int) k;
+    blas_int lda_  = (blas_int) lda;
+    blas_int incx_ = (blas_int) incx;
+    blas_int incy_ = (blas_int) incy;
+
+    // if x2=x, then it isn't modified
+    std::complex<double> *x2 = const_cast< std::complex<double>* >( x );
+    if (layout == Layout::RowMajor) {
+        // swap lower <=> upper
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+
+        // conjugate alpha, beta, x (in x2), and y (in-place)
+        alpha = conj( alpha );
+        beta  = conj( beta );
+
+        x2 = new std::complex<double>[n];
+        int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
+        for (int64_t i = 0; i < n; ++i) {
+            x2[i] = conj( x[ix] );
+            ix += incx;
+        }
+        incx_ = 1;
+
+        int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+        for (int64_t i = 0; i < n; ++i) {
+            y[iy] = conj( y[iy] );
+            iy += incy;
+        }
+    }
+
+    char uplo_ = uplo2char( uplo );
+    BLAS_zhbmv( &uplo_, &n_, &k_,
+                (blas_complex_double*) &alpha,
+                (blas_complex_double*) A, &lda_,
+                (blas_complex_double*) x2, &incx_,
+                (blas_complex_double*) &beta,
+                (blas_complex_double*) y, &incy_ );
+
+    if (layout == Layout::RowMajor) {
+        delete[] x2;
+        // y = conj( y )
+        int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+        for (int64_t i = 0; i < n; ++i) {
+            y[iy] = conj( y[iy] );
+            iy += incy;
+        }
+    }
+}
+
+}  // namespace blas
@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -26,6 +28,8 @@ void hemm(
     float beta,
     float       *C, int64_t ldc )
 {
+    blas_trace( "hemm", 's', { layout, side, uplo }, { m, n } );
+
     symm( layout, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc );
 }
 
@@ -42,6 +46,8 @@ void hemm(
     double beta,
     double       *C, int64_t ldc )
 {
+    blas_trace( "hemm", 'd', { layout, side, uplo }, { m, n } );
+
     symm( layout, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc );
 }
 
@@ -58,6 +64,8 @@ void hemm(
     std::complex<float> beta,
     std::complex<float>       *C, int64_t ldc )
 {
+    blas_trace( "hemm", 'c', { layout, side, uplo }, { m, n } );
+
     typedef long long lld;
 
     // check arguments
@@ -86,11 +94,22 @@ void hemm(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::hemm_split( layout, side, uplo, m, n, alpha, A, lda,
+                                  B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            hemm< std::complex<float>, std::complex<float>,
+                  std::complex<float> >(
+                layout, side, uplo, m, n,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
@@ -129,6 +148,8 @@ void hemm(
     std::complex<double> beta,
     std::complex<double>       *C, int64_t ldc )
 {
+    blas_trace( "hemm", 'z', { layout, side, uplo }, { m, n } );
+
     typedef long long lld;
 
     // check arguments
@@ -157,11 +178,22 @@ void hemm(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::hemm_split( layout, side, uplo, m, n, alpha, A, lda,
+                                  B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            hemm< std::complex<double>, std::complex<double>,
+                  std::complex<double> >(
+                layout, side, uplo, m, n,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -25,6 +27,8 @@ void hemv(
     float beta,
     float       *y, int64_t incy )
 {
+    blas_trace( "hemv", 's', { layout, uplo }, { n } );
+
     symv( layout, uplo, n, alpha, A, lda, x, incx, beta, y, incy );
 }
 
@@ -40,6 +44,8 @@ void hemv(
     double beta,
     double       *y, int64_t incy )
 {
+    blas_trace( "hemv", 'd', { layout, uplo }, { n } );
+
     symv( layout, uplo, n, alpha, A, lda, x, incx, beta, y, incy );
 }
 
@@ -55,6 +61,8 @@ void hemv(
     std::complex<float> beta,
     std::complex<float>       *y, int64_t incy )
 {
+    blas_trace( "hemv", 'c', { layout, uplo }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -67,10 +75,23 @@ void hemv(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::hemv_split( layout, uplo, n, alpha, A, lda, x, incx, beta,
+                                  y, incy );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            hemv< std::complex<float>, std::complex<float>,
+                  std::complex<float> >(
+                layout, uplo, n,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -134,6 +155,8 @@ void hemv(
     std::complex<double> beta,
     std::complex<double>       *y, int64_t incy )
 {
+    blas_trace( "hemv", 'z', { layout, uplo }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -146,10 +169,23 @@ void hemv(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::hemv_split( layout, uplo, n, alpha, A, lda, x, incx, beta,
+                                  y, incy );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            hemv< std::complex<double>, std::complex<double>,
+                  std::complex<double> >(
+                layout, uplo, n,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
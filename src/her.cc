@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -23,6 +25,8 @@ void her(
     float const *x, int64_t incx,
     float       *A, int64_t lda )
 {
+    blas_trace( "her", 's', { layout, uplo }, { n } );
+
     syr( layout, uplo, n, alpha, x, incx, A, lda );
 }
 
@@ -36,6 +40,8 @@ void her(
     double const *x, int64_t incx,
     double       *A, int64_t lda )
 {
+    blas_trace( "her", 'd', { layout, uplo }, { n } );
+
     syr( layout, uplo, n, alpha, x, incx, A, lda );
 }
 
@@ -49,6 +55,8 @@ void her(
     std::complex<float> const *x, int64_t incx,
     std::complex<float>       *A, int64_t lda )
 {
+    blas_trace( "her", 's', { layout, uplo }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -60,9 +68,20 @@ void her(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::her_split( layout, uplo, n, alpha, x, incx, A, lda );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ) } )) {
+            her< std::complex<float>, std::complex<float> >(
+                layout, uplo, n,
+                alpha, x, incx, A, lda );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -106,6 +125,8 @@ void her(
     std::complex<double> const *x, int64_t incx,
     std::complex<double>       *A, int64_t lda )
 {
+    blas_trace( "her", 'd', { layout, uplo }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -117,9 +138,20 @@ void her(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::her_split( layout, uplo, n, alpha, x, incx, A, lda );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ) } )) {
+            her< std::complex<double>, std::complex<double> >(
+                layout, uplo, n,
+                alpha, x, incx, A, lda );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
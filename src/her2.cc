@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -24,6 +26,8 @@ void her2(
     float const *y, int64_t incy,
     float       *A, int64_t lda )
 {
+    blas_trace( "her2", 's', { layout, uplo }, { n } );
+
     syr2( layout, uplo, n, alpha, x, incx, y, incy, A, lda );
 }
 
@@ -38,6 +42,8 @@ void her2(
     double const *y, int64_t incy,
     double       *A, int64_t lda )
 {
+    blas_trace( "her2", 'd', { layout, uplo }, { n } );
+
     syr2( layout, uplo, n, alpha, x, incx, y, incy, A, lda );
 }
 
@@ -52,6 +58,8 @@ void her2(
     std::complex<float> const *y, int64_t incy,
     std::complex<float>       *A, int64_t lda )
 {
+    blas_trace( "her2", 'c', { layout, uplo }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -64,10 +72,23 @@ void her2(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::her2_split( layout, uplo, n, alpha, x, incx, y, incy,
+                                  A, lda );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            her2< std::complex<float>, std::complex<float>,
+                  std::complex<float> >(
+                layout, uplo, n,
+                alpha, x, incx, y, incy, A, lda );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -99,6 +120,8 @@ void her2(
     std::complex<double> const *y, int64_t incy,
     std::complex<double>       *A, int64_t lda )
 {
+    blas_trace( "her2", 'z', { layout, uplo }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -111,10 +134,23 @@ void her2(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::her2_split( layout, uplo, n, alpha, x, incx, y, incy,
+                                  A, lda );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            her2< std::complex<double>, std::complex<double>,
+                  std::complex<double> >(
+                layout, uplo, n,
+                alpha, x, incx, y, incy, A, lda );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
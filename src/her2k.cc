@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -26,6 +28,8 @@ void her2k(
     float beta,
     float       *C, int64_t ldc )
 {
+    blas_trace( "her2k", 's', { layout, uplo, trans }, { n, k } );
+
     syr2k( layout, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
 }
 
@@ -42,6 +46,8 @@ void her2k(
     double beta,
     double       *C, int64_t ldc )
 {
+    blas_trace( "her2k", 'd', { layout, uplo, trans }, { n, k } );
+
     syr2k( layout, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
 }
 
@@ -58,6 +64,8 @@ void her2k(
     float beta,   // note: real
     std::complex<float>       *C, int64_t ldc )
 {
+    blas_trace( "her2k", 'c', { layout, uplo, trans }, { n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -81,10 +89,22 @@ void her2k(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n, k } )) {
+            internal::her2k_split( layout, uplo, trans, n, k, alpha, A, lda,
+                                   B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            her2k< std::complex<float>, std::complex<float>,
+                   std::complex<float> >(
+                layout, uplo, trans, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int n_   = (blas_int) n;
@@ -123,6 +143,8 @@ void her2k(
     double beta,  // note: real
     std::complex<double>       *C, int64_t ldc )
 {
+    blas_trace( "her2k", 'z', { layout, uplo, trans }, { n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -146,10 +168,22 @@ void her2k(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n, k } )) {
+            internal::her2k_split( layout, uplo, trans, n, k, alpha, A, lda,
+                                   B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            her2k< std::complex<double>, std::complex<double>,
+                   std::complex<double> >(
+                layout, uplo, trans, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int n_   = (blas_int) n;
@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -25,6 +27,8 @@ void herk(
     float beta,
     float       *C, int64_t ldc )
 {
+    blas_trace( "herk", 's', { layout, uplo, trans }, { n, k } );
+
     syrk( layout, uplo, trans, n, k, alpha, A, lda, beta, C, ldc );
 }
 
@@ -40,6 +44,8 @@ void herk(
     double beta,
     double       *C, int64_t ldc )
 {
+    blas_trace( "herk", 'd', { layout, uplo, trans }, { n, k } );
+
     syrk( layout, uplo, trans, n, k, alpha, A, lda, beta, C, ldc );
 }
 
@@ -55,6 +61,8 @@ void herk(
     float beta,   // note: real
     std::complex<float>       *C, int64_t ldc )
 {
+    blas_trace( "herk", 's', { layout, uplo, trans }, { n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -74,10 +82,21 @@ void herk(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n, k } )) {
+            internal::herk_split( layout, uplo, trans, n, k, alpha, A, lda,
+                                  beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldc } )) {
+            herk< std::complex<float>, std::complex<float> >(
+                layout, uplo, trans, n, k,
+                alpha, A, lda, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int n_   = (blas_int) n;
@@ -113,6 +132,8 @@ void herk(
     double beta,
     std::complex<double>       *C, int64_t ldc )
 {
+    blas_trace( "herk", 'd', { layout, uplo, trans }, { n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -132,10 +153,21 @@ void herk(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n, k } )) {
+            internal::herk_split( layout, uplo, trans, n, k, alpha, A, lda,
+                                  beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldc } )) {
+            herk< std::complex<double>, std::complex<double> >(
+                layout, uplo, trans, n, k,
+                alpha, A, lda, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int n_   = (blas_int) n;
@@ -3,10 +3,15 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
+#include "blas.hh"
 #include "blas/device.hh"
 
 #if ! defined(BLAS_HAVE_CUBLAS) && ! defined(BLAS_HAVE_ROCBLAS) && ! defined(BLAS_HAVE_ONEMKL)
 
+// Host backend: each routine is a task on the queue's current stream,
+// run in order by the stream's worker thread using the host BLAS.
+// Device memory is host memory, so pointers are passed through as is.
+
 namespace blas {
 namespace device {
 
@@ -24,7 +29,9 @@ void saxpy(
     float *dx, device_blas_int incdx,
     float *dy, device_blas_int incdy)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::axpy( n, alpha, dx, incdx, dy, incdy );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -36,7 +43,9 @@ void daxpy(
     double *dx, device_blas_int incdx,
     double *dy, device_blas_int incdy)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::axpy( n, alpha, dx, incdx, dy, incdy );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -48,7 +57,9 @@ void caxpy(
     std::complex<float> *dx, device_blas_int incdx,
     std::complex<float> *dy, device_blas_int incdy)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::axpy( n, alpha, dx, incdx, dy, incdy );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -60,7 +71,9 @@ void zaxpy(
     std::complex<double> *dx, device_blas_int incdx,
     std::complex<double> *dy, device_blas_int incdy)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::axpy( n, alpha, dx, incdx, dy, incdy );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -73,7 +86,9 @@ void snrm2(
     float *dx, device_blas_int incdx,
     float *result)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        *result = blas::nrm2( n, dx, incdx );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -84,7 +99,9 @@ void dnrm2(
     double *dx, device_blas_int incdx,
     double *result)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        *result = blas::nrm2( n, dx, incdx );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -95,7 +112,9 @@ void cnrm2(
     std::complex<float> *dx, device_blas_int incdx,
     float *result)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        *result = blas::nrm2( n, dx, incdx );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -106,7 +125,9 @@ void znrm2(
     std::complex<double> *dx, device_blas_int incdx,
     double *result)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        *result = blas::nrm2( n, dx, incdx );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -119,7 +140,9 @@ void sscal(
     float alpha,
     float *dx, device_blas_int incdx)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::scal( n, alpha, dx, incdx );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -130,7 +153,9 @@ void dscal(
     double alpha,
     double *dx, device_blas_int incdx)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::scal( n, alpha, dx, incdx );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -141,7 +166,9 @@ void cscal(
     std::complex<float> alpha,
     std::complex<float> *dx, device_blas_int incdx)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::scal( n, alpha, dx, incdx );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -152,7 +179,9 @@ void zscal(
     std::complex<double> alpha,
     std::complex<double> *dx, device_blas_int incdx)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::scal( n, alpha, dx, incdx );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -165,7 +194,9 @@ void sswap(
     float *dx, device_blas_int incdx,
     float *dy, device_blas_int incdy)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::swap( n, dx, incdx, dy, incdy );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -176,7 +207,9 @@ void dswap(
     double *dx, device_blas_int incdx,
     double *dy, device_blas_int incdy)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::swap( n, dx, incdx, dy, incdy );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -187,7 +220,9 @@ void cswap(
     std::complex<float> *dx, device_blas_int incdx,
     std::complex<float> *dy, device_blas_int incdy)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::swap( n, dx, incdx, dy, incdy );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -198,7 +233,9 @@ void zswap(
     std::complex<double> *dx, device_blas_int incdx,
     std::complex<double> *dy, device_blas_int incdy)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::swap( n, dx, incdx, dy, incdy );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -211,7 +248,9 @@ void scopy(
     float const *dx, device_blas_int incdx,
     float *dy, device_blas_int incdy)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::copy( n, dx, incdx, dy, incdy );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -222,7 +261,9 @@ void dcopy(
     double const *dx, device_blas_int incdx,
     double *dy, device_blas_int incdy)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::copy( n, dx, incdx, dy, incdy );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -233,7 +274,9 @@ void ccopy(
     std::complex<float> const *dx, device_blas_int incdx,
     std::complex<float> *dy, device_blas_int incdy)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::copy( n, dx, incdx, dy, incdy );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -244,7 +287,9 @@ void zcopy(
     std::complex<double> const *dx, device_blas_int incdx,
     std::complex<double> *dy, device_blas_int incdy)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::copy( n, dx, incdx, dy, incdy );
+    } );
 }
 // =============================================================================
 // Level 2 BLAS - Device Interfaces
@@ -268,7 +313,11 @@ void sgemm(
     float beta,
     float       *dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::gemm(
+            blas::Layout::ColMajor, transA, transB, m, n, k, alpha, dA, ldda,
+            dB, lddb, beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -283,7 +332,11 @@ void dgemm(
     double beta,
     double       *dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::gemm(
+            blas::Layout::ColMajor, transA, transB, m, n, k, alpha, dA, ldda,
+            dB, lddb, beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -298,7 +351,11 @@ void cgemm(
     std::complex<float> beta,
     std::complex<float>       *dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::gemm(
+            blas::Layout::ColMajor, transA, transB, m, n, k, alpha, dA, ldda,
+            dB, lddb, beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -313,7 +370,11 @@ void zgemm(
     std::complex<double> beta,
     std::complex<double>       *dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::gemm(
+            blas::Layout::ColMajor, transA, transB, m, n, k, alpha, dA, ldda,
+            dB, lddb, beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -328,7 +389,11 @@ void strsm(
     float const *dA, device_blas_int ldda,
     float       *dB, device_blas_int lddb)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::trsm(
+            blas::Layout::ColMajor, side, uplo, trans, diag, m, n, alpha, dA,
+            ldda, dB, lddb );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -341,7 +406,11 @@ void dtrsm(
     double const *dA, device_blas_int ldda,
     double       *dB, device_blas_int lddb)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::trsm(
+            blas::Layout::ColMajor, side, uplo, trans, diag, m, n, alpha, dA,
+            ldda, dB, lddb );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -354,7 +423,11 @@ void ctrsm(
     std::complex<float> const *dA, device_blas_int ldda,
     std::complex<float>       *dB, device_blas_int lddb)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::trsm(
+            blas::Layout::ColMajor, side, uplo, trans, diag, m, n, alpha, dA,
+            ldda, dB, lddb );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -367,7 +440,11 @@ void ztrsm(
     std::complex<double> const *dA, device_blas_int ldda,
     std::complex<double>       *dB, device_blas_int lddb)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::trsm(
+            blas::Layout::ColMajor, side, uplo, trans, diag, m, n, alpha, dA,
+            ldda, dB, lddb );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -382,7 +459,11 @@ void strmm(
     float const *dA, device_blas_int ldda,
     float       *dB, device_blas_int lddb)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::trmm(
+            blas::Layout::ColMajor, side, uplo, trans, diag, m, n, alpha, dA,
+            ldda, dB, lddb );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -395,7 +476,11 @@ void dtrmm(
     double const *dA, device_blas_int ldda,
     double       *dB, device_blas_int lddb)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::trmm(
+            blas::Layout::ColMajor, side, uplo, trans, diag, m, n, alpha, dA,
+            ldda, dB, lddb );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -408,7 +493,11 @@ void ctrmm(
     std::complex<float> const *dA, device_blas_int ldda,
     std::complex<float>       *dB, device_blas_int lddb)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::trmm(
+            blas::Layout::ColMajor, side, uplo, trans, diag, m, n, alpha, dA,
+            ldda, dB, lddb );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -421,7 +510,11 @@ void ztrmm(
     std::complex<double> const *dA, device_blas_int ldda,
     std::complex<double>       *dB, device_blas_int lddb)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::trmm(
+            blas::Layout::ColMajor, side, uplo, trans, diag, m, n, alpha, dA,
+            ldda, dB, lddb );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -438,7 +531,11 @@ void chemm(
     std::complex<float>  beta,
     std::complex<float>* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::hemm(
+            blas::Layout::ColMajor, side, uplo, m, n, alpha, dA, ldda, dB, lddb,
+            beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -453,7 +550,11 @@ void zhemm(
     std::complex<double>  beta,
     std::complex<double>* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::hemm(
+            blas::Layout::ColMajor, side, uplo, m, n, alpha, dA, ldda, dB, lddb,
+            beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -470,7 +571,11 @@ void ssymm(
     float  beta,
     float* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::symm(
+            blas::Layout::ColMajor, side, uplo, m, n, alpha, dA, ldda, dB, lddb,
+            beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -485,7 +590,11 @@ void dsymm(
     double  beta,
     double* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::symm(
+            blas::Layout::ColMajor, side, uplo, m, n, alpha, dA, ldda, dB, lddb,
+            beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -500,7 +609,11 @@ void csymm(
     std::complex<float>  beta,
     std::complex<float>* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::symm(
+            blas::Layout::ColMajor, side, uplo, m, n, alpha, dA, ldda, dB, lddb,
+            beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -515,7 +628,11 @@ void zsymm(
     std::complex<double>  beta,
     std::complex<double>* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::symm(
+            blas::Layout::ColMajor, side, uplo, m, n, alpha, dA, ldda, dB, lddb,
+            beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -531,7 +648,11 @@ void cherk(
     float  beta,
     std::complex<float>* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::herk(
+            blas::Layout::ColMajor, uplo, trans, n, k, alpha, dA, ldda, beta,
+            dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -545,7 +666,11 @@ void zherk(
     double  beta,
     std::complex<double>* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::herk(
+            blas::Layout::ColMajor, uplo, trans, n, k, alpha, dA, ldda, beta,
+            dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -561,7 +686,11 @@ void ssyrk(
     float  beta,
     float* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::syrk(
+            blas::Layout::ColMajor, uplo, trans, n, k, alpha, dA, ldda, beta,
+            dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -575,7 +704,11 @@ void dsyrk(
     double  beta,
     double* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::syrk(
+            blas::Layout::ColMajor, uplo, trans, n, k, alpha, dA, ldda, beta,
+            dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -589,7 +722,11 @@ void csyrk(
     std::complex<float>  beta,
     std::complex<float>* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::syrk(
+            blas::Layout::ColMajor, uplo, trans, n, k, alpha, dA, ldda, beta,
+            dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -603,7 +740,11 @@ void zsyrk(
     std::complex<double>  beta,
     std::complex<double>* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::syrk(
+            blas::Layout::ColMajor, uplo, trans, n, k, alpha, dA, ldda, beta,
+            dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -620,7 +761,11 @@ void cher2k(
     float  beta,
     std::complex<float>* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::her2k(
+            blas::Layout::ColMajor, uplo, trans, n, k, alpha, dA, ldda, dB,
+            lddb, beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -635,7 +780,11 @@ void zher2k(
     double  beta,
     std::complex<double>* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::her2k(
+            blas::Layout::ColMajor, uplo, trans, n, k, alpha, dA, ldda, dB,
+            lddb, beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -652,7 +801,11 @@ void ssyr2k(
     float  beta,
     float* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::syr2k(
+            blas::Layout::ColMajor, uplo, trans, n, k, alpha, dA, ldda, dB,
+            lddb, beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -667,7 +820,11 @@ void dsyr2k(
     double  beta,
     double* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::syr2k(
+            blas::Layout::ColMajor, uplo, trans, n, k, alpha, dA, ldda, dB,
+            lddb, beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -682,7 +839,11 @@ void csyr2k(
     std::complex<float>  beta,
     std::complex<float>* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::syr2k(
+            blas::Layout::ColMajor, uplo, trans, n, k, alpha, dA, ldda, dB,
+            lddb, beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -697,7 +858,11 @@ void zsyr2k(
     std::complex<double>  beta,
     std::complex<double>* dC, device_blas_int lddc)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        blas::syr2k(
+            blas::Layout::ColMajor, uplo, trans, n, k, alpha, dA, ldda, dB,
+            lddb, beta, dC, lddc );
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -715,7 +880,15 @@ void batch_sgemm(
     float** dCarray, device_blas_int lddc,
     device_blas_int batch_size)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        #pragma omp parallel for schedule(dynamic)
+        for (device_blas_int i = 0; i < batch_size; ++i) {
+            blas::gemm(
+                blas::Layout::ColMajor, transA, transB, m, n, k, alpha,
+                dAarray[ i ], ldda, dBarray[ i ], lddb, beta, dCarray[ i ],
+                lddc );
+        }
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -731,7 +904,15 @@ void batch_dgemm(
     double** dCarray, device_blas_int lddc,
     device_blas_int batch_size)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        #pragma omp parallel for schedule(dynamic)
+        for (device_blas_int i = 0; i < batch_size; ++i) {
+            blas::gemm(
+                blas::Layout::ColMajor, transA, transB, m, n, k, alpha,
+                dAarray[ i ], ldda, dBarray[ i ], lddb, beta, dCarray[ i ],
+                lddc );
+        }
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -747,7 +928,15 @@ void batch_cgemm(
     std::complex<float>** dCarray, device_blas_int lddc,
     device_blas_int batch_size)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        #pragma omp parallel for schedule(dynamic)
+        for (device_blas_int i = 0; i < batch_size; ++i) {
+            blas::gemm(
+                blas::Layout::ColMajor, transA, transB, m, n, k, alpha,
+                dAarray[ i ], ldda, dBarray[ i ], lddb, beta, dCarray[ i ],
+                lddc );
+        }
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -763,7 +952,111 @@ void batch_zgemm(
     std::complex<double>** dCarray, device_blas_int lddc,
     device_blas_int batch_size)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        #pragma omp parallel for schedule(dynamic)
+        for (device_blas_int i = 0; i < batch_size; ++i) {
+            blas::gemm(
+                blas::Layout::ColMajor, transA, transB, m, n, k, alpha,
+                dAarray[ i ], ldda, dBarray[ i ], lddb, beta, dCarray[ i ],
+                lddc );
+        }
+    } );
+}
+
+// -----------------------------------------------------------------------------
+// batch sgemm, strided
+void batch_sgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    float alpha,
+    float const *dA, device_blas_int ldda, int64_t strideA,
+    float const *dB, device_blas_int lddb, int64_t strideB,
+    float beta,
+    float       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size)
+{
+    queue.stream().submit( [=]() {
+        #pragma omp parallel for schedule(dynamic)
+        for (device_blas_int i = 0; i < batch_size; ++i) {
+            blas::gemm(
+                blas::Layout::ColMajor, transA, transB, m, n, k, alpha,
+                dA + i*strideA, ldda, dB + i*strideB, lddb, beta,
+                dC + i*strideC, lddc );
+        }
+    } );
+}
+
+// -----------------------------------------------------------------------------
+// batch dgemm, strided
+void batch_dgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    double alpha,
+    double const *dA, device_blas_int ldda, int64_t strideA,
+    double const *dB, device_blas_int lddb, int64_t strideB,
+    double beta,
+    double       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size)
+{
+    queue.stream().submit( [=]() {
+        #pragma omp parallel for schedule(dynamic)
+        for (device_blas_int i = 0; i < batch_size; ++i) {
+            blas::gemm(
+                blas::Layout::ColMajor, transA, transB, m, n, k, alpha,
+                dA + i*strideA, ldda, dB + i*strideB, lddb, beta,
+                dC + i*strideC, lddc );
+        }
+    } );
+}
+
+// -----------------------------------------------------------------------------
+// batch cgemm, strided
+void batch_cgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, device_blas_int ldda, int64_t strideA,
+    std::complex<float> const *dB, device_blas_int lddb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size)
+{
+    queue.stream().submit( [=]() {
+        #pragma omp parallel for schedule(dynamic)
+        for (device_blas_int i = 0; i < batch_size; ++i) {
+            blas::gemm(
+                blas::Layout::ColMajor, transA, transB, m, n, k, alpha,
+                dA + i*strideA, ldda, dB + i*strideB, lddb, beta,
+                dC + i*strideC, lddc );
+        }
+    } );
+}
+
+// -----------------------------------------------------------------------------
+// batch zgemm, strided
+void batch_zgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, device_blas_int ldda, int64_t strideA,
+    std::complex<double> const *dB, device_blas_int lddb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size)
+{
+    queue.stream().submit( [=]() {
+        #pragma omp parallel for schedule(dynamic)
+        for (device_blas_int i = 0; i < batch_size; ++i) {
+            blas::gemm(
+                blas::Layout::ColMajor, transA, transB, m, n, k, alpha,
+                dA + i*strideA, ldda, dB + i*strideB, lddb, beta,
+                dC + i*strideC, lddc );
+        }
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -776,9 +1069,16 @@ void batch_strsm(
     float const * const * dAarray, device_blas_int ldda,
     float const * const * dBarray, device_blas_int lddb,
     device_blas_int batch_size)
-
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        #pragma omp parallel for schedule(dynamic)
+        for (device_blas_int i = 0; i < batch_size; ++i) {
+            blas::trsm(
+                blas::Layout::ColMajor, side, uplo, trans, diag, m, n, alpha,
+                dAarray[ i ], ldda, const_cast< float* >( dBarray[ i ] ),
+                lddb );
+        }
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -792,7 +1092,15 @@ void batch_dtrsm(
     double const * const * dBarray, device_blas_int lddb,
     device_blas_int batch_size)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        #pragma omp parallel for schedule(dynamic)
+        for (device_blas_int i = 0; i < batch_size; ++i) {
+            blas::trsm(
+                blas::Layout::ColMajor, side, uplo, trans, diag, m, n, alpha,
+                dAarray[ i ], ldda, const_cast< double* >( dBarray[ i ] ),
+                lddb );
+        }
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -806,7 +1114,15 @@ void batch_ctrsm(
     std::complex<float> const * const * dBarray, device_blas_int lddb,
     device_blas_int batch_size)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        #pragma omp parallel for schedule(dynamic)
+        for (device_blas_int i = 0; i < batch_size; ++i) {
+            blas::trsm(
+                blas::Layout::ColMajor, side, uplo, trans, diag, m, n, alpha,
+                dAarray[ i ], ldda,
+                const_cast< std::complex<float>* >( dBarray[ i ] ), lddb );
+        }
+    } );
 }
 
 // -----------------------------------------------------------------------------
@@ -820,7 +1136,15 @@ void batch_ztrsm(
     std::complex<double> const * const * dBarray, device_blas_int lddb,
     device_blas_int batch_size)
 {
-    throw blas::Error( "device BLAS not available", __func__ );
+    queue.stream().submit( [=]() {
+        #pragma omp parallel for schedule(dynamic)
+        for (device_blas_int i = 0; i < batch_size; ++i) {
+            blas::trsm(
+                blas::Layout::ColMajor, side, uplo, trans, diag, m, n, alpha,
+                dAarray[ i ], ldda,
+                const_cast< std::complex<double>* >( dBarray[ i ] ), lddb );
+        }
+    } );
 }
 
 }  // namespace device
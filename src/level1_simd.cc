@@ -0,0 +1,582 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas/simd.hh"
+#include "blas/nrm2.hh"
+#include "level1_simd.hh"
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define BLAS_SIMD_NEON
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    #define BLAS_SIMD_X86
+#endif
+
+namespace blas {
+namespace internal {
+namespace simd {
+namespace {
+
+//------------------------------------------------------------------------------
+/// Plain C++ traits, used when no instruction set kernels are available.
+/// Compilers may still vectorize these loops for the baseline ISA.
+template <typename T>
+struct Portable {
+    typedef T real_t;
+    static const int width = 4;
+    struct vec_t { T v[ width ]; };
+
+    static vec_t load( T const* x )
+    {
+        vec_t a;
+        for (int i = 0; i < width; ++i)
+            a.v[ i ] = x[ i ];
+        return a;
+    }
+
+    static void store( T* x, vec_t a )
+    {
+        for (int i = 0; i < width; ++i)
+            x[ i ] = a.v[ i ];
+    }
+
+    static vec_t set1( T s )
+    {
+        vec_t a;
+        for (int i = 0; i < width; ++i)
+            a.v[ i ] = s;
+        return a;
+    }
+
+    static vec_t alternate( T e, T o )
+    {
+        vec_t a;
+        for (int i = 0; i < width; i += 2) {
+            a.v[ i     ] = e;
+            a.v[ i + 1 ] = o;
+        }
+        return a;
+    }
+
+    static vec_t add( vec_t a, vec_t b )
+    {
+        for (int i = 0; i < width; ++i)
+            a.v[ i ] += b.v[ i ];
+        return a;
+    }
+
+    static vec_t mul( vec_t a, vec_t b )
+    {
+        for (int i = 0; i < width; ++i)
+            a.v[ i ] *= b.v[ i ];
+        return a;
+    }
+
+    static vec_t fmadd( vec_t a, vec_t b, vec_t c )
+    {
+        for (int i = 0; i < width; ++i)
+            c.v[ i ] += a.v[ i ] * b.v[ i ];
+        return c;
+    }
+
+    static vec_t abs( vec_t a )
+    {
+        for (int i = 0; i < width; ++i)
+            a.v[ i ] = abs_( a.v[ i ] );
+        return a;
+    }
+
+    static vec_t max( vec_t a, vec_t b )
+    {
+        for (int i = 0; i < width; ++i)
+            b.v[ i ] = (a.v[ i ] > b.v[ i ] ? a.v[ i ] : b.v[ i ]);
+        return b;
+    }
+
+    static vec_t min( vec_t a, vec_t b )
+    {
+        for (int i = 0; i < width; ++i)
+            b.v[ i ] = (a.v[ i ] < b.v[ i ] ? a.v[ i ] : b.v[ i ]);
+        return b;
+    }
+
+    static vec_t select_lt( vec_t a, vec_t b, vec_t x, vec_t y )
+    {
+        for (int i = 0; i < width; ++i)
+            y.v[ i ] = (a.v[ i ] < b.v[ i ] ? x.v[ i ] : y.v[ i ]);
+        return y;
+    }
+
+    static vec_t swap_pairs( vec_t a )
+    {
+        for (int i = 0; i < width; i += 2) {
+            T tmp = a.v[ i ];
+            a.v[ i     ] = a.v[ i + 1 ];
+            a.v[ i + 1 ] = tmp;
+        }
+        return a;
+    }
+
+    static T reduce_add( vec_t a )
+    {
+        return (a.v[ 0 ] + a.v[ 1 ]) + (a.v[ 2 ] + a.v[ 3 ]);
+    }
+
+    static T reduce_max( vec_t a )
+    {
+        T m = a.v[ 0 ];
+        for (int i = 1; i < width; ++i)
+            m = (a.v[ i ] > m ? a.v[ i ] : m);
+        return m;
+    }
+
+    static int first_equal( vec_t a, T s )
+    {
+        for (int i = 0; i < width; ++i) {
+            if (a.v[ i ] == s)
+                return i;
+        }
+        return -1;
+    }
+
+    // 16-bit conversions, for T = float
+    static vec_t load_f16( uint16_t const* x )
+    {
+        vec_t a;
+        for (int i = 0; i < width; ++i)
+            a.v[ i ] = float16_bits_to_float( x[ i ] );
+        return a;
+    }
+
+    static void store_f16( uint16_t* x, vec_t a )
+    {
+        for (int i = 0; i < width; ++i)
+            x[ i ] = float_to_float16_bits( a.v[ i ] );
+    }
+
+    static vec_t load_bf16( uint16_t const* x )
+    {
+        vec_t a;
+        for (int i = 0; i < width; ++i)
+            a.v[ i ] = bfloat16_bits_to_float( x[ i ] );
+        return a;
+    }
+
+    static void store_bf16( uint16_t* x, vec_t a )
+    {
+        for (int i = 0; i < width; ++i)
+            x[ i ] = float_to_bfloat16_bits( a.v[ i ] );
+    }
+};
+
+#ifdef BLAS_SIMD_NEON
+//------------------------------------------------------------------------------
+/// NEON is part of the AArch64 baseline, so needs no special flags.
+/// maxnm and minnm return the non-NaN operand, which ignores NaN in x.
+struct Neon_s {
+    typedef float real_t;
+    typedef float32x4_t vec_t;
+    static const int width = 4;
+
+    static vec_t load( real_t const* x ) { return vld1q_f32( x ); }
+    static void store( real_t* x, vec_t a ) { vst1q_f32( x, a ); }
+    static vec_t set1( real_t s ) { return vdupq_n_f32( s ); }
+    static vec_t alternate( real_t e, real_t o )
+    {
+        real_t v[ width ] = { e, o, e, o };
+        return vld1q_f32( v );
+    }
+    static vec_t add( vec_t a, vec_t b ) { return vaddq_f32( a, b ); }
+    static vec_t mul( vec_t a, vec_t b ) { return vmulq_f32( a, b ); }
+    static vec_t fmadd( vec_t a, vec_t b, vec_t c )
+        { return vfmaq_f32( c, a, b ); }
+    static vec_t abs( vec_t a ) { return vabsq_f32( a ); }
+    static vec_t max( vec_t a, vec_t b ) { return vmaxnmq_f32( a, b ); }
+    static vec_t min( vec_t a, vec_t b ) { return vminnmq_f32( a, b ); }
+    static vec_t select_lt( vec_t a, vec_t b, vec_t x, vec_t y )
+        { return vbslq_f32( vcltq_f32( a, b ), x, y ); }
+    static vec_t swap_pairs( vec_t a ) { return vrev64q_f32( a ); }
+    static real_t reduce_add( vec_t a ) { return vaddvq_f32( a ); }
+    static real_t reduce_max( vec_t a ) { return vmaxnmvq_f32( a ); }
+
+    static int first_equal( vec_t a, real_t s )
+    {
+        uint32_t mask[ width ];
+        vst1q_u32( mask, vceqq_f32( a, vdupq_n_f32( s ) ) );
+        for (int i = 0; i < width; ++i) {
+            if (mask[ i ])
+                return i;
+        }
+        return -1;
+    }
+
+    static vec_t load_f16( uint16_t const* x )
+        { return vcvt_f32_f16( vreinterpret_f16_u16( vld1_u16( x ) ) ); }
+
+    static void store_f16( uint16_t* x, vec_t a )
+        { vst1_u16( x, vreinterpret_u16_f16( vcvt_f16_f32( a ) ) ); }
+
+    static vec_t load_bf16( uint16_t const* x )
+    {
+        return vreinterpretq_f32_u32(
+            vshlq_n_u32( vmovl_u16( vld1_u16( x ) ), 16 ) );
+    }
+
+    /// Rounds to nearest even by adding 0x7fff + lsb; NaN is made quiet.
+    static void store_bf16( uint16_t* x, vec_t a )
+    {
+        uint32x4_t u = vreinterpretq_u32_f32( a );
+        uint32x4_t lsb = vandq_u32( vshrq_n_u32( u, 16 ), vdupq_n_u32( 1 ) );
+        uint32x4_t r = vaddq_u32( u, vaddq_u32( lsb, vdupq_n_u32( 0x7fff ) ) );
+        uint32x4_t q = vorrq_u32( u, vdupq_n_u32( 0x00400000 ) );
+        r = vbslq_u32( vceqq_f32( a, a ), r, q );
+        vst1_u16( x, vshrn_n_u32( r, 16 ) );
+    }
+};
+
+//------------------------------------------------------------------------------
+struct Neon_d {
+    typedef double real_t;
+    typedef float64x2_t vec_t;
+    static const int width = 2;
+
+    static vec_t load( real_t const* x ) { return vld1q_f64( x ); }
+    static void store( real_t* x, vec_t a ) { vst1q_f64( x, a ); }
+    static vec_t set1( real_t s ) { return vdupq_n_f64( s ); }
+    static vec_t alternate( real_t e, real_t o )
+    {
+        real_t v[ width ] = { e, o };
+        return vld1q_f64( v );
+    }
+    static vec_t add( vec_t a, vec_t b ) { return vaddq_f64( a, b ); }
+    static vec_t mul( vec_t a, vec_t b ) { return vmulq_f64( a, b ); }
+    static vec_t fmadd( vec_t a, vec_t b, vec_t c )
+        { return vfmaq_f64( c, a, b ); }
+    static vec_t abs( vec_t a ) { return vabsq_f64( a ); }
+    static vec_t max( vec_t a, vec_t b ) { return vmaxnmq_f64( a, b ); }
+    static vec_t min( vec_t a, vec_t b ) { return vminnmq_f64( a, b ); }
+    static vec_t select_lt( vec_t a, vec_t b, vec_t x, vec_t y )
+        { return vbslq_f64( vcltq_f64( a, b ), x, y ); }
+    static vec_t swap_pairs( vec_t a ) { return vextq_f64( a, a, 1 ); }
+    static real_t reduce_add( vec_t a ) { return vaddvq_f64( a ); }
+    static real_t reduce_max( vec_t a ) { return vmaxnmvq_f64( a ); }
+
+    static int first_equal( vec_t a, real_t s )
+    {
+        uint64_t mask[ width ];
+        vst1q_u64( mask, vceqq_f64( a, vdupq_n_f64( s ) ) );
+        for (int i = 0; i < width; ++i) {
+            if (mask[ i ])
+                return i;
+        }
+        return -1;
+    }
+};
+#endif  // BLAS_SIMD_NEON
+
+//------------------------------------------------------------------------------
+/// @return kernels for isa, or nullptr if either the CPU or
+/// the library build doesn't support it.
+Level1Kernels const* kernels_for( Simd isa )
+{
+    switch (isa) {
+        case Simd::AVX512:
+            #ifdef BLAS_SIMD_X86
+                if (__builtin_cpu_supports( "avx512f" ))
+                    return avx512_kernels();
+            #endif
+            return nullptr;
+
+        case Simd::AVX2:
+            #ifdef BLAS_SIMD_X86
+                if (__builtin_cpu_supports( "avx2" )
+                    && __builtin_cpu_supports( "fma" )
+                    && __builtin_cpu_supports( "f16c" ))
+                    return avx2_kernels();
+            #endif
+            return nullptr;
+
+        case Simd::NEON:
+            #ifdef BLAS_SIMD_NEON
+                return make_kernels< Neon_s, Neon_d >();
+            #else
+                return nullptr;
+            #endif
+
+        case Simd::Portable:
+            return make_kernels< Portable<float>, Portable<double> >();
+    }
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------
+struct Selection {
+    Simd isa;
+    Level1Kernels const* kernels;
+};
+
+/// Selects isa, or the next supported one after it in order of preference.
+Selection select( Simd isa )
+{
+    const Simd order[] = { Simd::AVX512, Simd::AVX2, Simd::NEON,
+                           Simd::Portable };
+    bool found = false;
+    for (Simd s : order) {
+        found = found || (s == isa);
+        if (found) {
+            Level1Kernels const* kernels = kernels_for( s );
+            if (kernels)
+                return { s, kernels };
+        }
+    }
+    return { Simd::Portable, kernels_for( Simd::Portable ) };
+}
+
+//------------------------------------------------------------------------------
+/// Current selection, initially the best supported.
+Selection& current()
+{
+    static Selection selection = select( Simd::AVX512 );
+    return selection;
+}
+
+//------------------------------------------------------------------------------
+inline Level1Kernels const& kernels()
+{
+    return *current().kernels;
+}
+
+}  // namespace
+}  // namespace simd
+
+//------------------------------------------------------------------------------
+Simd simd_isa()
+{
+    return simd::current().isa;
+}
+
+//------------------------------------------------------------------------------
+Simd set_simd_isa( Simd isa )
+{
+    simd::current() = simd::select( isa );
+    return simd::current().isa;
+}
+
+// =============================================================================
+// Overloads called by the template routines.
+// std::complex<T> arrays are interleaved T arrays, per the C++ standard.
+
+//------------------------------------------------------------------------------
+void axpy_unit( int64_t n, float alpha,
+                float const* x, float* y )
+{
+    simd::kernels().saxpy( n, alpha, x, y );
+}
+
+void axpy_unit( int64_t n, double alpha,
+                double const* x, double* y )
+{
+    simd::kernels().daxpy( n, alpha, x, y );
+}
+
+void axpy_unit( int64_t n, std::complex<float> alpha,
+                std::complex<float> const* x, std::complex<float>* y )
+{
+    simd::kernels().caxpy( n, real( alpha ), imag( alpha ),
+                           (float const*) x, (float*) y );
+}
+
+void axpy_unit( int64_t n, std::complex<double> alpha,
+                std::complex<double> const* x, std::complex<double>* y )
+{
+    simd::kernels().zaxpy( n, real( alpha ), imag( alpha ),
+                           (double const*) x, (double*) y );
+}
+
+//------------------------------------------------------------------------------
+void scal_unit( int64_t n, float alpha, float* x )
+{
+    simd::kernels().sscal( n, alpha, x );
+}
+
+void scal_unit( int64_t n, double alpha, double* x )
+{
+    simd::kernels().dscal( n, alpha, x );
+}
+
+void scal_unit( int64_t n, std::complex<float> alpha,
+                std::complex<float>* x )
+{
+    simd::kernels().cscal( n, real( alpha ), imag( alpha ), (float*) x );
+}
+
+void scal_unit( int64_t n, std::complex<double> alpha,
+                std::complex<double>* x )
+{
+    simd::kernels().zscal( n, real( alpha ), imag( alpha ), (double*) x );
+}
+
+//------------------------------------------------------------------------------
+float dot_unit( int64_t n, float const* x, float const* y )
+{
+    return simd::kernels().sdot( n, x, y );
+}
+
+double dot_unit( int64_t n, double const* x, double const* y )
+{
+    return simd::kernels().ddot( n, x, y );
+}
+
+std::complex<float> dot_unit(
+    int64_t n, std::complex<float> const* x, std::complex<float> const* y )
+{
+    float result[ 2 ];
+    simd::kernels().cdot( n, (float const*) x, (float const*) y,
+                          true, result );
+    return std::complex<float>( result[ 0 ], result[ 1 ] );
+}
+
+std::complex<double> dot_unit(
+    int64_t n, std::complex<double> const* x, std::complex<double> const* y )
+{
+    double result[ 2 ];
+    simd::kernels().zdot( n, (double const*) x, (double const*) y,
+                          true, result );
+    return std::complex<double>( result[ 0 ], result[ 1 ] );
+}
+
+//------------------------------------------------------------------------------
+float dotu_unit( int64_t n, float const* x, float const* y )
+{
+    return simd::kernels().sdot( n, x, y );
+}
+
+double dotu_unit( int64_t n, double const* x, double const* y )
+{
+    return simd::kernels().ddot( n, x, y );
+}
+
+std::complex<float> dotu_unit(
+    int64_t n, std::complex<float> const* x, std::complex<float> const* y )
+{
+    float result[ 2 ];
+    simd::kernels().cdot( n, (float const*) x, (float const*) y,
+                          false, result );
+    return std::complex<float>( result[ 0 ], result[ 1 ] );
+}
+
+std::complex<double> dotu_unit(
+    int64_t n, std::complex<double> const* x, std::complex<double> const* y )
+{
+    double result[ 2 ];
+    simd::kernels().zdot( n, (double const*) x, (double const*) y,
+                          false, result );
+    return std::complex<double>( result[ 0 ], result[ 1 ] );
+}
+
+//------------------------------------------------------------------------------
+// For complex, |Re| + |Im| summed over n elements = sum over 2n reals.
+float asum_unit( int64_t n, float const* x )
+{
+    return simd::kernels().sasum( n, x );
+}
+
+double asum_unit( int64_t n, double const* x )
+{
+    return simd::kernels().dasum( n, x );
+}
+
+float asum_unit( int64_t n, std::complex<float> const* x )
+{
+    return simd::kernels().sasum( 2*n, (float const*) x );
+}
+
+double asum_unit( int64_t n, std::complex<double> const* x )
+{
+    return simd::kernels().dasum( 2*n, (double const*) x );
+}
+
+//------------------------------------------------------------------------------
+// For complex, sum of squares over n elements = sum over 2n reals.
+// Uses the same scaling constants and final combination as the template.
+template <typename real_t>
+real_t nrm2_blue(
+    int64_t n, real_t const* x,
+    void (*sums_kernel)( int64_t, real_t const*, real_t const*, real_t* ) )
+{
+    auto const& s = Nrm2Scaling< real_t >::get();
+    real_t scaling[ 4 ] = { s.tsml, s.tbig, s.ssml, s.sbig };
+    real_t sums[ 3 ];
+    sums_kernel( n, x, scaling, sums );
+    return nrm2_combine( sums[ 0 ], sums[ 1 ], sums[ 2 ], s );
+}
+
+float nrm2_unit( int64_t n, float const* x )
+{
+    return nrm2_blue( n, x, simd::kernels().snrm2_sums );
+}
+
+double nrm2_unit( int64_t n, double const* x )
+{
+    return nrm2_blue( n, x, simd::kernels().dnrm2_sums );
+}
+
+float nrm2_unit( int64_t n, std::complex<float> const* x )
+{
+    return nrm2_blue( 2*n, (float const*) x, simd::kernels().snrm2_sums );
+}
+
+double nrm2_unit( int64_t n, std::complex<double> const* x )
+{
+    return nrm2_blue( 2*n, (double const*) x, simd::kernels().dnrm2_sums );
+}
+
+//------------------------------------------------------------------------------
+int64_t iamax_unit( int64_t n, float const* x )
+{
+    return simd::kernels().isamax( n, x );
+}
+
+int64_t iamax_unit( int64_t n, double const* x )
+{
+    return simd::kernels().idamax( n, x );
+}
+
+int64_t iamax_unit( int64_t n, std::complex<float> const* x )
+{
+    return simd::kernels().icamax( n, (float const*) x );
+}
+
+int64_t iamax_unit( int64_t n, std::complex<double> const* x )
+{
+    return simd::kernels().izamax( n, (double const*) x );
+}
+
+//------------------------------------------------------------------------------
+// float16 and bfloat16 hold just their bits, so arrays are uint16_t arrays.
+void convert_unit( int64_t n, float16 const* x, float* y )
+{
+    simd::kernels().f16_to_s( n, (uint16_t const*) x, y );
+}
+
+void convert_unit( int64_t n, bfloat16 const* x, float* y )
+{
+    simd::kernels().bf16_to_s( n, (uint16_t const*) x, y );
+}
+
+void convert_unit( int64_t n, float const* x, float16* y )
+{
+    simd::kernels().s_to_f16( n, x, (uint16_t*) y );
+}
+
+void convert_unit( int64_t n, float const* x, bfloat16* y )
+{
+    simd::kernels().s_to_bf16( n, x, (uint16_t*) y );
+}
+
+}  // namespace internal
+}  // namespace blas
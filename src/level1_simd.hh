@@ -0,0 +1,533 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_LEVEL1_SIMD_HH
+#define BLAS_LEVEL1_SIMD_HH
+
+// Generic unit-stride Level 1 kernels, written in terms of a vector traits
+// class V. This header is included in one translation unit per instruction
+// set, each compiled with its own flags (e.g., -mavx2 -mfma).
+//
+// Because those flags apply to the whole translation unit, any inline
+// function it emits out-of-line could be picked by the linker for other
+// translation units and run on a CPU without that instruction set.
+// Hence this header and the per-ISA files use only intrinsics (which are
+// always inlined), builtin types, and functions with internal linkage;
+// they do not include <complex>, <cmath>, or BLAS++ headers.
+// Complex vectors are passed as interleaved (re, im) real arrays.
+//
+// Traits class V provides, for real_t = float or double:
+//     typedef real_t; typedef vec_t; static const int width (even);
+//     load( real_t const* ), store( real_t*, vec_t ), set1( real_t ),
+//     alternate( even, odd ) -> [ even, odd, even, odd, ... ],
+//     add, mul, fmadd( a, b, c ) = a*b + c, abs,
+//     max( a, b ), min( a, b ), which return b if either is NaN,
+//     select_lt( a, b, x, y ) = (a < b ? x : y) per lane, false for NaN,
+//     swap_pairs( a ) -> [ a1, a0, a3, a2, ... ],
+//     reduce_add( a ), reduce_max( a ) (ignoring NaN),
+//     first_equal( a, s ) -> first lane equal to s, or -1.
+// For real_t = float, V also provides conversions of width 16-bit values:
+//     load_f16( uint16_t const* ), store_f16( uint16_t*, vec_t ),
+//     load_bf16( uint16_t const* ), store_bf16( uint16_t*, vec_t ),
+// with IEEE half and bfloat16 formats, rounding to nearest even.
+
+#include <cstdint>
+
+namespace blas {
+namespace internal {
+namespace simd {
+
+//------------------------------------------------------------------------------
+/// Table of kernels for one instruction set. Complex routines take
+/// interleaved real arrays; n is the number of complex elements.
+struct Level1Kernels {
+    void (*saxpy)( int64_t n, float  alpha, float  const* x, float*  y );
+    void (*daxpy)( int64_t n, double alpha, double const* x, double* y );
+    void (*caxpy)( int64_t n, float  alpha_re, float  alpha_im,
+                   float  const* x, float*  y );
+    void (*zaxpy)( int64_t n, double alpha_re, double alpha_im,
+                   double const* x, double* y );
+
+    void (*sscal)( int64_t n, float  alpha, float*  x );
+    void (*dscal)( int64_t n, double alpha, double* x );
+    void (*cscal)( int64_t n, float  alpha_re, float  alpha_im, float*  x );
+    void (*zscal)( int64_t n, double alpha_re, double alpha_im, double* x );
+
+    float  (*sdot)( int64_t n, float  const* x, float  const* y );
+    double (*ddot)( int64_t n, double const* x, double const* y );
+    // result[ 0:1 ] = (re, im) of x^H y if conj, else x^T y
+    void (*cdot)( int64_t n, float  const* x, float  const* y,
+                  bool conj, float*  result );
+    void (*zdot)( int64_t n, double const* x, double const* y,
+                  bool conj, double* result );
+
+    // sum of |x_i| over n real elements
+    float  (*sasum)( int64_t n, float  const* x );
+    double (*dasum)( int64_t n, double const* x );
+
+    // Blue's sums of squares over n real elements, for nrm2.
+    // scaling = { tsml, tbig, ssml, sbig }; sums = { abig, amed, asml }.
+    void (*snrm2_sums)( int64_t n, float  const* x,
+                        float  const* scaling, float*  sums );
+    void (*dnrm2_sums)( int64_t n, double const* x,
+                        double const* scaling, double* sums );
+
+    int64_t (*isamax)( int64_t n, float  const* x );
+    int64_t (*idamax)( int64_t n, double const* x );
+    int64_t (*icamax)( int64_t n, float  const* x );
+    int64_t (*izamax)( int64_t n, double const* x );
+
+    // conversions of n elements between float and 16-bit formats,
+    // IEEE half (f16) and bfloat16 (bf16)
+    void (*f16_to_s)( int64_t n, uint16_t const* x, float* y );
+    void (*bf16_to_s)( int64_t n, uint16_t const* x, float* y );
+    void (*s_to_f16)( int64_t n, float const* x, uint16_t* y );
+    void (*s_to_bf16)( int64_t n, float const* x, uint16_t* y );
+};
+
+// Defined in the per-ISA translation units; return nullptr if the
+// library was compiled without support for that instruction set.
+Level1Kernels const* avx2_kernels();
+Level1Kernels const* avx512_kernels();
+
+namespace {
+
+//------------------------------------------------------------------------------
+template <typename real_t>
+inline real_t abs_( real_t x )
+{
+    return (x < 0 ? -x : x);
+}
+
+//==============================================================================
+// Real kernels.
+
+//------------------------------------------------------------------------------
+template <typename V>
+void axpy( int64_t n, typename V::real_t alpha,
+           typename V::real_t const* x, typename V::real_t* y )
+{
+    typedef typename V::vec_t vec_t;
+    const int w = V::width;
+
+    vec_t a = V::set1( alpha );
+    int64_t i = 0;
+    for (; i + 2*w <= n; i += 2*w) {
+        vec_t y0 = V::fmadd( a, V::load( &x[ i     ] ), V::load( &y[ i     ] ) );
+        vec_t y1 = V::fmadd( a, V::load( &x[ i + w ] ), V::load( &y[ i + w ] ) );
+        V::store( &y[ i     ], y0 );
+        V::store( &y[ i + w ], y1 );
+    }
+    for (; i < n; ++i)
+        y[ i ] += alpha * x[ i ];
+}
+
+//------------------------------------------------------------------------------
+template <typename V>
+void scal( int64_t n, typename V::real_t alpha, typename V::real_t* x )
+{
+    typedef typename V::vec_t vec_t;
+    const int w = V::width;
+
+    vec_t a = V::set1( alpha );
+    int64_t i = 0;
+    for (; i + 2*w <= n; i += 2*w) {
+        vec_t x0 = V::mul( a, V::load( &x[ i     ] ) );
+        vec_t x1 = V::mul( a, V::load( &x[ i + w ] ) );
+        V::store( &x[ i     ], x0 );
+        V::store( &x[ i + w ], x1 );
+    }
+    for (; i < n; ++i)
+        x[ i ] *= alpha;
+}
+
+//------------------------------------------------------------------------------
+/// Four independent accumulators hide the add latency.
+template <typename V>
+typename V::real_t dot(
+    int64_t n, typename V::real_t const* x, typename V::real_t const* y )
+{
+    typedef typename V::real_t real_t;
+    typedef typename V::vec_t vec_t;
+    const int w = V::width;
+
+    vec_t s0 = V::set1( 0 ), s1 = s0, s2 = s0, s3 = s0;
+    int64_t i = 0;
+    for (; i + 4*w <= n; i += 4*w) {
+        s0 = V::fmadd( V::load( &x[ i       ] ), V::load( &y[ i       ] ), s0 );
+        s1 = V::fmadd( V::load( &x[ i +   w ] ), V::load( &y[ i +   w ] ), s1 );
+        s2 = V::fmadd( V::load( &x[ i + 2*w ] ), V::load( &y[ i + 2*w ] ), s2 );
+        s3 = V::fmadd( V::load( &x[ i + 3*w ] ), V::load( &y[ i + 3*w ] ), s3 );
+    }
+    for (; i + w <= n; i += w)
+        s0 = V::fmadd( V::load( &x[ i ] ), V::load( &y[ i ] ), s0 );
+    real_t result = V::reduce_add( V::add( V::add( s0, s1 ),
+                                           V::add( s2, s3 ) ) );
+    for (; i < n; ++i)
+        result += x[ i ] * y[ i ];
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template <typename V>
+typename V::real_t asum( int64_t n, typename V::real_t const* x )
+{
+    typedef typename V::real_t real_t;
+    typedef typename V::vec_t vec_t;
+    const int w = V::width;
+
+    vec_t s0 = V::set1( 0 ), s1 = s0, s2 = s0, s3 = s0;
+    int64_t i = 0;
+    for (; i + 4*w <= n; i += 4*w) {
+        s0 = V::add( V::abs( V::load( &x[ i       ] ) ), s0 );
+        s1 = V::add( V::abs( V::load( &x[ i +   w ] ) ), s1 );
+        s2 = V::add( V::abs( V::load( &x[ i + 2*w ] ) ), s2 );
+        s3 = V::add( V::abs( V::load( &x[ i + 3*w ] ) ), s3 );
+    }
+    for (; i + w <= n; i += w)
+        s0 = V::add( V::abs( V::load( &x[ i ] ) ), s0 );
+    real_t result = V::reduce_add( V::add( V::add( s0, s1 ),
+                                           V::add( s2, s3 ) ) );
+    for (; i < n; ++i)
+        result += abs_( x[ i ] );
+    return result;
+}
+
+//------------------------------------------------------------------------------
+/// Blue's algorithm: accumulates (sbig x)^2 for |x| > tbig,
+/// (ssml x)^2 for |x| < tsml, and x^2 otherwise, including NaN.
+///
+/// Each L1-sized block is first summed unscaled, tracking min and max |x|,
+/// which costs little more than a plain sum of squares. Only if the block
+/// has elements outside [tsml, tbig] (including zeros) is it summed again,
+/// from L1 cache, with the branch-free three-way split. Either way, x is
+/// read from memory once.
+template <typename V>
+void nrm2_sums( int64_t n, typename V::real_t const* x,
+                typename V::real_t const* scaling, typename V::real_t* sums )
+{
+    typedef typename V::real_t real_t;
+    typedef typename V::vec_t vec_t;
+    const int w = V::width;
+    const int64_t block = 1024;  // multiple of 2*w
+
+    const real_t tsml = scaling[ 0 ], tbig = scaling[ 1 ];
+    const real_t ssml = scaling[ 2 ], sbig = scaling[ 3 ];
+    const vec_t vtsml = V::set1( tsml ), vtbig = V::set1( tbig );
+    const vec_t vssml = V::set1( ssml ), vsbig = V::set1( sbig );
+    const vec_t zero = V::set1( 0 );
+
+    vec_t big0 = zero, big1 = zero, med0 = zero, med1 = zero;
+    vec_t sml0 = zero, sml1 = zero;
+    const int64_t nvec = n - n % (2*w);  // elements done with vectors
+    for (int64_t i = 0; i < nvec; i += block) {
+        int64_t iend = (i + block < nvec ? i + block : nvec);
+
+        // fast path: unscaled
+        vec_t s0 = zero, s1 = zero;
+        vec_t amax = zero, amin = vtbig;
+        for (int64_t j = i; j < iend; j += 2*w) {
+            vec_t x0 = V::load( &x[ j     ] );
+            vec_t x1 = V::load( &x[ j + w ] );
+            s0 = V::fmadd( x0, x0, s0 );
+            s1 = V::fmadd( x1, x1, s1 );
+            vec_t a0 = V::abs( x0 ), a1 = V::abs( x1 );
+            amax = V::max( V::max( a0, a1 ), amax );
+            amin = V::min( V::min( a0, a1 ), amin );
+        }
+        // max( -amin ) = -min( amin ); NaN were skipped, but are in s0, s1
+        if (V::reduce_max( amax ) <= tbig
+            && -V::reduce_max( V::mul( V::set1( -1 ), amin ) ) >= tsml) {
+            med0 = V::add( med0, s0 );
+            med1 = V::add( med1, s1 );
+            continue;
+        }
+
+        // slow path: three-way split
+        for (int64_t j = i; j < iend; j += w) {
+            vec_t xv = V::load( &x[ j ] );
+            vec_t ax = V::abs( xv );
+            vec_t xb = V::mul( V::select_lt( vtbig, ax, xv, zero ), vsbig );
+            vec_t xs = V::mul( V::select_lt( ax, vtsml, xv, zero ), vssml );
+            vec_t xm = V::select_lt( vtbig, ax, zero,
+                       V::select_lt( ax, vtsml, zero, xv ) );
+            big0 = V::fmadd( xb, xb, big0 );
+            med0 = V::fmadd( xm, xm, med0 );
+            sml0 = V::fmadd( xs, xs, sml0 );
+        }
+    }
+    real_t abig = V::reduce_add( V::add( big0, big1 ) );
+    real_t amed = V::reduce_add( V::add( med0, med1 ) );
+    real_t asml = V::reduce_add( V::add( sml0, sml1 ) );
+    for (int64_t i = nvec; i < n; ++i) {
+        real_t xi = x[ i ];
+        real_t ax = abs_( xi );
+        if (ax > tbig) {
+            ax *= sbig;
+            abig += ax*ax;
+        }
+        else if (ax < tsml) {
+            ax *= ssml;
+            asml += ax*ax;
+        }
+        else {
+            amed += xi*xi;
+        }
+    }
+    sums[ 0 ] = abig;
+    sums[ 1 ] = amed;
+    sums[ 2 ] = asml;
+}
+
+//------------------------------------------------------------------------------
+/// Index of first max |x_i| for real x, or of first max |Re(x_i)| + |Im(x_i)|
+/// for complex x, ignoring NaN, as in the generic template.
+/// Two passes: a vectorized max, then a vectorized search for its first
+/// occurrence, which usually stops early. This is exact (no index
+/// arithmetic in floating point) and reads on average 1.5 n elements.
+template <typename V, bool is_complex>
+int64_t iamax( int64_t n, typename V::real_t const* x )
+{
+    typedef typename V::real_t real_t;
+    typedef typename V::vec_t vec_t;
+    const int w = V::width;
+    const int ps = (is_complex ? 2 : 1);  // reals per element
+    const int64_t len = n * ps;
+
+    // abs1 of each element; for complex, in both lanes of each pair
+    struct {
+        vec_t operator()( vec_t a )
+        {
+            a = V::abs( a );
+            return (is_complex ? V::add( a, V::swap_pairs( a ) ) : a);
+        }
+        real_t operator()( real_t const* xi )
+        {
+            return (is_complex ? abs_( xi[ 0 ] ) + abs_( xi[ 1 ] )
+                               : abs_( xi[ 0 ] ));
+        }
+    } abs1;
+
+    // pass 1: max
+    vec_t m0 = V::set1( -1 ), m1 = m0;
+    int64_t i = 0;
+    for (; i + 2*w <= len; i += 2*w) {
+        // x first, so NaN in x are ignored
+        m0 = V::max( abs1( V::load( &x[ i     ] ) ), m0 );
+        m1 = V::max( abs1( V::load( &x[ i + w ] ) ), m1 );
+    }
+    real_t amax = V::reduce_max( V::max( m0, m1 ) );
+    for (; i < len; i += ps) {
+        real_t tmp = abs1( &x[ i ] );
+        if (tmp > amax)
+            amax = tmp;
+    }
+    if (amax < 0)
+        return -1;  // n == 0 or all NaN
+
+    // pass 2: first occurrence
+    for (i = 0; i + w <= len; i += w) {
+        int lane = V::first_equal( abs1( V::load( &x[ i ] ) ), amax );
+        if (lane >= 0)
+            return (i + lane) / ps;
+    }
+    for (; i < len; i += ps) {
+        if (abs1( &x[ i ] ) == amax)
+            return i / ps;
+    }
+    return -1;  // not reached
+}
+
+//==============================================================================
+// Complex kernels, on interleaved (re, im) data.
+// For complex a and x, a x = ar [ xr, xi ] + ai [ -xi, xr ]
+//                          = ar x + [ -1, 1 ] .* ai swap_pairs( x ).
+
+//------------------------------------------------------------------------------
+template <typename V>
+void axpy_complex( int64_t n, typename V::real_t alpha_re,
+                   typename V::real_t alpha_im,
+                   typename V::real_t const* x, typename V::real_t* y )
+{
+    typedef typename V::vec_t vec_t;
+    const int w = V::width;
+    const int64_t len = 2*n;
+
+    vec_t ar = V::set1( alpha_re );
+    vec_t ai = V::mul( V::alternate( -1, 1 ), V::set1( alpha_im ) );
+    int64_t i = 0;
+    for (; i + w <= len; i += w) {
+        vec_t xv = V::load( &x[ i ] );
+        vec_t yv = V::fmadd( ar, xv, V::load( &y[ i ] ) );
+        yv = V::fmadd( ai, V::swap_pairs( xv ), yv );
+        V::store( &y[ i ], yv );
+    }
+    for (; i < len; i += 2) {
+        auto xr = x[ i ], xi = x[ i + 1 ];
+        y[ i     ] += alpha_re*xr - alpha_im*xi;
+        y[ i + 1 ] += alpha_re*xi + alpha_im*xr;
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename V>
+void scal_complex( int64_t n, typename V::real_t alpha_re,
+                   typename V::real_t alpha_im, typename V::real_t* x )
+{
+    typedef typename V::vec_t vec_t;
+    const int w = V::width;
+    const int64_t len = 2*n;
+
+    vec_t ar = V::set1( alpha_re );
+    vec_t ai = V::mul( V::alternate( -1, 1 ), V::set1( alpha_im ) );
+    int64_t i = 0;
+    for (; i + w <= len; i += w) {
+        vec_t xv = V::load( &x[ i ] );
+        V::store( &x[ i ], V::fmadd( ai, V::swap_pairs( xv ),
+                                     V::mul( ar, xv ) ) );
+    }
+    for (; i < len; i += 2) {
+        auto xr = x[ i ], xi = x[ i + 1 ];
+        x[ i     ] = alpha_re*xr - alpha_im*xi;
+        x[ i + 1 ] = alpha_re*xi + alpha_im*xr;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Accumulates s = x .* y = [ xr yr, xi yi ] and t = x .* swap_pairs( y )
+/// = [ xr yi, xi yr ]. Then
+///     x^T y = (sum xr yr - xi yi) + (sum xr yi + xi yr) i,
+///     x^H y = (sum xr yr + xi yi) + (sum xr yi - xi yr) i.
+template <typename V>
+void dot_complex( int64_t n, typename V::real_t const* x,
+                  typename V::real_t const* y, bool conj,
+                  typename V::real_t* result )
+{
+    typedef typename V::real_t real_t;
+    typedef typename V::vec_t vec_t;
+    const int w = V::width;
+    const int64_t len = 2*n;
+
+    vec_t s0 = V::set1( 0 ), s1 = s0, t0 = s0, t1 = s0;
+    int64_t i = 0;
+    for (; i + 2*w <= len; i += 2*w) {
+        vec_t x0 = V::load( &x[ i     ] ), y0 = V::load( &y[ i     ] );
+        vec_t x1 = V::load( &x[ i + w ] ), y1 = V::load( &y[ i + w ] );
+        s0 = V::fmadd( x0, y0, s0 );
+        s1 = V::fmadd( x1, y1, s1 );
+        t0 = V::fmadd( x0, V::swap_pairs( y0 ), t0 );
+        t1 = V::fmadd( x1, V::swap_pairs( y1 ), t1 );
+    }
+    for (; i + w <= len; i += w) {
+        vec_t x0 = V::load( &x[ i ] ), y0 = V::load( &y[ i ] );
+        s0 = V::fmadd( x0, y0, s0 );
+        t0 = V::fmadd( x0, V::swap_pairs( y0 ), t0 );
+    }
+    vec_t s = V::add( s0, s1 );
+    vec_t t = V::add( t0, t1 );
+    vec_t pm = V::alternate( 1, -1 );
+    real_t re, im;
+    if (conj) {
+        re = V::reduce_add( s );
+        im = V::reduce_add( V::mul( pm, t ) );
+    }
+    else {
+        re = V::reduce_add( V::mul( pm, s ) );
+        im = V::reduce_add( t );
+    }
+    for (; i < len; i += 2) {
+        real_t xr = x[ i ], xi = x[ i + 1 ];
+        real_t yr = y[ i ], yi = y[ i + 1 ];
+        if (conj) {
+            re += xr*yr + xi*yi;
+            im += xr*yi - xi*yr;
+        }
+        else {
+            re += xr*yr - xi*yi;
+            im += xr*yi + xi*yr;
+        }
+    }
+    result[ 0 ] = re;
+    result[ 1 ] = im;
+}
+
+//==============================================================================
+// Conversions between float and 16-bit formats.
+
+//------------------------------------------------------------------------------
+/// y = float( x ), for 16-bit x in bfloat16 format if bf16, else IEEE half.
+/// The tail goes through a zero-padded vector.
+template <typename V, bool bf16>
+void widen16( int64_t n, uint16_t const* x, float* y )
+{
+    const int w = V::width;
+
+    int64_t i = 0;
+    for (; i + w <= n; i += w)
+        V::store( &y[ i ], bf16 ? V::load_bf16( &x[ i ] )
+                                : V::load_f16(  &x[ i ] ) );
+    if (i < n) {
+        uint16_t xt[ w ] = {};
+        float yt[ w ];
+        for (int j = 0; j < n - i; ++j)
+            xt[ j ] = x[ i + j ];
+        V::store( yt, bf16 ? V::load_bf16( xt ) : V::load_f16( xt ) );
+        for (int j = 0; j < n - i; ++j)
+            y[ i + j ] = yt[ j ];
+    }
+}
+
+//------------------------------------------------------------------------------
+/// y = x rounded to 16 bits, in bfloat16 format if bf16, else IEEE half.
+template <typename V, bool bf16>
+void narrow16( int64_t n, float const* x, uint16_t* y )
+{
+    const int w = V::width;
+
+    int64_t i = 0;
+    for (; i + w <= n; i += w) {
+        if (bf16)
+            V::store_bf16( &y[ i ], V::load( &x[ i ] ) );
+        else
+            V::store_f16( &y[ i ], V::load( &x[ i ] ) );
+    }
+    if (i < n) {
+        float xt[ w ] = {};
+        uint16_t yt[ w ];
+        for (int j = 0; j < n - i; ++j)
+            xt[ j ] = x[ i + j ];
+        if (bf16)
+            V::store_bf16( yt, V::load( xt ) );
+        else
+            V::store_f16( yt, V::load( xt ) );
+        for (int j = 0; j < n - i; ++j)
+            y[ i + j ] = yt[ j ];
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return table of kernels for single (Vs) and double (Vd) traits.
+template <typename Vs, typename Vd>
+Level1Kernels const* make_kernels()
+{
+    static const Level1Kernels kernels = {
+        axpy<Vs>, axpy<Vd>, axpy_complex<Vs>, axpy_complex<Vd>,
+        scal<Vs>, scal<Vd>, scal_complex<Vs>, scal_complex<Vd>,
+        dot<Vs>,  dot<Vd>,  dot_complex<Vs>,  dot_complex<Vd>,
+        asum<Vs>, asum<Vd>, nrm2_sums<Vs>, nrm2_sums<Vd>,
+        iamax<Vs, false>, iamax<Vd, false>, iamax<Vs, true>, iamax<Vd, true>,
+        widen16<Vs, false>, widen16<Vs, true>,
+        narrow16<Vs, false>, narrow16<Vs, true>,
+    };
+    return &kernels;
+}
+
+}  // namespace
+
+}  // namespace simd
+}  // namespace internal
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_LEVEL1_SIMD_HH
@@ -0,0 +1,184 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// AVX2 Level 1 kernels. The build compiles this file with -mavx2 -mfma -mf16c
+// when the compiler accepts them; see level1_simd.hh for restrictions.
+
+#include "level1_simd.hh"
+
+#if defined(__AVX2__) && defined(__FMA__) && defined(__F16C__)
+
+#include <immintrin.h>
+
+namespace blas {
+namespace internal {
+namespace simd {
+namespace {
+
+//------------------------------------------------------------------------------
+struct Avx2_s {
+    typedef float real_t;
+    typedef __m256 vec_t;
+    static const int width = 8;
+
+    static vec_t load( real_t const* x ) { return _mm256_loadu_ps( x ); }
+    static void store( real_t* x, vec_t a ) { _mm256_storeu_ps( x, a ); }
+    static vec_t set1( real_t s ) { return _mm256_set1_ps( s ); }
+    static vec_t alternate( real_t e, real_t o )
+        { return _mm256_setr_ps( e, o, e, o, e, o, e, o ); }
+    static vec_t add( vec_t a, vec_t b ) { return _mm256_add_ps( a, b ); }
+    static vec_t mul( vec_t a, vec_t b ) { return _mm256_mul_ps( a, b ); }
+    static vec_t fmadd( vec_t a, vec_t b, vec_t c )
+        { return _mm256_fmadd_ps( a, b, c ); }
+    static vec_t abs( vec_t a )
+        { return _mm256_andnot_ps( _mm256_set1_ps( -0.0f ), a ); }
+    static vec_t max( vec_t a, vec_t b ) { return _mm256_max_ps( a, b ); }
+    static vec_t min( vec_t a, vec_t b ) { return _mm256_min_ps( a, b ); }
+    static vec_t select_lt( vec_t a, vec_t b, vec_t x, vec_t y )
+        { return _mm256_blendv_ps( y, x, _mm256_cmp_ps( a, b, _CMP_LT_OQ ) ); }
+    static vec_t swap_pairs( vec_t a )
+        { return _mm256_permute_ps( a, 0xB1 ); }
+
+    static real_t reduce_add( vec_t a )
+    {
+        __m128 s = _mm_add_ps( _mm256_castps256_ps128( a ),
+                               _mm256_extractf128_ps( a, 1 ) );
+        s = _mm_add_ps( s, _mm_movehl_ps( s, s ) );
+        s = _mm_add_ss( s, _mm_shuffle_ps( s, s, 1 ) );
+        return _mm_cvtss_f32( s );
+    }
+
+    static real_t reduce_max( vec_t a )
+    {
+        alignas(32) real_t v[ width ];
+        _mm256_store_ps( v, a );
+        real_t m = v[ 0 ];
+        for (int i = 1; i < width; ++i)
+            m = (v[ i ] > m ? v[ i ] : m);
+        return m;
+    }
+
+    static int first_equal( vec_t a, real_t s )
+    {
+        int mask = _mm256_movemask_ps(
+            _mm256_cmp_ps( a, _mm256_set1_ps( s ), _CMP_EQ_OQ ) );
+        return (mask ? __builtin_ctz( mask ) : -1);
+    }
+
+    static vec_t load_f16( uint16_t const* x )
+        { return _mm256_cvtph_ps( _mm_loadu_si128( (__m128i const*) x ) ); }
+
+    static void store_f16( uint16_t* x, vec_t a )
+    {
+        _mm_storeu_si128( (__m128i*) x,
+                          _mm256_cvtps_ph( a, _MM_FROUND_TO_NEAREST_INT ) );
+    }
+
+    static vec_t load_bf16( uint16_t const* x )
+    {
+        __m256i u = _mm256_cvtepu16_epi32(
+            _mm_loadu_si128( (__m128i const*) x ) );
+        return _mm256_castsi256_ps( _mm256_slli_epi32( u, 16 ) );
+    }
+
+    /// Rounds to nearest even by adding 0x7fff + lsb; NaN is made quiet
+    /// instead, so rounding can't carry it to Inf.
+    static void store_bf16( uint16_t* x, vec_t a )
+    {
+        __m256i u = _mm256_castps_si256( a );
+        __m256i lsb = _mm256_and_si256( _mm256_srli_epi32( u, 16 ),
+                                        _mm256_set1_epi32( 1 ) );
+        __m256i r = _mm256_add_epi32(
+            u, _mm256_add_epi32( lsb, _mm256_set1_epi32( 0x7fff ) ) );
+        __m256i q = _mm256_or_si256( u, _mm256_set1_epi32( 0x00400000 ) );
+        __m256 nan = _mm256_cmp_ps( a, a, _CMP_UNORD_Q );
+        r = _mm256_castps_si256( _mm256_blendv_ps(
+            _mm256_castsi256_ps( r ), _mm256_castsi256_ps( q ), nan ) );
+        r = _mm256_srli_epi32( r, 16 );
+        // packus works within 128-bit lanes, so pack the two halves
+        _mm_storeu_si128( (__m128i*) x,
+                          _mm_packus_epi32( _mm256_castsi256_si128( r ),
+                                            _mm256_extracti128_si256( r, 1 ) ) );
+    }
+};
+
+//------------------------------------------------------------------------------
+struct Avx2_d {
+    typedef double real_t;
+    typedef __m256d vec_t;
+    static const int width = 4;
+
+    static vec_t load( real_t const* x ) { return _mm256_loadu_pd( x ); }
+    static void store( real_t* x, vec_t a ) { _mm256_storeu_pd( x, a ); }
+    static vec_t set1( real_t s ) { return _mm256_set1_pd( s ); }
+    static vec_t alternate( real_t e, real_t o )
+        { return _mm256_setr_pd( e, o, e, o ); }
+    static vec_t add( vec_t a, vec_t b ) { return _mm256_add_pd( a, b ); }
+    static vec_t mul( vec_t a, vec_t b ) { return _mm256_mul_pd( a, b ); }
+    static vec_t fmadd( vec_t a, vec_t b, vec_t c )
+        { return _mm256_fmadd_pd( a, b, c ); }
+    static vec_t abs( vec_t a )
+        { return _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), a ); }
+    static vec_t max( vec_t a, vec_t b ) { return _mm256_max_pd( a, b ); }
+    static vec_t min( vec_t a, vec_t b ) { return _mm256_min_pd( a, b ); }
+    static vec_t select_lt( vec_t a, vec_t b, vec_t x, vec_t y )
+        { return _mm256_blendv_pd( y, x, _mm256_cmp_pd( a, b, _CMP_LT_OQ ) ); }
+    static vec_t swap_pairs( vec_t a )
+        { return _mm256_permute_pd( a, 0x5 ); }
+
+    static real_t reduce_add( vec_t a )
+    {
+        __m128d s = _mm_add_pd( _mm256_castpd256_pd128( a ),
+                                _mm256_extractf128_pd( a, 1 ) );
+        s = _mm_add_sd( s, _mm_unpackhi_pd( s, s ) );
+        return _mm_cvtsd_f64( s );
+    }
+
+    static real_t reduce_max( vec_t a )
+    {
+        alignas(32) real_t v[ width ];
+        _mm256_store_pd( v, a );
+        real_t m = v[ 0 ];
+        for (int i = 1; i < width; ++i)
+            m = (v[ i ] > m ? v[ i ] : m);
+        return m;
+    }
+
+    static int first_equal( vec_t a, real_t s )
+    {
+        int mask = _mm256_movemask_pd(
+            _mm256_cmp_pd( a, _mm256_set1_pd( s ), _CMP_EQ_OQ ) );
+        return (mask ? __builtin_ctz( mask ) : -1);
+    }
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+Level1Kernels const* avx2_kernels()
+{
+    return make_kernels< Avx2_s, Avx2_d >();
+}
+
+}  // namespace simd
+}  // namespace internal
+}  // namespace blas
+
+#else
+
+namespace blas {
+namespace internal {
+namespace simd {
+
+Level1Kernels const* avx2_kernels()
+{
+    return nullptr;
+}
+
+}  // namespace simd
+}  // namespace internal
+}  // namespace blas
+
+#endif  // __AVX2__ && __FMA__ && __F16C__
@@ -0,0 +1,183 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// AVX-512 Level 1 kernels. The build compiles this file with -mavx512f when
+// the compiler accepts it; see level1_simd.hh for restrictions.
+
+#include "level1_simd.hh"
+
+#if defined(__AVX512F__)
+
+// GCC 12 intrinsics fill unused lanes from _mm512_undefined_ps() and
+// similar, which are defined as `__Y = __Y`; with optimization, inlining
+// them gives false-positive "'__Y' may be used uninitialized" warnings.
+#if defined(__GNUC__) && ! defined(__clang__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+    #pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) && ! defined(__clang__)
+    #pragma GCC diagnostic pop
+#endif
+
+namespace blas {
+namespace internal {
+namespace simd {
+namespace {
+
+//------------------------------------------------------------------------------
+struct Avx512_s {
+    typedef float real_t;
+    typedef __m512 vec_t;
+    static const int width = 16;
+
+    static vec_t load( real_t const* x ) { return _mm512_loadu_ps( x ); }
+    static void store( real_t* x, vec_t a ) { _mm512_storeu_ps( x, a ); }
+    static vec_t set1( real_t s ) { return _mm512_set1_ps( s ); }
+    static vec_t alternate( real_t e, real_t o )
+        { return _mm512_setr_ps( e, o, e, o, e, o, e, o,
+                                 e, o, e, o, e, o, e, o ); }
+    static vec_t add( vec_t a, vec_t b ) { return _mm512_add_ps( a, b ); }
+    static vec_t mul( vec_t a, vec_t b ) { return _mm512_mul_ps( a, b ); }
+    static vec_t fmadd( vec_t a, vec_t b, vec_t c )
+        { return _mm512_fmadd_ps( a, b, c ); }
+    static vec_t abs( vec_t a ) { return _mm512_abs_ps( a ); }
+    static vec_t max( vec_t a, vec_t b ) { return _mm512_max_ps( a, b ); }
+    static vec_t min( vec_t a, vec_t b ) { return _mm512_min_ps( a, b ); }
+    static vec_t select_lt( vec_t a, vec_t b, vec_t x, vec_t y )
+    {
+        return _mm512_mask_blend_ps(
+            _mm512_cmp_ps_mask( a, b, _CMP_LT_OQ ), y, x );
+    }
+    static vec_t swap_pairs( vec_t a )
+        { return _mm512_permute_ps( a, 0xB1 ); }
+    static real_t reduce_add( vec_t a ) { return _mm512_reduce_add_ps( a ); }
+
+    static real_t reduce_max( vec_t a )
+    {
+        alignas(64) real_t v[ width ];
+        _mm512_store_ps( v, a );
+        real_t m = v[ 0 ];
+        for (int i = 1; i < width; ++i)
+            m = (v[ i ] > m ? v[ i ] : m);
+        return m;
+    }
+
+    static int first_equal( vec_t a, real_t s )
+    {
+        unsigned mask = _mm512_cmp_ps_mask( a, _mm512_set1_ps( s ),
+                                            _CMP_EQ_OQ );
+        return (mask ? __builtin_ctz( mask ) : -1);
+    }
+
+    static vec_t load_f16( uint16_t const* x )
+        { return _mm512_cvtph_ps( _mm256_loadu_si256( (__m256i const*) x ) ); }
+
+    static void store_f16( uint16_t* x, vec_t a )
+    {
+        _mm256_storeu_si256( (__m256i*) x,
+                             _mm512_cvtps_ph( a, _MM_FROUND_TO_NEAREST_INT ) );
+    }
+
+    static vec_t load_bf16( uint16_t const* x )
+    {
+        __m512i u = _mm512_cvtepu16_epi32(
+            _mm256_loadu_si256( (__m256i const*) x ) );
+        return _mm512_castsi512_ps( _mm512_slli_epi32( u, 16 ) );
+    }
+
+    /// Rounds to nearest even by adding 0x7fff + lsb; NaN is made quiet
+    /// instead, so rounding can't carry it to Inf.
+    static void store_bf16( uint16_t* x, vec_t a )
+    {
+        __m512i u = _mm512_castps_si512( a );
+        __m512i lsb = _mm512_and_si512( _mm512_srli_epi32( u, 16 ),
+                                        _mm512_set1_epi32( 1 ) );
+        __m512i r = _mm512_add_epi32(
+            u, _mm512_add_epi32( lsb, _mm512_set1_epi32( 0x7fff ) ) );
+        __m512i q = _mm512_or_si512( u, _mm512_set1_epi32( 0x00400000 ) );
+        __mmask16 nan = _mm512_cmp_ps_mask( a, a, _CMP_UNORD_Q );
+        r = _mm512_mask_mov_epi32( r, nan, q );
+        _mm256_storeu_si256( (__m256i*) x,
+                             _mm512_cvtepi32_epi16( _mm512_srli_epi32( r, 16 ) ) );
+    }
+};
+
+//------------------------------------------------------------------------------
+struct Avx512_d {
+    typedef double real_t;
+    typedef __m512d vec_t;
+    static const int width = 8;
+
+    static vec_t load( real_t const* x ) { return _mm512_loadu_pd( x ); }
+    static void store( real_t* x, vec_t a ) { _mm512_storeu_pd( x, a ); }
+    static vec_t set1( real_t s ) { return _mm512_set1_pd( s ); }
+    static vec_t alternate( real_t e, real_t o )
+        { return _mm512_setr_pd( e, o, e, o, e, o, e, o ); }
+    static vec_t add( vec_t a, vec_t b ) { return _mm512_add_pd( a, b ); }
+    static vec_t mul( vec_t a, vec_t b ) { return _mm512_mul_pd( a, b ); }
+    static vec_t fmadd( vec_t a, vec_t b, vec_t c )
+        { return _mm512_fmadd_pd( a, b, c ); }
+    static vec_t abs( vec_t a ) { return _mm512_abs_pd( a ); }
+    static vec_t max( vec_t a, vec_t b ) { return _mm512_max_pd( a, b ); }
+    static vec_t min( vec_t a, vec_t b ) { return _mm512_min_pd( a, b ); }
+    static vec_t select_lt( vec_t a, vec_t b, vec_t x, vec_t y )
+    {
+        return _mm512_mask_blend_pd(
+            _mm512_cmp_pd_mask( a, b, _CMP_LT_OQ ), y, x );
+    }
+    static vec_t swap_pairs( vec_t a )
+        { return _mm512_permute_pd( a, 0x55 ); }
+    static real_t reduce_add( vec_t a ) { return _mm512_reduce_add_pd( a ); }
+
+    static real_t reduce_max( vec_t a )
+    {
+        alignas(64) real_t v[ width ];
+        _mm512_store_pd( v, a );
+        real_t m = v[ 0 ];
+        for (int i = 1; i < width; ++i)
+            m = (v[ i ] > m ? v[ i ] : m);
+        return m;
+    }
+
+    static int first_equal( vec_t a, real_t s )
+    {
+        unsigned mask = _mm512_cmp_pd_mask( a, _mm512_set1_pd( s ),
+                                            _CMP_EQ_OQ );
+        return (mask ? __builtin_ctz( mask ) : -1);
+    }
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+Level1Kernels const* avx512_kernels()
+{
+    return make_kernels< Avx512_s, Avx512_d >();
+}
+
+}  // namespace simd
+}  // namespace internal
+}  // namespace blas
+
+#else
+
+namespace blas {
+namespace internal {
+namespace simd {
+
+Level1Kernels const* avx512_kernels()
+{
+    return nullptr;
+}
+
+}  // namespace simd
+}  // namespace internal
+}  // namespace blas
+
+#endif  // __AVX512F__
@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -19,14 +21,24 @@ float nrm2(
     int64_t n,
     float const *x, int64_t incx )
 {
+    blas_trace( "nrm2", 's', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( incx > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            return internal::nrm2_split( n, x, incx );
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ) } )) {
+            return nrm2< float >( n, x, incx );
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -40,14 +52,24 @@ double nrm2(
     int64_t n,
     double const *x, int64_t incx )
 {
+    blas_trace( "nrm2", 'd', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( incx > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            return internal::nrm2_split( n, x, incx );
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ) } )) {
+            return nrm2< double >( n, x, incx );
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -61,14 +83,24 @@ float nrm2(
     int64_t n,
     std::complex<float> const *x, int64_t incx )
 {
+    blas_trace( "nrm2", 'c', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( incx > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            return internal::nrm2_split( n, x, incx );
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ) } )) {
+            return nrm2< std::complex<float> >( n, x, incx );
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -83,14 +115,24 @@ double nrm2(
     int64_t n,
     std::complex<double> const *x, int64_t incx )
 {
+    blas_trace( "nrm2", 'z', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n    > std::numeric_limits<blas_int>::max() );
-        blas_error_if( incx > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            return internal::nrm2_split( n, x, incx );
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ) } )) {
+            return nrm2< std::complex<double> >( n, x, incx );
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -1189,6 +1189,110 @@ void batch_zgemm(
             batch_size ) );
 }
 
+// -----------------------------------------------------------------------------
+// batch sgemm, strided
+void batch_sgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    float alpha,
+    float const *dA, device_blas_int ldda, int64_t strideA,
+    float const *dB, device_blas_int lddb, int64_t strideB,
+    float beta,
+    float       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size)
+{
+    blas_dev_call(
+        rocblas_sgemm_strided_batched(
+            queue.handle(),
+            op2rocblas(transA), op2rocblas(transB),
+            m, n, k,
+            &alpha,
+            dA, ldda, strideA,
+            dB, lddb, strideB,
+            &beta,
+            dC, lddc, strideC,
+            batch_size ) );
+}
+
+// -----------------------------------------------------------------------------
+// batch dgemm, strided
+void batch_dgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    double alpha,
+    double const *dA, device_blas_int ldda, int64_t strideA,
+    double const *dB, device_blas_int lddb, int64_t strideB,
+    double beta,
+    double       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size)
+{
+    blas_dev_call(
+        rocblas_dgemm_strided_batched(
+            queue.handle(),
+            op2rocblas(transA), op2rocblas(transB),
+            m, n, k,
+            &alpha,
+            dA, ldda, strideA,
+            dB, lddb, strideB,
+            &beta,
+            dC, lddc, strideC,
+            batch_size ) );
+}
+
+// -----------------------------------------------------------------------------
+// batch cgemm, strided
+void batch_cgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, device_blas_int ldda, int64_t strideA,
+    std::complex<float> const *dB, device_blas_int lddb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size)
+{
+    blas_dev_call(
+        rocblas_cgemm_strided_batched(
+            queue.handle(),
+            op2rocblas(transA), op2rocblas(transB),
+            m, n, k,
+            (rocblas_float_complex*) &alpha,
+            (rocblas_float_complex const*) dA, ldda, strideA,
+            (rocblas_float_complex const*) dB, lddb, strideB,
+            (rocblas_float_complex*) &beta,
+            (rocblas_float_complex*) dC, lddc, strideC,
+            batch_size ) );
+}
+
+// -----------------------------------------------------------------------------
+// batch zgemm, strided
+void batch_zgemm_strided(
+    blas::Queue& queue,
+    blas::Op transA, blas::Op transB,
+    device_blas_int m, device_blas_int n, device_blas_int k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, device_blas_int ldda, int64_t strideA,
+    std::complex<double> const *dB, device_blas_int lddb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>       *dC, device_blas_int lddc, int64_t strideC,
+    device_blas_int batch_size)
+{
+    blas_dev_call(
+        rocblas_zgemm_strided_batched(
+            queue.handle(),
+            op2rocblas(transA), op2rocblas(transB),
+            m, n, k,
+            (rocblas_double_complex*) &alpha,
+            (rocblas_double_complex const*) dA, ldda, strideA,
+            (rocblas_double_complex const*) dB, lddb, strideB,
+            (rocblas_double_complex*) &beta,
+            (rocblas_double_complex*) dC, lddc, strideC,
+            batch_size ) );
+}
+
 // -----------------------------------------------------------------------------
 // batch strsm
 void batch_strsm(
@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -22,6 +24,8 @@ void rot(
     float c,
     float s )
 {
+    blas_trace( "rot", 's', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
@@ -29,9 +33,18 @@ void rot(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::rot_split( n, x, incx, y, incy, c, s );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            rot< float, float >( n, x, incx, y, incy, c, s );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -49,6 +62,8 @@ void rot(
     double c,
     double s )
 {
+    blas_trace( "rot", 'd', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
@@ -56,9 +71,18 @@ void rot(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::rot_split( n, x, incx, y, incy, c, s );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            rot< double, double >( n, x, incx, y, incy, c, s );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -81,6 +105,8 @@ void rot(
     float c,
     float s )
 {
+    blas_trace( "rot", 'c', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
@@ -88,9 +114,19 @@ void rot(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::rot_split( n, x, incx, y, incy, c, s );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            rot< std::complex<float>, std::complex<float> >(
+                n, x, incx, y, incy, c, s );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -112,6 +148,8 @@ void rot(
     double c,
     double s )
 {
+    blas_trace( "rot", 'z', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
@@ -119,9 +157,19 @@ void rot(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::rot_split( n, x, incx, y, incy, c, s );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            rot< std::complex<double>, std::complex<double> >(
+                n, x, incx, y, incy, c, s );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -146,6 +194,8 @@ void rot(
     float c,
     std::complex<float> s )
 {
+    blas_trace( "rot", 'c', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
@@ -153,9 +203,19 @@ void rot(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::rot_split( n, x, incx, y, incy, c, s );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            rot< std::complex<float>, std::complex<float> >(
+                n, x, incx, y, incy, c, s );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -178,6 +238,8 @@ void rot(
     double c,
     std::complex<double> s )
 {
+    blas_trace( "rot", 'z', {}, { n } );
+
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
@@ -185,9 +247,19 @@ void rot(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::rot_split( n, x, incx, y, incy, c, s );
+            return;
+        }
+
+        // increments cannot be split, so if they overflow, use the int64_t
+        // template implementation
+        if (internal::split_needed( { std::abs( incx ), std::abs( incy ) } )) {
+            rot< std::complex<double>, std::complex<double> >(
+                n, x, incx, y, incy, c, s );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -3,8 +3,9 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -21,6 +22,8 @@ void rotg(
     float *c,
     float *s )
 {
+    blas_trace( "rotg", 's', {}, {} );
+
     BLAS_srotg( a, b, c, s );
 }
 
@@ -32,6 +35,8 @@ void rotg(
     double *c,
     double *s )
 {
+    blas_trace( "rotg", 'd', {}, {} );
+
     BLAS_drotg( a, b, c, s );
 }
 
@@ -43,6 +48,8 @@ void rotg(
     float *c,
     std::complex<float> *s )
 {
+    blas_trace( "rotg", 'c', {}, {} );
+
     BLAS_crotg( (blas_complex_float*) a,
                 (blas_complex_float*) b,
                 c,
@@ -57,6 +64,8 @@ void rotg(
     double *c,
     std::complex<double> *s )
 {
+    blas_trace( "rotg", 'z', {}, {} );
+
     BLAS_zrotg( (blas_complex_double*) a,
                 (blas_complex_double*) b,
                 c,
@@ -3,8 +3,9 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -23,6 +24,8 @@ void rotmg(
     float  b,
     float  param[5] )
 {
+    blas_trace( "rotmg", 's', {}, {} );
+
     BLAS_srotmg( d1, d2, a, &b, param );
 }
 
@@ -35,6 +38,8 @@ void rotmg(
     double  b,
     double  param[5] )
 {
+    blas_trace( "rotmg", 'd', {}, {} );
+
     BLAS_drotmg( d1, d2, a, &b, param );
 }
 
@@ -0,0 +1,126 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "dispatch.hh"
+#include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
+
+#include <limits>
+
+namespace blas {
+
+// =============================================================================
+// Overloaded wrappers for s, d, c, z precisions.
+
+// -----------------------------------------------------------------------------
+/// @ingroup sbmv
+void sbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n, int64_t k,
+    float alpha,
+    float const *A, int64_t lda,
+    float const *x, int64_t incx,
+    float beta,
+    float       *y, int64_t incy )
+{
+    blas_trace( "sbmv", 's', { layout, uplo }, { n, k } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Upper &&
+                   uplo != Uplo::Lower );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( lda < k + 1 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(blas_int)) {
+        // band matrices are not split, so if any dimension, leading dimension,
+        // or increment overflows, use the int64_t template implementation
+        if (internal::split_needed( { n, lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            sbmv< float, float, float >(
+                layout, uplo, n, k,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
+    }
+
+    blas_int n_    = (blas_int) n;
+    blas_int k_    = (blas_int) k;
+    blas_int lda_  = (blas_int) lda;
+    blas_int incx_ = (blas_int) incx;
+    blas_int incy_ = (blas_int) incy;
+
+    if (layout == Layout::RowMajor) {
+        // swap lower <=> upper
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+    }
+
+    char uplo_ = uplo2char( uplo );
+    BLAS_ssbmv( &uplo_, &n_, &k_,
+                &alpha, A, &lda_, x, &incx_, &beta, y, &incy_ );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sbmv
+void sbmv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n, int64_t k,
+    double alpha,
+    double const *A, int64_t lda,
+    double const *x, int64_t incx,
+    double beta,
+    double       *y, int64_t incy )
+{
+    blas_trace( "sbmv", 'd', { layout, uplo }, { n, k } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Upper &&
+                   uplo != Uplo::Lower );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( lda < k + 1 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(blas_int)) {
+        // band matrices are not split, so if any dimension, leading dimension,
+        // or increment overflows, use the int64_t template implementation
+        if (internal::split_needed( { n, lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            sbmv< double, double, double >(
+                layout, uplo, n, k,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
+    }
+
+    blas_int n_    = (blas_int) n;
+    blas_int k_    = (blas_int) k;
+    blas_int lda_  = (blas_int) lda;
+    blas_int incx_ = (blas_int) incx;
+    blas_int incy_ = (blas_int) incy;
+
+    if (layout == Layout::RowMajor) {
+        // swap lower <=> upper
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+    }
+
+    char uplo_ = uplo2char( uplo );
+    BLAS_dsbmv( &uplo_, &n_, &k_,
+                &alpha, A, &lda_, x, &incx_, &beta, y, &incy_ );
+}
+
+}  // namespace blas
@@ -0,0 +1,1265 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_SPLIT_HH
+#define BLAS_SPLIT_HH
+
+// Splitting of dimensions that overflow the native BLAS integer type.
+//
+// When blas_int is 32-bit, the wrappers call these routines if a dimension
+// (m, n, or k) exceeds split_size(). Each one computes the operation on
+// blocks of at most split_size() rows or columns, calling the int64_t
+// wrappers on each block, which then fit in blas_int. Blocks that write
+// disjoint outputs run in parallel with OpenMP; blocks that accumulate
+// into the same output (the k dimension of gemm, or the triangular solve
+// order of trsm) run in order. Leading dimensions and increments cannot
+// be split; after splitting, a block whose leading dimension or increment
+// still exceeds split_size() goes to the int64_t template implementation,
+// as do band routines, which are not split.
+
+#include "blas.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <initializer_list>
+#include <limits>
+#include <vector>
+
+namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return largest dimension passed to the native BLAS: the maximum of
+/// blas_int, or the BLASPP_SPLIT_SIZE environment variable if it is
+/// smaller, which lets tests exercise splitting on small problems.
+inline int64_t split_size()
+{
+    static const int64_t size = []() -> int64_t {
+        int64_t max_size = std::numeric_limits<blas_int>::max();
+        char const* env = std::getenv( "BLASPP_SPLIT_SIZE" );
+        if (env != nullptr) {
+            int64_t env_size = std::atoll( env );
+            if (env_size > 0 && env_size < max_size)
+                return env_size;
+        }
+        return max_size;
+    }();
+    return size;
+}
+
+//------------------------------------------------------------------------------
+/// @return true if any dimension exceeds split_size().
+inline bool split_needed( std::initializer_list<int64_t> dims )
+{
+    int64_t nb = split_size();
+    for (int64_t dim : dims) {
+        if (dim > nb)
+            return true;
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+/// @return number of blocks of size nb to cover n.
+inline int64_t split_blocks( int64_t n, int64_t nb )
+{
+    return (n + nb - 1) / nb;
+}
+
+//------------------------------------------------------------------------------
+/// @return pointer to element (i, j) of matrix A.
+template <typename T>
+T* split_elem( Layout layout, T* A, int64_t lda, int64_t i, int64_t j )
+{
+    return layout == Layout::ColMajor ? A + i + j*lda : A + i*lda + j;
+}
+
+//------------------------------------------------------------------------------
+/// @return pointer to block (i, j) of op(A), as stored in A.
+template <typename T>
+T* split_op_elem( Layout layout, Op trans, T* A, int64_t lda,
+                  int64_t i, int64_t j )
+{
+    return trans == Op::NoTrans ? split_elem( layout, A, lda, i, j )
+                                : split_elem( layout, A, lda, j, i );
+}
+
+//------------------------------------------------------------------------------
+/// @return pointer to pass to BLAS for elements i, ..., i + ib - 1 of
+/// the n-element vector x. For negative inc, BLAS expects a pointer to the
+/// last element, which is the first in memory.
+template <typename T>
+T* split_vec( T* x, int64_t n, int64_t inc, int64_t i, int64_t ib )
+{
+    return inc > 0 ? x + i*inc : x + (n - i - ib)*(-inc);
+}
+
+//------------------------------------------------------------------------------
+/// y[ i ] = beta y[ i ] + alpha op(A)[ i, j ] x[ j ] for the ib-by-jb
+/// block (i, j) of op(A).
+template <typename T>
+void split_gemv_block(
+    Layout layout, Op trans, int64_t ib, int64_t jb,
+    T alpha, T const* A, int64_t lda, int64_t i, int64_t j,
+    T const* xj, int64_t incx,
+    T beta,  T* yi, int64_t incy )
+{
+    if (trans == Op::NoTrans) {
+        blas::gemv( layout, trans, ib, jb,
+                    alpha, split_elem( layout, A, lda, i, j ), lda,
+                    xj, incx, beta, yi, incy );
+    }
+    else {
+        blas::gemv( layout, trans, jb, ib,
+                    alpha, split_elem( layout, A, lda, j, i ), lda,
+                    xj, incx, beta, yi, incy );
+    }
+}
+
+// =============================================================================
+// Level 1
+
+//------------------------------------------------------------------------------
+template <typename T>
+void axpy_split(
+    int64_t n, T alpha,
+    T const* x, int64_t incx,
+    T*       y, int64_t incy )
+{
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t it = 0; it < nt; ++it) {
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        blas::axpy( ib, alpha, split_vec( x, n, incx, i, ib ), incx,
+                               split_vec( y, n, incy, i, ib ), incy );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void copy_split(
+    int64_t n,
+    T const* x, int64_t incx,
+    T*       y, int64_t incy )
+{
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t it = 0; it < nt; ++it) {
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        blas::copy( ib, split_vec( x, n, incx, i, ib ), incx,
+                        split_vec( y, n, incy, i, ib ), incy );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void swap_split(
+    int64_t n,
+    T* x, int64_t incx,
+    T* y, int64_t incy )
+{
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t it = 0; it < nt; ++it) {
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        blas::swap( ib, split_vec( x, n, incx, i, ib ), incx,
+                        split_vec( y, n, incy, i, ib ), incy );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void scal_split( int64_t n, T alpha, T* x, int64_t incx )
+{
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t it = 0; it < nt; ++it) {
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        blas::scal( ib, alpha, split_vec( x, n, incx, i, ib ), incx );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename T, typename real_t, typename S>
+void rot_split(
+    int64_t n,
+    T* x, int64_t incx,
+    T* y, int64_t incy,
+    real_t c, S s )
+{
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t it = 0; it < nt; ++it) {
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        blas::rot( ib, split_vec( x, n, incx, i, ib ), incx,
+                       split_vec( y, n, incy, i, ib ), incy, c, s );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void rotm_split(
+    int64_t n,
+    T* x, int64_t incx,
+    T* y, int64_t incy,
+    T const param[5] )
+{
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t it = 0; it < nt; ++it) {
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        blas::rotm( ib, split_vec( x, n, incx, i, ib ), incx,
+                        split_vec( y, n, incy, i, ib ), incy, param );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Partial sums are added in block order, so the result does not depend on
+/// the number of threads.
+template <typename T>
+T dot_split(
+    int64_t n,
+    T const* x, int64_t incx,
+    T const* y, int64_t incy )
+{
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    std::vector<T> partial( nt );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t it = 0; it < nt; ++it) {
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        partial[ it ] = blas::dot( ib, split_vec( x, n, incx, i, ib ), incx,
+                                       split_vec( y, n, incy, i, ib ), incy );
+    }
+    T result = 0;
+    for (int64_t it = 0; it < nt; ++it)
+        result += partial[ it ];
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+T dotu_split(
+    int64_t n,
+    T const* x, int64_t incx,
+    T const* y, int64_t incy )
+{
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    std::vector<T> partial( nt );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t it = 0; it < nt; ++it) {
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        partial[ it ] = blas::dotu( ib, split_vec( x, n, incx, i, ib ), incx,
+                                        split_vec( y, n, incy, i, ib ), incy );
+    }
+    T result = 0;
+    for (int64_t it = 0; it < nt; ++it)
+        result += partial[ it ];
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+real_type<T> asum_split( int64_t n, T const* x, int64_t incx )
+{
+    using real_t = real_type<T>;
+
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    std::vector<real_t> partial( nt );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t it = 0; it < nt; ++it) {
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        partial[ it ] = blas::asum( ib, split_vec( x, n, incx, i, ib ), incx );
+    }
+    real_t result = 0;
+    for (int64_t it = 0; it < nt; ++it)
+        result += partial[ it ];
+    return result;
+}
+
+//------------------------------------------------------------------------------
+/// Combines the norms of blocks scaled by the largest one, to avoid
+/// overflow and underflow in squaring them.
+template <typename T>
+real_type<T> nrm2_split( int64_t n, T const* x, int64_t incx )
+{
+    using real_t = real_type<T>;
+
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    std::vector<real_t> partial( nt );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t it = 0; it < nt; ++it) {
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        partial[ it ] = blas::nrm2( ib, split_vec( x, n, incx, i, ib ), incx );
+    }
+    real_t scale = 0;
+    for (int64_t it = 0; it < nt; ++it) {
+        if (std::isnan( partial[ it ] ))
+            return partial[ it ];
+        scale = std::max( scale, partial[ it ] );
+    }
+    if (scale == 0 || std::isinf( scale ))
+        return scale;
+    real_t sum = 0;
+    for (int64_t it = 0; it < nt; ++it) {
+        real_t r = partial[ it ] / scale;
+        sum += r*r;
+    }
+    return scale * std::sqrt( sum );
+}
+
+//------------------------------------------------------------------------------
+/// As in BLAS, returns the first index of the largest |Re(x_i)| + |Im(x_i)|.
+template <typename T>
+int64_t iamax_split( int64_t n, T const* x, int64_t incx )
+{
+    using real_t = real_type<T>;
+
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    std::vector<int64_t> partial( nt );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t it = 0; it < nt; ++it) {
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        partial[ it ] = i + blas::iamax( ib, &x[ i*incx ], incx );
+    }
+    int64_t index = partial[ 0 ];
+    real_t value = abs1( x[ index*incx ] );
+    for (int64_t it = 1; it < nt; ++it) {
+        real_t v = abs1( x[ partial[ it ]*incx ] );
+        if (v > value) {
+            index = partial[ it ];
+            value = v;
+        }
+    }
+    return index;
+}
+
+// =============================================================================
+// Level 2
+
+//------------------------------------------------------------------------------
+/// Blocks of y run in parallel; blocks of x accumulate in order.
+template <typename T>
+void gemv_split(
+    Layout layout, Op trans,
+    int64_t m, int64_t n,
+    T alpha,
+    T const* A, int64_t lda,
+    T const* x, int64_t incx,
+    T beta,
+    T*       y, int64_t incy )
+{
+    // op(A) is ylen-by-xlen
+    int64_t ylen = (trans == Op::NoTrans ? m : n);
+    int64_t xlen = (trans == Op::NoTrans ? n : m);
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( ylen, nb );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t it = 0; it < nt; ++it) {
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, ylen - i );
+        T* yi = split_vec( y, ylen, incy, i, ib );
+        T beta_j = beta;
+        for (int64_t j = 0; j < xlen; j += nb) {
+            int64_t jb = std::min( nb, xlen - j );
+            split_gemv_block( layout, trans, ib, jb, alpha, A, lda, i, j,
+                              split_vec( x, xlen, incx, j, jb ), incx,
+                              beta_j, yi, incy );
+            beta_j = 1;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Shared by ger (conj = true) and geru (conj = false).
+template <typename T>
+void ger_split_impl(
+    bool conj,
+    Layout layout,
+    int64_t m, int64_t n,
+    T alpha,
+    T const* x, int64_t incx,
+    T const* y, int64_t incy,
+    T*       A, int64_t lda )
+{
+    int64_t nb = split_size();
+    int64_t mt = split_blocks( m, nb );
+    int64_t nt = split_blocks( n, nb );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t ij = 0; ij < mt*nt; ++ij) {
+        int64_t i  = (ij % mt)*nb;
+        int64_t j  = (ij / mt)*nb;
+        int64_t ib = std::min( nb, m - i );
+        int64_t jb = std::min( nb, n - j );
+        T const* xi = split_vec( x, m, incx, i, ib );
+        T const* yj = split_vec( y, n, incy, j, jb );
+        T* Aij = split_elem( layout, A, lda, i, j );
+        if (conj)
+            blas::ger(  layout, ib, jb, alpha, xi, incx, yj, incy, Aij, lda );
+        else
+            blas::geru( layout, ib, jb, alpha, xi, incx, yj, incy, Aij, lda );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void ger_split(
+    Layout layout,
+    int64_t m, int64_t n,
+    T alpha,
+    T const* x, int64_t incx,
+    T const* y, int64_t incy,
+    T*       A, int64_t lda )
+{
+    ger_split_impl( true, layout, m, n, alpha, x, incx, y, incy, A, lda );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void geru_split(
+    Layout layout,
+    int64_t m, int64_t n,
+    T alpha,
+    T const* x, int64_t incx,
+    T const* y, int64_t incy,
+    T*       A, int64_t lda )
+{
+    ger_split_impl( false, layout, m, n, alpha, x, incx, y, incy, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Calls f( i, j, ib, jb ) in parallel for each block (i, j) of the uplo
+/// triangle of an n-by-n matrix, including diagonal blocks (i == j).
+template <typename F>
+void split_triangle( Uplo uplo, int64_t n, int64_t nb, F f )
+{
+    int64_t nt = split_blocks( n, nb );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t ij = 0; ij < nt*nt; ++ij) {
+        int64_t it = ij % nt;
+        int64_t jt = ij / nt;
+        if (uplo == Uplo::Lower ? it < jt : it > jt)
+            continue;
+        int64_t i = it*nb;
+        int64_t j = jt*nb;
+        f( i, j, std::min( nb, n - i ), std::min( nb, n - j ) );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Shared by her (herm = true) and syr (herm = false);
+/// diag( ib, xi, Aii ) updates a diagonal block.
+template <typename T, typename real_t, typename F>
+void her_split_impl(
+    bool herm, F diag,
+    Layout layout, Uplo uplo,
+    int64_t n,
+    real_t alpha,
+    T const* x, int64_t incx,
+    T*       A, int64_t lda )
+{
+    int64_t nb = split_size();
+    split_triangle( uplo, n, nb,
+        [&]( int64_t i, int64_t j, int64_t ib, int64_t jb )
+        {
+            T const* xi = split_vec( x, n, incx, i, ib );
+            T* Aij = split_elem( layout, A, lda, i, j );
+            if (i == j) {
+                diag( ib, xi, Aij );
+            }
+            else {
+                T const* xj = split_vec( x, n, incx, j, jb );
+                if (herm)
+                    blas::ger(  layout, ib, jb, T( alpha ), xi, incx,
+                                xj, incx, Aij, lda );
+                else
+                    blas::geru( layout, ib, jb, T( alpha ), xi, incx,
+                                xj, incx, Aij, lda );
+            }
+        } );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void her_split(
+    Layout layout, Uplo uplo,
+    int64_t n,
+    real_type<T> alpha,
+    T const* x, int64_t incx,
+    T*       A, int64_t lda )
+{
+    her_split_impl( true,
+        [&]( int64_t ib, T const* xi, T* Aii )
+        {
+            blas::her( layout, uplo, ib, alpha, xi, incx, Aii, lda );
+        },
+        layout, uplo, n, alpha, x, incx, A, lda );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void syr_split(
+    Layout layout, Uplo uplo,
+    int64_t n,
+    T alpha,
+    T const* x, int64_t incx,
+    T*       A, int64_t lda )
+{
+    her_split_impl( false,
+        [&]( int64_t ib, T const* xi, T* Aii )
+        {
+            blas::syr( layout, uplo, ib, alpha, xi, incx, Aii, lda );
+        },
+        layout, uplo, n, alpha, x, incx, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Shared by her2 (herm = true) and syr2 (herm = false).
+template <typename T>
+void her2_split_impl(
+    bool herm,
+    Layout layout, Uplo uplo,
+    int64_t n,
+    T alpha,
+    T const* x, int64_t incx,
+    T const* y, int64_t incy,
+    T*       A, int64_t lda )
+{
+    using blas::conj;
+
+    int64_t nb = split_size();
+    split_triangle( uplo, n, nb,
+        [&]( int64_t i, int64_t j, int64_t ib, int64_t jb )
+        {
+            T const* xi = split_vec( x, n, incx, i, ib );
+            T const* yi = split_vec( y, n, incy, i, ib );
+            T* Aij = split_elem( layout, A, lda, i, j );
+            if (i == j) {
+                if (herm)
+                    blas::her2( layout, uplo, ib, alpha, xi, incx, yi, incy,
+                                Aij, lda );
+                else
+                    blas::syr2( layout, uplo, ib, alpha, xi, incx, yi, incy,
+                                Aij, lda );
+            }
+            else {
+                // A_ij += alpha x_i y_j^H + conj(alpha) y_i x_j^H, or
+                // A_ij += alpha x_i y_j^T + alpha y_i x_j^T
+                T const* xj = split_vec( x, n, incx, j, jb );
+                T const* yj = split_vec( y, n, incy, j, jb );
+                if (herm) {
+                    blas::ger( layout, ib, jb, alpha, xi, incx,
+                               yj, incy, Aij, lda );
+                    blas::ger( layout, ib, jb, conj( alpha ), yi, incy,
+                               xj, incx, Aij, lda );
+                }
+                else {
+                    blas::geru( layout, ib, jb, alpha, xi, incx,
+                                yj, incy, Aij, lda );
+                    blas::geru( layout, ib, jb, alpha, yi, incy,
+                                xj, incx, Aij, lda );
+                }
+            }
+        } );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void her2_split(
+    Layout layout, Uplo uplo,
+    int64_t n,
+    T alpha,
+    T const* x, int64_t incx,
+    T const* y, int64_t incy,
+    T*       A, int64_t lda )
+{
+    her2_split_impl( true, layout, uplo, n, alpha, x, incx, y, incy, A, lda );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void syr2_split(
+    Layout layout, Uplo uplo,
+    int64_t n,
+    T alpha,
+    T const* x, int64_t incx,
+    T const* y, int64_t incy,
+    T*       A, int64_t lda )
+{
+    her2_split_impl( false, layout, uplo, n, alpha, x, incx, y, incy, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Shared by hemv (herm = true) and symv (herm = false).
+/// diag( ib, Aii, xi, yi ) multiplies by a diagonal block.
+/// Blocks of y run in parallel. Each block row uses the diagonal block, and
+/// the blocks left and right of it, from the uplo triangle or transposed.
+template <typename T, typename F>
+void hemv_split_impl(
+    bool herm, F diag,
+    Layout layout, Uplo uplo,
+    int64_t n,
+    T alpha,
+    T const* A, int64_t lda,
+    T const* x, int64_t incx,
+    T*       y, int64_t incy )
+{
+    const T one = 1;
+    Op trans = herm ? Op::ConjTrans : Op::Trans;
+    // blocks left of the diagonal are stored if Lower, right of it if Upper
+    Op trans_left  = (uplo == Uplo::Lower ? Op::NoTrans : trans);
+    Op trans_right = (uplo == Uplo::Lower ? trans : Op::NoTrans);
+
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t it = 0; it < nt; ++it) {
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        int64_t r  = n - i - ib;
+        T* yi = split_vec( y, n, incy, i, ib );
+        diag( ib, split_elem( layout, A, lda, i, i ),
+              split_vec( x, n, incx, i, ib ), yi );
+        if (i > 0) {
+            split_gemv_block( layout, trans_left, ib, i, alpha, A, lda, i, 0,
+                              split_vec( x, n, incx, 0, i ), incx,
+                              one, yi, incy );
+        }
+        if (r > 0) {
+            split_gemv_block( layout, trans_right, ib, r, alpha, A, lda,
+                              i, i + ib,
+                              split_vec( x, n, incx, i + ib, r ), incx,
+                              one, yi, incy );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void hemv_split(
+    Layout layout, Uplo uplo,
+    int64_t n,
+    T alpha,
+    T const* A, int64_t lda,
+    T const* x, int64_t incx,
+    T beta,
+    T*       y, int64_t incy )
+{
+    hemv_split_impl( true,
+        [&]( int64_t ib, T const* Aii, T const* xi, T* yi )
+        {
+            blas::hemv( layout, uplo, ib, alpha, Aii, lda, xi, incx,
+                        beta, yi, incy );
+        },
+        layout, uplo, n, alpha, A, lda, x, incx, y, incy );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void symv_split(
+    Layout layout, Uplo uplo,
+    int64_t n,
+    T alpha,
+    T const* A, int64_t lda,
+    T const* x, int64_t incx,
+    T beta,
+    T*       y, int64_t incy )
+{
+    hemv_split_impl( false,
+        [&]( int64_t ib, T const* Aii, T const* xi, T* yi )
+        {
+            blas::symv( layout, uplo, ib, alpha, Aii, lda, xi, incx,
+                        beta, yi, incy );
+        },
+        layout, uplo, n, alpha, A, lda, x, incx, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// Block rows of x are updated in order: bottom up if op(A) is lower,
+/// so each block uses the blocks above before they are updated.
+template <typename T>
+void trmv_split(
+    Layout layout, Uplo uplo, Op trans, Diag diag,
+    int64_t n,
+    T const* A, int64_t lda,
+    T*       x, int64_t incx )
+{
+    const T one = 1;
+    bool lower = (uplo == Uplo::Lower) == (trans == Op::NoTrans);
+
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    for (int64_t k = 0; k < nt; ++k) {
+        int64_t it = lower ? nt - 1 - k : k;
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        int64_t r  = n - i - ib;
+        T* xi = split_vec( x, n, incx, i, ib );
+        blas::trmv( layout, uplo, trans, diag, ib,
+                    split_elem( layout, A, lda, i, i ), lda, xi, incx );
+        if (lower && i > 0) {
+            split_gemv_block( layout, trans, ib, i, one, A, lda, i, 0,
+                              split_vec( x, n, incx, 0, i ), incx,
+                              one, xi, incx );
+        }
+        else if (! lower && r > 0) {
+            split_gemv_block( layout, trans, ib, r, one, A, lda, i, i + ib,
+                              split_vec( x, n, incx, i + ib, r ), incx,
+                              one, xi, incx );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Block rows of x are solved in order: top down if op(A) is lower.
+template <typename T>
+void trsv_split(
+    Layout layout, Uplo uplo, Op trans, Diag diag,
+    int64_t n,
+    T const* A, int64_t lda,
+    T*       x, int64_t incx )
+{
+    const T one = 1;
+    bool lower = (uplo == Uplo::Lower) == (trans == Op::NoTrans);
+
+    int64_t nb = split_size();
+    int64_t nt = split_blocks( n, nb );
+    for (int64_t k = 0; k < nt; ++k) {
+        int64_t it = lower ? k : nt - 1 - k;
+        int64_t i  = it*nb;
+        int64_t ib = std::min( nb, n - i );
+        int64_t r  = n - i - ib;
+        T* xi = split_vec( x, n, incx, i, ib );
+        if (lower && i > 0) {
+            split_gemv_block( layout, trans, ib, i, -one, A, lda, i, 0,
+                              split_vec( x, n, incx, 0, i ), incx,
+                              one, xi, incx );
+        }
+        else if (! lower && r > 0) {
+            split_gemv_block( layout, trans, ib, r, -one, A, lda, i, i + ib,
+                              split_vec( x, n, incx, i + ib, r ), incx,
+                              one, xi, incx );
+        }
+        blas::trsv( layout, uplo, trans, diag, ib,
+                    split_elem( layout, A, lda, i, i ), lda, xi, incx );
+    }
+}
+
+// =============================================================================
+// Level 3
+
+//------------------------------------------------------------------------------
+/// Blocks of C run in parallel; blocks of k accumulate in order.
+template <typename T>
+void gemm_split(
+    Layout layout, Op transA, Op transB,
+    int64_t m, int64_t n, int64_t k,
+    T alpha,
+    T const* A, int64_t lda,
+    T const* B, int64_t ldb,
+    T beta,
+    T*       C, int64_t ldc )
+{
+    int64_t nb = split_size();
+    int64_t mt = split_blocks( m, nb );
+    int64_t nt = split_blocks( n, nb );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t ij = 0; ij < mt*nt; ++ij) {
+        int64_t i  = (ij % mt)*nb;
+        int64_t j  = (ij / mt)*nb;
+        int64_t ib = std::min( nb, m - i );
+        int64_t jb = std::min( nb, n - j );
+        T beta_l = beta;
+        // if k = 0, one call with lb = 0 scales C by beta
+        for (int64_t l = 0; l < k || l == 0; l += nb) {
+            int64_t lb = std::min( nb, k - l );
+            blas::gemm( layout, transA, transB, ib, jb, lb,
+                        alpha, split_op_elem( layout, transA, A, lda, i, l ), lda,
+                               split_op_elem( layout, transB, B, ldb, l, j ), ldb,
+                        beta_l, split_elem( layout, C, ldc, i, j ), ldc );
+            beta_l = 1;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Blocks of the right-hand sides B run in parallel. Within each, blocks
+/// are solved in order, updating the remaining blocks with gemm.
+template <typename T>
+void trsm_split(
+    Layout layout, Side side, Uplo uplo, Op trans, Diag diag,
+    int64_t m, int64_t n,
+    T alpha,
+    T const* A, int64_t lda,
+    T*       B, int64_t ldb )
+{
+    const T one = 1;
+    bool lower = (uplo == Uplo::Lower) == (trans == Op::NoTrans);
+
+    int64_t nb = split_size();
+    if (side == Side::Left) {
+        // op(A) X = alpha B; A is m-by-m
+        int64_t mt = split_blocks( m, nb );
+        int64_t nt = split_blocks( n, nb );
+        #pragma omp parallel for schedule(dynamic)
+        for (int64_t jt = 0; jt < nt; ++jt) {
+            int64_t j  = jt*nb;
+            int64_t jb = std::min( nb, n - j );
+            for (int64_t k = 0; k < mt; ++k) {
+                int64_t i  = (lower ? k : mt - 1 - k)*nb;
+                int64_t ib = std::min( nb, m - i );
+                int64_t r  = m - i - ib;
+                T* Bij = split_elem( layout, B, ldb, i, j );
+                // B_i = alpha B_i - op(A)_{i, solved} X_solved
+                T alpha_i = alpha;
+                if (lower && i > 0) {
+                    blas::gemm( layout, trans, Op::NoTrans, ib, jb, i,
+                                -one, split_op_elem( layout, trans, A, lda, i, 0 ), lda,
+                                      split_elem( layout, B, ldb, 0, j ), ldb,
+                                alpha, Bij, ldb );
+                    alpha_i = one;
+                }
+                else if (! lower && r > 0) {
+                    blas::gemm( layout, trans, Op::NoTrans, ib, jb, r,
+                                -one, split_op_elem( layout, trans, A, lda, i, i + ib ), lda,
+                                      split_elem( layout, B, ldb, i + ib, j ), ldb,
+                                alpha, Bij, ldb );
+                    alpha_i = one;
+                }
+                blas::trsm( layout, side, uplo, trans, diag, ib, jb, alpha_i,
+                            split_elem( layout, A, lda, i, i ), lda, Bij, ldb );
+            }
+        }
+    }
+    else {
+        // X op(A) = alpha B; A is n-by-n
+        int64_t mt = split_blocks( m, nb );
+        int64_t nt = split_blocks( n, nb );
+        #pragma omp parallel for schedule(dynamic)
+        for (int64_t it = 0; it < mt; ++it) {
+            int64_t i  = it*nb;
+            int64_t ib = std::min( nb, m - i );
+            for (int64_t k = 0; k < nt; ++k) {
+                int64_t j  = (lower ? nt - 1 - k : k)*nb;
+                int64_t jb = std::min( nb, n - j );
+                int64_t r  = n - j - jb;
+                T* Bij = split_elem( layout, B, ldb, i, j );
+                // B_j = alpha B_j - X_solved op(A)_{solved, j}
+                T alpha_j = alpha;
+                if (! lower && j > 0) {
+                    blas::gemm( layout, Op::NoTrans, trans, ib, jb, j,
+                                -one, split_elem( layout, B, ldb, i, 0 ), ldb,
+                                      split_op_elem( layout, trans, A, lda, 0, j ), lda,
+                                alpha, Bij, ldb );
+                    alpha_j = one;
+                }
+                else if (lower && r > 0) {
+                    blas::gemm( layout, Op::NoTrans, trans, ib, jb, r,
+                                -one, split_elem( layout, B, ldb, i, j + jb ), ldb,
+                                      split_op_elem( layout, trans, A, lda, j + jb, j ), lda,
+                                alpha, Bij, ldb );
+                    alpha_j = one;
+                }
+                blas::trsm( layout, side, uplo, trans, diag, ib, jb, alpha_j,
+                            split_elem( layout, A, lda, j, j ), lda, Bij, ldb );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Blocks of B run in parallel as in trsm_split, but in the opposite order,
+/// so each block uses the blocks it depends on before they are updated.
+template <typename T>
+void trmm_split(
+    Layout layout, Side side, Uplo uplo, Op trans, Diag diag,
+    int64_t m, int64_t n,
+    T alpha,
+    T const* A, int64_t lda,
+    T*       B, int64_t ldb )
+{
+    const T one = 1;
+    bool lower = (uplo == Uplo::Lower) == (trans == Op::NoTrans);
+
+    int64_t nb = split_size();
+    if (side == Side::Left) {
+        // B = alpha op(A) B; A is m-by-m
+        int64_t mt = split_blocks( m, nb );
+        int64_t nt = split_blocks( n, nb );
+        #pragma omp parallel for schedule(dynamic)
+        for (int64_t jt = 0; jt < nt; ++jt) {
+            int64_t j  = jt*nb;
+            int64_t jb = std::min( nb, n - j );
+            for (int64_t k = 0; k < mt; ++k) {
+                int64_t i  = (lower ? mt - 1 - k : k)*nb;
+                int64_t ib = std::min( nb, m - i );
+                int64_t r  = m - i - ib;
+                T* Bij = split_elem( layout, B, ldb, i, j );
+                blas::trmm( layout, side, uplo, trans, diag, ib, jb, alpha,
+                            split_elem( layout, A, lda, i, i ), lda, Bij, ldb );
+                if (lower && i > 0) {
+                    blas::gemm( layout, trans, Op::NoTrans, ib, jb, i,
+                                alpha, split_op_elem( layout, trans, A, lda, i, 0 ), lda,
+                                       split_elem( layout, B, ldb, 0, j ), ldb,
+                                one, Bij, ldb );
+                }
+                else if (! lower && r > 0) {
+                    blas::gemm( layout, trans, Op::NoTrans, ib, jb, r,
+                                alpha, split_op_elem( layout, trans, A, lda, i, i + ib ), lda,
+                                       split_elem( layout, B, ldb, i + ib, j ), ldb,
+                                one, Bij, ldb );
+                }
+            }
+        }
+    }
+    else {
+        // B = alpha B op(A); A is n-by-n
+        int64_t mt = split_blocks( m, nb );
+        int64_t nt = split_blocks( n, nb );
+        #pragma omp parallel for schedule(dynamic)
+        for (int64_t it = 0; it < mt; ++it) {
+            int64_t i  = it*nb;
+            int64_t ib = std::min( nb, m - i );
+            for (int64_t k = 0; k < nt; ++k) {
+                int64_t j  = (lower ? k : nt - 1 - k)*nb;
+                int64_t jb = std::min( nb, n - j );
+                int64_t r  = n - j - jb;
+                T* Bij = split_elem( layout, B, ldb, i, j );
+                blas::trmm( layout, side, uplo, trans, diag, ib, jb, alpha,
+                            split_elem( layout, A, lda, j, j ), lda, Bij, ldb );
+                if (! lower && j > 0) {
+                    blas::gemm( layout, Op::NoTrans, trans, ib, jb, j,
+                                alpha, split_elem( layout, B, ldb, i, 0 ), ldb,
+                                       split_op_elem( layout, trans, A, lda, 0, j ), lda,
+                                one, Bij, ldb );
+                }
+                else if (lower && r > 0) {
+                    blas::gemm( layout, Op::NoTrans, trans, ib, jb, r,
+                                alpha, split_elem( layout, B, ldb, i, j + jb ), ldb,
+                                       split_op_elem( layout, trans, A, lda, j + jb, j ), lda,
+                                one, Bij, ldb );
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Shared by hemm (herm = true) and symm (herm = false).
+/// Blocks of C run in parallel. Each uses the diagonal block of A, and the
+/// blocks before and after it, from the uplo triangle or transposed.
+template <typename T>
+void hemm_split_impl(
+    bool herm,
+    Layout layout, Side side, Uplo uplo,
+    int64_t m, int64_t n,
+    T alpha,
+    T const* A, int64_t lda,
+    T const* B, int64_t ldb,
+    T beta,
+    T*       C, int64_t ldc )
+{
+    const T one = 1;
+    const Op NoTrans = Op::NoTrans;
+    Op trans = herm ? Op::ConjTrans : Op::Trans;
+    bool lower = (uplo == Uplo::Lower);
+
+    int64_t nb = split_size();
+    int64_t mt = split_blocks( m, nb );
+    int64_t nt = split_blocks( n, nb );
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t ij = 0; ij < mt*nt; ++ij) {
+        int64_t i  = (ij % mt)*nb;
+        int64_t j  = (ij / mt)*nb;
+        int64_t ib = std::min( nb, m - i );
+        int64_t jb = std::min( nb, n - j );
+        T* Cij = split_elem( layout, C, ldc, i, j );
+        // diagonal block d, and lengths before and after it
+        int64_t d  = (side == Side::Left ? i : j);
+        int64_t db = (side == Side::Left ? ib : jb);
+        int64_t r  = (side == Side::Left ? m : n) - d - db;
+        T const* Add = split_elem( layout, A, lda, d, d );
+        T const* Bij = split_elem( layout, B, ldb, i, j );
+        if (herm)
+            blas::hemm( layout, side, uplo, ib, jb, alpha, Add, lda,
+                        Bij, ldb, beta, Cij, ldc );
+        else
+            blas::symm( layout, side, uplo, ib, jb, alpha, Add, lda,
+                        Bij, ldb, beta, Cij, ldc );
+
+        if (side == Side::Left) {
+            // C_i += alpha A_{i, 0:i} B_{0:i} + alpha A_{i, i+ib:m} B_{i+ib:m}
+            if (d > 0) {
+                blas::gemm( layout, lower ? NoTrans : trans, NoTrans,
+                            ib, jb, d,
+                            alpha, lower ? split_elem( layout, A, lda, d, 0 )
+                                         : split_elem( layout, A, lda, 0, d ), lda,
+                                   split_elem( layout, B, ldb, 0, j ), ldb,
+                            one, Cij, ldc );
+            }
+            if (r > 0) {
+                blas::gemm( layout, lower ? trans : NoTrans, NoTrans,
+                            ib, jb, r,
+                            alpha, lower ? split_elem( layout, A, lda, d + db, d )
+                                         : split_elem( layout, A, lda, d, d + db ), lda,
+                                   split_elem( layout, B, ldb, d + db, j ), ldb,
+                            one, Cij, ldc );
+            }
+        }
+        else {
+            // C_j += alpha B_{0:j} A_{0:j, j} + alpha B_{j+jb:n} A_{j+jb:n, j}
+            if (d > 0) {
+                blas::gemm( layout, NoTrans, lower ? trans : NoTrans,
+                            ib, jb, d,
+                            alpha, split_elem( layout, B, ldb, i, 0 ), ldb,
+                                   lower ? split_elem( layout, A, lda, d, 0 )
+                                         : split_elem( layout, A, lda, 0, d ), lda,
+                            one, Cij, ldc );
+            }
+            if (r > 0) {
+                blas::gemm( layout, NoTrans, lower ? NoTrans : trans,
+                            ib, jb, r,
+                            alpha, split_elem( layout, B, ldb, i, d + db ), ldb,
+                                   lower ? split_elem( layout, A, lda, d + db, d )
+                                         : split_elem( layout, A, lda, d, d + db ), lda,
+                            one, Cij, ldc );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void hemm_split(
+    Layout layout, Side side, Uplo uplo,
+    int64_t m, int64_t n,
+    T alpha,
+    T const* A, int64_t lda,
+    T const* B, int64_t ldb,
+    T beta,
+    T*       C, int64_t ldc )
+{
+    hemm_split_impl( true, layout, side, uplo, m, n, alpha, A, lda, B, ldb,
+                     beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void symm_split(
+    Layout layout, Side side, Uplo uplo,
+    int64_t m, int64_t n,
+    T alpha,
+    T const* A, int64_t lda,
+    T const* B, int64_t ldb,
+    T beta,
+    T*       C, int64_t ldc )
+{
+    hemm_split_impl( false, layout, side, uplo, m, n, alpha, A, lda, B, ldb,
+                     beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// Shared by herk (herm = true) and syrk (herm = false);
+/// diag( ib, lb, Ail, beta_l, Cii ) updates a diagonal block.
+/// Blocks of the uplo triangle of C run in parallel; blocks of k
+/// accumulate in order.
+template <typename T, typename scalar_t, typename F>
+void herk_split_impl(
+    bool herm, F diag,
+    Layout layout, Uplo uplo, Op trans,
+    int64_t n, int64_t k,
+    scalar_t alpha,
+    T const* A, int64_t lda,
+    scalar_t beta,
+    T*       C, int64_t ldc )
+{
+    Op conj_trans = herm ? Op::ConjTrans : Op::Trans;
+    Op transA = (trans == Op::NoTrans ? Op::NoTrans : conj_trans);
+    Op transB = (trans == Op::NoTrans ? conj_trans : Op::NoTrans);
+
+    int64_t nb = split_size();
+    split_triangle( uplo, n, nb,
+        [&]( int64_t i, int64_t j, int64_t ib, int64_t jb )
+        {
+            T* Cij = split_elem( layout, C, ldc, i, j );
+            scalar_t beta_l = beta;
+            // if k = 0, one call with lb = 0 scales C by beta
+            for (int64_t l = 0; l < k || l == 0; l += nb) {
+                int64_t lb = std::min( nb, k - l );
+                T const* Ail = split_op_elem( layout, trans, A, lda, i, l );
+                if (i == j) {
+                    diag( ib, lb, Ail, beta_l, Cij );
+                }
+                else {
+                    // C_ij += alpha op(A)_i op(A)_j^H
+                    blas::gemm( layout, transA, transB, ib, jb, lb,
+                                T( alpha ), Ail, lda,
+                                split_op_elem( layout, trans, A, lda, j, l ), lda,
+                                T( beta_l ), Cij, ldc );
+                }
+                beta_l = 1;
+            }
+        } );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void herk_split(
+    Layout layout, Uplo uplo, Op trans,
+    int64_t n, int64_t k,
+    real_type<T> alpha,
+    T const* A, int64_t lda,
+    real_type<T> beta,
+    T*       C, int64_t ldc )
+{
+    using real_t = real_type<T>;
+    herk_split_impl( true,
+        [&]( int64_t ib, int64_t lb, T const* Ail, real_t beta_l, T* Cii )
+        {
+            blas::herk( layout, uplo, trans, ib, lb, alpha, Ail, lda,
+                        beta_l, Cii, ldc );
+        },
+        layout, uplo, trans, n, k, alpha, A, lda, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void syrk_split(
+    Layout layout, Uplo uplo, Op trans,
+    int64_t n, int64_t k,
+    T alpha,
+    T const* A, int64_t lda,
+    T beta,
+    T*       C, int64_t ldc )
+{
+    herk_split_impl( false,
+        [&]( int64_t ib, int64_t lb, T const* Ail, T beta_l, T* Cii )
+        {
+            blas::syrk( layout, uplo, trans, ib, lb, alpha, Ail, lda,
+                        beta_l, Cii, ldc );
+        },
+        layout, uplo, trans, n, k, alpha, A, lda, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// Shared by her2k (herm = true) and syr2k (herm = false);
+/// diag( ib, lb, Ail, Bil, beta_l, Cii ) updates a diagonal block.
+template <typename T, typename scalar_t, typename F>
+void her2k_split_impl(
+    bool herm, F diag,
+    Layout layout, Uplo uplo, Op trans,
+    int64_t n, int64_t k,
+    T alpha,
+    T const* A, int64_t lda,
+    T const* B, int64_t ldb,
+    scalar_t beta,
+    T*       C, int64_t ldc )
+{
+    using blas::conj;
+
+    const T one = 1;
+    Op conj_trans = herm ? Op::ConjTrans : Op::Trans;
+    Op transA = (trans == Op::NoTrans ? Op::NoTrans : conj_trans);
+    Op transB = (trans == Op::NoTrans ? conj_trans : Op::NoTrans);
+    T alpha2 = herm ? conj( alpha ) : alpha;
+
+    int64_t nb = split_size();
+    split_triangle( uplo, n, nb,
+        [&]( int64_t i, int64_t j, int64_t ib, int64_t jb )
+        {
+            T* Cij = split_elem( layout, C, ldc, i, j );
+            scalar_t beta_l = beta;
+            // if k = 0, one call with lb = 0 scales C by beta
+            for (int64_t l = 0; l < k || l == 0; l += nb) {
+                int64_t lb = std::min( nb, k - l );
+                T const* Ail = split_op_elem( layout, trans, A, lda, i, l );
+                T const* Bil = split_op_elem( layout, trans, B, ldb, i, l );
+                if (i == j) {
+                    diag( ib, lb, Ail, Bil, beta_l, Cij );
+                }
+                else {
+                    // C_ij += alpha op(A)_i op(B)_j^H + conj(alpha) op(B)_i op(A)_j^H
+                    blas::gemm( layout, transA, transB, ib, jb, lb,
+                                alpha, Ail, lda,
+                                split_op_elem( layout, trans, B, ldb, j, l ), ldb,
+                                T( beta_l ), Cij, ldc );
+                    blas::gemm( layout, transA, transB, ib, jb, lb,
+                                alpha2, Bil, ldb,
+                                split_op_elem( layout, trans, A, lda, j, l ), lda,
+                                one, Cij, ldc );
+                }
+                beta_l = 1;
+            }
+        } );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void her2k_split(
+    Layout layout, Uplo uplo, Op trans,
+    int64_t n, int64_t k,
+    T alpha,
+    T const* A, int64_t lda,
+    T const* B, int64_t ldb,
+    real_type<T> beta,
+    T*       C, int64_t ldc )
+{
+    using real_t = real_type<T>;
+    her2k_split_impl( true,
+        [&]( int64_t ib, int64_t lb, T const* Ail, T const* Bil,
+             real_t beta_l, T* Cii )
+        {
+            blas::her2k( layout, uplo, trans, ib, lb, alpha, Ail, lda,
+                         Bil, ldb, beta_l, Cii, ldc );
+        },
+        layout, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void syr2k_split(
+    Layout layout, Uplo uplo, Op trans,
+    int64_t n, int64_t k,
+    T alpha,
+    T const* A, int64_t lda,
+    T const* B, int64_t ldb,
+    T beta,
+    T*       C, int64_t ldc )
+{
+    her2k_split_impl( false,
+        [&]( int64_t ib, int64_t lb, T const* Ail, T const* Bil,
+             T beta_l, T* Cii )
+        {
+            blas::syr2k( layout, uplo, trans, ib, lb, alpha, Ail, lda,
+                         Bil, ldb, beta_l, Cii, ldc );
+        },
+        layout, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif // BLAS_SPLIT_HH
@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -26,6 +28,8 @@ void symm(
     float beta,
     float       *C, int64_t ldc )
 {
+    blas_trace( "symm", 's', { layout, side, uplo }, { m, n } );
+
     typedef long long lld;
 
     // check arguments
@@ -54,11 +58,21 @@ void symm(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::symm_split( layout, side, uplo, m, n, alpha, A, lda,
+                                  B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            symm< float, float, float >(
+                layout, side, uplo, m, n,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
@@ -93,6 +107,8 @@ void symm(
     double beta,
     double       *C, int64_t ldc )
 {
+    blas_trace( "symm", 'd', { layout, side, uplo }, { m, n } );
+
     typedef long long lld;
 
     // check arguments
@@ -121,11 +137,21 @@ void symm(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::symm_split( layout, side, uplo, m, n, alpha, A, lda,
+                                  B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            symm< double, double, double >(
+                layout, side, uplo, m, n,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
@@ -160,6 +186,8 @@ void symm(
     std::complex<float> beta,
     std::complex<float>       *C, int64_t ldc )
 {
+    blas_trace( "symm", 'c', { layout, side, uplo }, { m, n } );
+
     typedef long long lld;
 
     // check arguments
@@ -188,11 +216,22 @@ void symm(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::symm_split( layout, side, uplo, m, n, alpha, A, lda,
+                                  B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            symm< std::complex<float>, std::complex<float>,
+                  std::complex<float> >(
+                layout, side, uplo, m, n,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
@@ -231,6 +270,8 @@ void symm(
     std::complex<double> beta,
     std::complex<double>       *C, int64_t ldc )
 {
+    blas_trace( "symm", 'z', { layout, side, uplo }, { m, n } );
+
     typedef long long lld;
 
     // check arguments
@@ -259,11 +300,22 @@ void symm(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::symm_split( layout, side, uplo, m, n, alpha, A, lda,
+                                  B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            symm< std::complex<double>, std::complex<double>,
+                  std::complex<double> >(
+                layout, side, uplo, m, n,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -25,6 +27,8 @@ void symv(
     float beta,
     float       *y, int64_t incy )
 {
+    blas_trace( "symv", 's', { layout, uplo }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -37,10 +41,22 @@ void symv(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::symv_split( layout, uplo, n, alpha, A, lda, x, incx, beta,
+                                  y, incy );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            symv< float, float, float >(
+                layout, uplo, n,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -70,6 +86,8 @@ void symv(
     double beta,
     double       *y, int64_t incy )
 {
+    blas_trace( "symv", 'd', { layout, uplo }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -82,10 +100,22 @@ void symv(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incy) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::symv_split( layout, uplo, n, alpha, A, lda, x, incx, beta,
+                                  y, incy );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ),
+                                      std::abs( incy ) } )) {
+            symv< double, double, double >(
+                layout, uplo, n,
+                alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
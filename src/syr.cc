@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -23,6 +25,8 @@ void syr(
     float const *x, int64_t incx,
     float       *A, int64_t lda )
 {
+    blas_trace( "syr", 's', { layout, uplo }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -34,9 +38,20 @@ void syr(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::syr_split( layout, uplo, n, alpha, x, incx, A, lda );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ) } )) {
+            syr< float, float >(
+                layout, uplo, n,
+                alpha, x, incx, A, lda );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -62,6 +77,8 @@ void syr(
     double const *x, int64_t incx,
     double       *A, int64_t lda )
 {
+    blas_trace( "syr", 'd', { layout, uplo }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -73,9 +90,20 @@ void syr(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::syr_split( layout, uplo, n, alpha, x, incx, A, lda );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ) } )) {
+            syr< double, double >(
+                layout, uplo, n,
+                alpha, x, incx, A, lda );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
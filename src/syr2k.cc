@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -26,6 +28,8 @@ void syr2k(
     float beta,
     float       *C, int64_t ldc )
 {
+    blas_trace( "syr2k", 's', { layout, uplo, trans }, { n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -50,10 +54,21 @@ void syr2k(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n, k } )) {
+            internal::syr2k_split( layout, uplo, trans, n, k, alpha, A, lda,
+                                   B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            syr2k< float, float, float >(
+                layout, uplo, trans, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int n_   = (blas_int) n;
@@ -88,6 +103,8 @@ void syr2k(
     double beta,
     double       *C, int64_t ldc )
 {
+    blas_trace( "syr2k", 'd', { layout, uplo, trans }, { n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -112,10 +129,21 @@ void syr2k(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n, k } )) {
+            internal::syr2k_split( layout, uplo, trans, n, k, alpha, A, lda,
+                                   B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            syr2k< double, double, double >(
+                layout, uplo, trans, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int n_   = (blas_int) n;
@@ -150,6 +178,8 @@ void syr2k(
     std::complex<float> beta,
     std::complex<float>       *C, int64_t ldc )
 {
+    blas_trace( "syr2k", 'c', { layout, uplo, trans }, { n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -173,10 +203,22 @@ void syr2k(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n, k } )) {
+            internal::syr2k_split( layout, uplo, trans, n, k, alpha, A, lda,
+                                   B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            syr2k< std::complex<float>, std::complex<float>,
+                   std::complex<float> >(
+                layout, uplo, trans, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int n_   = (blas_int) n;
@@ -215,6 +257,8 @@ void syr2k(
     std::complex<double> beta,
     std::complex<double>       *C, int64_t ldc )
 {
+    blas_trace( "syr2k", 'z', { layout, uplo, trans }, { n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -238,10 +282,22 @@ void syr2k(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n, k } )) {
+            internal::syr2k_split( layout, uplo, trans, n, k, alpha, A, lda,
+                                   B, ldb, beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb, ldc } )) {
+            syr2k< std::complex<double>, std::complex<double>,
+                   std::complex<double> >(
+                layout, uplo, trans, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int n_   = (blas_int) n;
@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -25,6 +27,8 @@ void syrk(
     float beta,
     float       *C, int64_t ldc )
 {
+    blas_trace( "syrk", 's', { layout, uplo, trans }, { n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -45,10 +49,21 @@ void syrk(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n, k } )) {
+            internal::syrk_split( layout, uplo, trans, n, k, alpha, A, lda,
+                                  beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldc } )) {
+            syrk< float, float >(
+                layout, uplo, trans, n, k,
+                alpha, A, lda, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int n_   = (blas_int) n;
@@ -81,6 +96,8 @@ void syrk(
     double beta,
     double       *C, int64_t ldc )
 {
+    blas_trace( "syrk", 'd', { layout, uplo, trans }, { n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -101,10 +118,21 @@ void syrk(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n, k } )) {
+            internal::syrk_split( layout, uplo, trans, n, k, alpha, A, lda,
+                                  beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldc } )) {
+            syrk< double, double >(
+                layout, uplo, trans, n, k,
+                alpha, A, lda, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int n_   = (blas_int) n;
@@ -137,6 +165,8 @@ void syrk(
     std::complex<float> beta,
     std::complex<float>       *C, int64_t ldc )
 {
+    blas_trace( "syrk", 'c', { layout, uplo, trans }, { n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -156,10 +186,21 @@ void syrk(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n, k } )) {
+            internal::syrk_split( layout, uplo, trans, n, k, alpha, A, lda,
+                                  beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldc } )) {
+            syrk< std::complex<float>, std::complex<float> >(
+                layout, uplo, trans, n, k,
+                alpha, A, lda, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int n_   = (blas_int) n;
@@ -195,6 +236,8 @@ void syrk(
     std::complex<double> beta,
     std::complex<double>       *C, int64_t ldc )
 {
+    blas_trace( "syrk", 'z', { layout, uplo, trans }, { n, k } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -214,10 +257,21 @@ void syrk(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( k   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldc > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n, k } )) {
+            internal::syrk_split( layout, uplo, trans, n, k, alpha, A, lda,
+                                  beta, C, ldc );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldc } )) {
+            syrk< std::complex<double>, std::complex<double> >(
+                layout, uplo, trans, n, k,
+                alpha, A, lda, beta, C, ldc );
+            return;
+        }
     }
 
     blas_int n_   = (blas_int) n;
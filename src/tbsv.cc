@@ -0,0 +1,288 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "dispatch.hh"
+#include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
+
+#include <limits>
+
+namespace blas {
+
+// =============================================================================
+// Overloaded wrappers for s, d, c, z precisions.
+
+// -----------------------------------------------------------------------------
+/// @ingroup tbsv
+void tbsv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t n, int64_t k,
+    float const *A, int64_t lda,
+    float       *x, int64_t incx )
+{
+    blas_trace( "tbsv", 's', { layout, uplo, trans, diag }, { n, k } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( diag != Diag::NonUnit &&
+                   diag != Diag::Unit );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( lda < k + 1 );
+    blas_error_if( incx == 0 );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(blas_int)) {
+        // band matrices are not split, so if any dimension, leading dimension,
+        // or increment overflows, use the int64_t template implementation
+        if (internal::split_needed( { n, lda, std::abs( incx ) } )) {
+            tbsv< float, float >(
+                layout, uplo, trans, diag, n, k, A, lda, x, incx );
+            return;
+        }
+    }
+
+    blas_int n_    = (blas_int) n;
+    blas_int k_    = (blas_int) k;
+    blas_int lda_  = (blas_int) lda;
+    blas_int incx_ = (blas_int) incx;
+
+    if (layout == Layout::RowMajor) {
+        // swap lower <=> upper
+        // A => A^T; A^T => A; A^H => A
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+        trans = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
+    }
+
+    char uplo_  = uplo2char( uplo );
+    char trans_ = op2char( trans );
+    char diag_  = diag2char( diag );
+    BLAS_stbsv( &uplo_, &trans_, &diag_, &n_, &k_, A, &lda_, x, &incx_ );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup tbsv
+void tbsv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t n, int64_t k,
+    double const *A, int64_t lda,
+    double       *x, int64_t incx )
+{
+    blas_trace( "tbsv", 'd', { layout, uplo, trans, diag }, { n, k } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( diag != Diag::NonUnit &&
+                   diag != Diag::Unit );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( lda < k + 1 );
+    blas_error_if( incx == 0 );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(blas_int)) {
+        // band matrices are not split, so if any dimension, leading dimension,
+        // or increment overflows, use the int64_t template implementation
+        if (internal::split_needed( { n, lda, std::abs( incx ) } )) {
+            tbsv< double, double >(
+                layout, uplo, trans, diag, n, k, A, lda, x, incx );
+            return;
+        }
+    }
+
+    blas_int n_    = (blas_int) n;
+    blas_int k_    = (blas_int) k;
+    blas_int lda_  = (blas_int) lda;
+    blas_int incx_ = (blas_int) incx;
+
+    if (layout == Layout::RowMajor) {
+        // swap lower <=> upper
+        // A => A^T; A^T => A; A^H => A
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+        trans = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
+    }
+
+    char uplo_  = uplo2char( uplo );
+    char trans_ = op2char( trans );
+    char diag_  = diag2char( diag );
+    BLAS_dtbsv( &uplo_, &trans_, &diag_, &n_, &k_, A, &lda_, x, &incx_ );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup tbsv
+void tbsv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t n, int64_t k,
+    std::complex<float> const *A, int64_t lda,
+    std::complex<float>       *x, int64_t incx )
+{
+    blas_trace( "tbsv", 'c', { layout, uplo, trans, diag }, { n, k } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( diag != Diag::NonUnit &&
+                   diag != Diag::Unit );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( lda < k + 1 );
+    blas_error_if( incx == 0 );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(blas_int)) {
+        // band matrices are not split, so if any dimension, leading dimension,
+        // or increment overflows, use the int64_t template implementation
+        if (internal::split_needed( { n, lda, std::abs( incx ) } )) {
+            tbsv< std::complex<float>, std::complex<float> >(
+                layout, uplo, trans, diag, n, k, A, lda, x, incx );
+            return;
+        }
+    }
+
+    blas_int n_    = (blas_int) n;
+    blas_int k_    = (blas_int) k;
+    blas_int lda_  = (blas_int) lda;
+    blas_int incx_ = (blas_int) incx;
+
+    blas::Op trans2 = trans;
+    if (layout == Layout::RowMajor) {
+        // swap lower <=> upper
+        // A => A^T; A^T => A; A^H => A
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+        trans2 = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
+
+        if (trans == Op::ConjTrans) {
+            // conjugate x (in-place)
+            int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
+            for (int64_t i = 0; i < n; ++i) {
+                x[ix] = conj( x[ix] );
+                ix += incx;
+            }
+        }
+    }
+
+    char uplo_  = uplo2char( uplo );
+    char trans_ = op2char( trans2 );
+    char diag_  = diag2char( diag );
+    BLAS_ctbsv( &uplo_, &trans_, &diag_, &n_, &k_,
+                (blas_complex_float*) A, &lda_,
+                (blas_complex_float*) x, &incx_ );
+
+    if (layout == Layout::RowMajor && trans == Op::ConjTrans) {
+        // conjugate x (in-place)
+        int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
+        for (int64_t i = 0; i < n; ++i) {
+            x[ix] = conj( x[ix] );
+            ix += incx;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup tbsv
+void tbsv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t n, int64_t k,
+    std::complex<double> const *A, int64_t lda,
+    std::complex<double>       *x, int64_t incx )
+{
+    blas_trace( "tbsv", 'z', { layout, uplo, trans, diag }, { n, k } );
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( diag != Diag::NonUnit &&
+                   diag != Diag::Unit );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( lda < k + 1 );
+    blas_error_if( incx == 0 );
+
+    // check for overflow in native BLAS integer type, if smaller than int64_t
+    if (sizeof(int64_t) > sizeof(blas_int)) {
+        // band matrices are not split, so if any dimension, leading dimension,
+        // or increment overflows, use the int64_t template implementation
+        if (internal::split_needed( { n, lda, std::abs( incx ) } )) {
+            tbsv< std::complex<double>, std::complex<double> >(
+                layout, uplo, trans, diag, n, k, A, lda, x, incx );
+            return;
+        }
+    }
+
+    blas_int n_    = (blas_int) n;
+    blas_int k_    = (blas_int) k;
+    blas_int lda_  = (blas_int) lda;
+    blas_int incx_ = (blas_int) incx;
+
+    blas::Op trans2 = trans;
+    if (layout == Layout::RowMajor) {
+        // swap lower <=> upper
+        // A => A^T; A^T => A; A^H => A
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+        trans2 = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
+
+        if (trans == Op::ConjTrans) {
+            // conjugate x (in-place)
+            int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
+            for (int64_t i = 0; i < n; ++i) {
+                x[ix] = conj( x[ix] );
+                ix += incx;
+            }
+        }
+    }
+
+    char uplo_  = uplo2char( uplo );
+    char trans_ = op2char( trans2 );
+    char diag_  = diag2char( diag );
+    BLAS_ztbsv( &uplo_, &trans_, &diag_, &n_, &k_,
+                (blas_complex_double*) A, &lda_,
+                (blas_complex_double*) x, &incx_ );
+
+    if (layout == Layout::RowMajor && trans == Op::ConjTrans) {
+        // conjugate x (in-place)
+        int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
+        for (int64_t i = 0; i < n; ++i) {
+            x[ix] = conj( x[ix] );
+            ix += incx;
+        }
+    }
+}
+
+}  // namespace blas
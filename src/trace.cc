@@ -0,0 +1,478 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "trace.hh"
+#include "blas/flops.hh"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+namespace blas {
+namespace internal {
+
+std::atomic<bool> trace_on( false );
+
+namespace {
+
+typedef std::chrono::steady_clock trace_clock;
+
+/// Start of tracing; record times are relative to it.
+const trace_clock::time_point trace_origin = trace_clock::now();
+
+/// @return seconds since trace_origin.
+double trace_time()
+{
+    return std::chrono::duration<double>(
+               trace_clock::now() - trace_origin ).count();
+}
+
+//------------------------------------------------------------------------------
+/// Ring buffer of records written by one thread. Only the owning thread
+/// writes; readers see records up to count, published with release order.
+/// Once full, new records overwrite the oldest.
+struct TraceBuffer {
+    static const int64_t capacity = 65536;
+
+    TraceBuffer( int thread_ ):
+        count( 0 ),
+        thread( thread_ ),
+        records( capacity )
+    {}
+
+    std::atomic<int64_t> count;  ///< records written, including overwritten
+    int thread;                  ///< index of thread, in order of first call
+    std::vector<TraceRecord> records;
+};
+
+/// Guards buffers. Taken once per thread, when it creates its buffer,
+/// and when writing or clearing the trace.
+std::mutex buffers_mutex;
+
+/// Buffers of all threads; kept after threads exit, until program exit.
+std::vector< TraceBuffer* > buffers;
+
+thread_local TraceBuffer* thread_buffer = nullptr;
+
+/// Number of traced calls running in this thread.
+thread_local int thread_depth = 0;
+
+/// Depth of this thread's outermost running call: 1 if it runs in a
+/// parallel region opened inside a traced call in another thread,
+/// e.g., gemm in the parallel loop of batch gemm; otherwise 0.
+thread_local int thread_base_depth = 0;
+
+#ifdef _OPENMP
+/// Number of threads with a traced call running, by the OpenMP level
+/// at which their outermost call started. A call starting in a thread
+/// at level L is nested if some thread has a call running at a level < L.
+const int max_levels = 8;
+std::atomic<int> level_calls[ max_levels ];
+
+/// OpenMP level of this thread's outermost running call.
+thread_local int thread_level = 0;
+#endif
+
+//------------------------------------------------------------------------------
+/// @return this thread's buffer, creating it on first use.
+TraceBuffer* get_thread_buffer()
+{
+    if (thread_buffer == nullptr) {
+        std::lock_guard< std::mutex > lock( buffers_mutex );
+        thread_buffer = new TraceBuffer( int( buffers.size() ) );
+        buffers.push_back( thread_buffer );
+    }
+    return thread_buffer;
+}
+
+//------------------------------------------------------------------------------
+/// Calls func( record, thread ) for each record in the buffers.
+/// Caller must hold buffers_mutex.
+template <typename Func>
+void for_each_record( Func func )
+{
+    for (TraceBuffer* buffer : buffers) {
+        int64_t count = buffer->count.load( std::memory_order_acquire );
+        int64_t first = std::max( int64_t( 0 ), count - TraceBuffer::capacity );
+        for (int64_t i = first; i < count; ++i) {
+            func( buffer->records[ i % TraceBuffer::capacity ],
+                  buffer->thread );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return Gflop of one problem of record r, for routine family,
+/// e.g., "gemm", with precision T; 0 for rotations.
+template <typename T>
+double trace_gflop( std::string const& family, TraceRecord const& r )
+{
+    typedef Gflop<T> G;
+    double d0 = double( r.dims[ 0 ] );
+    double d1 = double( r.dims[ 1 ] );
+    double d2 = double( r.dims[ 2 ] );
+    double d3 = double( r.dims[ 3 ] );
+    double d4 = double( r.dims[ 4 ] );
+
+    // options are layout, side, ... for symm, hemm, trmm, trsm
+    Side side = (r.opts[ 1 ] == 'R' ? Side::Right : Side::Left);
+
+    // Level 1: dims are n
+    if      (family == "asum")  return G::asum( d0 );
+    else if (family == "axpy")  return G::axpy( d0 );
+    else if (family == "copy")  return G::copy( d0 );
+    else if (family == "dot")   return G::dot( d0 );
+    else if (family == "dotu")  return G::dot( d0 );
+    else if (family == "iamax") return G::iamax( d0 );
+    else if (family == "nrm2")  return G::nrm2( d0 );
+    else if (family == "scal")  return G::scal( d0 );
+    else if (family == "swap")  return G::swap( d0 );
+
+    // Level 2: dims are m, n or n; band routines add kl, ku or k
+    else if (family == "gemv")  return G::gemv( d0, d1 );
+    else if (family == "gbmv")  return G::gbmv( d0, d1, d2, d3 );
+    else if (family == "ger")   return G::ger( d0, d1 );
+    else if (family == "geru")  return G::ger( d0, d1 );
+    else if (family == "hemv")  return G::hemv( d0 );
+    else if (family == "symv")  return G::symv( d0 );
+    else if (family == "hbmv")  return G::hbmv( d0, d1 );
+    else if (family == "sbmv")  return G::sbmv( d0, d1 );
+    else if (family == "her")   return G::her( d0 );
+    else if (family == "syr")   return G::syr( d0 );
+    else if (family == "her2")  return G::her2( d0 );
+    else if (family == "syr2")  return G::syr2( d0 );
+    else if (family == "trmv")  return G::trmv( d0 );
+    else if (family == "trsv")  return G::trsv( d0 );
+    else if (family == "tbmv")  return G::tbmv( d0, d1 );
+    else if (family == "tbsv")  return G::tbsv( d0, d1 );
+
+    // Level 3: dims are m, n, k or m, n or n, k; gbmm adds kl, ku
+    else if (family == "gemm")  return G::gemm( d0, d1, d2 );
+    else if (family == "gbmm")  return G::gbmm( d0, d1, d2, d3, d4 );
+    else if (family == "gemmt") return G::gemmt( d0, d1 );
+    else if (family == "hemm")  return G::hemm( side, d0, d1 );
+    else if (family == "symm")  return G::symm( side, d0, d1 );
+    else if (family == "herk")  return G::herk( d0, d1 );
+    else if (family == "syrk")  return G::syrk( d0, d1 );
+    else if (family == "her2k") return G::her2k( d0, d1 );
+    else if (family == "syr2k") return G::syr2k( d0, d1 );
+    else if (family == "trmm")  return G::trmm( side, d0, d1 );
+    else if (family == "trsm")  return G::trsm( side, d0, d1 );
+    else
+        return 0;
+}
+
+//------------------------------------------------------------------------------
+/// @return Gflop of record r, for all problems in a batch.
+double trace_gflop( TraceRecord const& r )
+{
+    // family: routine without batch_ prefix or _strided, _compact suffix
+    std::string family = r.routine;
+    if (family.compare( 0, 6, "batch_" ) == 0)
+        family = family.substr( 6 );
+    size_t pos = family.find( '_' );
+    if (pos != std::string::npos)
+        family = family.substr( 0, pos );
+
+    double gflop;
+    if (r.type == 'c' || r.type == 'z')
+        gflop = trace_gflop< std::complex<double> >( family, r );
+    else
+        gflop = trace_gflop< double >( family, r );
+    return gflop * r.batch;
+}
+
+//------------------------------------------------------------------------------
+/// Writes the summary and Chrome trace at exit, if any calls were traced.
+void trace_at_exit()
+{
+    bool empty = true;
+    {
+        std::lock_guard< std::mutex > lock( buffers_mutex );
+        for (TraceBuffer* buffer : buffers)
+            empty = empty && buffer->count.load() == 0;
+    }
+    if (empty)
+        return;
+
+    std::fprintf( stderr, "%s", trace_summary().c_str() );
+
+    char const* env = std::getenv( "BLASPP_TRACE_FILE" );
+    std::string filename = (env != nullptr ? env : "blaspp_trace.json");
+    try {
+        trace_write( filename );
+        std::fprintf( stderr, "BLAS++ trace written to %s\n",
+                      filename.c_str() );
+    }
+    catch (blas::Error const& ex) {
+        std::fprintf( stderr, "BLAS++: %s\n", ex.what() );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Turns tracing on if BLASPP_TRACE is set to a nonzero value.
+bool set_trace_from_env()
+{
+    char const* env = std::getenv( "BLASPP_TRACE" );
+    if (env != nullptr && std::atoi( env ) != 0)
+        set_trace( true );
+    return true;
+}
+
+const bool trace_from_env = set_trace_from_env();
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+/// Starts recording a call to routine with precision type, options
+/// (layout, side, uplo, trans, diag, in argument order), and dimensions
+/// (m, n, k, in argument order). For batch routines, options and
+/// dimensions are of the first problem.
+void Trace::start( char const* routine, char type,
+                   std::initializer_list<TraceOpt> opts,
+                   std::initializer_list<TraceDim> dims,
+                   int64_t batch, int device )
+{
+    record_.routine = routine;
+    record_.type    = type;
+    int i = 0;
+    for (auto opt : opts) {
+        if (i < TraceRecord::max_opts)
+            record_.opts[ i++ ] = opt.c;
+    }
+    for (; i < TraceRecord::max_opts; ++i)
+        record_.opts[ i ] = '\0';
+    int j = 0;
+    for (auto dim : dims) {
+        if (j < TraceRecord::max_dims)
+            record_.dims[ j++ ] = dim.d;
+    }
+    for (; j < TraceRecord::max_dims; ++j)
+        record_.dims[ j ] = 0;
+    record_.batch  = batch;
+    record_.device = device;
+    if (thread_depth == 0) {
+        thread_base_depth = 0;
+        #ifdef _OPENMP
+            thread_level = std::min( omp_get_level(), max_levels - 1 );
+            for (int level = 0; level < thread_level; ++level) {
+                if (level_calls[ level ].load( std::memory_order_acquire ) > 0) {
+                    thread_base_depth = 1;
+                    break;
+                }
+            }
+            level_calls[ thread_level ].fetch_add( 1, std::memory_order_release );
+        #endif
+    }
+    record_.depth  = thread_base_depth + thread_depth++;
+    record_.start  = trace_time();
+}
+
+//------------------------------------------------------------------------------
+/// Stops timing and saves the record in this thread's buffer.
+void Trace::finish()
+{
+    record_.stop = trace_time();
+    --thread_depth;
+    #ifdef _OPENMP
+        if (thread_depth == 0)
+            level_calls[ thread_level ].fetch_sub( 1, std::memory_order_release );
+    #endif
+
+    TraceBuffer* buffer = get_thread_buffer();
+    int64_t count = buffer->count.load( std::memory_order_relaxed );
+    buffer->records[ count % TraceBuffer::capacity ] = record_;
+    buffer->count.store( count + 1, std::memory_order_release );
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Turns call tracing on or off. Tracing records each call to a BLAS++
+/// routine, its options, dimensions, and wall time, in a per-thread ring
+/// buffer of the last 65536 calls. For device routines, the time is of
+/// launching the call on the queue, unless the queue is synchronized.
+///
+/// Setting BLASPP_TRACE=1 turns tracing on when BLAS++ is loaded.
+/// Once tracing is on, at exit BLAS++ prints trace_summary to stderr,
+/// and writes the Chrome trace to BLASPP_TRACE_FILE, by default
+/// blaspp_trace.json, if any calls were recorded.
+///
+/// Has no effect if BLAS++ was built without tracing (CMake trace=off).
+///
+void set_trace( bool enable )
+{
+    #ifdef BLAS_NO_TRACE
+        enable = false;
+    #endif
+
+    static std::once_flag at_exit;
+    if (enable) {
+        std::call_once( at_exit, [] {
+            std::atexit( internal::trace_at_exit );
+        } );
+    }
+    internal::trace_on.store( enable );
+}
+
+//------------------------------------------------------------------------------
+/// @return true if call tracing is on.
+bool get_trace()
+{
+    return internal::trace_on.load();
+}
+
+//------------------------------------------------------------------------------
+/// Discards all recorded calls.
+/// Not safe while other threads call traced routines.
+void trace_clear()
+{
+    using namespace internal;
+
+    std::lock_guard< std::mutex > lock( buffers_mutex );
+    for (TraceBuffer* buffer : buffers)
+        buffer->count.store( 0 );
+}
+
+//------------------------------------------------------------------------------
+/// @return table of recorded calls per routine, precision, and device,
+/// sorted by total time. Calls inside other traced calls, such as gemm
+/// in batch gemm, are left out so times are not counted twice, including
+/// calls in OpenMP threads of the enclosing call; they are in the Chrome
+/// trace.
+std::string trace_summary()
+{
+    using namespace internal;
+
+    struct Total {
+        int64_t calls = 0;
+        double  time  = 0;
+        double  gflop = 0;
+    };
+
+    // (routine, type, device) => totals
+    std::map< std::tuple< std::string, char, int >, Total > totals;
+    double total_time = 0;
+    int64_t total_calls = 0, nested_calls = 0, dropped = 0;
+    int threads = 0;
+    {
+        std::lock_guard< std::mutex > lock( buffers_mutex );
+        for_each_record( [&]( TraceRecord const& r, int ) {
+            if (r.depth > 0) {
+                ++nested_calls;
+                return;
+            }
+            Total& t = totals[ std::make_tuple( std::string( r.routine ),
+                                                r.type, r.device ) ];
+            double time = r.stop - r.start;
+            t.calls += 1;
+            t.time  += time;
+            t.gflop += trace_gflop( r );
+            total_time  += time;
+            total_calls += 1;
+        } );
+        for (TraceBuffer* buffer : buffers) {
+            int64_t count = buffer->count.load();
+            dropped += std::max( int64_t( 0 ), count - TraceBuffer::capacity );
+            threads += (count > 0);
+        }
+    }
+
+    // sort by time, descending
+    typedef std::pair< std::tuple< std::string, char, int >, Total > Item;
+    std::vector< Item > items( totals.begin(), totals.end() );
+    std::sort( items.begin(), items.end(),
+               [] (Item const& a, Item const& b) {
+                   return a.second.time > b.second.time;
+               } );
+
+    std::string summary;
+    char buf[ 256 ];
+    snprintf( buf, sizeof(buf),
+              "BLAS++ trace: %lld calls in %d threads, %.4f sec"
+              " (%lld nested calls not shown, %lld dropped)\n",
+              (long long) total_calls, threads, total_time,
+              (long long) nested_calls, (long long) dropped );
+    summary += buf;
+    snprintf( buf, sizeof(buf), "%-20s %4s %6s %10s %12s %7s %12s %10s\n",
+              "routine", "type", "device", "calls", "time (sec)", "% time",
+              "Gflop", "Gflop/s" );
+    summary += buf;
+    for (auto const& item : items) {
+        std::string const& routine = std::get<0>( item.first );
+        char type   = std::get<1>( item.first );
+        int  device = std::get<2>( item.first );
+        Total const& t = item.second;
+        char dev[ 16 ] = "host";
+        if (device >= 0)
+            snprintf( dev, sizeof(dev), "%d", device );
+        snprintf( buf, sizeof(buf),
+                  "%-20s %4c %6s %10lld %12.6f %7.2f %12.4f %10.4f\n",
+                  routine.c_str(), type, dev, (long long) t.calls, t.time,
+                  (total_time > 0 ? 100 * t.time / total_time : 0.),
+                  t.gflop, (t.time > 0 ? t.gflop / t.time : 0.) );
+        summary += buf;
+    }
+    return summary;
+}
+
+//------------------------------------------------------------------------------
+/// Writes recorded calls to filename in Chrome trace event format (JSON),
+/// to view in chrome://tracing or Perfetto. Each thread is a row, with
+/// nested calls below their callers. Throws Error if it cannot write.
+void trace_write( std::string const& filename )
+{
+    using namespace internal;
+
+    FILE* file = std::fopen( filename.c_str(), "w" );
+    blas_error_if_msg( file == nullptr, "cannot write %s", filename.c_str() );
+
+    std::fprintf( file, "{\"traceEvents\": [\n" );
+    {
+        std::lock_guard< std::mutex > lock( buffers_mutex );
+        bool first = true;
+        for_each_record( [&]( TraceRecord const& r, int thread ) {
+            // options as a string, with invalid ones as ?
+            char opts[ TraceRecord::max_opts + 1 ] = "";
+            int nopts = 0;
+            while (nopts < TraceRecord::max_opts && r.opts[ nopts ] != '\0') {
+                char c = r.opts[ nopts ];
+                opts[ nopts++ ] = (std::isalpha( (unsigned char) c ) ? c : '?');
+            }
+            opts[ nopts ] = '\0';
+            std::fprintf( file,
+                "%s{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\","
+                " \"ts\": %.3f, \"dur\": %.3f, \"pid\": 0, \"tid\": %d,"
+                " \"args\": {\"type\": \"%c\", \"opts\": \"%s\","
+                " \"dims\": [%lld, %lld, %lld, %lld, %lld], \"batch\": %lld,"
+                " \"device\": %d, \"gflop\": %.6g}}",
+                (first ? "" : ",\n"), r.routine,
+                (r.device >= 0 ? "device" : "host"),
+                1e6 * r.start, 1e6 * (r.stop - r.start), thread,
+                r.type, opts,
+                (long long) r.dims[ 0 ], (long long) r.dims[ 1 ],
+                (long long) r.dims[ 2 ], (long long) r.dims[ 3 ],
+                (long long) r.dims[ 4 ], (long long) r.batch,
+                r.device, trace_gflop( r ) );
+            first = false;
+        } );
+    }
+    std::fprintf( file, "\n]}\n" );
+
+    bool okay = (std::fclose( file ) == 0);
+    blas_error_if_msg( ! okay, "cannot write %s", filename.c_str() );
+}
+
+}  // namespace blas
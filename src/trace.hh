@@ -0,0 +1,144 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_TRACE_HH
+#define BLAS_TRACE_HH
+
+// Call tracing of BLAS++ routines.
+//
+// Each wrapper starts with blas_trace( routine, type, { options },
+// { dimensions } [, batch] [, queue] ). When tracing is off, that is one
+// load and branch; its arguments are not evaluated. When on, it records
+// the call and its wall time in a per-thread ring buffer, which only that
+// thread writes, so recording takes no locks. Flops are computed from the
+// options and dimensions when the trace is written (see trace.cc).
+// Building with -DBLAS_NO_TRACE (CMake trace=off) removes tracing.
+
+#include "blas.hh"
+
+#include <atomic>
+#include <initializer_list>
+#include <vector>
+
+namespace blas {
+namespace internal {
+
+/// true when tracing is on; see set_trace.
+extern std::atomic<bool> trace_on;
+
+//------------------------------------------------------------------------------
+/// Option of a traced call, as its LAPACK-style char. For batch routines,
+/// the option of the first problem.
+struct TraceOpt {
+    TraceOpt( Layout layout ): c( layout2char( layout ) ) {}
+    TraceOpt( Op     op     ): c( op2char( op ) ) {}
+    TraceOpt( Uplo   uplo   ): c( uplo2char( uplo ) ) {}
+    TraceOpt( Diag   diag   ): c( diag2char( diag ) ) {}
+    TraceOpt( Side   side   ): c( side2char( side ) ) {}
+
+    template <typename T>
+    TraceOpt( std::vector<T> const& opts ):
+        c( opts.empty() ? '?' : TraceOpt( opts[ 0 ] ).c ) {}
+
+    char c;
+};
+
+//------------------------------------------------------------------------------
+/// Dimension of a traced call. For batch routines, the dimension of the
+/// first problem.
+struct TraceDim {
+    TraceDim( int64_t dim ): d( dim ) {}
+
+    TraceDim( std::vector<int64_t> const& dims ):
+        d( dims.empty() ? 0 : dims[ 0 ] ) {}
+
+    int64_t d;
+};
+
+//------------------------------------------------------------------------------
+/// @return number of problems in a batch given by group sizes.
+inline int64_t trace_batch( std::vector<size_t> const& group_size )
+{
+    int64_t batch = 0;
+    for (size_t size : group_size)
+        batch += size;
+    return batch;
+}
+
+//------------------------------------------------------------------------------
+/// One traced call.
+struct TraceRecord {
+    static const int max_opts = 5;
+    static const int max_dims = 5;  ///< e.g., m, n, k, kl, ku for gbmm
+
+    char const* routine;        ///< e.g., "gemm", "batch_gemm"
+    char        type;           ///< precision: s, d, c, z, h, i
+    char        opts[ max_opts ];
+    int         depth;          ///< number of enclosing traced calls
+    int         device;         ///< device of queue, or -1 on host
+    int64_t     dims[ max_dims ];
+    int64_t     batch;          ///< number of problems
+    double      start;          ///< seconds since tracing began
+    double      stop;
+};
+
+//------------------------------------------------------------------------------
+/// Records a traced call when it goes out of scope.
+class Trace
+{
+public:
+    Trace()
+    {
+        record_.routine = nullptr;
+    }
+
+    ~Trace()
+    {
+        if (record_.routine != nullptr)
+            finish();
+    }
+
+    void start( char const* routine, char type,
+                std::initializer_list<TraceOpt> opts,
+                std::initializer_list<TraceDim> dims,
+                int64_t batch = 1, int device = -1 );
+
+    void start( char const* routine, char type,
+                std::initializer_list<TraceOpt> opts,
+                std::initializer_list<TraceDim> dims,
+                Queue const& queue )
+    {
+        start( routine, type, opts, dims, 1, queue.device() );
+    }
+
+    void start( char const* routine, char type,
+                std::initializer_list<TraceOpt> opts,
+                std::initializer_list<TraceDim> dims,
+                int64_t batch, Queue const& queue )
+    {
+        start( routine, type, opts, dims, batch, queue.device() );
+    }
+
+private:
+    void finish();
+
+    TraceRecord record_;
+};
+
+}  // namespace internal
+}  // namespace blas
+
+//------------------------------------------------------------------------------
+#ifdef BLAS_NO_TRACE
+    #define blas_trace( ... ) \
+        ((void) 0)
+#else
+    #define blas_trace( ... ) \
+        blas::internal::Trace blas_trace_; \
+        if (blas::internal::trace_on.load( std::memory_order_relaxed )) \
+            blas_trace_.start( __VA_ARGS__ )
+#endif
+
+#endif // BLAS_TRACE_HH
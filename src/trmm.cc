@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -27,6 +29,8 @@ void trmm(
     float const *A, int64_t lda,
     float       *B, int64_t ldb )
 {
+    blas_trace( "trmm", 's', { layout, side, uplo, trans, diag }, { m, n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -54,10 +58,21 @@ void trmm(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::trmm_split( layout, side, uplo, trans, diag, m, n, alpha,
+                                  A, lda, B, ldb );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb } )) {
+            trmm< float, float >(
+                layout, side, uplo, trans, diag, m, n,
+                alpha, A, lda, B, ldb );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
@@ -94,6 +109,8 @@ void trmm(
     double const *A, int64_t lda,
     double       *B, int64_t ldb )
 {
+    blas_trace( "trmm", 'd', { layout, side, uplo, trans, diag }, { m, n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -121,10 +138,21 @@ void trmm(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::trmm_split( layout, side, uplo, trans, diag, m, n, alpha,
+                                  A, lda, B, ldb );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb } )) {
+            trmm< double, double >(
+                layout, side, uplo, trans, diag, m, n,
+                alpha, A, lda, B, ldb );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
@@ -161,6 +189,8 @@ void trmm(
     std::complex<float> const *A, int64_t lda,
     std::complex<float>       *B, int64_t ldb )
 {
+    blas_trace( "trmm", 'c', { layout, side, uplo, trans, diag }, { m, n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -188,10 +218,21 @@ void trmm(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::trmm_split( layout, side, uplo, trans, diag, m, n, alpha,
+                                  A, lda, B, ldb );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb } )) {
+            trmm< std::complex<float>, std::complex<float> >(
+                layout, side, uplo, trans, diag, m, n,
+                alpha, A, lda, B, ldb );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
@@ -230,6 +271,8 @@ void trmm(
     std::complex<double> const *A, int64_t lda,
     std::complex<double>       *B, int64_t ldb )
 {
+    blas_trace( "trmm", 'z', { layout, side, uplo, trans, diag }, { m, n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -257,10 +300,21 @@ void trmm(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( m   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( n   > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda > std::numeric_limits<blas_int>::max() );
-        blas_error_if( ldb > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { m, n } )) {
+            internal::trmm_split( layout, side, uplo, trans, diag, m, n, alpha,
+                                  A, lda, B, ldb );
+            return;
+        }
+
+        // leading dimensions cannot be split, so if they overflow, use the
+        // int64_t template implementation
+        if (internal::split_needed( { lda, ldb } )) {
+            trmm< std::complex<double>, std::complex<double> >(
+                layout, side, uplo, trans, diag, m, n,
+                alpha, A, lda, B, ldb );
+            return;
+        }
     }
 
     blas_int m_   = (blas_int) m;
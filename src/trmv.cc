@@ -3,8 +3,10 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "blas/fortran.h"
+#include "dispatch.hh"
 #include "blas.hh"
+#include "split.hh"
+#include "trace.hh"
 
 #include <limits>
 
@@ -24,6 +26,8 @@ void trmv(
     float const *A, int64_t lda,
     float       *x, int64_t incx )
 {
+    blas_trace( "trmv", 's', { layout, uplo, trans, diag }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -40,9 +44,20 @@ void trmv(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::trmv_split( layout, uplo, trans, diag, n, A, lda,
+                                  x, incx );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ) } )) {
+            trmv< float, float >(
+                layout, uplo, trans, diag, n, A, lda, x, incx );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -73,6 +88,8 @@ void trmv(
     double const *A, int64_t lda,
     double       *x, int64_t incx )
 {
+    blas_trace( "trmv", 'd', { layout, uplo, trans, diag }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -89,9 +106,20 @@ void trmv(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::trmv_split( layout, uplo, trans, diag, n, A, lda,
+                                  x, incx );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ) } )) {
+            trmv< double, double >(
+                layout, uplo, trans, diag, n, A, lda, x, incx );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -122,6 +150,8 @@ void trmv(
     std::complex<float> const *A, int64_t lda,
     std::complex<float>       *x, int64_t incx )
 {
+    blas_trace( "trmv", 'c', { layout, uplo, trans, diag }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -138,9 +168,20 @@ void trmv(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::trmv_split( layout, uplo, trans, diag, n, A, lda,
+                                  x, incx );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ) } )) {
+            trmv< std::complex<float>, std::complex<float> >(
+                layout, uplo, trans, diag, n, A, lda, x, incx );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -192,6 +233,8 @@ void trmv(
     std::complex<double> const *A, int64_t lda,
     std::complex<double>       *x, int64_t incx )
 {
+    blas_trace( "trmv", 'z', { layout, uplo, trans, diag }, { n } );
+
     // check arguments
     blas_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -208,9 +251,20 @@ void trmv(
 
     // check for overflow in native BLAS integer type, if smaller than int64_t
     if (sizeof(int64_t) > sizeof(blas_int)) {
-        blas_error_if( n              > std::numeric_limits<blas_int>::max() );
-        blas_error_if( lda            > std::numeric_limits<blas_int>::max() );
-        blas_error_if( std::abs(incx) > std::numeric_limits<blas_int>::max() );
+        // split dimensions that overflow into blocks
+        if (internal::split_needed( { n } )) {
+            internal::trmv_split( layout, uplo, trans, diag, n, A, lda,
+                                  x, incx );
+            return;
+        }
+
+        // leading dimensions and increments cannot be split, so if they
+        // overflow, use the int64_t template implementation
+        if (internal::split_needed( { lda, std::abs( incx ) } )) {
+            trmv< std::complex<double>, std::complex<double> >(
+                layout, uplo, trans, diag, n, A, lda, x, incx );
+            return;
+        }
     }
 
     blas_int n_    = (blas_int) n;
@@ -0,0 +1,415 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "tune.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace blas {
+namespace internal {
+
+std::atomic<double> tune_crossover[ int( Tune::num_routines ) ];
+
+std::atomic<int> tune_loaded( 0 );
+
+namespace {
+
+/// Names of tuned routines, in the order of Tune.
+char const* const tune_names[] = {
+    #define BLAS_TUNE_NAME( name, family ) #name,
+    BLAS_TUNE_ROUTINES( BLAS_TUNE_NAME )
+    #undef BLAS_TUNE_NAME
+};
+
+/// BLAS++ names of tuned routines, for all precisions, e.g., "dot".
+char const* const tune_families[] = {
+    #define BLAS_TUNE_FAMILY( name, family ) #family,
+    BLAS_TUNE_ROUTINES( BLAS_TUNE_FAMILY )
+    #undef BLAS_TUNE_FAMILY
+};
+
+const int num_tuned = int( Tune::num_routines );
+
+//------------------------------------------------------------------------------
+/// @return index of routine in Tune, or -1 if it is not tuned.
+int tune_index( std::string const& routine )
+{
+    for (int i = 0; i < num_tuned; ++i) {
+        if (routine == tune_names[ i ])
+            return i;
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+/// @return true if routine names tune_names[ index ]: either all routines,
+/// if routine is empty, its name (dgemm), or its BLAS++ family (gemm
+/// matches sgemm, dgemm, cgemm, zgemm; dot matches sdot, ddot, cdotc, zdotc).
+bool tune_matches( std::string const& routine, int index )
+{
+    return routine.empty()
+           || routine == tune_names[ index ]
+           || routine == tune_families[ index ];
+}
+
+//------------------------------------------------------------------------------
+/// @return default tuning file: BLASPP_TUNE_FILE if set,
+/// otherwise $HOME/.blaspp_tune, or empty if HOME is not set.
+std::string tune_file()
+{
+    char const* env = std::getenv( "BLASPP_TUNE_FILE" );
+    if (env != nullptr)
+        return env;
+    char const* home = std::getenv( "HOME" );
+    if (home != nullptr)
+        return std::string( home ) + "/.blaspp_tune";
+    return "";
+}
+
+//------------------------------------------------------------------------------
+/// Reads crossovers from filename, ignoring unknown routines.
+/// @return false if the file cannot be opened.
+bool tune_read( std::string const& filename )
+{
+    std::ifstream file( filename );
+    if (! file)
+        return false;
+
+    std::string line;
+    while (std::getline( file, line )) {
+        std::istringstream words( line );
+        std::string routine;
+        double work;
+        if (words >> routine >> work && routine[ 0 ] != '#' && work >= 0) {
+            int i = tune_index( routine );
+            if (i >= 0)
+                tune_crossover[ i ].store( work );
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+/// Writes all crossovers to filename. Throws Error on failure.
+void tune_write( std::string const& filename )
+{
+    FILE* file = std::fopen( filename.c_str(), "w" );
+    blas_error_if_msg( file == nullptr, "cannot write %s", filename.c_str() );
+
+    std::fprintf( file,
+        "# BLAS++ crossovers: the template implementation is used when\n"
+        "# the work is below the crossover; otherwise, the native BLAS.\n"
+        "# Work is n for axpy and dot, m*n for gemv, m*n*k for gemm.\n" );
+    for (int i = 0; i < num_tuned; ++i) {
+        std::fprintf( file, "%-8s %.0f\n",
+                      tune_names[ i ], tune_crossover[ i ].load() );
+    }
+    bool okay = (std::fclose( file ) == 0);
+    blas_error_if_msg( ! okay, "cannot write %s", filename.c_str() );
+}
+
+//==============================================================================
+// Benchmarks
+
+//------------------------------------------------------------------------------
+/// @return seconds per call of func, the best of 3 trials, each running
+/// func in groups of 8 calls for at least 1 ms.
+template <typename Func>
+double time_call( Func func )
+{
+    typedef std::chrono::steady_clock clock;
+    const double min_time = 1e-3;
+
+    func();  // warm up
+    double best = std::numeric_limits<double>::infinity();
+    for (int trial = 0; trial < 3; ++trial) {
+        int64_t calls = 0;
+        double elapsed = 0;
+        auto start = clock::now();
+        do {
+            for (int i = 0; i < 8; ++i)
+                func();
+            calls += 8;
+            elapsed = std::chrono::duration<double>(
+                          clock::now() - start ).count();
+        } while (elapsed < min_time);
+        best = std::min( best, elapsed / calls );
+    }
+    return best;
+}
+
+//------------------------------------------------------------------------------
+/// Times the native BLAS and the template for each size n in turn;
+/// bench( n, native ) returns seconds per call of either one.
+/// @return work( n ) for the first size n where the native BLAS is as fast
+/// as the template; the work of the largest size if the template is
+/// always faster; or 0 if the native BLAS is as fast already at the
+/// smallest size.
+template <typename Work, typename Bench>
+double find_crossover( std::vector<int64_t> const& sizes,
+                       Work work, Bench bench )
+{
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        double time_native   = bench( sizes[ i ], true  );
+        double time_template = bench( sizes[ i ], false );
+        if (time_native <= time_template)
+            return (i == 0 ? 0 : work( sizes[ i ] ));
+    }
+    return work( sizes.back() );
+}
+
+//------------------------------------------------------------------------------
+/// @return crossover for axpy, over vectors of length n.
+template <typename T>
+double tune_axpy()
+{
+    const T alpha = 0.5;
+    return find_crossover(
+        { 4, 8, 16, 32, 64, 128, 256, 512, 1024, 4096, 16384 },
+        [] (int64_t n) { return double( n ); },
+        [&] (int64_t n, bool native) {
+            std::vector<T> x( n, T( 1 ) ), y( n, T( 1 ) );
+            if (native) {
+                return time_call( [&] {
+                    blas::axpy( n, alpha, x.data(), 1, y.data(), 1 );
+                } );
+            }
+            else {
+                return time_call( [&] {
+                    blas::axpy<T, T>( n, alpha, x.data(), 1, y.data(), 1 );
+                } );
+            }
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// @return crossover for dot (dotc for complex), over vectors of length n.
+template <typename T>
+double tune_dot()
+{
+    return find_crossover(
+        { 4, 8, 16, 32, 64, 128, 256, 512, 1024, 4096, 16384 },
+        [] (int64_t n) { return double( n ); },
+        [&] (int64_t n, bool native) {
+            std::vector<T> x( n, T( 1 ) ), y( n, T( 1 ) );
+            volatile real_type<T> sink = 0;
+            if (native) {
+                return time_call( [&] {
+                    sink = real( blas::dot( n, x.data(), 1, y.data(), 1 ) );
+                } );
+            }
+            else {
+                return time_call( [&] {
+                    sink = real( blas::dot<T, T>( n, x.data(), 1,
+                                                     y.data(), 1 ) );
+                } );
+            }
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// @return crossover for gemv, over n-by-n matrices.
+template <typename T>
+double tune_gemv()
+{
+    const T alpha = 0.5, beta = 0.5;
+    return find_crossover(
+        { 2, 4, 8, 12, 16, 24, 32, 48, 64, 128, 256, 512 },
+        [] (int64_t n) { return double( n ) * n; },
+        [&] (int64_t n, bool native) {
+            std::vector<T> A( n*n, T( 1 ) ), x( n, T( 1 ) ), y( n, T( 1 ) );
+            if (native) {
+                return time_call( [&] {
+                    blas::gemv( Layout::ColMajor, Op::NoTrans, n, n,
+                                alpha, A.data(), n, x.data(), 1,
+                                beta, y.data(), 1 );
+                } );
+            }
+            else {
+                return time_call( [&] {
+                    blas::gemv<T, T, T>( Layout::ColMajor, Op::NoTrans, n, n,
+                                         alpha, A.data(), n, x.data(), 1,
+                                         beta, y.data(), 1 );
+                } );
+            }
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// @return crossover for gemm, over n-by-n matrices.
+template <typename T>
+double tune_gemm()
+{
+    const T alpha = 0.5, beta = 0.5;
+    return find_crossover(
+        { 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128, 256 },
+        [] (int64_t n) { return double( n ) * n * n; },
+        [&] (int64_t n, bool native) {
+            std::vector<T> A( n*n, T( 1 ) ), B( n*n, T( 1 ) ),
+                           C( n*n, T( 1 ) );
+            if (native) {
+                return time_call( [&] {
+                    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                                n, n, n, alpha, A.data(), n, B.data(), n,
+                                beta, C.data(), n );
+                } );
+            }
+            else {
+                return time_call( [&] {
+                    blas::gemm<T, T, T>( Layout::ColMajor, Op::NoTrans,
+                                         Op::NoTrans, n, n, n,
+                                         alpha, A.data(), n, B.data(), n,
+                                         beta, C.data(), n );
+                } );
+            }
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// @return measured crossover for routine Tune( index ).
+double tune_routine( int index )
+{
+    switch (Tune( index )) {
+        case Tune::saxpy: return tune_axpy< float >();
+        case Tune::daxpy: return tune_axpy< double >();
+        case Tune::caxpy: return tune_axpy< std::complex<float> >();
+        case Tune::zaxpy: return tune_axpy< std::complex<double> >();
+
+        case Tune::sdot:  return tune_dot< float >();
+        case Tune::ddot:  return tune_dot< double >();
+        case Tune::cdotc: return tune_dot< std::complex<float> >();
+        case Tune::zdotc: return tune_dot< std::complex<double> >();
+
+        case Tune::sgemv: return tune_gemv< float >();
+        case Tune::dgemv: return tune_gemv< double >();
+        case Tune::cgemv: return tune_gemv< std::complex<float> >();
+        case Tune::zgemv: return tune_gemv< std::complex<double> >();
+
+        case Tune::sgemm: return tune_gemm< float >();
+        case Tune::dgemm: return tune_gemm< double >();
+        case Tune::cgemm: return tune_gemm< std::complex<float> >();
+        case Tune::zgemm: return tune_gemm< std::complex<double> >();
+
+        default: return 0;
+    }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+/// Loads crossovers from the tuning file on first use of a tuned routine.
+/// If there is no tuning file and BLASPP_AUTOTUNE is set to a nonzero
+/// value, runs autotune to create it. Calls during loading, including
+/// those by autotune, see crossovers of 0 and use the native BLAS.
+void tune_load()
+{
+    if (tune_loaded.exchange( 1 ) != 0)
+        return;
+
+    std::string filename = tune_file();
+    if (! filename.empty() && tune_read( filename ))
+        return;
+
+    char const* env = std::getenv( "BLASPP_AUTOTUNE" );
+    if (env != nullptr && std::atoi( env ) != 0) {
+        try {
+            autotune();
+        }
+        catch (blas::Error const& ex) {
+            std::fprintf( stderr, "BLAS++: BLASPP_AUTOTUNE: %s\n", ex.what() );
+        }
+    }
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Measures crossovers between the native BLAS and the template
+/// implementations, and saves them for later runs. Tuned routines are
+/// axpy, dot (dotc for complex), gemv, and gemm, in all precisions.
+/// Each is timed over a grid of sizes; its crossover is the work
+/// (n for axpy and dot, m*n for gemv, m*n*k for gemm) of the smallest
+/// size where the native BLAS is as fast as the template. The wrappers
+/// call the template for smaller problems.
+///
+/// Run this once after installing BLAS++, or at first use by setting
+/// BLASPP_AUTOTUNE=1. It takes a few seconds per routine.
+/// Not safe while other threads call BLAS++.
+///
+/// @param[in] filename
+///     File to save the crossover table in. If empty (default),
+///     BLASPP_TUNE_FILE if set, otherwise $HOME/.blaspp_tune, which
+///     BLAS++ reads on first use.
+///
+/// @param[in] routine
+///     Routine to tune, e.g., "dgemm"; or "gemm" for all precisions;
+///     or empty (default) for all routines. Other routines keep their
+///     crossovers, and all are saved.
+///
+void autotune( std::string const& filename, std::string const& routine )
+{
+    using namespace internal;
+
+    tune_load();
+
+    bool found = false;
+    for (int i = 0; i < num_tuned; ++i) {
+        if (tune_matches( routine, i )) {
+            found = true;
+            // time the native BLAS without the crossover
+            tune_crossover[ i ].store( 0 );
+            tune_crossover[ i ].store( tune_routine( i ) );
+        }
+    }
+    blas_error_if_msg( ! found, "unknown tuned routine %s", routine.c_str() );
+
+    std::string file = (filename.empty() ? tune_file() : filename);
+    if (! file.empty())
+        tune_write( file );
+}
+
+//------------------------------------------------------------------------------
+/// @return crossover work of routine, e.g., "dgemm": the wrapper calls the
+/// template implementation for problems with less work. See autotune.
+///
+double get_crossover( std::string const& routine )
+{
+    using namespace internal;
+
+    tune_load();
+    int i = tune_index( routine );
+    blas_error_if_msg( i < 0, "unknown tuned routine %s", routine.c_str() );
+    return tune_crossover[ i ].load();
+}
+
+//------------------------------------------------------------------------------
+/// Sets crossover work of routine, e.g., "dgemm"; or "gemm" for all
+/// precisions. 0 always uses the native BLAS. Not saved; see autotune.
+///
+void set_crossover( std::string const& routine, double work )
+{
+    using namespace internal;
+
+    tune_load();
+    blas_error_if( work < 0 );
+    bool found = false;
+    for (int i = 0; i < num_tuned; ++i) {
+        if (! routine.empty() && tune_matches( routine, i )) {
+            found = true;
+            tune_crossover[ i ].store( work );
+        }
+    }
+    blas_error_if_msg( ! found, "unknown tuned routine %s", routine.c_str() );
+}
+
+}  // namespace blas
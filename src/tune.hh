@@ -0,0 +1,64 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_TUNE_HH
+#define BLAS_TUNE_HH
+
+// Crossover table between the native BLAS and the template implementations.
+//
+// For small problems, argument checks and the call into the native BLAS
+// can cost more than the operation, so the inline templates are faster.
+// The wrappers for the tuned routines ask use_template whether the work
+// (n for Level 1, m*n for gemv, m*n*k for gemm) is below the tuned
+// crossover, and if so call the template instead. Crossovers are 0, so
+// the native BLAS is always used, until a table is loaded from the tuning
+// file or measured by blas::autotune (see tune.cc).
+
+#include "blas.hh"
+
+#include <atomic>
+
+namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// X( routine, BLAS++ routine ) for each tuned routine. The BLAS++ routine
+/// names the family for autotune and set_crossover, e.g., dot for cdotc.
+#define BLAS_TUNE_ROUTINES( X ) \
+    X( saxpy, axpy ) X( daxpy, axpy ) X( caxpy, axpy ) X( zaxpy, axpy ) \
+    X( sdot,  dot  ) X( ddot,  dot  ) X( cdotc, dot  ) X( zdotc, dot  ) \
+    X( sgemv, gemv ) X( dgemv, gemv ) X( cgemv, gemv ) X( zgemv, gemv ) \
+    X( sgemm, gemm ) X( dgemm, gemm ) X( cgemm, gemm ) X( zgemm, gemm )
+
+enum class Tune {
+    #define BLAS_TUNE_ENUM( name, family ) name,
+    BLAS_TUNE_ROUTINES( BLAS_TUNE_ENUM )
+    #undef BLAS_TUNE_ENUM
+    num_routines
+};
+
+/// Crossover work for each routine; the template is used below it.
+extern std::atomic<double> tune_crossover[ int( Tune::num_routines ) ];
+
+/// 0 until the crossover table is loaded, then 1.
+extern std::atomic<int> tune_loaded;
+
+void tune_load();
+
+//------------------------------------------------------------------------------
+/// @return true if the template implementation is faster than the native
+/// BLAS for routine with the given work. Loads the tuning file on first use.
+inline bool use_template( Tune routine, double work )
+{
+    if (tune_loaded.load( std::memory_order_acquire ) == 0)
+        tune_load();
+    return work < tune_crossover[ int( routine ) ].load(
+                      std::memory_order_relaxed );
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif // BLAS_TUNE_HH
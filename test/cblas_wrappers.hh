@@ -45,6 +45,7 @@
 #include "blas/util.hh"
 
 #include <complex>
+#include <vector>
 
 // =============================================================================
 // constants
@@ -1152,6 +1153,222 @@ cblas_syr2(
     fprintf( stderr, "zsyr2 unavailable\n" );
 }
 
+// -----------------------------------------------------------------------------
+inline void
+cblas_gbmv(
+    CBLAS_LAYOUT layout, CBLAS_TRANSPOSE trans, int m, int n, int kl, int ku,
+    float  alpha,
+    float const *A, int lda,
+    float const *x, int incx,
+    float  beta,
+    float* y, int incy )
+{
+    cblas_sgbmv( layout, trans, m, n, kl, ku,
+                 alpha, A, lda, x, incx, beta, y, incy );
+}
+
+inline void
+cblas_gbmv(
+    CBLAS_LAYOUT layout, CBLAS_TRANSPOSE trans, int m, int n, int kl, int ku,
+    double  alpha,
+    double const *A, int lda,
+    double const *x, int incx,
+    double  beta,
+    double* y, int incy )
+{
+    cblas_dgbmv( layout, trans, m, n, kl, ku,
+                 alpha, A, lda, x, incx, beta, y, incy );
+}
+
+inline void
+cblas_gbmv(
+    CBLAS_LAYOUT layout, CBLAS_TRANSPOSE trans, int m, int n, int kl, int ku,
+    std::complex<float>  alpha,
+    std::complex<float> const *A, int lda,
+    std::complex<float> const *x, int incx,
+    std::complex<float>  beta,
+    std::complex<float>* y, int incy )
+{
+    cblas_cgbmv( layout, trans, m, n, kl, ku,
+                 &alpha, A, lda, x, incx, &beta, y, incy );
+}
+
+inline void
+cblas_gbmv(
+    CBLAS_LAYOUT layout, CBLAS_TRANSPOSE trans, int m, int n, int kl, int ku,
+    std::complex<double>  alpha,
+    std::complex<double> const *A, int lda,
+    std::complex<double> const *x, int incx,
+    std::complex<double>  beta,
+    std::complex<double>* y, int incy )
+{
+    cblas_zgbmv( layout, trans, m, n, kl, ku,
+                 &alpha, A, lda, x, incx, &beta, y, incy );
+}
+
+// -----------------------------------------------------------------------------
+inline void
+cblas_hbmv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, int n, int k,
+    float  alpha,
+    float const *A, int lda,
+    float const *x, int incx,
+    float  beta,
+    float* y, int incy )
+{
+    cblas_ssbmv( layout, uplo, n, k,
+                 alpha, A, lda, x, incx, beta, y, incy );
+}
+
+inline void
+cblas_hbmv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, int n, int k,
+    double  alpha,
+    double const *A, int lda,
+    double const *x, int incx,
+    double  beta,
+    double* y, int incy )
+{
+    cblas_dsbmv( layout, uplo, n, k,
+                 alpha, A, lda, x, incx, beta, y, incy );
+}
+
+inline void
+cblas_hbmv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, int n, int k,
+    std::complex<float>  alpha,
+    std::complex<float> const *A, int lda,
+    std::complex<float> const *x, int incx,
+    std::complex<float>  beta,
+    std::complex<float>* y, int incy )
+{
+    cblas_chbmv( layout, uplo, n, k,
+                 &alpha, A, lda, x, incx, &beta, y, incy );
+}
+
+inline void
+cblas_hbmv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, int n, int k,
+    std::complex<double>  alpha,
+    std::complex<double> const *A, int lda,
+    std::complex<double> const *x, int incx,
+    std::complex<double>  beta,
+    std::complex<double>* y, int incy )
+{
+    cblas_zhbmv( layout, uplo, n, k,
+                 &alpha, A, lda, x, incx, &beta, y, incy );
+}
+
+// -----------------------------------------------------------------------------
+// CBLAS lacks [cz]sbmv; see hbmv
+inline void
+cblas_sbmv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, int n, int k,
+    float  alpha,
+    float const *A, int lda,
+    float const *x, int incx,
+    float  beta,
+    float* y, int incy )
+{
+    cblas_ssbmv( layout, uplo, n, k,
+                 alpha, A, lda, x, incx, beta, y, incy );
+}
+
+inline void
+cblas_sbmv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, int n, int k,
+    double  alpha,
+    double const *A, int lda,
+    double const *x, int incx,
+    double  beta,
+    double* y, int incy )
+{
+    cblas_dsbmv( layout, uplo, n, k,
+                 alpha, A, lda, x, incx, beta, y, incy );
+}
+
+// -----------------------------------------------------------------------------
+inline void
+cblas_tbmv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, int n, int k,
+    float const *A, int lda,
+    float* x, int incx )
+{
+    cblas_stbmv( layout, uplo, trans, diag, n, k,
+                 A, lda, x, incx );
+}
+
+inline void
+cblas_tbmv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, int n, int k,
+    double const *A, int lda,
+    double* x, int incx )
+{
+    cblas_dtbmv( layout, uplo, trans, diag, n, k,
+                 A, lda, x, incx );
+}
+
+inline void
+cblas_tbmv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, int n, int k,
+    std::complex<float> const *A, int lda,
+    std::complex<float>* x, int incx )
+{
+    cblas_ctbmv( layout, uplo, trans, diag, n, k,
+                 A, lda, x, incx );
+}
+
+inline void
+cblas_tbmv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, int n, int k,
+    std::complex<double> const *A, int lda,
+    std::complex<double>* x, int incx )
+{
+    cblas_ztbmv( layout, uplo, trans, diag, n, k,
+                 A, lda, x, incx );
+}
+
+// -----------------------------------------------------------------------------
+inline void
+cblas_tbsv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, int n, int k,
+    float const *A, int lda,
+    float* x, int incx )
+{
+    cblas_stbsv( layout, uplo, trans, diag, n, k,
+                 A, lda, x, incx );
+}
+
+inline void
+cblas_tbsv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, int n, int k,
+    double const *A, int lda,
+    double* x, int incx )
+{
+    cblas_dtbsv( layout, uplo, trans, diag, n, k,
+                 A, lda, x, incx );
+}
+
+inline void
+cblas_tbsv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, int n, int k,
+    std::complex<float> const *A, int lda,
+    std::complex<float>* x, int incx )
+{
+    cblas_ctbsv( layout, uplo, trans, diag, n, k,
+                 A, lda, x, incx );
+}
+
+inline void
+cblas_tbsv(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, int n, int k,
+    std::complex<double> const *A, int lda,
+    std::complex<double>* x, int incx )
+{
+    cblas_ztbsv( layout, uplo, trans, diag, n, k,
+                 A, lda, x, incx );
+}
+
 
 // =============================================================================
 // Level 3 BLAS
@@ -1217,6 +1434,28 @@ cblas_gemm(
                  &beta,  C, ldc );
 }
 
+// 16-bit A and B are copied to float.
+template <typename T16>
+inline typename std::enable_if< blas::is_low_precision<T16>::value >::type
+cblas_gemm(
+    CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB,
+    int m, int n, int k,
+    float  alpha,
+    T16 const *A, int lda,
+    T16 const *B, int ldb,
+    float  beta,
+    float* C, int ldc )
+{
+    bool col = (layout == CblasColMajor);
+    int An = (col == (transA == CblasNoTrans) ? k : m);
+    int Bn = (col == (transB == CblasNoTrans) ? n : k);
+    std::vector<float> Af( A, A + size_t(lda)*An );
+    std::vector<float> Bf( B, B + size_t(ldb)*Bn );
+    cblas_sgemm( layout, transA, transB, m, n, k,
+                 alpha, Af.data(), lda, Bf.data(), ldb,
+                 beta,  C, ldc );
+}
+
 // -----------------------------------------------------------------------------
 inline void
 cblas_hemm(
@@ -1431,6 +1670,21 @@ cblas_syrk(
     cblas_zsyrk( layout, uplo, trans, n, k, &alpha, A, lda, &beta, C, ldc );
 }
 
+// 16-bit A is copied to float.
+template <typename T16>
+inline typename std::enable_if< blas::is_low_precision<T16>::value >::type
+cblas_syrk(
+    CBLAS_LAYOUT layout, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, int n, int k,
+    float alpha,
+    T16 const *A, int lda,
+    float beta,
+    float*       C, int ldc )
+{
+    int An = ((layout == CblasColMajor) == (trans == CblasNoTrans) ? k : n);
+    std::vector<float> Af( A, A + size_t(lda)*An );
+    cblas_ssyrk( layout, uplo, trans, n, k, alpha, Af.data(), lda, beta, C, ldc );
+}
+
 
 // -----------------------------------------------------------------------------
 inline void
@@ -1631,4 +1885,20 @@ cblas_trsm(
     cblas_ztrsm( layout, side, uplo, trans, diag, m, n, &alpha, A, lda, B, ldb );
 }
 
+// 16-bit A is copied to float.
+template <typename T16>
+inline typename std::enable_if< blas::is_low_precision<T16>::value >::type
+cblas_trsm(
+    CBLAS_LAYOUT layout, CBLAS_SIDE side, CBLAS_UPLO uplo,
+    CBLAS_TRANSPOSE trans, CBLAS_DIAG diag,
+    int m, int n,
+    float alpha,
+    T16 const *A, int lda,
+    float       *B, int ldb )
+{
+    int Am = (side == CblasLeft ? m : n);
+    std::vector<float> Af( A, A + size_t(lda)*Am );
+    cblas_strsm( layout, side, uplo, trans, diag, m, n, alpha, Af.data(), lda, B, ldb );
+}
+
 #endif        //  #ifndef CBLAS_HH
@@ -154,4 +154,39 @@ void check_herk(
     #undef Cref
 }
 
+// -----------------------------------------------------------------------------
+// Checks the parts of a symmetric or Hermitian result that the update must
+// not change. The triangle opposite uplo must equal the original C0 exactly.
+// If real_diag, the diagonal imaginary parts must be zero, as herk and her2k
+// set them. Column-major; for row-major, pass the opposite uplo.
+// Returns the number of entries that fail.
+template< typename T >
+int64_t check_herk_structure(
+    blas::Uplo uplo, bool real_diag,
+    int64_t n,
+    T const* C0, int64_t ldc0,
+    T const* C, int64_t ldc )
+{
+    #define  C(i_, j_)  C[ (i_) + (j_)*ldc ]
+    #define C0(i_, j_) C0[ (i_) + (j_)*ldc0 ]
+
+    int64_t count = 0;
+    for (int64_t j = 0; j < n; ++j) {
+        if (uplo == blas::Uplo::Lower) {
+            for (int64_t i = 0; i < j; ++i)  // upper
+                count += (C(i, j) != C0(i, j));
+        }
+        else {
+            for (int64_t i = j+1; i < n; ++i)  // lower
+                count += (C(i, j) != C0(i, j));
+        }
+        if (real_diag)
+            count += (std::imag( C(j, j) ) != 0);
+    }
+    return count;
+
+    #undef C
+    #undef C0
+}
+
 #endif        //  #ifndef CHECK_GEMM_HH
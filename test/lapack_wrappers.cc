@@ -10,7 +10,9 @@
 
 #include "lapack_wrappers.hh"
 
+#include <algorithm>
 #include <complex>
+#include <vector>
 
 // This is a temporary file giving simple LAPACK wrappers,
 // until the real lapackpp wrappers are available.
@@ -371,3 +373,107 @@ void lapack_potrf(  char const *uplo, int64_t n,
     blas_int *info_ = (blas_int *) info;
     lapack_zpotrf( uplo, &n_, A, &lda_, info_ );
 }
+
+// =============================================================================
+// 16-bit types copy to float, call the float routine, and round results.
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// @return m-by-n matrix A converted to float, with leading dimension m.
+template <typename T16>
+std::vector<float> to_float( int64_t m, int64_t n, T16 const* A, int64_t lda )
+{
+    std::vector<float> Af( m*n );
+    for (int64_t j = 0; j < n; ++j)
+        for (int64_t i = 0; i < m; ++i)
+            Af[ i + j*m ] = A[ i + j*lda ];
+    return Af;
+}
+
+//------------------------------------------------------------------------------
+/// A = Af, rounding the m-by-n float matrix Af to T16.
+template <typename T16>
+void from_float( int64_t m, int64_t n, std::vector<float> const& Af,
+                 T16* A, int64_t lda )
+{
+    for (int64_t j = 0; j < n; ++j)
+        for (int64_t i = 0; i < m; ++i)
+            A[ i + j*lda ] = Af[ i + j*m ];
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+void lapack_larnv( int64_t idist, int iseed[4], int64_t size, blas::float16 *x )
+{
+    std::vector<float> xf( size );
+    lapack_larnv( idist, iseed, size, xf.data() );
+    from_float( size, 1, xf, x, size );
+}
+
+void lapack_larnv( int64_t idist, int iseed[4], int64_t size, blas::bfloat16 *x )
+{
+    std::vector<float> xf( size );
+    lapack_larnv( idist, iseed, size, xf.data() );
+    from_float( size, 1, xf, x, size );
+}
+
+// -----------------------------------------------------------------------------
+float  lapack_lange( char const *norm,
+                     int64_t m, int64_t n,
+                     blas::float16 const *A, int64_t lda,
+                     float *work )
+{
+    std::vector<float> Af = to_float( m, n, A, lda );
+    return lapack_lange( norm, m, n, Af.data(), std::max( m, int64_t(1) ), work );
+}
+
+float  lapack_lange( char const *norm,
+                     int64_t m, int64_t n,
+                     blas::bfloat16 const *A, int64_t lda,
+                     float *work )
+{
+    std::vector<float> Af = to_float( m, n, A, lda );
+    return lapack_lange( norm, m, n, Af.data(), std::max( m, int64_t(1) ), work );
+}
+
+// -----------------------------------------------------------------------------
+float  lapack_lantr( char const *norm, char const *uplo, char const *diag,
+                     int64_t m, int64_t n,
+                     blas::float16 const *A, int64_t lda,
+                     float *work )
+{
+    std::vector<float> Af = to_float( m, n, A, lda );
+    return lapack_lantr( norm, uplo, diag, m, n,
+                         Af.data(), std::max( m, int64_t(1) ), work );
+}
+
+float  lapack_lantr( char const *norm, char const *uplo, char const *diag,
+                     int64_t m, int64_t n,
+                     blas::bfloat16 const *A, int64_t lda,
+                     float *work )
+{
+    std::vector<float> Af = to_float( m, n, A, lda );
+    return lapack_lantr( norm, uplo, diag, m, n,
+                         Af.data(), std::max( m, int64_t(1) ), work );
+}
+
+// -----------------------------------------------------------------------------
+void lapack_potrf(  char const *uplo, int64_t n,
+                    blas::float16 *A, int64_t lda,
+                    int64_t *info )
+{
+    std::vector<float> Af = to_float( n, n, A, lda );
+    lapack_potrf( uplo, n, Af.data(), std::max( n, int64_t(1) ), info );
+    from_float( n, n, Af, A, lda );
+}
+
+void lapack_potrf(  char const *uplo, int64_t n,
+                    blas::bfloat16 *A, int64_t lda,
+                    int64_t *info )
+{
+    std::vector<float> Af = to_float( n, n, A, lda );
+    lapack_potrf( uplo, n, Af.data(), std::max( n, int64_t(1) ), info );
+    from_float( n, n, Af, A, lda );
+}
@@ -10,6 +10,8 @@
 #include <cassert>
 #include <complex>
 
+#include "blas/util.hh"
+
 // This is a temporary file giving simple LAPACK wrappers,
 // until the real lapackpp wrappers are available.
 
@@ -146,4 +148,37 @@ void lapack_potrf(  char const *uplo, int64_t n,
                     std::complex<double> *A, int64_t lda,
                     int64_t *info );
 
+// -----------------------------------------------------------------------------
+// 16-bit types compute in float, then round results.
+void lapack_larnv( int64_t idist, int iseed[4], int64_t size, blas::float16  *x );
+void lapack_larnv( int64_t idist, int iseed[4], int64_t size, blas::bfloat16 *x );
+
+float  lapack_lange( char const *norm,
+                     int64_t m, int64_t n,
+                     blas::float16 const *A, int64_t lda,
+                     float *work );
+
+float  lapack_lange( char const *norm,
+                     int64_t m, int64_t n,
+                     blas::bfloat16 const *A, int64_t lda,
+                     float *work );
+
+float  lapack_lantr( char const *norm, char const *uplo, char const *diag,
+                     int64_t m, int64_t n,
+                     blas::float16 const *A, int64_t lda,
+                     float *work );
+
+float  lapack_lantr( char const *norm, char const *uplo, char const *diag,
+                     int64_t m, int64_t n,
+                     blas::bfloat16 const *A, int64_t lda,
+                     float *work );
+
+void lapack_potrf(  char const *uplo, int64_t n,
+                    blas::float16 *A, int64_t lda,
+                    int64_t *info );
+
+void lapack_potrf(  char const *uplo, int64_t n,
+                    blas::bfloat16 *A, int64_t lda,
+                    int64_t *info );
+
 #endif        //  #ifndef LAPACK_WRAPPERS_HH
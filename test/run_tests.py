@@ -59,6 +59,7 @@ categories = [
     group_cat.add_argument( '--blas2', action='store_true', help='run Level 2 BLAS tests' ),
     group_cat.add_argument( '--blas3', action='store_true', help='run Level 3 BLAS tests' ),
     group_cat.add_argument( '--batch-blas3', action='store_true', help='run Level 3 Batch BLAS tests' ),
+    group_cat.add_argument( '--split', action='store_true', help='run BLAS tests with a forced split size smaller than the leading dimensions' ),
 
     group_cat.add_argument( '--host', action='store_true', help='run all CPU host routines' ),
 
@@ -88,8 +89,13 @@ group_opt.add_argument( '--alpha',  action='store', help='default=%(default)s',
 group_opt.add_argument( '--beta',   action='store', help='default=%(default)s', default='' )
 group_opt.add_argument( '--incx',   action='store', help='default=%(default)s', default='1,2,-1,-2' )
 group_opt.add_argument( '--incy',   action='store', help='default=%(default)s', default='1,2,-1,-2' )
+group_opt.add_argument( '--kl',     action='store', help='default=%(default)s', default='0,3,20' )
+group_opt.add_argument( '--ku',     action='store', help='default=%(default)s', default='0,2,20' )
+group_opt.add_argument( '--kd',     action='store', help='default=%(default)s', default='0,3,20' )
 group_opt.add_argument( '--batch',  action='store', help='default=%(default)s', default='' )
 group_opt.add_argument( '--align',  action='store', help='default=%(default)s', default='32' )
+group_opt.add_argument( '--threads', action='store', help='default=%(default)s', default='1,2' )
+group_opt.add_argument( '--zero-point', action='store', help='default=%(default)s', default='n,y' )
 group_opt.add_argument( '--check',  action='store', help='default=y', default='' )  # default in test.cc
 group_opt.add_argument( '--ref',    action='store', help='default=y', default='' )  # default in test.cc
 
@@ -229,8 +235,13 @@ a      = ' --alpha '  + opts.alpha  if (opts.alpha)  else ''
 ab     = a+' --beta ' + opts.beta   if (opts.beta)   else a
 incx   = ' --incx '   + opts.incx   if (opts.incx)   else ''
 incy   = ' --incy '   + opts.incy   if (opts.incy)   else ''
+kl     = ' --kl '     + opts.kl     if (opts.kl)     else ''
+ku     = ' --ku '     + opts.ku     if (opts.ku)     else ''
+kd     = ' --kd '     + opts.kd     if (opts.kd)     else ''
 batch  = ' --batch '  + opts.batch  if (opts.batch)  else ''
 align  = ' --align '  + opts.align  if (opts.align)  else ''
+threads = ' --threads ' + opts.threads if (opts.threads) else ''
+zero_point = ' --zero-point ' + opts.zero_point if (opts.zero_point) else ''
 check  = ' --check '  + opts.check  if (opts.check)  else ''
 ref    = ' --ref '    + opts.ref    if (opts.ref)    else ''
 
@@ -249,6 +260,7 @@ def filter_csv( values, csv ):
 dtype_real    = ' --type ' + filter_csv( ('s', 'd'), opts.type )
 dtype_complex = ' --type ' + filter_csv( ('c', 'z'), opts.type )
 dtype_double  = ' --type ' + filter_csv( ('d', 'z'), opts.type )
+dtype_half    = ' --type ' + filter_csv( ('h', 'b'), opts.type )
 
 trans_nt = ' --trans ' + filter_csv( ('n', 't'), opts.trans )
 trans_nc = ' --trans ' + filter_csv( ('n', 'c'), opts.trans )
@@ -276,6 +288,14 @@ if (opts.blas1):
     [ 'rotmg', dtype_real ],
     [ 'scal',  dtype      + n + incx_pos ],
     [ 'swap',  dtype      + n + incx + incy ],
+
+    [ 'tmpl-asum',  dtype + n + incx_pos ],
+    [ 'tmpl-axpy',  dtype + n + incx + incy ],
+    [ 'tmpl-dot',   dtype + n + incx + incy ],
+    [ 'tmpl-dotu',  dtype + n + incx + incy ],
+    [ 'tmpl-iamax', dtype + n + incx_pos ],
+    [ 'tmpl-nrm2',  dtype + n + incx_pos ],
+    [ 'tmpl-scal',  dtype + n + incx_pos ],
     ]
 
 if (opts.blas1_device):
@@ -291,44 +311,76 @@ if (opts.blas1_device):
 if (opts.blas2):
     cmds += [
     [ 'gemv',  dtype      + layout + align + trans + mn + incx + incy ],
+    [ 'gbmv',  dtype      + layout + align + trans + mn + kl + ku + incx + incy ],
     [ 'ger',   dtype      + layout + align + mn + incx + incy ],
     [ 'geru',  dtype      + layout + align + mn + incx + incy ],
     [ 'hemv',  dtype      + layout + align + uplo + n + incx + incy ],
+    [ 'hbmv',  dtype      + layout + align + uplo + n + kd + incx + incy ],
     [ 'her',   dtype      + layout + align + uplo + n + incx ],
     [ 'her2',  dtype      + layout + align + uplo + n + incx + incy ],
     [ 'symv',  dtype_real + layout + align + uplo + n + incx + incy ], # complex is in lapack++
+    [ 'sbmv',  dtype_real + layout + align + uplo + n + kd + incx + incy ],
     [ 'syr',   dtype_real + layout + align + uplo + n + incx ], # complex is in lapack++
     [ 'syr2',  dtype      + layout + align + uplo + n + incx + incy ],
     [ 'trmv',  dtype      + layout + align + uplo + trans + diag + n + incx ],
     [ 'trsv',  dtype      + layout + align + uplo + trans + diag + n + incx ],
+    [ 'tbmv',  dtype      + layout + align + uplo + trans + diag + n + kd + incx ],
+    [ 'tbsv',  dtype      + layout + align + uplo + trans + diag + n + kd + incx ],
     ]
 
 # Level 3
 if (opts.blas3):
     cmds += [
     [ 'gemm',  dtype         + layout + align + transA + transB + mnk ],
+    [ 'tmpl-gemm', dtype     + layout + align + transA + transB + mnk + threads ],
+    [ 'gemm',  dtype_half    + layout + align + transA + transB + mnk ],
+    [ 'gemm-int8',  layout + align + transA + transB + mnk + zero_point ],
+    [ 'gemm-uint8', layout + align + transA + transB + mnk + zero_point ],
+    [ 'gemmt', dtype         + layout + align + uplo + transA + transB + mn ],
+    [ 'gbmm',  dtype         + layout + align + transA + transB + mnk + kl + ku ],
     [ 'hemm',  dtype         + layout + align + side + uplo + mn ],
+    [ 'tmpl-hemm', dtype     + layout + align + side + uplo + mn + threads ],
     [ 'symm',  dtype         + layout + align + side + uplo + mn ],
+    [ 'tmpl-symm', dtype     + layout + align + side + uplo + mn + threads ],
     [ 'trmm',  dtype         + layout + align + side + uplo + trans + diag + mn ],
+    [ 'tmpl-trmm', dtype     + layout + align + side + uplo + trans + diag + mn + threads ],
     [ 'trsm',  dtype         + layout + align + side + uplo + trans + diag + mn ],
+    [ 'tmpl-trsm', dtype     + layout + align + side + uplo + trans + diag + mn + threads ],
+    [ 'trsm',  dtype_half    + layout + align + side + uplo + trans + diag + mn ],
     [ 'herk',  dtype_real    + layout + align + uplo + trans    + mn ],
     [ 'herk',  dtype_complex + layout + align + uplo + trans_nc + mn ],
+    [ 'tmpl-herk', dtype_real    + layout + align + uplo + trans    + mn + threads ],
+    [ 'tmpl-herk', dtype_complex + layout + align + uplo + trans_nc + mn + threads ],
     [ 'syrk',  dtype_real    + layout + align + uplo + trans    + mn ],
     [ 'syrk',  dtype_complex + layout + align + uplo + trans_nt + mn ],
+    [ 'syrk',  dtype_half    + layout + align + uplo + trans    + mn ],
+    [ 'tmpl-syrk', dtype_real    + layout + align + uplo + trans    + mn + threads ],
+    [ 'tmpl-syrk', dtype_complex + layout + align + uplo + trans_nt + mn + threads ],
     [ 'her2k', dtype_real    + layout + align + uplo + trans    + mn ],
     [ 'her2k', dtype_complex + layout + align + uplo + trans_nc + mn ],
+    [ 'tmpl-her2k', dtype_real    + layout + align + uplo + trans    + mn + threads ],
+    [ 'tmpl-her2k', dtype_complex + layout + align + uplo + trans_nc + mn + threads ],
     [ 'syr2k', dtype_real    + layout + align + uplo + trans    + mn ],
     [ 'syr2k', dtype_complex + layout + align + uplo + trans_nt + mn ],
+    [ 'tmpl-syr2k', dtype_real    + layout + align + uplo + trans    + mn + threads ],
+    [ 'tmpl-syr2k', dtype_complex + layout + align + uplo + trans_nt + mn + threads ],
     ]
 
 # Batch Level 3
 if (opts.batch_blas3):
     cmds += [
     [ 'batch-gemm',  dtype         + batch + layout + align + transA + transB + mnk ],
+    [ 'batch-gemm',  dtype         + batch + layout + align + transA + transB + mnk + ' --schedule i,b' ],
+    [ 'batch-gemm-strided', dtype  + batch + layout + align + transA + transB + mnk ],
+    [ 'batch-gemm-grouped', dtype  + batch + layout + align + transA + transB + mnk ],
+    [ 'batch-gemmt', dtype         + batch + layout + align + uplo + transA + transB + mn ],
     [ 'batch-hemm',  dtype         + batch + layout + align + side + uplo + mn ],
     [ 'batch-symm',  dtype         + batch + layout + align + side + uplo + mn ],
     [ 'batch-trmm',  dtype         + batch + layout + align + side + uplo + trans + diag + mn ],
     [ 'batch-trsm',  dtype         + batch + layout + align + side + uplo + trans + diag + mn ],
+    [ 'batch-gemm-compact', dtype  + batch + layout + align + transA + transB + mnk ],
+    [ 'batch-trmm-compact', dtype  + batch + layout + align + side + uplo + trans + diag + mn ],
+    [ 'batch-trsm-compact', dtype  + batch + layout + align + side + uplo + trans + diag + mn ],
     [ 'batch-herk',  dtype_real    + batch + layout + align + uplo + trans    + mn ],
     [ 'batch-herk',  dtype_complex + batch + layout + align + uplo + trans_nc + mn ],
     [ 'batch-syrk',  dtype_real    + batch + layout + align + uplo + trans    + mn ],
@@ -337,11 +389,39 @@ if (opts.batch_blas3):
     [ 'batch-her2k', dtype_complex + batch + layout + align + uplo + trans_nc + mn ],
     [ 'batch-syr2k', dtype_real    + batch + layout + align + uplo + trans    + mn ],
     [ 'batch-syr2k', dtype_complex + batch + layout + align + uplo + trans_nt + mn ],
+    [ 'batch-hemm-strided',  dtype         + batch + layout + align + side + uplo + mn ],
+    [ 'batch-symm-strided',  dtype         + batch + layout + align + side + uplo + mn ],
+    [ 'batch-trmm-strided',  dtype         + batch + layout + align + side + uplo + trans + diag + mn ],
+    [ 'batch-trsm-strided',  dtype         + batch + layout + align + side + uplo + trans + diag + mn ],
+    [ 'batch-herk-strided',  dtype_real    + batch + layout + align + uplo + trans    + mn ],
+    [ 'batch-herk-strided',  dtype_complex + batch + layout + align + uplo + trans_nc + mn ],
+    [ 'batch-syrk-strided',  dtype_real    + batch + layout + align + uplo + trans    + mn ],
+    [ 'batch-syrk-strided',  dtype_complex + batch + layout + align + uplo + trans_nt + mn ],
+    [ 'batch-her2k-strided', dtype_real    + batch + layout + align + uplo + trans    + mn ],
+    [ 'batch-her2k-strided', dtype_complex + batch + layout + align + uplo + trans_nc + mn ],
+    [ 'batch-syr2k-strided', dtype_real    + batch + layout + align + uplo + trans    + mn ],
+    [ 'batch-syr2k-strided', dtype_complex + batch + layout + align + uplo + trans_nt + mn ],
+    ]
+
+# BLASPP_SPLIT_SIZE forces splitting at a small size; with --align 32, the
+# leading dimensions exceed it, so both split blocks and unsplit calls take
+# the int64_t template path.
+if (opts.split):
+    split = { 'BLASPP_SPLIT_SIZE': '16' }
+    dim_split = ' --dim 10 --dim 40 --dim 10x40x20'
+    cmds += [
+    [ 'dot',   dtype      + ' --dim 10 --dim 40' + ' --incx 1,20,-20' + ' --incy 1,-20', split ],
+    [ 'gemv',  dtype      + layout + ' --align 32' + trans + dim_split + incx_pos + incy_pos, split ],
+    [ 'gbmv',  dtype      + layout + ' --align 32' + trans + dim_split + ' --kl 3 --ku 2' + incx_pos + incy_pos, split ],
+    [ 'gemm',  dtype      + layout + ' --align 32' + transA + transB + dim_split, split ],
+    [ 'trsm',  dtype      + layout + ' --align 32' + side + uplo + trans + diag + dim_split, split ],
+    [ 'her2k', dtype      + layout + ' --align 32' + uplo + trans_nc + dim_split, split ],
     ]
 
 if (opts.blas3_device):
     cmds += [
     [ 'dev-gemm',  dtype         + layout + align + transA + transB + mnk ],
+    [ 'dev-gemmt', dtype         + layout + align + uplo + transA + transB + mn ],
     [ 'schur-gemm',dtype         + align + ' --dim 512x512x32:64:32' + ' --format l,t' ],
     [ 'dev-hemm',  dtype         + layout + align + side + uplo + mn ],
     [ 'dev-symm',  dtype         + layout + align + side + uplo + mn ],
@@ -360,6 +440,8 @@ if (opts.blas3_device):
 if (opts.batch_blas3_device):
     cmds += [
     [ 'dev-batch-gemm',  dtype         + batch + layout + align + transA + transB + mnk ],
+    [ 'dev-batch-gemm-strided', dtype  + batch + layout + align + transA + transB + mnk ],
+    [ 'dev-batch-gemm-grouped', dtype  + batch + layout + align + transA + transB + mnk ],
     [ 'dev-batch-hemm',  dtype         + batch + layout + align + side + uplo + mn ],
     [ 'dev-batch-symm',  dtype         + batch + layout + align + side + uplo + mn ],
     [ 'dev-batch-trmm',  dtype         + batch + layout + align + side + uplo + trans + diag + mn ],
@@ -372,6 +454,18 @@ if (opts.batch_blas3_device):
     [ 'dev-batch-her2k', dtype_complex + batch + layout + align + uplo + trans_nc + mn ],
     [ 'dev-batch-syr2k', dtype_real    + batch + layout + align + uplo + trans    + mn ],
     [ 'dev-batch-syr2k', dtype_complex + batch + layout + align + uplo + trans_nt + mn ],
+    [ 'dev-batch-hemm-strided',  dtype         + batch + layout + align + side + uplo + mn ],
+    [ 'dev-batch-symm-strided',  dtype         + batch + layout + align + side + uplo + mn ],
+    [ 'dev-batch-trmm-strided',  dtype         + batch + layout + align + side + uplo + trans + diag + mn ],
+    [ 'dev-batch-trsm-strided',  dtype         + batch + layout + align + side + uplo + trans + diag + mn ],
+    [ 'dev-batch-herk-strided',  dtype_real    + batch + layout + align + uplo + trans    + mn ],
+    [ 'dev-batch-herk-strided',  dtype_complex + batch + layout + align + uplo + trans_nc + mn ],
+    [ 'dev-batch-syrk-strided',  dtype_real    + batch + layout + align + uplo + trans    + mn ],
+    [ 'dev-batch-syrk-strided',  dtype_complex + batch + layout + align + uplo + trans_nt + mn ],
+    [ 'dev-batch-her2k-strided', dtype_real    + batch + layout + align + uplo + trans    + mn ],
+    [ 'dev-batch-her2k-strided', dtype_complex + batch + layout + align + uplo + trans_nc + mn ],
+    [ 'dev-batch-syr2k-strided', dtype_real    + batch + layout + align + uplo + trans    + mn ],
+    [ 'dev-batch-syr2k-strided', dtype_complex + batch + layout + align + uplo + trans_nt + mn ],
     ]
 
 if (opts.aux):
@@ -383,6 +477,13 @@ if (opts.aux):
     [ 'memcpy_2d',   dtype + mn + align ],
     [ 'copy_matrix', dtype + mn + align ],
     [ 'set_matrix',  dtype + mn + align ],
+
+    [ 'pool',        dtype + n ],
+    [ 'event',       dtype + n ],
+    [ 'fork',        dtype + n ],
+    [ 'backend',     dtype + n ],
+    [ 'tune',        dtype + n ],
+    [ 'trace',       dtype + n ],
     ]
 
 # ------------------------------------------------------------------------------
@@ -403,12 +504,20 @@ def print_tee( *args ):
 # ------------------------------------------------------------------------------
 # cmd is a pair of strings: (function, args)
 
+# optional third item is a dict of environment variables to set.
+
 def run_test( cmd ):
+    env = dict( os.environ )
+    prefix = ''
+    if (len( cmd ) > 2):
+        env.update( cmd[2] )
+        prefix = ''.join( map( lambda kv: kv[0] +'='+ kv[1] +' ',
+                               cmd[2].items() ))
     cmd = opts.test +' '+ cmd[1] +' '+ cmd[0]
-    print_tee( cmd )
+    print_tee( prefix + cmd )
     output = ''
     p = subprocess.Popen( cmd.split(), stdout=subprocess.PIPE,
-                                       stderr=subprocess.STDOUT )
+                                       stderr=subprocess.STDOUT, env=env )
     p_out = p.stdout
     if (sys.version_info.major >= 3):
         p_out = io.TextIOWrapper(p.stdout, encoding='utf-8')
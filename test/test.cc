@@ -5,6 +5,7 @@
 
 #include <complex>
 
+#include <ctype.h>
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
@@ -14,9 +15,6 @@
 // -----------------------------------------------------------------------------
 using testsweeper::ParamType;
 using testsweeper::DataType;
-using testsweeper::char2datatype;
-using testsweeper::datatype2char;
-using testsweeper::datatype2str;
 using testsweeper::ansi_bold;
 using testsweeper::ansi_red;
 using testsweeper::ansi_normal;
@@ -64,45 +62,75 @@ std::vector< testsweeper::routines_t > routines = {
     { "swap",   test_swap,   Section::blas1   },
     { "",       nullptr,     Section::newline },
 
+    { "tmpl-asum",  test_asum,  Section::blas1 },
+    { "tmpl-axpy",  test_axpy,  Section::blas1 },
+    { "tmpl-dot",   test_dot,   Section::blas1 },
+    { "tmpl-dotu",  test_dotu,  Section::blas1 },
+    { "tmpl-iamax", test_iamax, Section::blas1 },
+    { "tmpl-nrm2",  test_nrm2,  Section::blas1 },
+    { "tmpl-scal",  test_scal,  Section::blas1 },
+    { "",           nullptr,    Section::newline },
+
     // Level 2 BLAS
     { "gemv",   test_gemv,   Section::blas2   },
+    { "gbmv",   test_gbmv,   Section::blas2   },
     { "ger",    test_ger,    Section::blas2   },
     { "geru",   test_geru,   Section::blas2   },
     { "",       nullptr,     Section::newline },
 
     { "hemv",   test_hemv,   Section::blas2   },
+    { "hbmv",   test_hbmv,   Section::blas2   },
     { "her",    test_her,    Section::blas2   },
     { "her2",   test_her2,   Section::blas2   },
     { "",       nullptr,     Section::newline },
 
     { "symv",   test_symv,   Section::blas2   },
+    { "sbmv",   test_sbmv,   Section::blas2   },
     { "syr",    test_syr,    Section::blas2   },
     { "syr2",   test_syr2,   Section::blas2   },
     { "",       nullptr,     Section::newline },
 
     { "trmv",   test_trmv,   Section::blas2   },
     { "trsv",   test_trsv,   Section::blas2   },
+    { "tbmv",   test_tbmv,   Section::blas2   },
+    { "tbsv",   test_tbsv,   Section::blas2   },
     { "",       nullptr,     Section::newline },
 
     // Level 3 BLAS
     { "gemm",   test_gemm,   Section::blas3   },
+    { "tmpl-gemm", test_gemm, Section::blas3  },
+    { "gemm-int8",  test_gemm_int8, Section::blas3 },
+    { "gemm-uint8", test_gemm_int8, Section::blas3 },
+    { "gemmt",  test_gemmt,  Section::blas3   },
+    { "gbmm",   test_gbmm,   Section::blas3   },
     { "",       nullptr,     Section::newline },
 
     { "hemm",   test_hemm,   Section::blas3   },
+    { "tmpl-hemm", test_hemm, Section::blas3  },
     { "herk",   test_herk,   Section::blas3   },
+    { "tmpl-herk", test_herk, Section::blas3  },
     { "her2k",  test_her2k,  Section::blas3   },
+    { "tmpl-her2k", test_her2k, Section::blas3 },
     { "",       nullptr,     Section::newline },
 
     { "symm",   test_symm,   Section::blas3   },
+    { "tmpl-symm", test_symm, Section::blas3  },
     { "syrk",   test_syrk,   Section::blas3   },
+    { "tmpl-syrk", test_syrk, Section::blas3  },
     { "syr2k",  test_syr2k,  Section::blas3   },
+    { "tmpl-syr2k", test_syr2k, Section::blas3 },
     { "",       nullptr,     Section::newline },
 
     { "trmm",   test_trmm,   Section::blas3   },
+    { "tmpl-trmm", test_trmm, Section::blas3  },
     { "trsm",   test_trsm,   Section::blas3   },
+    { "tmpl-trsm", test_trsm, Section::blas3  },
     { "",       nullptr,     Section::newline },
 
     { "batch-gemm",   test_batch_gemm,   Section::blas3   },
+    { "batch-gemm-strided", test_batch_gemm, Section::blas3 },
+    { "batch-gemm-grouped", test_batch_gemm, Section::blas3 },
+    { "batch-gemmt",  test_batch_gemmt,  Section::blas3   },
     { "",             nullptr,           Section::newline },
 
     { "batch-hemm",   test_batch_hemm,   Section::blas3   },
@@ -117,6 +145,25 @@ std::vector< testsweeper::routines_t > routines = {
 
     { "batch-trmm",   test_batch_trmm,   Section::blas3   },
     { "batch-trsm",   test_batch_trsm,   Section::blas3   },
+    { "",             nullptr,           Section::newline },
+
+    { "batch-hemm-strided",  test_batch_hemm,  Section::blas3 },
+    { "batch-herk-strided",  test_batch_herk,  Section::blas3 },
+    { "batch-her2k-strided", test_batch_her2k, Section::blas3 },
+    { "",                    nullptr,          Section::newline },
+
+    { "batch-symm-strided",  test_batch_symm,  Section::blas3 },
+    { "batch-syrk-strided",  test_batch_syrk,  Section::blas3 },
+    { "batch-syr2k-strided", test_batch_syr2k, Section::blas3 },
+    { "",                    nullptr,          Section::newline },
+
+    { "batch-trmm-strided",  test_batch_trmm,  Section::blas3 },
+    { "batch-trsm-strided",  test_batch_trsm,  Section::blas3 },
+    { "",                    nullptr,          Section::newline },
+
+    { "batch-gemm-compact", test_batch_compact, Section::blas3 },
+    { "batch-trmm-compact", test_batch_compact, Section::blas3 },
+    { "batch-trsm-compact", test_batch_compact, Section::blas3 },
     { "",              nullptr,          Section::newline },
 
     { "dev-axpy",         test_axpy_device,         Section::device_blas1   },
@@ -135,6 +182,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "",                 nullptr,                  Section::newline },
 
     { "dev-gemm",         test_gemm_device,         Section::device_blas3   },
+    { "dev-gemmt",        test_gemmt_device,        Section::device_blas3   },
     { "",                 nullptr,                  Section::newline },
 
     { "dev-hemm",         test_hemm_device,         Section::device_blas3   },
@@ -155,6 +203,8 @@ std::vector< testsweeper::routines_t > routines = {
     { "",                 nullptr,                  Section::newline },
 
     { "dev-batch-gemm",   test_batch_gemm_device,   Section::device_blas3   },
+    { "dev-batch-gemm-strided", test_batch_gemm_device, Section::device_blas3 },
+    { "dev-batch-gemm-grouped", test_batch_gemm_device, Section::device_blas3 },
     { "",                 nullptr,                  Section::newline },
 
     { "dev-batch-hemm",   test_batch_hemm_device,   Section::device_blas3   },
@@ -171,6 +221,20 @@ std::vector< testsweeper::routines_t > routines = {
     { "dev-batch-trsm",   test_batch_trsm_device,   Section::device_blas3   },
     { "",                 nullptr,                  Section::newline        },
 
+    { "dev-batch-hemm-strided",  test_batch_hemm_device,  Section::device_blas3 },
+    { "dev-batch-herk-strided",  test_batch_herk_device,  Section::device_blas3 },
+    { "dev-batch-her2k-strided", test_batch_her2k_device, Section::device_blas3 },
+    { "",                        nullptr,                 Section::newline      },
+
+    { "dev-batch-symm-strided",  test_batch_symm_device,  Section::device_blas3 },
+    { "dev-batch-syrk-strided",  test_batch_syrk_device,  Section::device_blas3 },
+    { "dev-batch-syr2k-strided", test_batch_syr2k_device, Section::device_blas3 },
+    { "",                        nullptr,                 Section::newline      },
+
+    { "dev-batch-trmm-strided",  test_batch_trmm_device,  Section::device_blas3 },
+    { "dev-batch-trsm-strided",  test_batch_trsm_device,  Section::device_blas3 },
+    { "",                        nullptr,                 Section::newline      },
+
     // auxiliary
     { "error",            test_error,               Section::aux            },
     { "max",              test_max,                 Section::aux            },
@@ -186,8 +250,40 @@ std::vector< testsweeper::routines_t > routines = {
     { "copy_matrix",      test_memcpy_2d,           Section::aux            },
     { "set_matrix",       test_memcpy_2d,           Section::aux            },
     { "",                 nullptr,                  Section::newline        },
+
+    { "pool",             test_pool,                Section::aux            },
+    { "event",            test_event,               Section::aux            },
+    { "fork",             test_fork,                Section::aux            },
+    { "backend",          test_backend,             Section::aux            },
+    { "tune",             test_tune,                Section::aux            },
+    { "trace",            test_trace,               Section::aux            },
+    { "",                 nullptr,                  Section::newline        },
 };
 
+// -----------------------------------------------------------------------------
+// DataType conversions, adding 16-bit types to testsweeper's.
+DataType char2datatype( char ch )
+{
+    ch = tolower( ch );
+    if (ch == char( DataType_Half ) || ch == char( DataType_BFloat16 ))
+        return DataType( ch );
+    return testsweeper::char2datatype( ch );
+}
+
+char datatype2char( DataType datatype )
+{
+    return testsweeper::datatype2char( datatype );
+}
+
+const char* datatype2str( DataType datatype )
+{
+    if (datatype == DataType_Half)
+        return "h";
+    else if (datatype == DataType_BFloat16)
+        return "b";
+    return testsweeper::datatype2str( datatype );
+}
+
 // -----------------------------------------------------------------------------
 // Params class
 // List of parameters
@@ -210,7 +306,7 @@ Params::Params():
 
     // ----- routine parameters
     //          name,      w,    type,            def,                    char2enum,         enum2char,         enum2str,         help
-    datatype  ( "type",    4,    ParamType::List, DataType::Double,       char2datatype,     datatype2char,     datatype2str,     "s=single (float), d=double, c=complex-single, z=complex-double" ),
+    datatype  ( "type",    4,    ParamType::List, DataType::Double,       char2datatype,     datatype2char,     datatype2str,     "s=single (float), d=double, c=complex-single, z=complex-double, h=half (float16), b=bfloat16" ),
     layout    ( "layout",  6,    ParamType::List, blas::Layout::ColMajor, blas::char2layout, blas::layout2char, blas::layout2str, "layout: r=row major, c=column major" ),
     format    ( "format",  6,    ParamType::List, blas::Format::LAPACK,   blas::char2format, blas::format2char, blas::format2str, "format: l=lapack, t=tile" ),
     side      ( "side",    6,    ParamType::List, blas::Side::Left,       blas::char2side,   blas::side2char,   blas::side2str,   "side: l=left, r=right" ),
@@ -219,6 +315,7 @@ Params::Params():
     transA    ( "transA",  7,    ParamType::List, blas::Op::NoTrans,      blas::char2op,     blas::op2char,     blas::op2str,     "transpose of A: n=no-trans, t=trans, c=conj-trans" ),
     transB    ( "transB",  7,    ParamType::List, blas::Op::NoTrans,      blas::char2op,     blas::op2char,     blas::op2str,     "transpose of B: n=no-trans, t=trans, c=conj-trans" ),
     diag      ( "diag",    7,    ParamType::List, blas::Diag::NonUnit,    blas::char2diag,   blas::diag2char,   blas::diag2str,   "diagonal: n=non-unit, u=unit" ),
+    schedule  ( "schedule", 8,   ParamType::List, blas::batch::Schedule::InOrder, blas::batch::char2schedule, blas::batch::schedule2char, blas::batch::schedule2str, "batch schedule: i=in order, b=balanced" ),
 
     //          name,      w, p, type,            def,   min,     max, help
     dim       ( "dim",     6,    ParamType::List,          0,     1e9, "m by n by k dimensions" ),
@@ -226,10 +323,15 @@ Params::Params():
     beta      ( "beta",    9, 4, ParamType::List,   e,  -inf,     inf, "scalar beta" ),
     incx      ( "incx",    4,    ParamType::List,   1, -1000,    1000, "stride of x vector" ),
     incy      ( "incy",    4,    ParamType::List,   1, -1000,    1000, "stride of y vector" ),
+    kl        ( "kl",      4,    ParamType::List,  10,     0,     1e6, "number of sub-diagonals of band matrix" ),
+    ku        ( "ku",      4,    ParamType::List,  10,     0,     1e6, "number of super-diagonals of band matrix" ),
+    kd        ( "kd",      4,    ParamType::List,  10,     0,     1e6, "number of off-diagonals of symmetric, Hermitian, or triangular band matrix" ),
     align     ( "align",   0,    ParamType::List,   1,     1,    1024, "column alignment (sets lda, ldb, etc. to multiple of align)" ),
     batch     ( "batch",   6,    ParamType::List, 100,     0,     1e6, "batch size" ),
     device    ( "device",  6,    ParamType::List,   0,     0,     100, "device id" ),
+    threads   ( "threads", 7,    ParamType::List,   0,     0,    1024, "threads for template routines; 0 = omp_get_max_threads" ),
     pointer_mode ( "pointer-mode",  3,    ParamType::List, 'h',  "hd",          "h == host, d == device" ),
+    zero_point   ( "zero-point",    4,    ParamType::List, 'n',  "ny",          "integer gemm zero points: n == none, y == random" ),
 
     // ----- output parameters
     // min, max are ignored
@@ -257,12 +359,15 @@ Params::Params():
     ref_gflops( "Ref.\nGflop/s",    11, 4, ParamType::Output, testsweeper::no_data_flag,   0,   0, "reference Gflop/s rate" ),
     ref_gbytes( "Ref.\nGbyte/s",    11, 4, ParamType::Output, testsweeper::no_data_flag,   0,   0, "reference Gbyte/s rate" ),
 
+    efficiency( "Parallel\nefficiency", 10, 2, ParamType::Output, testsweeper::no_data_flag, 0, 0, "parallel efficiency, time(1 thread) / (threads * time)" ),
+
     // default -1 means "no check"
     okay      ( "status",              6,    ParamType::Output,  -1,   0,   0, "success indicator" ),
     msg       ( "",       1, ParamType::Output,  "",           "error message" )
 {
     // set header different than command line prefix 
     pointer_mode.name("ptr", "pointer-mode");
+    zero_point.name("zero", "zero-point");
 
     // mark standard set of output fields as used
     okay();
@@ -9,6 +9,16 @@
 #include "testsweeper.hh"
 #include "blas.hh"
 
+// -----------------------------------------------------------------------------
+// testsweeper::DataType extended with 16-bit types, using the same
+// one-letter codes as for the type parameter.
+const testsweeper::DataType DataType_Half     = testsweeper::DataType( 'h' );
+const testsweeper::DataType DataType_BFloat16 = testsweeper::DataType( 'b' );
+
+testsweeper::DataType char2datatype( char ch );
+char datatype2char( testsweeper::DataType datatype );
+const char* datatype2str( testsweeper::DataType datatype );
+
 // -----------------------------------------------------------------------------
 class Params: public testsweeper::ParamsBase
 {
@@ -40,16 +50,22 @@ public:
     testsweeper::ParamEnum< blas::Op >          transA;
     testsweeper::ParamEnum< blas::Op >          transB;
     testsweeper::ParamEnum< blas::Diag >        diag;
+    testsweeper::ParamEnum< blas::batch::Schedule > schedule;
 
     testsweeper::ParamInt3   dim;
     testsweeper::ParamDouble alpha;
     testsweeper::ParamDouble beta;
     testsweeper::ParamInt    incx;
     testsweeper::ParamInt    incy;
+    testsweeper::ParamInt    kl;
+    testsweeper::ParamInt    ku;
+    testsweeper::ParamInt    kd;
     testsweeper::ParamInt    align;
     testsweeper::ParamInt    batch;
     testsweeper::ParamInt    device;
+    testsweeper::ParamInt    threads;
     testsweeper::ParamChar   pointer_mode;
+    testsweeper::ParamChar   zero_point;
 
     // ----- output parameters
     testsweeper::ParamScientific error;
@@ -75,6 +91,8 @@ public:
     testsweeper::ParamDouble     ref_gflops;
     testsweeper::ParamDouble     ref_gbytes;
 
+    testsweeper::ParamDouble     efficiency;
+
     testsweeper::ParamOkay       okay;
     testsweeper::ParamString     msg;
 
@@ -149,21 +167,29 @@ void test_swap  ( Params& params, bool run );
 
 // -----------------------------------------------------------------------------
 // Level 2 BLAS
+void test_gbmv  ( Params& params, bool run );
 void test_gemv  ( Params& params, bool run );
 void test_ger   ( Params& params, bool run );
 void test_geru  ( Params& params, bool run );
+void test_hbmv  ( Params& params, bool run );
 void test_hemv  ( Params& params, bool run );
 void test_her   ( Params& params, bool run );
 void test_her2  ( Params& params, bool run );
+void test_sbmv  ( Params& params, bool run );
 void test_symv  ( Params& params, bool run );
 void test_syr   ( Params& params, bool run );
 void test_syr2  ( Params& params, bool run );
+void test_tbmv  ( Params& params, bool run );
+void test_tbsv  ( Params& params, bool run );
 void test_trmv  ( Params& params, bool run );
 void test_trsv  ( Params& params, bool run );
 
 // -----------------------------------------------------------------------------
 // Level 3 BLAS
+void test_gbmm  ( Params& params, bool run );
 void test_gemm  ( Params& params, bool run );
+void test_gemm_int8( Params& params, bool run );
+void test_gemmt ( Params& params, bool run );
 void test_hemm  ( Params& params, bool run );
 void test_her2k ( Params& params, bool run );
 void test_herk  ( Params& params, bool run );
@@ -176,6 +202,7 @@ void test_trsm  ( Params& params, bool run );
 // -----------------------------------------------------------------------------
 // Level 3 Batch BLAS
 void test_batch_gemm  ( Params& params, bool run );
+void test_batch_gemmt ( Params& params, bool run );
 void test_batch_hemm  ( Params& params, bool run );
 void test_batch_her2k ( Params& params, bool run );
 void test_batch_herk  ( Params& params, bool run );
@@ -184,6 +211,7 @@ void test_batch_syr2k ( Params& params, bool run );
 void test_batch_syrk  ( Params& params, bool run );
 void test_batch_trmm  ( Params& params, bool run );
 void test_batch_trsm  ( Params& params, bool run );
+void test_batch_compact( Params& params, bool run );
 
 // -----------------------------------------------------------------------------
 // Level 1 GPU BLAS
@@ -196,6 +224,7 @@ void test_copy_device  ( Params& params, bool run );
 // -----------------------------------------------------------------------------
 // Level 3 GPU BLAS
 void test_gemm_device  ( Params& params, bool run );
+void test_gemmt_device ( Params& params, bool run );
 void test_hemm_device  ( Params& params, bool run );
 void test_her2k_device ( Params& params, bool run );
 void test_herk_device  ( Params& params, bool run );
@@ -223,6 +252,12 @@ void test_max   ( Params& params, bool run );
 void test_util  ( Params& params, bool run );
 void test_memcpy( Params& params, bool run );
 void test_memcpy_2d( Params& params, bool run );
+void test_pool( Params& params, bool run );
+void test_event( Params& params, bool run );
+void test_fork( Params& params, bool run );
+void test_backend( Params& params, bool run );
+void test_tune( Params& params, bool run );
+void test_trace( Params& params, bool run );
 
 typedef long long llong;
 
@@ -24,6 +24,9 @@ void test_asum_work( Params& params, bool run )
     int64_t incx    = params.incx();
     int64_t verbose = params.verbose();
 
+    // tmpl-asum calls the template implementation instead of vendor BLAS
+    bool tmpl = (params.routine == "tmpl-asum");
+
     // mark non-standard output values
     params.gflops();
     params.gbytes();
@@ -63,7 +66,13 @@ void test_asum_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    real_t result = blas::asum( n, x, incx );
+    real_t result;
+    if (tmpl) {
+        result = blas::asum< T >( n, x, incx );
+    }
+    else {
+        result = blas::asum( n, x, incx );
+    }
     time = get_wtime() - time;
 
     double gflop = Gflop < T >::asum( n );
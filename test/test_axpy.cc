@@ -27,6 +27,9 @@ void test_axpy_work( Params& params, bool run )
     int64_t incy    = params.incy();
     int64_t verbose = params.verbose();
 
+    // tmpl-axpy calls the template implementation instead of vendor BLAS
+    bool tmpl = (params.routine == "tmpl-axpy");
+
     // mark non-standard output values
     params.gflops();
     params.gbytes();
@@ -78,7 +81,12 @@ void test_axpy_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::axpy( n, alpha, x, incx, y, incy );
+    if (tmpl) {
+        blas::axpy< TX, TY >( n, alpha, x, incx, y, incy );
+    }
+    else {
+        blas::axpy( n, alpha, x, incx, y, incy );
+    }
     time = get_wtime() - time;
 
     double gflop = Gflop < scalar_t >::axpy( n );
@@ -0,0 +1,167 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+
+#include <string>
+
+// -----------------------------------------------------------------------------
+/// Runs gemm with the template backend and the previous backend,
+/// and compares results. Also checks set_backend and get_backend.
+template <typename T>
+void test_backend_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type<T>;
+
+    // get & mark input values
+    T alpha         = params.alpha();
+    T beta          = params.beta();
+    int64_t n       = params.dim.n();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    params.time    .name( "template (sec)" );
+    params.gflops  .name( "template Gflop/s" );
+
+    if (! run)
+        return;
+
+    // gemm routine of this precision, e.g., "dgemm"
+    std::string routine = "gemm";
+    if (std::is_same< T, float >::value)
+        routine = "s" + routine;
+    else if (std::is_same< T, double >::value)
+        routine = "d" + routine;
+    else if (std::is_same< T, std::complex<float> >::value)
+        routine = "c" + routine;
+    else
+        routine = "z" + routine;
+
+    // setup
+    int64_t lda = roundup( n, int64_t( 64 ) );
+    T* A    = new T[ lda*n ];
+    T* B    = new T[ lda*n ];
+    T* C    = new T[ lda*n ];
+    T* Cref = new T[ lda*n ];
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, lda*n, A );
+    lapack_larnv( idist, iseed, lda*n, B );
+    lapack_larnv( idist, iseed, lda*n, C );
+    lapack_lacpy( "g", n, n, C, lda, Cref, lda );
+
+    // Each failed check adds 1 to error.
+    real_t error = 0;
+
+    std::string backend = blas::get_backend( routine );
+    if (verbose >= 1)
+        printf( "%s backend %s\n", routine.c_str(), backend.c_str() );
+
+    // Unknown routines and libraries throw, leaving the backend unchanged.
+    assert_throw( blas::get_backend( "nosuch" ), blas::Error );
+    assert_throw( blas::set_backend( "template", "nosuch" ), blas::Error );
+    assert_throw( blas::set_backend( "libnosuch.so", "gemm" ), blas::Error );
+    if (blas::get_backend( routine ) != backend)
+        error += 1;
+
+    // A routine name sets only that routine; a family name sets all of
+    // its routines, including those with other prefixes.
+    std::string rot_backend   = blas::get_backend( "csrot" );
+    std::string nrm2_backend  = blas::get_backend( "scnrm2" );
+    std::string iamax_backend = blas::get_backend( "icamax" );
+    blas::set_backend( "template", "srot" );
+    if (blas::get_backend( "csrot" ) != rot_backend)
+        error += 1;
+    blas::set_backend( "template", "nrm2" );
+    blas::set_backend( "template", "iamax" );
+    if (blas::get_backend( "scnrm2" ) != "template"
+        || blas::get_backend( "icamax" ) != "template")
+        error += 1;
+    blas::set_backend( rot_backend,   "rot" );
+    blas::set_backend( nrm2_backend,  "nrm2" );
+    blas::set_backend( iamax_backend, "iamax" );
+
+    //----------
+    // run test with template backend
+    blas::set_backend( "template", "gemm" );
+    if (blas::get_backend( routine ) != "template")
+        error += 1;
+
+    double time = get_wtime();
+    blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                n, n, n, alpha, A, lda, B, lda, beta, C, lda );
+    time = get_wtime() - time;
+
+    //----------
+    // run reference with previous backend
+    blas::set_backend( backend, "gemm" );
+    if (blas::get_backend( routine ) != backend)
+        error += 1;
+
+    double ref_time = get_wtime();
+    blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                n, n, n, alpha, A, lda, B, lda, beta, Cref, lda );
+    ref_time = get_wtime() - ref_time;
+
+    // check error compared to reference
+    real_t dummy;
+    real_t C_norm = lapack_lange( "m", n, n, Cref, lda, &dummy );
+    for (int64_t j = 0; j < n; ++j)
+        blas::axpy( n, -1.0, &Cref[ j*lda ], 1, &C[ j*lda ], 1 );
+    real_t diff = lapack_lange( "m", n, n, C, lda, &dummy );
+    if (C_norm > 0)
+        diff /= C_norm;
+    if (verbose >= 1)
+        printf( "checks failed %.0f, difference %.2e\n",
+                double( error ), double( diff ) );
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    double gflop = blas::Gflop<T>::gemm( n, n, n );
+    params.time()       = time;
+    params.gflops()     = gflop / time;
+    params.ref_time()   = ref_time;
+    params.ref_gflops() = gflop / ref_time;
+    params.error()      = error + diff;
+    params.okay()       = (error == 0 && diff < 3*n*eps);
+
+    delete[] A;
+    delete[] B;
+    delete[] C;
+    delete[] Cref;
+}
+
+// -----------------------------------------------------------------------------
+void test_backend( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_backend_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_backend_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_backend_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_backend_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
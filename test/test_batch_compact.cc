@@ -0,0 +1,333 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+// -----------------------------------------------------------------------------
+// Tests the compact batch routines. The reference is a loop of blas::gemm,
+// trsm, or trmm over the batch, which the compact format is meant to beat
+// for tiny matrices.
+template <typename T>
+void test_batch_gemm_compact_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using namespace blas;
+    typedef real_type<T> real_t;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op transA = params.transA();
+    blas::Op transB = params.transB();
+    T alpha         = params.alpha();
+    T beta          = params.beta();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    size_t  batch   = params.batch();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (transA == Op::NoTrans ? m : k);
+    int64_t An = (transA == Op::NoTrans ? k : m);
+    int64_t Bm = (transB == Op::NoTrans ? k : n);
+    int64_t Bn = (transB == Op::NoTrans ? n : k);
+    int64_t Cm = m;
+    int64_t Cn = n;
+    if (layout == Layout::RowMajor) {
+        std::swap( Am, An );
+        std::swap( Bm, Bn );
+        std::swap( Cm, Cn );
+    }
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    int64_t ldc = roundup( Cm, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_B = size_t(ldb)*Bn;
+    size_t size_C = size_t(ldc)*Cn;
+    std::vector<T> A( batch * size_A ), B( batch * size_B ),
+                   C( batch * size_C ), Cref( batch * size_C );
+
+    std::vector<T*> Aarray( batch ), Barray( batch ),
+                    Carray( batch ), Crefarray( batch );
+    for (size_t s = 0; s < batch; ++s) {
+        Aarray[ s ]    = &A[ s * size_A ];
+        Barray[ s ]    = &B[ s * size_B ];
+        Carray[ s ]    = &C[ s * size_C ];
+        Crefarray[ s ] = &Cref[ s * size_C ];
+    }
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, batch * size_A, A.data() );
+    lapack_larnv( idist, iseed, batch * size_B, B.data() );
+    lapack_larnv( idist, iseed, batch * size_C, C.data() );
+    Cref = C;
+
+    // norms for error check
+    real_t work[1];
+    std::vector<real_t> Anorm( batch ), Bnorm( batch ), Cnorm( batch );
+    for (size_t s = 0; s < batch; ++s) {
+        Anorm[ s ] = lapack_lange( "f", Am, An, Aarray[ s ], lda, work );
+        Bnorm[ s ] = lapack_lange( "f", Bm, Bn, Barray[ s ], ldb, work );
+        Cnorm[ s ] = lapack_lange( "f", Cm, Cn, Carray[ s ], ldc, work );
+    }
+
+    // pack into compact format; ldac = Am, etc.
+    // In row-major, the compact layout's m-by-n are the op(X) dimensions.
+    int64_t Xm = (layout == Layout::ColMajor ? Am : An);
+    int64_t Xn = (layout == Layout::ColMajor ? An : Am);
+    std::vector<T> Ac( batch::compact_size<T>( layout, Xm, Xn, Am, batch ) );
+    batch::pack_compact( layout, Xm, Xn, Aarray, lda, Ac.data(), Am, batch );
+
+    Xm = (layout == Layout::ColMajor ? Bm : Bn);
+    Xn = (layout == Layout::ColMajor ? Bn : Bm);
+    std::vector<T> Bc( batch::compact_size<T>( layout, Xm, Xn, Bm, batch ) );
+    batch::pack_compact( layout, Xm, Xn, Barray, ldb, Bc.data(), Bm, batch );
+
+    std::vector<T> Cc( batch::compact_size<T>( layout, m, n, Cm, batch ) );
+    batch::pack_compact( layout, m, n, Carray, ldc, Cc.data(), Cm, batch );
+
+    // test error exits
+    assert_throw( batch::gemm_compact( Layout(0), transA, transB,  m,  n,  k, alpha, Ac.data(), Am, Bc.data(), Bm, beta, Cc.data(), Cm, batch ), blas::Error );
+    assert_throw( batch::gemm_compact( layout,    Op(0),  transB,  m,  n,  k, alpha, Ac.data(), Am, Bc.data(), Bm, beta, Cc.data(), Cm, batch ), blas::Error );
+    assert_throw( batch::gemm_compact( layout,    transA, transB, -1,  n,  k, alpha, Ac.data(), Am, Bc.data(), Bm, beta, Cc.data(), Cm, batch ), blas::Error );
+    assert_throw( batch::gemm_compact( layout,    transA, transB,  m,  n,  k, alpha, Ac.data(), Am, Bc.data(), Bm, beta, Cc.data(), Cm-1, batch ), blas::Error );
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    batch::gemm_compact( layout, transA, transB, m, n, k,
+                         alpha, Ac.data(), Am, Bc.data(), Bm,
+                         beta,  Cc.data(), Cm, batch );
+    time = get_wtime() - time;
+
+    double gflop = batch * Gflop < T >::gemm( m, n, k );
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    batch::unpack_compact( layout, m, n, Cc.data(), Cm, Carray, ldc, batch );
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        for (size_t s = 0; s < batch; ++s) {
+            blas::gemm( layout, transA, transB, m, n, k,
+                        alpha, Aarray[ s ], lda, Barray[ s ], ldb,
+                        beta,  Crefarray[ s ], ldc );
+        }
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        // check error compared to reference
+        real_t err, error = 0;
+        bool ok, okay = true;
+        for (size_t s = 0; s < batch; ++s) {
+            check_gemm( Cm, Cn, k, alpha, beta, Anorm[ s ], Bnorm[ s ], Cnorm[ s ],
+                        Crefarray[ s ], ldc, Carray[ s ], ldc, verbose, &err, &ok );
+            error = max( error, err );
+            okay &= ok;
+        }
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tests trsm_compact (if solve) or trmm_compact.
+template <typename T>
+void test_batch_trxm_compact_work( Params& params, bool run, bool solve )
+{
+    using namespace testsweeper;
+    using namespace blas;
+    typedef real_type<T> real_t;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Side side     = params.side();
+    blas::Uplo uplo     = params.uplo();
+    blas::Op trans      = params.trans();
+    blas::Diag diag     = params.diag();
+    T alpha             = params.alpha();
+    int64_t m           = params.dim.m();
+    int64_t n           = params.dim.n();
+    size_t  batch       = params.batch();
+    int64_t align       = params.align();
+    int64_t verbose     = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (side == Side::Left ? m : n);
+    int64_t Bm = m;
+    int64_t Bn = n;
+    if (layout == Layout::RowMajor)
+        std::swap( Bm, Bn );
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    size_t size_A = size_t(lda)*Am;
+    size_t size_B = size_t(ldb)*Bn;
+    std::vector<T> A( batch * size_A ), B( batch * size_B ),
+                   Bref( batch * size_B );
+
+    std::vector<T*> Aarray( batch ), Barray( batch ), Brefarray( batch );
+    for (size_t s = 0; s < batch; ++s) {
+        Aarray[ s ]    = &A[ s * size_A ];
+        Barray[ s ]    = &B[ s * size_B ];
+        Brefarray[ s ] = &Bref[ s * size_B ];
+    }
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, batch * size_A, A.data() );
+    lapack_larnv( idist, iseed, batch * size_B, B.data() );
+    Bref = B;
+
+    // Factor A into L L^H or U U^H to get a well-conditioned triangular
+    // matrix, as in test_batch_trsm. In row-major, the uplo triangle is the
+    // opposite triangle of the column-major storage.
+    blas::Uplo uplo_col = uplo;
+    if (layout == Layout::RowMajor)
+        uplo_col = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+    for (size_t s = 0; s < batch; ++s) {
+        for (int64_t i = 0; i < Am; ++i)
+            Aarray[ s ][ i + i*lda ] += Am;
+        int64_t blas_info = 0;
+        lapack_potrf( uplo2str( uplo_col ), Am, Aarray[ s ], lda, &blas_info );
+        require( blas_info == 0 );
+    }
+
+    // norms for error check
+    real_t work[1];
+    std::vector<real_t> Anorm( batch ), Bnorm( batch );
+    for (size_t s = 0; s < batch; ++s) {
+        Anorm[ s ] = lapack_lantr( "f", uplo2str( uplo_col ), diag2str( diag ),
+                                   Am, Am, Aarray[ s ], lda, work );
+        Bnorm[ s ] = lapack_lange( "f", Bm, Bn, Barray[ s ], ldb, work );
+    }
+
+    // pack into compact format
+    std::vector<T> Ac( batch::compact_size<T>( layout, Am, Am, Am, batch ) );
+    std::vector<T> Bc( batch::compact_size<T>( layout, m, n, Bm, batch ) );
+    batch::pack_compact( layout, Am, Am, Aarray, lda, Ac.data(), Am, batch );
+    batch::pack_compact( layout, m, n, Barray, ldb, Bc.data(), Bm, batch );
+
+    // test error exits
+    assert_throw( batch::trsm_compact( Layout(0), side, uplo, trans, diag,  m,  n, alpha, Ac.data(), Am, Bc.data(), Bm, batch ), blas::Error );
+    assert_throw( batch::trsm_compact( layout, Side(0), uplo, trans, diag,  m,  n, alpha, Ac.data(), Am, Bc.data(), Bm, batch ), blas::Error );
+    assert_throw( batch::trmm_compact( layout,    side, uplo, trans, diag, -1,  n, alpha, Ac.data(), Am, Bc.data(), Bm, batch ), blas::Error );
+    assert_throw( batch::trmm_compact( layout,    side, uplo, trans, diag,  m,  n, alpha, Ac.data(), Am, Bc.data(), Bm-1, batch ), blas::Error );
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    if (solve) {
+        batch::trsm_compact( layout, side, uplo, trans, diag, m, n,
+                             alpha, Ac.data(), Am, Bc.data(), Bm, batch );
+    }
+    else {
+        batch::trmm_compact( layout, side, uplo, trans, diag, m, n,
+                             alpha, Ac.data(), Am, Bc.data(), Bm, batch );
+    }
+    time = get_wtime() - time;
+
+    double gflop = batch * (solve ? Gflop < T >::trsm( side, m, n )
+                                  : Gflop < T >::trmm( side, m, n ));
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    batch::unpack_compact( layout, m, n, Bc.data(), Bm, Barray, ldb, batch );
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        for (size_t s = 0; s < batch; ++s) {
+            if (solve) {
+                blas::trsm( layout, side, uplo, trans, diag, m, n,
+                            alpha, Aarray[ s ], lda, Brefarray[ s ], ldb );
+            }
+            else {
+                blas::trmm( layout, side, uplo, trans, diag, m, n,
+                            alpha, Aarray[ s ], lda, Brefarray[ s ], ldb );
+            }
+        }
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        // check error compared to reference; Am is reduction dimension
+        real_t err, error = 0;
+        bool ok, okay = true;
+        for (size_t s = 0; s < batch; ++s) {
+            check_gemm( Bm, Bn, Am, alpha, T(0), Anorm[ s ], Bnorm[ s ], real_t(0),
+                        Brefarray[ s ], ldb, Barray[ s ], ldb, verbose, &err, &ok );
+            error = max( error, err );
+            okay &= ok;
+        }
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void test_batch_compact_work( Params& params, bool run )
+{
+    if (params.routine == "batch-gemm-compact")
+        test_batch_gemm_compact_work< T >( params, run );
+    else
+        test_batch_trxm_compact_work< T >(
+            params, run, params.routine == "batch-trsm-compact" );
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_compact( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_batch_compact_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_batch_compact_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_batch_compact_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_batch_compact_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
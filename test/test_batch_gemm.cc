@@ -9,6 +9,7 @@
 #include "blas/flops.hh"
 #include "print_matrix.hh"
 #include "check_gemm.hh"
+#include "blas/batch_common.hh"
 
 #include "blas.hh"
 // -----------------------------------------------------------------------------
@@ -32,6 +33,7 @@ void test_batch_gemm_work( Params& params, bool run )
     int64_t n_       = params.dim.n();
     int64_t k_       = params.dim.k();
     size_t  batch   = params.batch();
+    blas::batch::Schedule schedule = params.schedule();
     int64_t align   = params.align();
     int64_t verbose = params.verbose();
 
@@ -43,18 +45,43 @@ void test_batch_gemm_work( Params& params, bool run )
     if (! run)
         return;
 
-    // setup
-    int64_t Am = (transA_ == Op::NoTrans ? m_ : k_);
-    int64_t An = (transA_ == Op::NoTrans ? k_ : m_);
-    int64_t Bm = (transB_ == Op::NoTrans ? k_ : n_);
-    int64_t Bn = (transB_ == Op::NoTrans ? n_ : k_);
-    int64_t Cm = m_;
-    int64_t Cn = n_;
-    if (layout == Layout::RowMajor) {
-        std::swap( Am, An );
-        std::swap( Bm, Bn );
-        std::swap( Cm, Cn );
+    // grouped: problems cycle over 3 shapes, one too large for the compact
+    // format, and 2 values of alpha, giving 6 interleaved groups of problems
+    // with equal arguments; matrices are allocated for the largest shape
+    bool grouped = (params.routine == "batch-gemm-grouped");
+    std::vector<int64_t> m_shape( 1, m_ ), n_shape( 1, n_ ), k_shape( 1, k_ );
+    if (grouped) {
+        int64_t big = blas::batch::compact_max_dim + 1;
+        m_shape = { m_, 4, big     };
+        n_shape = { n_, 5, big + 2 };
+        k_shape = { k_, 3, big + 1 };
     }
+    size_t nshapes = m_shape.size();
+
+    // sizes of A, B, C as stored, for each shape
+    std::vector<int64_t> Am_( nshapes ), An_( nshapes ), Bm_( nshapes ),
+                         Bn_( nshapes ), Cm_( nshapes ), Cn_( nshapes );
+    for (size_t j = 0; j < nshapes; ++j) {
+        Am_[ j ] = (transA_ == Op::NoTrans ? m_shape[ j ] : k_shape[ j ]);
+        An_[ j ] = (transA_ == Op::NoTrans ? k_shape[ j ] : m_shape[ j ]);
+        Bm_[ j ] = (transB_ == Op::NoTrans ? k_shape[ j ] : n_shape[ j ]);
+        Bn_[ j ] = (transB_ == Op::NoTrans ? n_shape[ j ] : k_shape[ j ]);
+        Cm_[ j ] = m_shape[ j ];
+        Cn_[ j ] = n_shape[ j ];
+        if (layout == Layout::RowMajor) {
+            std::swap( Am_[ j ], An_[ j ] );
+            std::swap( Bm_[ j ], Bn_[ j ] );
+            std::swap( Cm_[ j ], Cn_[ j ] );
+        }
+    }
+
+    // setup
+    int64_t Am = *std::max_element( Am_.begin(), Am_.end() );
+    int64_t An = *std::max_element( An_.begin(), An_.end() );
+    int64_t Bm = *std::max_element( Bm_.begin(), Bm_.end() );
+    int64_t Bn = *std::max_element( Bn_.begin(), Bn_.end() );
+    int64_t Cm = *std::max_element( Cm_.begin(), Cm_.end() );
+    int64_t Cn = *std::max_element( Cn_.begin(), Cn_.end() );
 
     int64_t lda_ = roundup( Am, align );
     int64_t ldb_ = roundup( Bm, align );
@@ -109,23 +136,86 @@ void test_batch_gemm_work( Params& params, bool run )
     real_t* Cnorm = new real_t[ batch ];
 
     for (size_t i = 0; i < batch; ++i) {
-        Anorm[i] = lapack_lange( "f", Am, An, Aarray[i], lda_, work );
-        Bnorm[i] = lapack_lange( "f", Bm, Bn, Barray[i], ldb_, work );
-        Cnorm[i] = lapack_lange( "f", Cm, Cn, Carray[i], ldc_, work );
+        size_t j = i % nshapes;
+        Anorm[i] = lapack_lange( "f", Am_[j], An_[j], Aarray[i], lda_, work );
+        Bnorm[i] = lapack_lange( "f", Bm_[j], Bn_[j], Barray[i], ldb_, work );
+        Cnorm[i] = lapack_lange( "f", Cm_[j], Cn_[j], Carray[i], ldc_, work );
     }
 
+    // test error checking, which is fused into the compute loop;
+    // every problem has m < 0, so none is computed
+    std::vector<int64_t> m_bad( batch, -1 );
+    std::vector<int64_t> info1( 1 );
+    assert_throw( blas::batch::gemm( layout, transA, transB, m_bad, n, k,
+                                     alpha, Aarray, lda, Barray, ldb,
+                                     beta, Carray, ldc, batch, info1 ),
+                  blas::Error );
+    require( info1[ 0 ] == -4 );
+    assert_throw( blas::batch::gemm( layout, transA, transB, m_bad, n, k,
+                                     alpha, Aarray, lda, Barray, ldb,
+                                     beta, Carray, ldc, batch, info ),
+                  blas::Error );
+    for (size_t i = 0; i < batch; ++i)
+        require( info[ i ] == -4 );
+
     // decide error checking mode
     info.resize( 0 );
 
+    // the balanced schedule skips sorting if dimensions are uniform,
+    // so pass per-problem dimensions to exercise it
+    if (schedule == blas::batch::Schedule::Balanced) {
+        m.assign( batch, m_ );
+        n.assign( batch, n_ );
+        k.assign( batch, k_ );
+    }
+
+    // grouped: per-problem shapes and alpha, as set up above
+    if (grouped) {
+        m.resize( batch );
+        n.resize( batch );
+        k.resize( batch );
+        alpha.resize( batch );
+        for (size_t s = 0; s < batch; ++s) {
+            m[ s ] = m_shape[ s % nshapes ];
+            n[ s ] = n_shape[ s % nshapes ];
+            k[ s ] = k_shape[ s % nshapes ];
+            alpha[ s ] = scalar_t( s / nshapes % 2 + 1 ) * alpha_;
+        }
+
+        if (verbose >= 1) {
+            auto groups = blas::batch::gemm_groups(
+                transA, transB, m, n, k, alpha, lda, ldb, beta, ldc, batch );
+            size_t largest = 0, singletons = 0;
+            for (auto const& group : groups) {
+                largest = std::max( largest, group.size() );
+                singletons += (group.size() == 1);
+            }
+            printf( "groups %lld, largest %lld, singletons %lld\n",
+                    lld( groups.size() ), lld( largest ),
+                    lld( singletons ) );
+        }
+    }
+
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::gemm( layout, transA, transB, m, n, k,
-                       alpha, Aarray, lda, Barray, ldb, beta, Carray, ldc,
-                       batch, info );
+    if (params.routine == "batch-gemm-strided") {
+        blas::batch::gemm_strided( layout, transA_, transB_, m_, n_, k_,
+                                   alpha_, A, lda_, size_A, B, ldb_, size_B,
+                                   beta_,  C, ldc_, size_C, batch );
+    }
+    else {
+        blas::batch::gemm( layout, transA, transB, m, n, k,
+                           alpha, Aarray, lda, Barray, ldb, beta, Carray, ldc,
+                           batch, info, schedule );
+    }
     time = get_wtime() - time;
 
-    double gflop = batch * Gflop < scalar_t >::gemm( m_, n_, k_ );
+    double gflop = 0;
+    for (size_t i = 0; i < batch; ++i) {
+        size_t j = i % nshapes;
+        gflop += Gflop < scalar_t >::gemm( m_shape[j], n_shape[j], k_shape[j] );
+    }
     params.time()   = time;
     params.gflops() = gflop / time;
 
@@ -134,10 +224,13 @@ void test_batch_gemm_work( Params& params, bool run )
         testsweeper::flush_cache( params.cache() );
         time = get_wtime();
         for (size_t i = 0; i < batch; ++i) {
+            size_t j = i % nshapes;
             cblas_gemm( cblas_layout_const(layout),
                         cblas_trans_const(transA_),
                         cblas_trans_const(transB_),
-                        m_, n_, k_, alpha_, Aarray[i], lda_, Barray[i], ldb_, beta_, Crefarray[i], ldc_ );
+                        m_shape[j], n_shape[j], k_shape[j],
+                        blas::batch::extract( alpha, i ),
+                        Aarray[i], lda_, Barray[i], ldb_, beta_, Crefarray[i], ldc_ );
         }
         time = get_wtime() - time;
 
@@ -148,7 +241,10 @@ void test_batch_gemm_work( Params& params, bool run )
         real_t err, error = 0;
         bool ok, okay = true;
         for (size_t i = 0; i < batch; ++i) {
-            check_gemm( Cm, Cn, k_, alpha_, beta_, Anorm[i], Bnorm[i], Cnorm[i],
+            size_t j = i % nshapes;
+            check_gemm( Cm_[j], Cn_[j], k_shape[j],
+                        blas::batch::extract( alpha, i ), beta_,
+                        Anorm[i], Bnorm[i], Cnorm[i],
                         Crefarray[i], ldc_, Carray[i], ldc_, verbose, &err, &ok );
             error = max(error, err);
             okay &= ok;
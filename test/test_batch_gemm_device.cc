@@ -9,6 +9,7 @@
 #include "blas/flops.hh"
 #include "print_matrix.hh"
 #include "check_gemm.hh"
+#include "blas/batch_common.hh"
 
 // -----------------------------------------------------------------------------
 template< typename TA, typename TB, typename TC >
@@ -48,18 +49,43 @@ void test_device_batch_gemm_work( Params& params, bool run )
         return;
     }
 
-    // setup
-    int64_t Am = (transA_ == Op::NoTrans ? m_ : k_);
-    int64_t An = (transA_ == Op::NoTrans ? k_ : m_);
-    int64_t Bm = (transB_ == Op::NoTrans ? k_ : n_);
-    int64_t Bn = (transB_ == Op::NoTrans ? n_ : k_);
-    int64_t Cm = m_;
-    int64_t Cn = n_;
-    if (layout == Layout::RowMajor) {
-        std::swap( Am, An );
-        std::swap( Bm, Bn );
-        std::swap( Cm, Cn );
+    // grouped: problems cycle over 3 shapes, one too large for the compact
+    // format, and 2 values of alpha, giving 6 interleaved groups of problems
+    // with equal arguments; matrices are allocated for the largest shape
+    bool grouped = (params.routine == "dev-batch-gemm-grouped");
+    std::vector<int64_t> m_shape( 1, m_ ), n_shape( 1, n_ ), k_shape( 1, k_ );
+    if (grouped) {
+        int64_t big = blas::batch::compact_max_dim + 1;
+        m_shape = { m_, 4, big     };
+        n_shape = { n_, 5, big + 2 };
+        k_shape = { k_, 3, big + 1 };
     }
+    size_t nshapes = m_shape.size();
+
+    // sizes of A, B, C as stored, for each shape
+    std::vector<int64_t> Am_( nshapes ), An_( nshapes ), Bm_( nshapes ),
+                         Bn_( nshapes ), Cm_( nshapes ), Cn_( nshapes );
+    for (size_t j = 0; j < nshapes; ++j) {
+        Am_[ j ] = (transA_ == Op::NoTrans ? m_shape[ j ] : k_shape[ j ]);
+        An_[ j ] = (transA_ == Op::NoTrans ? k_shape[ j ] : m_shape[ j ]);
+        Bm_[ j ] = (transB_ == Op::NoTrans ? k_shape[ j ] : n_shape[ j ]);
+        Bn_[ j ] = (transB_ == Op::NoTrans ? n_shape[ j ] : k_shape[ j ]);
+        Cm_[ j ] = m_shape[ j ];
+        Cn_[ j ] = n_shape[ j ];
+        if (layout == Layout::RowMajor) {
+            std::swap( Am_[ j ], An_[ j ] );
+            std::swap( Bm_[ j ], Bn_[ j ] );
+            std::swap( Cm_[ j ], Cn_[ j ] );
+        }
+    }
+
+    // setup
+    int64_t Am = *std::max_element( Am_.begin(), Am_.end() );
+    int64_t An = *std::max_element( An_.begin(), An_.end() );
+    int64_t Bm = *std::max_element( Bm_.begin(), Bm_.end() );
+    int64_t Bn = *std::max_element( Bn_.begin(), Bn_.end() );
+    int64_t Cm = *std::max_element( Cm_.begin(), Cm_.end() );
+    int64_t Cn = *std::max_element( Cn_.begin(), Cn_.end() );
 
     int64_t lda_ = roundup( Am, align );
     int64_t ldb_ = roundup( Bm, align );
@@ -132,23 +158,62 @@ void test_device_batch_gemm_work( Params& params, bool run )
     real_t* Cnorm = new real_t[ batch ];
 
     for (size_t s = 0; s < batch; ++s) {
-        Anorm[s] = lapack_lange( "f", Am, An, Aarray[s], lda_, work );
-        Bnorm[s] = lapack_lange( "f", Bm, Bn, Barray[s], ldb_, work );
-        Cnorm[s] = lapack_lange( "f", Cm, Cn, Carray[s], ldc_, work );
+        size_t j = s % nshapes;
+        Anorm[s] = lapack_lange( "f", Am_[j], An_[j], Aarray[s], lda_, work );
+        Bnorm[s] = lapack_lange( "f", Bm_[j], Bn_[j], Barray[s], ldb_, work );
+        Cnorm[s] = lapack_lange( "f", Cm_[j], Cn_[j], Carray[s], ldc_, work );
     }
 
     // decide error checking mode
     info.resize( 0 );
+
+    // grouped: per-problem shapes and alpha, as set up above
+    if (grouped) {
+        m.resize( batch );
+        n.resize( batch );
+        k.resize( batch );
+        alpha.resize( batch );
+        for (size_t s = 0; s < batch; ++s) {
+            m[ s ] = m_shape[ s % nshapes ];
+            n[ s ] = n_shape[ s % nshapes ];
+            k[ s ] = k_shape[ s % nshapes ];
+            alpha[ s ] = scalar_t( s / nshapes % 2 + 1 ) * alpha_;
+        }
+
+        if (verbose >= 1) {
+            auto groups = blas::batch::gemm_groups(
+                transA, transB, m, n, k, alpha, ldda, lddb, beta, lddc, batch );
+            size_t largest = 0, singletons = 0;
+            for (auto const& group : groups) {
+                largest = std::max( largest, group.size() );
+                singletons += (group.size() == 1);
+            }
+            printf( "groups %lld, largest %lld, singletons %lld\n",
+                    lld( groups.size() ), lld( largest ), lld( singletons ) );
+        }
+    }
+
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::gemm( layout, transA, transB, m, n, k,
-                       alpha, dAarray, ldda, dBarray, lddb, beta, dCarray, lddc,
-                       batch, info, queue );
+    if (params.routine == "dev-batch-gemm-strided") {
+        blas::batch::gemm_strided( layout, transA_, transB_, m_, n_, k_,
+                                   alpha_, dA, lda_, size_A, dB, ldb_, size_B,
+                                   beta_,  dC, ldc_, size_C, batch, queue );
+    }
+    else {
+        blas::batch::gemm( layout, transA, transB, m, n, k,
+                           alpha, dAarray, ldda, dBarray, lddb, beta, dCarray, lddc,
+                           batch, info, queue );
+    }
     queue.sync();
     time = get_wtime() - time;
 
-    double gflop = batch * Gflop < scalar_t >::gemm( m_, n_, k_ );
+    double gflop = 0;
+    for (size_t s = 0; s < batch; ++s) {
+        size_t j = s % nshapes;
+        gflop += Gflop < scalar_t >::gemm( m_shape[j], n_shape[j], k_shape[j] );
+    }
     params.time()   = time;
     params.gflops() = gflop / time;
     blas::device_getmatrix(Cm, batch * Cn, dC, ldc_, C, ldc_, queue);
@@ -159,10 +224,13 @@ void test_device_batch_gemm_work( Params& params, bool run )
         testsweeper::flush_cache( params.cache() );
         time = get_wtime();
         for (size_t s = 0; s < batch; ++s) {
+            size_t j = s % nshapes;
             cblas_gemm( cblas_layout_const(layout),
                         cblas_trans_const(transA_),
                         cblas_trans_const(transB_),
-                        m_, n_, k_, alpha_, Aarray[s], lda_, Barray[s], ldb_, beta_, Crefarray[s], ldc_ );
+                        m_shape[j], n_shape[j], k_shape[j],
+                        blas::batch::extract( alpha, s ),
+                        Aarray[s], lda_, Barray[s], ldb_, beta_, Crefarray[s], ldc_ );
         }
         time = get_wtime() - time;
 
@@ -173,7 +241,10 @@ void test_device_batch_gemm_work( Params& params, bool run )
         real_t err, error = 0;
         bool ok, okay = true;
         for (size_t s = 0; s < batch; ++s) {
-            check_gemm( Cm, Cn, k_, alpha_, beta_, Anorm[s], Bnorm[s], Cnorm[s],
+            size_t j = s % nshapes;
+            check_gemm( Cm_[j], Cn_[j], k_shape[j],
+                        blas::batch::extract( alpha, s ), beta_,
+                        Anorm[s], Bnorm[s], Cnorm[s],
                         Crefarray[s], ldc_, Carray[s], ldc_, verbose, &err, &ok );
             error = max(error, err);
             okay &= ok;
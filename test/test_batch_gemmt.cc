@@ -0,0 +1,203 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+// -----------------------------------------------------------------------------
+template< typename TA, typename TB, typename TC >
+void test_batch_gemmt_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using namespace blas;
+    typedef scalar_type<TA, TB, TC> scalar_t;
+    typedef real_type<scalar_t> real_t;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Uplo uplo_    = params.uplo();
+    blas::Op transA_    = params.transA();
+    blas::Op transB_    = params.transB();
+    scalar_t alpha_     = params.alpha();
+    scalar_t beta_      = params.beta();
+    int64_t n_          = params.dim.n();
+    int64_t k_          = params.dim.k();
+    size_t  batch      = params.batch();
+    int64_t align      = params.align();
+    int64_t verbose    = params.verbose();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (transA_ == Op::NoTrans ? n_ : k_);
+    int64_t An = (transA_ == Op::NoTrans ? k_ : n_);
+    int64_t Bm = (transB_ == Op::NoTrans ? k_ : n_);
+    int64_t Bn = (transB_ == Op::NoTrans ? n_ : k_);
+    if (layout == Layout::RowMajor) {
+        std::swap( Am, An );
+        std::swap( Bm, Bn );
+    }
+    int64_t lda_ = roundup( Am, align );
+    int64_t ldb_ = roundup( Bm, align );
+    int64_t ldc_ = roundup( n_, align );
+    size_t size_A = size_t(lda_)*An;
+    size_t size_B = size_t(ldb_)*Bn;
+    size_t size_C = size_t(ldc_)*n_;
+    TA* A    = new TA[ batch * size_A ];
+    TB* B    = new TB[ batch * size_B ];
+    TC* C    = new TC[ batch * size_C ];
+    TC* Cref = new TC[ batch * size_C ];
+    TC* C0   = new TC[ batch * size_C ];  // original C
+
+    // pointer arrays
+    std::vector<TA*>    Aarray( batch );
+    std::vector<TB*>    Barray( batch );
+    std::vector<TC*>    Carray( batch );
+    std::vector<TC*> Crefarray( batch );
+
+    for (size_t i = 0; i < batch; ++i) {
+         Aarray[i]   =  A   + i * size_A;
+         Barray[i]   =  B   + i * size_B;
+         Carray[i]   =  C   + i * size_C;
+        Crefarray[i] = Cref + i * size_C;
+    }
+
+    // info
+    std::vector<int64_t> info( batch );
+
+    // wrap scalar arguments in std::vector
+    std::vector<blas::Uplo> uplo(1, uplo_);
+    std::vector<blas::Op>   transA(1, transA_);
+    std::vector<blas::Op>   transB(1, transB_);
+    std::vector<int64_t>    n(1, n_);
+    std::vector<int64_t>    k(1, k_);
+    std::vector<int64_t>    lda(1, lda_);
+    std::vector<int64_t>    ldb(1, ldb_);
+    std::vector<int64_t>    ldc(1, ldc_);
+    std::vector<scalar_t>   alpha(1, alpha_);
+    std::vector<scalar_t>   beta(1, beta_);
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, batch * size_A, A );
+    lapack_larnv( idist, iseed, batch * size_B, B );
+    lapack_larnv( idist, iseed, batch * size_C, C );
+    lapack_lacpy( "g", n_, batch * n_, C, ldc_, Cref, ldc_ );
+    lapack_lacpy( "g", n_, batch * n_, C, ldc_, C0,   ldc_ );
+
+    // norms for error check
+    real_t work[1];
+    real_t* Anorm = new real_t[ batch ];
+    real_t* Bnorm = new real_t[ batch ];
+    real_t* Cnorm = new real_t[ batch ];
+
+    for (size_t s = 0; s < batch; ++s) {
+        Anorm[s] = lapack_lange( "f", Am, An, Aarray[s], lda_, work );
+        Bnorm[s] = lapack_lange( "f", Bm, Bn, Barray[s], ldb_, work );
+        Cnorm[s] = lapack_lange( "f", n_, n_, Carray[s], ldc_, work );
+    }
+
+    // decide error checking mode
+    info.resize( 0 );
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::batch::gemmt( layout, uplo, transA, transB, n, k,
+                        alpha, Aarray, lda, Barray, ldb, beta, Carray, ldc,
+                        batch, info );
+    time = get_wtime() - time;
+
+    double gflop = batch * Gflop < scalar_t >::gemmt( n_, k_ );
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference, full gemm
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        for (size_t s = 0; s < batch; ++s) {
+            cblas_gemm( cblas_layout_const(layout),
+                        cblas_trans_const(transA_),
+                        cblas_trans_const(transB_),
+                        n_, n_, k_, alpha_, Aarray[s], lda_, Barray[s], ldb_,
+                        beta_, Crefarray[s], ldc_ );
+        }
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        // check error compared to reference;
+        // in storage, RowMajor lower is ColMajor upper
+        bool lower = ((uplo_ == Uplo::Lower) ^ (layout == Layout::RowMajor));
+        real_t err, error = 0;
+        bool ok, okay = true;
+        for (size_t s = 0; s < batch; ++s) {
+            // restore the other triangle, so any change to it is an error
+            TC const* C0s = C0 + s * size_C;
+            for (int64_t j = 0; j < n_; ++j) {
+                for (int64_t i = 0; i < n_; ++i) {
+                    if (lower ? i < j : i > j)
+                        Crefarray[s][ i + j*ldc_ ] = C0s[ i + j*ldc_ ];
+                }
+            }
+            check_gemm( n_, n_, k_, alpha_, beta_, Anorm[s], Bnorm[s], Cnorm[s],
+                        Crefarray[s], ldc_, Carray[s], ldc_, verbose, &err, &ok );
+
+            error = max( error, err );
+            okay &= ok;
+        }
+        params.error() = error;
+        params.okay() = okay;
+    }
+
+    delete[] A;
+    delete[] B;
+    delete[] C;
+    delete[] Cref;
+    delete[] C0;
+
+    delete[] Anorm;
+    delete[] Bnorm;
+    delete[] Cnorm;
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_gemmt( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_batch_gemmt_work< float, float, float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_batch_gemmt_work< double, double, double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_batch_gemmt_work< std::complex<float>, std::complex<float>,
+                                   std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_batch_gemmt_work< std::complex<double>, std::complex<double>,
+                                   std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
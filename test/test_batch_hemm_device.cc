@@ -132,8 +132,16 @@ void test_batch_hemm_device_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::hemm( layout, side, uplo, m, n, alpha, dAarray, lda, dBarray, ldb, beta, dCarray, ldc,
-                       batch, info, queue);
+    if (params.routine == "dev-batch-hemm-strided") {
+        blas::batch::hemm_strided( layout, side_, uplo_, m_, n_,
+                                   alpha_, dA, lda_, size_A, dB, ldb_, size_B,
+                                   beta_,  dC, ldc_, size_C,
+                                   batch, queue );
+    }
+    else {
+        blas::batch::hemm( layout, side, uplo, m, n, alpha, dAarray, lda, dBarray, ldb, beta, dCarray, ldc,
+                           batch, info, queue);
+    }
     queue.sync();
     time = get_wtime() - time;
 
@@ -107,8 +107,16 @@ void test_batch_her2k_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::her2k( layout, uplo, trans, n, k, alpha, Aarray, lda, Barray, ldb, beta, Carray, ldc,
-                        batch, info );
+    if (params.routine == "batch-her2k-strided") {
+        blas::batch::her2k_strided( layout, uplo_, trans_, n_, k_,
+                                    alpha_, A, lda_, size_A, B, ldb_, size_B,
+                                    beta_,  C, ldc_, size_C,
+                                    batch );
+    }
+    else {
+        blas::batch::her2k( layout, uplo, trans, n, k, alpha, Aarray, lda, Barray, ldb, beta, Carray, ldc,
+                            batch, info );
+    }
     time = get_wtime() - time;
 
     double gflop = batch * Gflop < scalar_t >::her2k( n_, k_ );
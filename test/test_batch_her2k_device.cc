@@ -131,8 +131,16 @@ void test_batch_her2k_device_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::her2k( layout, uplo, trans, n, k, alpha, dAarray, lda, dBarray, ldb, beta, dCarray, ldc,
-                        batch, info, queue);
+    if (params.routine == "dev-batch-her2k-strided") {
+        blas::batch::her2k_strided( layout, uplo_, trans_, n_, k_,
+                                    alpha_, dA, lda_, size_A, dB, ldb_, size_B,
+                                    beta_,  dC, ldc_, size_C,
+                                    batch, queue );
+    }
+    else {
+        blas::batch::her2k( layout, uplo, trans, n, k, alpha, dAarray, lda, dBarray, ldb, beta, dCarray, ldc,
+                            batch, info, queue);
+    }
     queue.sync();
     time = get_wtime() - time;
 
@@ -98,8 +98,16 @@ void test_batch_herk_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::herk( layout, uplo, trans, n, k, alpha, Aarray, lda, beta, Carray, ldc,
-                       batch, info );
+    if (params.routine == "batch-herk-strided") {
+        blas::batch::herk_strided( layout, uplo_, trans_, n_, k_,
+                                   alpha_, A, lda_, size_A,
+                                   beta_,  C, ldc_, size_C,
+                                   batch );
+    }
+    else {
+        blas::batch::herk( layout, uplo, trans, n, k, alpha, Aarray, lda, beta, Carray, ldc,
+                           batch, info );
+    }
     time = get_wtime() - time;
 
     double gflop = batch * Gflop < scalar_t >::herk( n_, k_ );
@@ -118,8 +118,16 @@ void test_batch_herk_device_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::herk( layout, uplo, trans, n, k, alpha, dAarray, lda, beta, dCarray, ldc,
-                       batch, info, queue );
+    if (params.routine == "dev-batch-herk-strided") {
+        blas::batch::herk_strided( layout, uplo_, trans_, n_, k_,
+                                   alpha_, dA, lda_, size_A,
+                                   beta_,  dC, ldc_, size_C,
+                                   batch, queue );
+    }
+    else {
+        blas::batch::herk( layout, uplo, trans, n, k, alpha, dAarray, lda, beta, dCarray, ldc,
+                           batch, info, queue );
+    }
     queue.sync();
     time = get_wtime() - time;
 
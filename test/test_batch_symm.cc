@@ -108,8 +108,16 @@ void test_batch_symm_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::symm( layout, side, uplo, m, n, alpha, Aarray, lda, Barray, ldb, beta, Carray, ldc,
-                       batch, info );
+    if (params.routine == "batch-symm-strided") {
+        blas::batch::symm_strided( layout, side_, uplo_, m_, n_,
+                                   alpha_, A, lda_, size_A, B, ldb_, size_B,
+                                   beta_,  C, ldc_, size_C,
+                                   batch );
+    }
+    else {
+        blas::batch::symm( layout, side, uplo, m, n, alpha, Aarray, lda, Barray, ldb, beta, Carray, ldc,
+                           batch, info );
+    }
     time = get_wtime() - time;
 
     double gflop = batch * Gflop < scalar_t >::symm( side_, m_, n_ );
@@ -131,8 +131,16 @@ void test_batch_symm_device_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::symm( layout, side, uplo, m, n, alpha, dAarray, lda, dBarray, ldb, beta, dCarray, ldc,
-                       batch, info, queue);
+    if (params.routine == "dev-batch-symm-strided") {
+        blas::batch::symm_strided( layout, side_, uplo_, m_, n_,
+                                   alpha_, dA, lda_, size_A, dB, ldb_, size_B,
+                                   beta_,  dC, ldc_, size_C,
+                                   batch, queue );
+    }
+    else {
+        blas::batch::symm( layout, side, uplo, m, n, alpha, dAarray, lda, dBarray, ldb, beta, dCarray, ldc,
+                           batch, info, queue);
+    }
     time = get_wtime() - time;
 
     double gflop = batch * Gflop < scalar_t >::symm( side_, m_, n_ );
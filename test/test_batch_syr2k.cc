@@ -107,8 +107,16 @@ void test_batch_syr2k_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::syr2k( layout, uplo, trans, n, k, alpha, Aarray, lda, Barray, ldb, beta, Carray, ldc,
-                        batch, info );
+    if (params.routine == "batch-syr2k-strided") {
+        blas::batch::syr2k_strided( layout, uplo_, trans_, n_, k_,
+                                    alpha_, A, lda_, size_A, B, ldb_, size_B,
+                                    beta_,  C, ldc_, size_C,
+                                    batch );
+    }
+    else {
+        blas::batch::syr2k( layout, uplo, trans, n, k, alpha, Aarray, lda, Barray, ldb, beta, Carray, ldc,
+                            batch, info );
+    }
     time = get_wtime() - time;
 
     double gflop = batch * Gflop < scalar_t >::syr2k( n_, k_ );
@@ -118,8 +118,16 @@ void test_batch_syrk_device_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::syrk( layout, uplo, trans, n, k, alpha, dAarray, lda, beta, dCarray, ldc,
-                       batch, info, queue );
+    if (params.routine == "dev-batch-syrk-strided") {
+        blas::batch::syrk_strided( layout, uplo_, trans_, n_, k_,
+                                   alpha_, dA, lda_, size_A,
+                                   beta_,  dC, ldc_, size_C,
+                                   batch, queue );
+    }
+    else {
+        blas::batch::syrk( layout, uplo, trans, n, k, alpha, dAarray, lda, beta, dCarray, ldc,
+                           batch, info, queue );
+    }
     queue.sync();
     time = get_wtime() - time;
 
@@ -102,8 +102,15 @@ void test_batch_trmm_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::trmm( layout, side, uplo, trans, diag, m, n, alpha, Aarray, lda, Barray, ldb,
-                       batch, info );
+    if (params.routine == "batch-trmm-strided") {
+        blas::batch::trmm_strided( layout, side_, uplo_, trans_, diag_, m_, n_,
+                                   alpha_, A, lda_, size_A, B, ldb_, size_B,
+                                   batch );
+    }
+    else {
+        blas::batch::trmm( layout, side, uplo, trans, diag, m, n, alpha, Aarray, lda, Barray, ldb,
+                           batch, info );
+    }
     time = get_wtime() - time;
 
     double gflop = batch * Gflop < scalar_t >::trmm( side_, m_, n_ );
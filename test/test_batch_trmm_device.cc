@@ -122,8 +122,15 @@ void test_batch_trmm_work_device( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::trmm( layout, side, uplo, trans, diag, m, n, alpha, dAarray, lda, dBarray, ldb,
-                       batch, info, queue );
+    if (params.routine == "dev-batch-trmm-strided") {
+        blas::batch::trmm_strided( layout, side_, uplo_, trans_, diag_, m_, n_,
+                                   alpha_, dA, lda_, size_A, dB, ldb_, size_B,
+                                   batch, queue );
+    }
+    else {
+        blas::batch::trmm( layout, side, uplo, trans, diag, m, n, alpha, dAarray, lda, dBarray, ldb,
+                           batch, info, queue );
+    }
     queue.sync();
     time = get_wtime() - time;
 
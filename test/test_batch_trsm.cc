@@ -139,8 +139,15 @@ void test_batch_trsm_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::trsm( layout, side, uplo, trans, diag, m, n, alpha, Aarray, vlda_, Barray, vldb_,
-                       batch, info );
+    if (params.routine == "batch-trsm-strided") {
+        blas::batch::trsm_strided( layout, side_, uplo_, trans_, diag_, m_, n_,
+                                   alpha_, A, lda_, size_A, B, ldb_, size_B,
+                                   batch );
+    }
+    else {
+        blas::batch::trsm( layout, side, uplo, trans, diag, m, n, alpha, Aarray, vlda_, Barray, vldb_,
+                           batch, info );
+    }
     time = get_wtime() - time;
 
     double gflop = batch * Gflop < scalar_t >::trsm( side_, m_, n_ );
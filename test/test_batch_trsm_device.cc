@@ -161,8 +161,15 @@ void test_device_batch_trsm_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::batch::trsm( layout, side, uplo, trans, diag, m, n, alpha, dAarray, ldda, dBarray, lddb,
-                       batch, info, queue );
+    if (params.routine == "dev-batch-trsm-strided") {
+        blas::batch::trsm_strided( layout, side_, uplo_, trans_, diag_, m_, n_,
+                                   alpha_, dA, lda_, size_A, dB, ldb_, size_B,
+                                   batch, queue );
+    }
+    else {
+        blas::batch::trsm( layout, side, uplo, trans, diag, m, n, alpha, dAarray, ldda, dBarray, lddb,
+                           batch, info, queue );
+    }
     queue.sync();
     time = get_wtime() - time;
 
@@ -26,6 +26,9 @@ void test_dot_work( Params& params, bool run )
     int64_t incy    = params.incy();
     int64_t verbose = params.verbose();
 
+    // tmpl-dot calls the template implementation instead of vendor BLAS
+    bool tmpl = (params.routine == "tmpl-dot");
+
     // mark non-standard output values
     params.gflops();
     params.gbytes();
@@ -75,7 +78,13 @@ void test_dot_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    scalar_t result = blas::dot( n, x, incx, y, incy );
+    scalar_t result;
+    if (tmpl) {
+        result = blas::dot< TX, TY >( n, x, incx, y, incy );
+    }
+    else {
+        result = blas::dot( n, x, incx, y, incy );
+    }
     time = get_wtime() - time;
 
     double gflop = Gflop < scalar_t >::dot( n );
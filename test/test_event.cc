@@ -0,0 +1,161 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+
+// -----------------------------------------------------------------------------
+/// Double-buffered pipeline on 3 queues, ordered only by events:
+/// copy chunk to device, scale it, copy it back.
+template <typename T>
+void test_event_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type<T>;
+
+    // get & mark input values
+    T alpha         = params.alpha();
+    int64_t n       = params.dim.n();
+    int64_t device  = params.device();
+    int64_t verbose = params.verbose();
+    int64_t chunks  = 8;
+
+    // mark non-standard output values
+    params.gbytes();
+    params.ref_time();
+    params.ref_gbytes();
+
+    params.time    .name( "pipe (sec)" );
+    params.ref_time.name( "sync (sec)" );
+    params.gbytes    .name( "pipe GB/s" );
+    params.ref_gbytes.name( "sync GB/s" );
+
+    if (! run)
+        return;
+
+    if (blas::get_device_count() == 0) {
+        params.msg() = "skipping: no GPU devices or no GPU support";
+        return;
+    }
+
+    // setup
+    blas::Queue h2d_queue( device, 0 );
+    blas::Queue compute_queue( device, 0 );
+    blas::Queue d2h_queue( device, 0 );
+
+    int64_t size = n * chunks;
+    T* x_host = blas::device_malloc_pinned<T>( size, h2d_queue );
+    T* y_host = blas::device_malloc_pinned<T>( size, h2d_queue );
+    T* y_ref  = new T[ size ];
+    T* d_buf[ 2 ];
+    d_buf[ 0 ] = blas::device_malloc<T>( n, h2d_queue );
+    d_buf[ 1 ] = blas::device_malloc<T>( n, h2d_queue );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size, x_host );
+    blas::copy( size, x_host, 1, y_ref, 1 );
+    blas::scal( size, alpha, y_ref, 1 );
+
+    // Each failed check adds 1 to error.
+    real_t error = 0;
+
+    // An event that was never recorded is complete.
+    blas::Event event;
+    if (! event.query())
+        error += 1;
+    event.sync();
+    compute_queue.wait( event );
+
+    //----------
+    // pipeline: chunk k uses buffer k % 2
+    blas::Event copied[ 2 ], scaled[ 2 ], copied_back[ 2 ];
+    double time = sync_get_wtime( h2d_queue );
+    for (int64_t k = 0; k < chunks; ++k) {
+        int b = k % 2;
+        h2d_queue.wait( copied_back[ b ] );
+        blas::device_memcpy( d_buf[ b ], &x_host[ k*n ], n, h2d_queue );
+        h2d_queue.record( copied[ b ] );
+
+        compute_queue.wait( copied[ b ] );
+        blas::scal( n, alpha, d_buf[ b ], 1, compute_queue );
+        compute_queue.record( scaled[ b ] );
+
+        d2h_queue.wait( scaled[ b ] );
+        blas::device_memcpy( &y_host[ k*n ], d_buf[ b ], n, d2h_queue );
+        d2h_queue.record( copied_back[ b ] );
+    }
+    copied_back[ (chunks - 1) % 2 ].sync();
+    time = get_wtime() - time;
+
+    if (! copied_back[ 0 ].query() || ! copied_back[ 1 ].query())
+        error += 1;
+
+    // check error; scaling is exact elementwise
+    for (int64_t i = 0; i < size; ++i) {
+        if (y_host[ i ] != y_ref[ i ]) {
+            error += 1;
+            break;
+        }
+    }
+    if (verbose >= 1)
+        printf( "pipeline error %.2e\n", double( error ) );
+
+    //----------
+    // reference: same steps with host syncs between queues
+    double ref_time = sync_get_wtime( h2d_queue );
+    for (int64_t k = 0; k < chunks; ++k) {
+        int b = k % 2;
+        blas::device_memcpy( d_buf[ b ], &x_host[ k*n ], n, h2d_queue );
+        h2d_queue.sync();
+        blas::scal( n, alpha, d_buf[ b ], 1, compute_queue );
+        compute_queue.sync();
+        blas::device_memcpy( &y_host[ k*n ], d_buf[ b ], n, d2h_queue );
+        d2h_queue.sync();
+    }
+    ref_time = get_wtime() - ref_time;
+
+    // read and write x on the host, read and write each chunk on the device
+    double gbyte = blas::Gbyte<T>::copy( size ) * 2;
+    params.time()       = time;
+    params.gbytes()     = gbyte / time;
+    params.ref_time()   = ref_time;
+    params.ref_gbytes() = gbyte / ref_time;
+    params.error()      = error;
+    params.okay()       = (error == 0);
+
+    blas::device_free( d_buf[ 0 ], h2d_queue );
+    blas::device_free( d_buf[ 1 ], h2d_queue );
+    blas::device_free_pinned( x_host, h2d_queue );
+    blas::device_free_pinned( y_host, h2d_queue );
+    delete[] y_ref;
+}
+
+// -----------------------------------------------------------------------------
+void test_event( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_event_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_event_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_event_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_event_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
@@ -0,0 +1,166 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack_wrappers.hh"
+
+#include <set>
+
+// -----------------------------------------------------------------------------
+/// @return identity of the queue's current stream.
+inline void const* current_stream_id( blas::Queue& queue )
+{
+    #if defined(BLAS_HAVE_CUBLAS) || defined(BLAS_HAVE_ROCBLAS)
+        return (void const*) queue.stream();
+    #elif defined(BLAS_HAVE_ONEMKL)
+        // fork-join is disabled for sycl; no streams to compare
+        return nullptr;
+    #else
+        return &queue.stream();
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// Nested fork and join: each outer stream forks to copy chunks of x to y,
+/// then after the inner join adds alpha*y to z, which must see the copies.
+/// The inner forks must not use any of the outer fork's streams.
+template <typename T>
+void test_fork_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type<T>;
+
+    // get & mark input values
+    T alpha         = params.alpha();
+    int64_t n       = params.dim.n();
+    int64_t device  = params.device();
+    int64_t verbose = params.verbose();
+    int64_t outer   = 3;
+    int64_t inner   = 2;
+
+    if (! run)
+        return;
+
+    if (blas::get_device_count() == 0) {
+        params.msg() = "skipping: no GPU devices or no GPU support";
+        return;
+    }
+
+    // setup
+    blas::Queue queue( device, 0 );
+    queue.set_fork_size( outer );
+
+    // chunks of n elements: outer*inner in all
+    int64_t size = n * outer * inner;
+    T* x_host = blas::device_malloc_pinned<T>( size, queue );
+    T* z_host = blas::device_malloc_pinned<T>( size, queue );
+    T* z_ref  = new T[ size ];
+    T* dx = blas::device_malloc<T>( size, queue );
+    T* dy = blas::device_malloc<T>( size, queue );
+    T* dz = blas::device_malloc<T>( size, queue );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size, x_host );
+    lapack_larnv( idist, iseed, size, z_host );
+    blas::copy( size, z_host, 1, z_ref, 1 );
+    blas::axpy( size, alpha, x_host, 1, z_ref, 1 );
+
+    blas::device_memcpy( dx, x_host, size, queue );
+    blas::device_memcpy( dz, z_host, size, queue );
+    blas::device_memset( dy, 0, size, queue );
+
+    // run test
+    std::set< void const* > outer_streams, inner_streams;
+    double time = sync_get_wtime( queue );
+    queue.fork( outer );
+    assert_throw( queue.set_fork_size( 1 ), blas::Error );
+    for (int64_t i = 0; i < outer; ++i) {
+        int64_t offset = i * inner * n;
+        outer_streams.insert( current_stream_id( queue ) );
+        queue.fork( inner );
+        for (int64_t j = 0; j < inner; ++j) {
+            inner_streams.insert( current_stream_id( queue ) );
+            blas::copy( n, &dx[ offset + j*n ], 1, &dy[ offset + j*n ], 1,
+                        queue );
+            queue.revolve();
+        }
+        queue.join();
+        blas::axpy( inner*n, alpha, &dy[ offset ], 1, &dz[ offset ], 1,
+                    queue );
+        queue.revolve();
+    }
+    queue.join();
+    blas::device_memcpy( z_host, dz, size, queue );
+    queue.sync();
+    time = get_wtime() - time;
+
+    // count inner streams that are also outer streams
+    int64_t shared = 0;
+    for (void const* stream : inner_streams) {
+        if (stream != nullptr && outer_streams.count( stream ) > 0)
+            ++shared;
+    }
+
+    // check error; a stale y would leave z unchanged
+    real_t dummy;
+    real_t z_norm = lapack_lange( "m", 1, size, z_ref, 1, &dummy );
+    blas::axpy( size, -1.0, z_ref, 1, z_host, 1 );
+    real_t error = lapack_lange( "m", 1, size, z_host, 1, &dummy ) / z_norm;
+    if (verbose >= 1)
+        printf( "fork size %lld, error %.2e, shared streams %lld\n",
+                llong( queue.fork_size() ), double( error ), llong( shared ) );
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    params.time()  = time;
+    params.error() = error;
+    params.okay()  = (error < 3*eps) && (shared == 0);
+    if (shared > 0)
+        params.msg() = "inner fork uses outer streams";
+
+    #if ! defined(BLAS_HAVE_CUBLAS) && ! defined(BLAS_HAVE_ROCBLAS) \
+        && ! defined(BLAS_HAVE_ONEMKL)
+        // an error in a task on a parallel stream is rethrown by sync
+        // after join
+        queue.fork( outer );
+        queue.stream().submit( []() { throw blas::Error( "forked task" ); } );
+        queue.join();
+        assert_throw( queue.sync(), blas::Error );
+        queue.sync();
+    #endif
+
+    blas::device_free( dx, queue );
+    blas::device_free( dy, queue );
+    blas::device_free( dz, queue );
+    blas::device_free_pinned( x_host, queue );
+    blas::device_free_pinned( z_host, queue );
+    delete[] z_ref;
+}
+
+// -----------------------------------------------------------------------------
+void test_fork( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_fork_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_fork_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_fork_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_fork_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
@@ -0,0 +1,214 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+// -----------------------------------------------------------------------------
+template< typename TA, typename TB, typename TC >
+void test_gbmm_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using namespace blas;
+    typedef scalar_type<TA, TB, TC> scalar_t;
+    typedef real_type<scalar_t> real_t;
+    typedef long long lld;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op transA = params.transA();
+    blas::Op transB = params.transB();
+    scalar_t alpha  = params.alpha();
+    scalar_t beta   = params.beta();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t kl      = params.kl();
+    int64_t ku      = params.ku();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // setup
+    // A is Ar-by-Ac with kl sub- and ku super-diagonals, stored as
+    // (kl + ku + 1)-by-Ac band [RowMajor: Ar-by-(kl + ku + 1)]
+    int64_t Ar = (transA == Op::NoTrans ? m : k);
+    int64_t Ac = (transA == Op::NoTrans ? k : m);
+    int64_t Am = kl + ku + 1;
+    int64_t An = (layout == Layout::ColMajor ? Ac : Ar);
+    int64_t Bm = (transB == Op::NoTrans ? k : n);
+    int64_t Bn = (transB == Op::NoTrans ? n : k);
+    int64_t Cm = m;
+    int64_t Cn = n;
+    if (layout == Layout::RowMajor) {
+        std::swap( Bm, Bn );
+        std::swap( Cm, Cn );
+    }
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    int64_t ldc = roundup( Cm, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_B = size_t(ldb)*Bn;
+    size_t size_C = size_t(ldc)*Cn;
+    TA* A    = new TA[ size_A ];
+    TB* B    = new TB[ size_B ];
+    TC* C    = new TC[ size_C ];
+    TC* Cref = new TC[ size_C ];
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A );
+    lapack_larnv( idist, iseed, size_B, B );
+    lapack_larnv( idist, iseed, size_C, C );
+    lapack_lacpy( "g", Cm, Cn, C, ldc, Cref, ldc );
+
+    // norms for error check; the band storage bounds the norm of A
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, A, lda, work );
+    real_t Bnorm = lapack_lange( "f", Bm, Bn, B, ldb, work );
+    real_t Cnorm = lapack_lange( "f", Cm, Cn, C, ldc, work );
+
+    // test error exits
+    assert_throw( blas::gbmm( Layout(0), transA, transB,  m,  n,  k, kl, ku, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gbmm( layout,    Op(0),  transB,  m,  n,  k, kl, ku, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gbmm( layout,    transA, Op(0),   m,  n,  k, kl, ku, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gbmm( layout,    transA, transB, -1,  n,  k, kl, ku, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gbmm( layout,    transA, transB,  m, -1,  k, kl, ku, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gbmm( layout,    transA, transB,  m,  n, -1, kl, ku, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gbmm( layout,    transA, transB,  m,  n,  k, -1, ku, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gbmm( layout,    transA, transB,  m,  n,  k, kl, -1, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gbmm( layout,    transA, transB,  m,  n,  k, kl, ku, alpha, A, Am-1, B, ldb, beta, C, ldc ), blas::Error );
+
+    assert_throw( blas::gbmm( Layout::ColMajor, transA, Op::NoTrans, m, n, k, kl, ku, alpha, A, lda, B, k-1, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gbmm( Layout::ColMajor, transA, Op::Trans,   m, n, k, kl, ku, alpha, A, lda, B, n-1, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gbmm( Layout::RowMajor, transA, Op::NoTrans, m, n, k, kl, ku, alpha, A, lda, B, n-1, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gbmm( Layout::RowMajor, transA, Op::Trans,   m, n, k, kl, ku, alpha, A, lda, B, k-1, beta, C, ldc ), blas::Error );
+
+    assert_throw( blas::gbmm( Layout::ColMajor, transA, transB, m, n, k, kl, ku, alpha, A, lda, B, ldb, beta, C, m-1 ), blas::Error );
+    assert_throw( blas::gbmm( Layout::RowMajor, transA, transB, m, n, k, kl, ku, alpha, A, lda, B, ldb, beta, C, n-1 ), blas::Error );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A Ar=%5lld, Ac=%5lld, kl=%5lld, ku=%5lld, lda=%5lld, size=%10lld, norm %.2e\n"
+                "B Bm=%5lld, Bn=%5lld, ldb=%5lld, size=%10lld, norm %.2e\n"
+                "C Cm=%5lld, Cn=%5lld, ldc=%5lld, size=%10lld, norm %.2e\n",
+                (lld) Ar, (lld) Ac, (lld) kl, (lld) ku, (lld) lda, (lld) size_A, Anorm,
+                (lld) Bm, (lld) Bn, (lld) ldb, (lld) size_B, Bnorm,
+                (lld) Cm, (lld) Cn, (lld) ldc, (lld) size_C, Cnorm );
+    }
+    if (verbose >= 2) {
+        printf( "alpha = %.4e + %.4ei; beta = %.4e + %.4ei;\n",
+                real(alpha), imag(alpha),
+                real(beta),  imag(beta) );
+        printf( "A = "    ); print_matrix( Am, An, A, lda );
+        printf( "B = "    ); print_matrix( Bm, Bn, B, ldb );
+        printf( "C = "    ); print_matrix( Cm, Cn, C, ldc );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::gbmm( layout, transA, transB, m, n, k, kl, ku,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+    time = get_wtime() - time;
+
+    // op(A) has kl sub-diagonals and ku super-diagonals, swapped if transposed
+    double gflop = (transA == Op::NoTrans
+                    ? Gflop < scalar_t >::gbmm( m, n, k, kl, ku )
+                    : Gflop < scalar_t >::gbmm( m, n, k, ku, kl ));
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "C2 = " ); print_matrix( Cm, Cn, C, ldc );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // expand A to a dense Ar-by-Ac matrix Ad, in the same layout
+        int64_t ldd = (layout == Layout::ColMajor ? Ar : Ac);
+        TA* Ad = new TA[ size_t(Ar)*Ac ];
+        for (int64_t c = 0; c < Ac; ++c) {
+            for (int64_t r = 0; r < Ar; ++r) {
+                bool in_band = (r - c <= kl && c - r <= ku);
+                if (layout == Layout::ColMajor) {
+                    Ad[ r + c*ldd ] = (in_band ? A[ ku + r - c + c*lda ] : TA( 0 ));
+                }
+                else {
+                    Ad[ r*ldd + c ] = (in_band ? A[ kl + c - r + r*lda ] : TA( 0 ));
+                }
+            }
+        }
+
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_gemm( cblas_layout_const(layout),
+                    cblas_trans_const(transA),
+                    cblas_trans_const(transB),
+                    m, n, k, alpha, Ad, std::max< int64_t >( 1, ldd ),
+                    B, ldb, beta, Cref, ldc );
+        time = get_wtime() - time;
+        delete[] Ad;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        if (verbose >= 2) {
+            printf( "Cref = " ); print_matrix( Cm, Cn, Cref, ldc );
+        }
+
+        // check error compared to reference
+        real_t error;
+        bool okay;
+        check_gemm( Cm, Cn, k, alpha, beta, Anorm, Bnorm, Cnorm,
+                    Cref, ldc, C, ldc, verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+
+    delete[] A;
+    delete[] B;
+    delete[] C;
+    delete[] Cref;
+}
+
+// -----------------------------------------------------------------------------
+void test_gbmm( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gbmm_work< float, float, float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gbmm_work< double, double, double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gbmm_work< std::complex<float>, std::complex<float>,
+                            std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gbmm_work< std::complex<double>, std::complex<double>,
+                            std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
@@ -32,10 +32,23 @@ void test_gemm_work( Params& params, bool run )
     int64_t align   = params.align();
     int64_t verbose = params.verbose();
 
+    // tmpl-gemm calls the template implementation instead of vendor BLAS
+    bool tmpl = (params.routine == "tmpl-gemm");
+    int64_t threads = (tmpl ? params.threads() : 1);
+
     // mark non-standard output values
     params.gflops();
     params.ref_time();
     params.ref_gflops();
+    if (tmpl) {
+        params.time2.name( "Unblocked\ntime (s)" );
+        params.gflops2.name( "Unblocked\nGflop/s" );
+        params.time2();
+        params.gflops2();
+        params.time3.name( "1 thread\ntime (s)" );
+        params.time3();
+        params.efficiency();
+    }
 
     if (! run)
         return;
@@ -70,6 +83,13 @@ void test_gemm_work( Params& params, bool run )
     lapack_larnv( idist, iseed, size_C, C );
     lapack_lacpy( "g", Cm, Cn, C, ldc, Cref, ldc );
 
+    // C2 is input for the unblocked loops
+    TC* C2 = nullptr;
+    if (tmpl && params.ref() == 'y') {
+        C2 = new TC[ size_C ];
+        lapack_lacpy( "g", Cm, Cn, C, ldc, C2, ldc );
+    }
+
     // norms for error check
     real_t work[1];
     real_t Anorm = lapack_lange( "f", Am, An, A, lda, work );
@@ -121,16 +141,50 @@ void test_gemm_work( Params& params, bool run )
         printf( "C = "    ); print_matrix( Cm, Cn, C, ldc );
     }
 
+    if (tmpl) {
+        blas::set_template_threads( threads );
+        threads = blas::get_template_threads();
+    }
+
+    // for parallel efficiency, time a 1-thread run on a copy of C
+    double time1 = 0;
+    if (tmpl && threads > 1) {
+        TC* C1 = new TC[ size_C ];
+        lapack_lacpy( "g", Cm, Cn, C, ldc, C1, ldc );
+        blas::set_template_threads( 1 );
+        testsweeper::flush_cache( params.cache() );
+        time1 = get_wtime();
+        blas::gemm< TA, TB, TC >( layout, transA, transB, m, n, k,
+                                  alpha, A, lda, B, ldb, beta, C1, ldc );
+        time1 = get_wtime() - time1;
+        blas::set_template_threads( threads );
+        delete[] C1;
+    }
+
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::gemm( layout, transA, transB, m, n, k,
-                alpha, A, lda, B, ldb, beta, C, ldc );
+    if (tmpl) {
+        blas::gemm< TA, TB, TC >( layout, transA, transB, m, n, k,
+                                  alpha, A, lda, B, ldb, beta, C, ldc );
+    }
+    else {
+        blas::gemm( layout, transA, transB, m, n, k,
+                    alpha, A, lda, B, ldb, beta, C, ldc );
+    }
     time = get_wtime() - time;
 
     double gflop = Gflop < scalar_t >::gemm( m, n, k );
     params.time()   = time;
     params.gflops() = gflop / time;
+    if (tmpl) {
+        // restore default thread count
+        blas::set_template_threads( 0 );
+        if (threads == 1)
+            time1 = time;
+        params.time3() = time1;
+        params.efficiency() = time1 / (threads * time);
+    }
 
     if (verbose >= 2) {
         printf( "C2 = " ); print_matrix( Cm, Cn, C, ldc );
@@ -149,6 +203,26 @@ void test_gemm_work( Params& params, bool run )
         params.ref_time()   = time;
         params.ref_gflops() = gflop / time;
 
+        if (tmpl && params.ref() == 'y') {
+            // time the unblocked loops that the blocked engine replaced;
+            // they take column-major arguments, so swap A and B if row-major.
+            testsweeper::flush_cache( params.cache() );
+            time = get_wtime();
+            if (layout == Layout::ColMajor) {
+                blas::internal::gemm_reference(
+                    transA, transB, m, n, k,
+                    alpha, A, lda, B, ldb, beta, C2, ldc );
+            }
+            else {
+                blas::internal::gemm_reference(
+                    transB, transA, n, m, k,
+                    alpha, B, ldb, A, lda, beta, C2, ldc );
+            }
+            time = get_wtime() - time;
+            params.time2()   = time;
+            params.gflops2() = gflop / time;
+        }
+
         if (verbose >= 2) {
             printf( "Cref = " ); print_matrix( Cm, Cn, Cref, ldc );
         }
@@ -166,6 +240,7 @@ void test_gemm_work( Params& params, bool run )
     delete[] B;
     delete[] C;
     delete[] Cref;
+    delete[] C2;
 }
 
 // -----------------------------------------------------------------------------
@@ -190,6 +265,17 @@ void test_gemm( Params& params, bool run )
                             std::complex<double> >( params, run );
             break;
 
+        // 16-bit inputs, float output
+        case DataType_Half:
+            test_gemm_work< blas::float16, blas::float16, float >(
+                params, run );
+            break;
+
+        case DataType_BFloat16:
+            test_gemm_work< blas::bfloat16, blas::bfloat16, float >(
+                params, run );
+            break;
+
         default:
             throw std::exception();
             break;
@@ -0,0 +1,249 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Sets x[ i ] = offset + floor( range * u ), for u uniform in [0, 1),
+// and returns the same values as floats in xf.
+template <typename T>
+void random_int( int iseed[4], size_t n, int32_t offset, int32_t range,
+                 T* x, float* xf )
+{
+    lapack_larnv( 1, iseed, n, xf );
+    for (size_t i = 0; i < n; ++i) {
+        int32_t xi = std::min( offset + int32_t( range * xf[ i ] ),
+                               offset + range - 1 );
+        x[ i ]  = T( xi );
+        xf[ i ] = float( xi );
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Exact integer gemm, accumulated in int64, for column-major arguments:
+// C = alpha (op(A) - A_zero) (op(B) - B_zero) + beta C.
+template <typename TA, typename TB>
+void gemm_int_reference(
+    blas::Op transA, blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int32_t alpha,
+    TA const* A, int64_t lda, int32_t const* A_zero,
+    TB const* B, int64_t ldb, int32_t const* B_zero,
+    int32_t beta,
+    int32_t* C, int64_t ldc )
+{
+    using blas::Op;
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            int64_t sum = 0;
+            for (int64_t l = 0; l < k; ++l) {
+                int64_t a = (transA == Op::NoTrans ? A[ i + l*lda ]
+                                                   : A[ l + i*lda ]);
+                int64_t b = (transB == Op::NoTrans ? B[ l + j*ldb ]
+                                                   : B[ j + l*ldb ]);
+                if (A_zero)
+                    a -= A_zero[ i ];
+                if (B_zero)
+                    b -= B_zero[ j ];
+                sum += a * b;
+            }
+            C[ i + j*ldc ] = int32_t( alpha*sum + int64_t( beta )*C[ i + j*ldc ] );
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename TA, typename TB>
+void test_gemm_int8_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using namespace blas;
+    typedef long long lld;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op transA = params.transA();
+    blas::Op transB = params.transB();
+    int32_t alpha   = int32_t( params.alpha() );
+    int32_t beta    = int32_t( params.beta() );
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+    bool use_zero   = (params.zero_point() == 'y');
+
+    // mark non-standard output values
+    params.gflops();
+    params.gbytes();
+    params.ref_time();
+    params.ref_gflops();
+    params.ref_time.name( "sgemm\ntime (s)" );
+    params.ref_gflops.name( "sgemm\nGflop/s" );
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (transA == Op::NoTrans ? m : k);
+    int64_t An = (transA == Op::NoTrans ? k : m);
+    int64_t Bm = (transB == Op::NoTrans ? k : n);
+    int64_t Bn = (transB == Op::NoTrans ? n : k);
+    int64_t Cm = m;
+    int64_t Cn = n;
+    if (layout == Layout::RowMajor) {
+        std::swap( Am, An );
+        std::swap( Bm, Bn );
+        std::swap( Cm, Cn );
+    }
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    int64_t ldc = roundup( Cm, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_B = size_t(ldb)*Bn;
+    size_t size_C = size_t(ldc)*Cn;
+    TA*      A    = new TA[ size_A ];
+    TB*      B    = new TB[ size_B ];
+    int32_t* C    = new int32_t[ size_C ];
+    int32_t* Cref = new int32_t[ size_C ];
+    float*   Af   = new float[ size_A ];
+    float*   Bf   = new float[ size_B ];
+    float*   Cf   = new float[ size_C ];
+    int32_t* A_zero = nullptr;
+    int32_t* B_zero = nullptr;
+
+    // A and B cover their full range; unsigned A is centered at 128
+    const bool unsigned_A = std::is_unsigned<TA>::value;
+    int iseed[4] = { 0, 0, 0, 1 };
+    random_int( iseed, size_A, (unsigned_A ? 0 : -128), 256, A, Af );
+    random_int( iseed, size_B, -128, 256, B, Bf );
+    random_int( iseed, size_C, -1000, 2000, C, Cf );
+    std::copy( C, C + size_C, Cref );
+    if (use_zero) {
+        std::vector<float> work( std::max( m, n ) );
+        A_zero = new int32_t[ m ];
+        B_zero = new int32_t[ n ];
+        random_int( iseed, m, (unsigned_A ? 120 : -8), 16, A_zero, work.data() );
+        random_int( iseed, n, -8, 16, B_zero, work.data() );
+    }
+
+    // test error exits
+    assert_throw( blas::gemm( Layout(0), transA, transB,  m,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    Op(0),  transB,  m,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    transA, Op(0),   m,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    transA, transB, -1,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    transA, transB,  m, -1,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    transA, transB,  m,  n, -1, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+
+    assert_throw( blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, m, n, k, alpha, A, m-1, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( Layout::ColMajor, Op::Trans,   Op::NoTrans, m, n, k, alpha, A, k-1, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( Layout::RowMajor, Op::NoTrans, Op::NoTrans, m, n, k, alpha, A, k-1, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( Layout::RowMajor, Op::Trans,   Op::NoTrans, m, n, k, alpha, A, m-1, B, ldb, beta, C, ldc ), blas::Error );
+
+    assert_throw( blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, m, n, k, alpha, A, lda, B, k-1, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( Layout::ColMajor, Op::NoTrans, Op::Trans,   m, n, k, alpha, A, lda, B, n-1, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( Layout::RowMajor, Op::NoTrans, Op::NoTrans, m, n, k, alpha, A, lda, B, n-1, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( Layout::RowMajor, Op::NoTrans, Op::Trans,   m, n, k, alpha, A, lda, B, k-1, beta, C, ldc ), blas::Error );
+
+    assert_throw( blas::gemm( Layout::ColMajor, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, m-1 ), blas::Error );
+    assert_throw( blas::gemm( Layout::RowMajor, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, n-1 ), blas::Error );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A Am=%5lld, An=%5lld, lda=%5lld, size=%10lld\n"
+                "B Bm=%5lld, Bn=%5lld, ldb=%5lld, size=%10lld\n"
+                "C Cm=%5lld, Cn=%5lld, ldc=%5lld, size=%10lld\n"
+                "alpha = %d; beta = %d\n",
+                (lld) Am, (lld) An, (lld) lda, (lld) size_A,
+                (lld) Bm, (lld) Bn, (lld) ldb, (lld) size_B,
+                (lld) Cm, (lld) Cn, (lld) ldc, (lld) size_C,
+                alpha, beta );
+    }
+    if (verbose >= 2) {
+        printf( "A = "    ); print_matrix( Am, An, Af, lda );
+        printf( "B = "    ); print_matrix( Bm, Bn, Bf, ldb );
+        printf( "C = "    ); print_matrix( Cm, Cn, Cf, ldc );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::gemm( layout, transA, transB, m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc, A_zero, B_zero );
+    time = get_wtime() - time;
+
+    double gflop = Gflop < int32_t >::gemm( m, n, k );
+    double gbyte = Gbyte < int32_t >::template gemm< TA, TB >( m, n, k );
+    params.time()   = time;
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // time sgemm on the same values, for comparison; it ignores zero points
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_gemm( cblas_layout_const(layout),
+                    cblas_trans_const(transA),
+                    cblas_trans_const(transB),
+                    m, n, k, float( alpha ), Af, lda, Bf, ldb,
+                    float( beta ), Cf, ldc );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        // exact reference; it takes column-major arguments,
+        // so swap A and B if row-major.
+        if (layout == Layout::ColMajor) {
+            gemm_int_reference( transA, transB, m, n, k,
+                                alpha, A, lda, A_zero, B, ldb, B_zero,
+                                beta, Cref, ldc );
+        }
+        else {
+            gemm_int_reference( transB, transA, n, m, k,
+                                alpha, B, ldb, B_zero, A, lda, A_zero,
+                                beta, Cref, ldc );
+        }
+
+        // integer results must match exactly
+        double error = 0;
+        for (int64_t j = 0; j < Cn; ++j) {
+            for (int64_t i = 0; i < Cm; ++i) {
+                error = std::max( error, std::abs( double( C[ i + j*ldc ] )
+                                                 - double( Cref[ i + j*ldc ] ) ) );
+            }
+        }
+        params.error() = error;
+        params.okay() = (error == 0);
+    }
+
+    delete[] A;
+    delete[] B;
+    delete[] C;
+    delete[] Cref;
+    delete[] Af;
+    delete[] Bf;
+    delete[] Cf;
+    delete[] A_zero;
+    delete[] B_zero;
+}
+
+// -----------------------------------------------------------------------------
+void test_gemm_int8( Params& params, bool run )
+{
+    if (params.routine == "gemm-int8")
+        test_gemm_int8_work< int8_t, int8_t >( params, run );
+    else
+        test_gemm_int8_work< uint8_t, int8_t >( params, run );
+}
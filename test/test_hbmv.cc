@@ -0,0 +1,174 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+// -----------------------------------------------------------------------------
+template< typename TA, typename TX, typename TY >
+void test_hbmv_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using namespace blas;
+    typedef scalar_type<TA, TX, TY> scalar_t;
+    typedef real_type<scalar_t> real_t;
+    typedef long long lld;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Uplo uplo = params.uplo();
+    scalar_t alpha  = params.alpha();
+    scalar_t beta   = params.beta();
+    int64_t n       = params.dim.n();
+    int64_t kd      = params.kd();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.gbytes();
+    params.ref_time();
+    params.ref_gflops();
+    params.ref_gbytes();
+
+    // adjust header to msec
+    params.time.name( "BLAS++\ntime (ms)" );
+    params.ref_time.name( "Ref.\ntime (ms)" );
+
+    if (! run)
+        return;
+
+    // setup
+    // A is stored as (kd + 1)-by-n band [RowMajor: n-by-(kd + 1)]
+    int64_t lda = roundup( kd + 1, align );
+    size_t size_A = size_t(lda)*n;
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    size_t size_y = (n - 1) * std::abs(incy) + 1;
+    TA* A    = new TA[ size_A ];
+    TX* x    = new TX[ size_x ];
+    TY* y    = new TY[ size_y ];
+    TY* yref = new TY[ size_y ];
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A );
+    lapack_larnv( idist, iseed, size_x, x );
+    lapack_larnv( idist, iseed, size_y, y );
+    cblas_copy( n, y, incy, yref, incy );
+
+    // norms for error check; the band storage bounds the norm of A
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", kd + 1, n, A, lda, work );
+    real_t Xnorm = cblas_nrm2( n, x, std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( n, y, std::abs(incy) );
+
+    // test error exits
+    assert_throw( blas::hbmv( Layout(0), uplo,     n, kd, alpha, A, lda, x, incx, beta, y, incy ), blas::Error );
+    assert_throw( blas::hbmv( layout,    Uplo(0),  n, kd, alpha, A, lda, x, incx, beta, y, incy ), blas::Error );
+    assert_throw( blas::hbmv( layout,    uplo,    -1, kd, alpha, A, lda, x, incx, beta, y, incy ), blas::Error );
+    assert_throw( blas::hbmv( layout,    uplo,     n, -1, alpha, A, lda, x, incx, beta, y, incy ), blas::Error );
+    assert_throw( blas::hbmv( layout,    uplo,     n, kd, alpha, A,  kd, x, incx, beta, y, incy ), blas::Error );
+    assert_throw( blas::hbmv( layout,    uplo,     n, kd, alpha, A, lda, x,    0, beta, y, incy ), blas::Error );
+    assert_throw( blas::hbmv( layout,    uplo,     n, kd, alpha, A, lda, x, incx, beta, y,    0 ), blas::Error );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, kd=%5lld, lda=%5lld, size=%10lld, norm=%.2e\n"
+                "x n=%5lld, inc=%5lld, size=%10lld, norm=%.2e\n"
+                "y n=%5lld, inc=%5lld, size=%10lld, norm=%.2e\n",
+                (lld) n, (lld) kd, (lld) lda, (lld) size_A, Anorm,
+                (lld) n, (lld) incx, (lld) size_x, Xnorm,
+                (lld) n, (lld) incy, (lld) size_y, Ynorm );
+    }
+    if (verbose >= 2) {
+        printf( "alpha = %.4e + %.4ei; beta = %.4e + %.4ei;\n",
+                real(alpha), imag(alpha),
+                real(beta),  imag(beta) );
+        printf( "A = "    ); print_matrix( kd + 1, n, A, lda );
+        printf( "x    = " ); print_vector( n, x, incx );
+        printf( "y    = " ); print_vector( n, y, incy );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::hbmv( layout, uplo, n, kd, alpha, A, lda, x, incx, beta, y, incy );
+    time = get_wtime() - time;
+
+    double gflop = Gflop < scalar_t >::hbmv( n, kd );
+    double gbyte = Gbyte < scalar_t >::hbmv( n, kd );
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (verbose >= 2) {
+        printf( "y2   = " ); print_vector( n, y, incy );
+    }
+
+    if (params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_hbmv( cblas_layout_const(layout), cblas_uplo_const(uplo), n, kd,
+                    alpha, A, lda, x, incx, beta, yref, incy );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+
+        if (verbose >= 2) {
+            printf( "yref = " ); print_vector( n, yref, incy );
+        }
+
+        // check error compared to reference
+        // treat y as 1 x n matrix with ld = incy; k = n is reduction dimension
+        real_t error;
+        bool okay;
+        check_gemm( 1, n, n, alpha, beta, Anorm, Xnorm, Ynorm,
+                    yref, std::abs(incy), y, std::abs(incy), verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+
+    delete[] A;
+    delete[] x;
+    delete[] y;
+    delete[] yref;
+}
+
+// -----------------------------------------------------------------------------
+void test_hbmv( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_hbmv_work< float, float, float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_hbmv_work< double, double, double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_hbmv_work< std::complex<float>, std::complex<float>,
+                            std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_hbmv_work< std::complex<double>, std::complex<double>,
+                            std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
@@ -23,6 +23,9 @@ void test_iamax_work( Params& params, bool run )
     int64_t incx    = params.incx();
     int64_t verbose = params.verbose();
 
+    // tmpl-iamax calls the template implementation instead of vendor BLAS
+    bool tmpl = (params.routine == "tmpl-iamax");
+
     // mark non-standard output values
     params.gflops();
     params.gbytes();
@@ -62,7 +65,13 @@ void test_iamax_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    int64_t result = blas::iamax( n, x, incx );
+    int64_t result;
+    if (tmpl) {
+        result = blas::iamax< T >( n, x, incx );
+    }
+    else {
+        result = blas::iamax( n, x, incx );
+    }
     time = get_wtime() - time;
 
     double gflop = Gflop < T >::iamax( n );
@@ -24,12 +24,21 @@ void test_nrm2_work( Params& params, bool run )
     int64_t incx    = params.incx();
     int64_t verbose = params.verbose();
 
+    // tmpl-nrm2 calls the template implementation instead of vendor BLAS
+    bool tmpl = (params.routine == "tmpl-nrm2");
+
     // mark non-standard output values
     params.gflops();
     params.gbytes();
     params.ref_time();
     params.ref_gflops();
     params.ref_gbytes();
+    if (tmpl) {
+        params.error2.name( "Overflow\nerror" );
+        params.error3.name( "Underflow\nerror" );
+        params.error2();
+        params.error3();
+    }
 
     // adjust header to msec
     params.time.name( "BLAS++\ntime (ms)" );
@@ -63,7 +72,13 @@ void test_nrm2_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    real_t result = blas::nrm2( n, x, incx );
+    real_t result;
+    if (tmpl) {
+        result = blas::nrm2< T >( n, x, incx );
+    }
+    else {
+        result = blas::nrm2( n, x, incx );
+    }
     time = get_wtime() - time;
 
     double gflop = Gflop < T >::nrm2( n );
@@ -102,6 +117,31 @@ void test_nrm2_work( Params& params, bool run )
         real_t u = 0.5 * std::numeric_limits< real_t >::epsilon();
         params.error() = error;
         params.okay() = (error < u);
+
+        if (tmpl && n > 0 && result > 0) {
+            // Scale x by powers of 2 so squares of its elements overflow,
+            // or underflow to subnormal; the scaled algorithm must still
+            // get ||s x|| = s ||x||.
+            typedef std::numeric_limits< real_t > limits;
+            real_t scales[ 2 ] = {
+                std::ldexp( real_t( 1 ), limits::max_exponent/2 + 1 ),
+                std::ldexp( real_t( 1 ), (limits::min_exponent - limits::digits)/2 )
+            };
+            real_t errors[ 2 ];
+            T* xs = new T[ size_x ];
+            for (int j = 0; j < 2; ++j) {
+                for (size_t i = 0; i < size_x; ++i)
+                    xs[ i ] = scales[ j ] * x[ i ];
+                real_t scaled = blas::nrm2< T >( n, xs, incx ) / scales[ j ];
+                errors[ j ] = std::abs( (result - scaled) / (sqrt(n+1) * result) );
+                if (blas::is_complex<scalar_t>::value)
+                    errors[ j ] /= 2*sqrt(2);
+            }
+            delete[] xs;
+            params.error2() = errors[ 0 ];
+            params.error3() = errors[ 1 ];
+            params.okay() = params.okay() && errors[ 0 ] < u && errors[ 1 ] < u;
+        }
     }
 
     delete[] x;
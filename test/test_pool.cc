@@ -0,0 +1,174 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack_wrappers.hh"
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void test_pool_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+
+    // get & mark input values
+    int64_t n       = params.dim.n();
+    int64_t device  = params.device();
+    int64_t verbose = params.verbose();
+    int64_t iters   = 100;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.time    .name( "pool (sec)" );
+    params.ref_time.name( "malloc (sec)" );
+
+    if (! run)
+        return;
+
+    if (blas::get_device_count() == 0) {
+        params.msg() = "skipping: no GPU devices or no GPU support";
+        return;
+    }
+
+    // setup
+    blas::Queue queue( device, 0 );
+    queue.pool_trim( 0 );
+    queue.pool_reset_stats();
+
+    // Each failed check adds 1 to error.
+    int64_t error = 0;
+    auto check = [&error, verbose]( bool cond, char const* msg ) {
+        if (! cond) {
+            error += 1;
+            if (verbose >= 1)
+                printf( "failed: %s\n", msg );
+        }
+    };
+
+    T* x_host = blas::device_malloc_pinned<T>( n, queue );
+    T* y_host = blas::device_malloc_pinned<T>( n, queue );
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, n, x_host );
+
+    //----------
+    // The freeing stream reuses a block at once, in stream order:
+    // the memset must run after the copy into a.
+    T* a = queue.pool_malloc<T>( n );
+    blas::device_memcpy( a, x_host, n, queue );
+    queue.pool_free( a );
+    T* b = queue.pool_malloc<T>( n );
+    check( b == a, "same stream reuses freed block" );
+    blas::device_memset( b, 0, n, queue );
+    blas::device_memcpy( y_host, b, n, queue );
+    queue.sync();
+    for (int64_t i = 0; i < n; ++i) {
+        if (y_host[ i ] != T( 0 )) {
+            check( false, "reused block in stream order" );
+            break;
+        }
+    }
+
+    //----------
+    // Other streams reuse a block only after fork, join, or sync.
+    queue.fork();
+    T* c = queue.pool_malloc<T>( n );
+    queue.pool_free( c );
+    queue.revolve();
+    T* d = queue.pool_malloc<T>( n );
+    check( d != c, "other stream does not reuse pending block" );
+    queue.pool_free( d );
+    queue.join();
+    T* e = queue.pool_malloc<T>( n );
+    check( e == c || e == d, "block is ready after join" );
+    queue.pool_free( e );
+    queue.pool_free( b );
+
+    blas::PoolStats stats = queue.pool_stats();
+    check( stats.allocs == 5 && stats.hits == 2, "hit count" );
+    check( stats.device_allocs == 3, "device allocation count" );
+    check( stats.bytes_in_use == 0, "bytes in use" );
+    check( stats.high_water >= 2 * n * sizeof(T), "high water" );
+
+    //----------
+    // Repeated allocations, as in an iterative solver, hit the cache.
+    queue.sync();
+    queue.pool_reset_stats();
+    double time = sync_get_wtime( queue );
+    for (int64_t iter = 0; iter < iters; ++iter) {
+        T* w1 = queue.pool_malloc<T>( n );
+        T* w2 = queue.pool_malloc<T>( 2*n );
+        T* w3 = queue.pool_malloc<T>( 3*n );
+        queue.pool_free( w3 );
+        queue.pool_free( w2 );
+        queue.pool_free( w1 );
+    }
+    time = sync_get_wtime( queue ) - time;
+
+    stats = queue.pool_stats();
+    if (verbose >= 1) {
+        printf( "allocs %lld, hits %lld, hit rate %.2f, device allocs %lld, "
+                "cached %lld bytes, high water %lld bytes\n",
+                llong( stats.allocs ), llong( stats.hits ), stats.hit_rate(),
+                llong( stats.device_allocs ), llong( stats.bytes_cached ),
+                llong( stats.high_water ) );
+    }
+    // n, 2n, 3n may share a size class with the blocks cached above.
+    check( stats.allocs == 3*iters, "alloc count" );
+    check( stats.hits >= 3*(iters - 1), "hit rate" );
+
+    double ref_time = sync_get_wtime( queue );
+    for (int64_t iter = 0; iter < iters; ++iter) {
+        T* w1 = blas::device_malloc<T>( n, queue );
+        T* w2 = blas::device_malloc<T>( 2*n, queue );
+        T* w3 = blas::device_malloc<T>( 3*n, queue );
+        blas::device_free( w3, queue );
+        blas::device_free( w2, queue );
+        blas::device_free( w1, queue );
+    }
+    ref_time = sync_get_wtime( queue ) - ref_time;
+
+    //----------
+    // After sync, trim frees all cached blocks.
+    queue.pool_trim( 0 );
+    stats = queue.pool_stats();
+    check( stats.bytes_cached == 0, "trim" );
+    check( stats.device_frees > 0, "device free count" );
+
+    assert_throw( queue.pool_free( x_host ), blas::Error );
+
+    params.time()     = time;
+    params.ref_time() = ref_time;
+    params.error()    = error;
+    params.okay()     = (error == 0);
+
+    blas::device_free_pinned( x_host, queue );
+    blas::device_free_pinned( y_host, queue );
+}
+
+// -----------------------------------------------------------------------------
+void test_pool( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_pool_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_pool_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_pool_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_pool_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
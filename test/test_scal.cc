@@ -24,6 +24,9 @@ void test_scal_work( Params& params, bool run )
     int64_t incx    = params.incx();
     int64_t verbose = params.verbose();
 
+    // tmpl-scal calls the template implementation instead of vendor BLAS
+    bool tmpl = (params.routine == "tmpl-scal");
+
     // mark non-standard output values
     params.gflops();
     params.gbytes();
@@ -67,7 +70,12 @@ void test_scal_work( Params& params, bool run )
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::scal( n, alpha, x, incx );
+    if (tmpl) {
+        blas::scal< T >( n, alpha, x, incx );
+    }
+    else {
+        blas::scal( n, alpha, x, incx );
+    }
     time = get_wtime() - time;
 
     double gflop = Gflop < T >::scal( n );
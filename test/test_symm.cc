@@ -31,10 +31,19 @@ void test_symm_work( Params& params, bool run )
     int64_t align   = params.align();
     int64_t verbose = params.verbose();
 
+    // tmpl-symm calls the template implementation instead of vendor BLAS
+    bool tmpl = (params.routine == "tmpl-symm");
+    int64_t threads = (tmpl ? params.threads() : 1);
+
     // mark non-standard output values
     params.gflops();
     params.ref_time();
     params.ref_gflops();
+    if (tmpl) {
+        params.time3.name( "1 thread\ntime (s)" );
+        params.time3();
+        params.efficiency();
+    }
 
     if (! run)
         return;
@@ -105,16 +114,50 @@ void test_symm_work( Params& params, bool run )
         printf( "C = "    ); print_matrix( Cm, Cn, C, ldc );
     }
 
+    if (tmpl) {
+        blas::set_template_threads( threads );
+        threads = blas::get_template_threads();
+    }
+
+    // for parallel efficiency, time a 1-thread run on a copy of C
+    double time1 = 0;
+    if (tmpl && threads > 1) {
+        TC* C1 = new TC[ size_C ];
+        lapack_lacpy( "g", Cm, Cn, C, ldc, C1, ldc );
+        blas::set_template_threads( 1 );
+        testsweeper::flush_cache( params.cache() );
+        time1 = get_wtime();
+        blas::symm< TA, TB, TC >( layout, side, uplo, m, n,
+                                  alpha, A, lda, B, ldb, beta, C1, ldc );
+        time1 = get_wtime() - time1;
+        blas::set_template_threads( threads );
+        delete[] C1;
+    }
+
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::symm( layout, side, uplo, m, n,
-                alpha, A, lda, B, ldb, beta, C, ldc );
+    if (tmpl) {
+        blas::symm< TA, TB, TC >( layout, side, uplo, m, n,
+                                  alpha, A, lda, B, ldb, beta, C, ldc );
+    }
+    else {
+        blas::symm( layout, side, uplo, m, n,
+                    alpha, A, lda, B, ldb, beta, C, ldc );
+    }
     time = get_wtime() - time;
 
     double gflop = Gflop < scalar_t >::symm( side, m, n );
     params.time()   = time;
     params.gflops() = gflop / time;
+    if (tmpl) {
+        // restore default thread count
+        blas::set_template_threads( 0 );
+        if (threads == 1)
+            time1 = time;
+        params.time3() = time1;
+        params.efficiency() = time1 / (threads * time);
+    }
 
     if (verbose >= 2) {
         printf( "C2 = " ); print_matrix( Cm, Cn, C, ldc );
@@ -31,10 +31,19 @@ void test_syr2k_work( Params& params, bool run )
     int64_t align   = params.align();
     int64_t verbose = params.verbose();
 
+    // tmpl-syr2k calls the template implementation instead of vendor BLAS
+    bool tmpl = (params.routine == "tmpl-syr2k");
+    int64_t threads = (tmpl ? params.threads() : 1);
+
     // mark non-standard output values
     params.gflops();
     params.ref_time();
     params.ref_gflops();
+    if (tmpl) {
+        params.time3.name( "1 thread\ntime (s)" );
+        params.time3();
+        params.efficiency();
+    }
 
     if (! run)
         return;
@@ -62,11 +71,16 @@ void test_syr2k_work( Params& params, bool run )
     lapack_larnv( idist, iseed, size_C, C );
     lapack_lacpy( "g", n, n, C, ldc, Cref, ldc );
 
+    // triangle of C in column-major order, for the error check
+    blas::Uplo uplo_col = uplo;
+    if (layout == Layout::RowMajor)
+        uplo_col = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+
     // norms for error check
     real_t work[1];
     real_t Anorm = lapack_lange( "f", Am, An, A, lda, work );
     real_t Bnorm = lapack_lange( "f", Am, An, B, ldb, work );
-    real_t Cnorm = lapack_lansy( "f", uplo2str(uplo), n, C, ldc, work );
+    real_t Cnorm = lapack_lansy( "f", uplo2str(uplo_col), n, C, ldc, work );
 
     // test error exits
     assert_throw( blas::syr2k( Layout(0), uplo,    trans,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
@@ -113,22 +127,65 @@ void test_syr2k_work( Params& params, bool run )
         printf( "C = "    ); print_matrix(  n,  n, C, ldc );
     }
 
+    if (tmpl) {
+        blas::set_template_threads( threads );
+        threads = blas::get_template_threads();
+    }
+
+    // for parallel efficiency, time a 1-thread run on a copy of C
+    double time1 = 0;
+    if (tmpl && threads > 1) {
+        TC* C1 = new TC[ size_C ];
+        lapack_lacpy( "g", n, n, C, ldc, C1, ldc );
+        blas::set_template_threads( 1 );
+        testsweeper::flush_cache( params.cache() );
+        time1 = get_wtime();
+        blas::syr2k< TA, TB, TC >( layout, uplo, trans, n, k,
+                                   alpha, A, lda, B, ldb, beta, C1, ldc );
+        time1 = get_wtime() - time1;
+        blas::set_template_threads( threads );
+        delete[] C1;
+    }
+
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::syr2k( layout, uplo, trans, n, k,
-                 alpha, A, lda, B, ldb, beta, C, ldc );
+    if (tmpl) {
+        blas::syr2k< TA, TB, TC >( layout, uplo, trans, n, k,
+                                   alpha, A, lda, B, ldb, beta, C, ldc );
+    }
+    else {
+        blas::syr2k( layout, uplo, trans, n, k,
+                     alpha, A, lda, B, ldb, beta, C, ldc );
+    }
     time = get_wtime() - time;
 
     double gflop = Gflop < scalar_t >::syr2k( n, k );
     params.time()   = time;
     params.gflops() = gflop / time;
+    if (tmpl) {
+        // restore default thread count
+        blas::set_template_threads( 0 );
+        if (threads == 1)
+            time1 = time;
+        params.time3() = time1;
+        params.efficiency() = time1 / (threads * time);
+    }
 
     if (verbose >= 2) {
         printf( "C2 = " ); print_matrix( n, n, C, ldc );
     }
 
     if (params.ref() == 'y' || params.check() == 'y') {
+        // check that the other triangle is unchanged, against Cref, which
+        // is still the original C
+        bool real_diag = false;
+        int64_t bad = check_herk_structure( uplo_col, real_diag, n,
+                                            Cref, ldc, C, ldc );
+        if (verbose >= 1)
+            printf( "%lld entries wrongly changed\n",
+                    llong( bad ) );
+
         // run reference
         testsweeper::flush_cache( params.cache() );
         time = get_wtime();
@@ -148,10 +205,10 @@ void test_syr2k_work( Params& params, bool run )
         // check error compared to reference
         real_t error;
         bool okay;
-        check_herk( uplo, n, 2*k, alpha, beta, Anorm, Bnorm, Cnorm,
+        check_herk( uplo_col, n, 2*k, alpha, beta, Anorm, Bnorm, Cnorm,
                     Cref, ldc, C, ldc, verbose, &error, &okay );
         params.error() = error;
-        params.okay() = okay;
+        params.okay() = okay && (bad == 0);
     }
 
     delete[] A;
@@ -0,0 +1,168 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+// -----------------------------------------------------------------------------
+template< typename TA, typename TX >
+void test_tbmv_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using namespace blas;
+    typedef scalar_type<TA, TX> scalar_t;
+    typedef real_type<scalar_t> real_t;
+    typedef long long lld;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Uplo uplo = params.uplo();
+    blas::Op trans  = params.trans();
+    blas::Diag diag = params.diag();
+    int64_t n       = params.dim.n();
+    int64_t kd      = params.kd();
+    int64_t incx    = params.incx();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.gbytes();
+    params.ref_time();
+    params.ref_gflops();
+    params.ref_gbytes();
+
+    // adjust header to msec
+    params.time.name( "BLAS++\ntime (ms)" );
+    params.ref_time.name( "Ref.\ntime (ms)" );
+
+    if (! run)
+        return;
+
+    // ----------
+    // setup
+    // A is stored as (kd + 1)-by-n band [RowMajor: n-by-(kd + 1)]
+    int64_t lda = roundup( kd + 1, align );
+    size_t size_A = size_t(lda)*n;
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    TA* A    = new TA[ size_A ];
+    TX* x    = new TX[ size_x ];
+    TX* xref = new TX[ size_x ];
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A );
+    lapack_larnv( idist, iseed, size_x, x );
+    cblas_copy( n, x, incx, xref, incx );
+
+    // norms for error check; the band storage bounds the norm of A
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", kd + 1, n, A, lda, work );
+    real_t Xnorm = cblas_nrm2( n, x, std::abs(incx) );
+
+    // test error exits
+    assert_throw( blas::tbmv( Layout(0), uplo,    trans, diag,     n, kd, A, lda, x, incx ), blas::Error );
+    assert_throw( blas::tbmv( layout,    Uplo(0), trans, diag,     n, kd, A, lda, x, incx ), blas::Error );
+    assert_throw( blas::tbmv( layout,    uplo,    Op(0), diag,     n, kd, A, lda, x, incx ), blas::Error );
+    assert_throw( blas::tbmv( layout,    uplo,    trans, Diag(0),  n, kd, A, lda, x, incx ), blas::Error );
+    assert_throw( blas::tbmv( layout,    uplo,    trans, diag,    -1, kd, A, lda, x, incx ), blas::Error );
+    assert_throw( blas::tbmv( layout,    uplo,    trans, diag,     n, -1, A, lda, x, incx ), blas::Error );
+    assert_throw( blas::tbmv( layout,    uplo,    trans, diag,     n, kd, A,  kd, x, incx ), blas::Error );
+    assert_throw( blas::tbmv( layout,    uplo,    trans, diag,     n, kd, A, lda, x,    0 ), blas::Error );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, kd=%5lld, lda=%5lld, size=%10lld, norm=%.2e\n"
+                "x n=%5lld, inc=%5lld, size=%10lld, norm=%.2e\n",
+                (lld) n, (lld) kd, (lld) lda, (lld) size_A, Anorm,
+                (lld) n, (lld) incx, (lld) size_x, Xnorm );
+    }
+    if (verbose >= 2) {
+        printf( "A = [];\n"    ); print_matrix( kd + 1, n, A, lda );
+        printf( "x    = [];\n" ); print_vector( n, x, incx );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::tbmv( layout, uplo, trans, diag, n, kd, A, lda, x, incx );
+    time = get_wtime() - time;
+
+    double gflop = Gflop < scalar_t >::tbmv( n, kd );
+    double gbyte = Gbyte < scalar_t >::tbmv( n, kd );
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (verbose >= 2) {
+        printf( "x2   = [];\n" ); print_vector( n, x, incx );
+    }
+
+    if (params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_tbmv( cblas_layout_const(layout),
+                    cblas_uplo_const(uplo),
+                    cblas_trans_const(trans),
+                    cblas_diag_const(diag),
+                    n, kd, A, lda, xref, incx );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+
+        if (verbose >= 2) {
+            printf( "xref = [];\n" ); print_vector( n, xref, incx );
+        }
+
+        // check error compared to reference
+        // treat x as 1 x n matrix with ld = incx; k = n is reduction dimension
+        // alpha = 1, beta = 0.
+        real_t error;
+        bool okay;
+        check_gemm( 1, n, n, scalar_t(1), scalar_t(0), Anorm, Xnorm, real_t(0),
+                    xref, std::abs(incx), x, std::abs(incx), verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+
+    delete[] A;
+    delete[] x;
+    delete[] xref;
+}
+
+// -----------------------------------------------------------------------------
+void test_tbmv( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_tbmv_work< float, float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_tbmv_work< double, double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_tbmv_work< std::complex<float>, std::complex<float> >
+                ( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_tbmv_work< std::complex<double>, std::complex<double> >
+                ( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
@@ -0,0 +1,234 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "blas/flops.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+// -----------------------------------------------------------------------------
+/// Traces calls to gemm, gemv, and axpy, and checks the summary and the
+/// Chrome trace. The tracing cost is compared to an untraced run.
+/// Then traces a batch gemm on several threads, and checks that gemm calls
+/// in its worker threads are nested, not top-level.
+template <typename T>
+void test_trace_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+
+    // get & mark input values
+    T alpha         = params.alpha();
+    T beta          = params.beta();
+    int64_t n       = params.dim.n();
+    int64_t verbose = params.verbose();
+    int64_t calls   = 100;
+
+    // mark non-standard output values
+    params.ref_time();
+
+    params.time    .name( "traced (sec)" );
+    params.ref_time.name( "untraced (sec)" );
+
+    if (! run)
+        return;
+
+    // setup; small sizes, so tracing cost is visible
+    std::vector<T> A( n*n, T( 1 ) ), B( n*n, T( 1 ) ), C( n*n, T( 1 ) );
+    std::vector<T> x( n, T( 1 ) ), y( n, T( 1 ) );
+
+    auto work = [&]() {
+        for (int64_t i = 0; i < calls; ++i) {
+            blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans,
+                        blas::Op::Trans, n, n, n, alpha, A.data(), n,
+                        B.data(), n, beta, C.data(), n );
+            blas::gemv( blas::Layout::RowMajor, blas::Op::NoTrans, n, n,
+                        alpha, A.data(), n, x.data(), 1, beta, y.data(), 1 );
+            blas::axpy( n, alpha, x.data(), 1, y.data(), 1 );
+        }
+    };
+
+    // Each failed check adds 1 to error.
+    double error = 0;
+
+    bool trace_orig = blas::get_trace();
+
+    //----------
+    // untraced
+    blas::set_trace( false );
+    blas::trace_clear();
+    double ref_time = get_wtime();
+    work();
+    ref_time = get_wtime() - ref_time;
+    if (blas::trace_summary().find( "gemm" ) != std::string::npos)
+        error += 1;
+
+    //----------
+    // traced
+    blas::set_trace( true );
+    if (! blas::get_trace()) {
+        params.msg() = "skipping: BLAS++ built without tracing";
+        return;
+    }
+    double time = get_wtime();
+    work();
+    time = get_wtime() - time;
+    blas::set_trace( trace_orig );
+
+    std::string summary = blas::trace_summary();
+    if (verbose >= 1)
+        printf( "%s", summary.c_str() );
+
+    // each routine should have calls calls
+    for (std::string routine : { "gemm", "gemv", "axpy" }) {
+        std::istringstream lines( summary );
+        std::string line, name;
+        int64_t routine_calls = -1;
+        while (std::getline( lines, line )) {
+            std::istringstream words( line );
+            std::string type, device;
+            int64_t count;
+            if (words >> name >> type >> device >> count && name == routine)
+                routine_calls = count;
+        }
+        if (routine_calls != calls)
+            error += 1;
+    }
+
+    // Chrome trace has one event per call, with flops
+    std::string filename = "blaspp_trace_test.json";
+    blas::trace_write( filename );
+    std::ifstream file( filename );
+    std::string line;
+    int64_t events = 0, gemm_events = 0;
+    std::string gemm_gflop = "\"gflop\": ";
+    {
+        char buf[ 32 ];
+        snprintf( buf, sizeof(buf), "%.6g",
+                  blas::Gflop<T>::gemm( n, n, n ) );
+        gemm_gflop += buf;
+    }
+    while (std::getline( file, line )) {
+        if (line.find( "\"ph\": \"X\"" ) != std::string::npos)
+            ++events;
+        if (line.find( "\"name\": \"gemm\"" ) != std::string::npos
+            && line.find( "\"opts\": \"CNT\"" ) != std::string::npos
+            && line.find( gemm_gflop ) != std::string::npos)
+            ++gemm_events;
+    }
+    file.close();
+    std::remove( filename.c_str() );
+    if (events != 3*calls || gemm_events != calls)
+        error += 1;
+
+    blas::trace_clear();
+    if (blas::trace_summary().find( "gemm" ) != std::string::npos)
+        error += 1;
+
+    if (verbose >= 1)
+        printf( "events %lld, gemm events %lld\n",
+                llong( events ), llong( gemm_events ) );
+
+    //----------
+    // threaded batch; sizes above the compact format limit (16),
+    // so each problem calls gemm
+    int64_t batch = 32;
+    int64_t nb = std::max( n, int64_t( 32 ) );
+    std::vector<T> Ab( batch*nb*nb, T( 1 ) ), Bb( batch*nb*nb, T( 1 ) ),
+                   Cb( batch*nb*nb, T( 1 ) );
+    std::vector<T*> Aarray( batch ), Barray( batch ), Carray( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        Aarray[ i ] = &Ab[ i*nb*nb ];
+        Barray[ i ] = &Bb[ i*nb*nb ];
+        Carray[ i ] = &Cb[ i*nb*nb ];
+    }
+    std::vector<int64_t> info;
+
+    #ifdef _OPENMP
+        int omp_threads = omp_get_max_threads();
+        omp_set_num_threads( 4 );
+    #endif
+    blas::set_trace( true );
+    blas::batch::gemm( blas::Layout::ColMajor, { blas::Op::NoTrans },
+                       { blas::Op::NoTrans }, { nb }, { nb }, { nb },
+                       { alpha }, Aarray, { nb }, Barray, { nb },
+                       { beta }, Carray, { nb }, batch, info );
+    blas::set_trace( trace_orig );
+    #ifdef _OPENMP
+        omp_set_num_threads( omp_threads );
+    #endif
+
+    // one top-level batch_gemm; its batch gemm calls are nested
+    summary = blas::trace_summary();
+    if (verbose >= 1)
+        printf( "%s", summary.c_str() );
+    int64_t batch_calls = 0, gemm_calls = 0, nested = -1;
+    {
+        std::istringstream lines( summary );
+        std::string line, name;
+        while (std::getline( lines, line )) {
+            std::istringstream words( line );
+            std::string type, device;
+            int64_t count;
+            if (line.compare( 0, 13, "BLAS++ trace:" ) == 0) {
+                size_t pos = line.find( '(' );
+                if (pos != std::string::npos)
+                    nested = std::atoll( line.c_str() + pos + 1 );
+            }
+            else if (words >> name >> type >> device >> count) {
+                if (name == "batch_gemm")
+                    batch_calls = count;
+                else if (name == "gemm")
+                    gemm_calls = count;
+            }
+        }
+    }
+    if (batch_calls != 1 || gemm_calls != 0 || nested < batch)
+        error += 1;
+    blas::trace_clear();
+
+    if (verbose >= 1)
+        printf( "batch_gemm %lld, gemm %lld, nested %lld\n",
+                llong( batch_calls ), llong( gemm_calls ), llong( nested ) );
+
+    params.time()     = time;
+    params.ref_time() = ref_time;
+    params.error()    = error;
+    params.okay()     = (error == 0);
+}
+
+// -----------------------------------------------------------------------------
+void test_trace( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_trace_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_trace_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_trace_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_trace_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
@@ -32,10 +32,19 @@ void test_trmm_work( Params& params, bool run )
     int64_t align   = params.align();
     int64_t verbose = params.verbose();
 
+    // tmpl-trmm calls the template implementation instead of vendor BLAS
+    bool tmpl = (params.routine == "tmpl-trmm");
+    int64_t threads = (tmpl ? params.threads() : 1);
+
     // mark non-standard output values
     params.gflops();
     params.ref_time();
     params.ref_gflops();
+    if (tmpl) {
+        params.time3.name( "1 thread\ntime (s)" );
+        params.time3();
+        params.efficiency();
+    }
 
     if (! run)
         return;
@@ -94,15 +103,50 @@ void test_trmm_work( Params& params, bool run )
         printf( "B = " ); print_matrix( Bm, Bn, B, ldb );
     }
 
+    if (tmpl) {
+        blas::set_template_threads( threads );
+        threads = blas::get_template_threads();
+    }
+
+    // for parallel efficiency, time a 1-thread run on a copy of B
+    double time1 = 0;
+    if (tmpl && threads > 1) {
+        TB* B1 = new TB[ size_B ];
+        lapack_lacpy( "g", Bm, Bn, B, ldb, B1, ldb );
+        blas::set_template_threads( 1 );
+        testsweeper::flush_cache( params.cache() );
+        time1 = get_wtime();
+        blas::trmm< TA, TB >( layout, side, uplo, trans, diag, m, n,
+                              alpha, A, lda, B1, ldb );
+        time1 = get_wtime() - time1;
+        blas::set_template_threads( threads );
+        delete[] B1;
+    }
+
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::trmm( layout, side, uplo, trans, diag, m, n, alpha, A, lda, B, ldb );
+    if (tmpl) {
+        blas::trmm< TA, TB >( layout, side, uplo, trans, diag, m, n,
+                              alpha, A, lda, B, ldb );
+    }
+    else {
+        blas::trmm( layout, side, uplo, trans, diag, m, n,
+                    alpha, A, lda, B, ldb );
+    }
     time = get_wtime() - time;
 
     double gflop = Gflop < scalar_t >::trmm( side, m, n );
     params.time()   = time;
     params.gflops() = gflop / time;
+    if (tmpl) {
+        // restore default thread count
+        blas::set_template_threads( 0 );
+        if (threads == 1)
+            time1 = time;
+        params.time3() = time1;
+        params.efficiency() = time1 / (threads * time);
+    }
 
     if (verbose >= 2) {
         printf( "X = " ); print_matrix( Bm, Bn, B, ldb );
@@ -32,10 +32,23 @@ void test_trsm_work( Params& params, bool run )
     int64_t align   = params.align();
     int64_t verbose = params.verbose();
 
+    // tmpl-trsm calls the template implementation instead of vendor BLAS
+    bool tmpl = (params.routine == "tmpl-trsm");
+    int64_t threads = (tmpl ? params.threads() : 1);
+
     // mark non-standard output values
     params.gflops();
     params.ref_time();
     params.ref_gflops();
+    if (tmpl) {
+        params.time2.name( "Unblocked\ntime (s)" );
+        params.gflops2.name( "Unblocked\nGflop/s" );
+        params.time2();
+        params.gflops2();
+        params.time3.name( "1 thread\ntime (s)" );
+        params.time3();
+        params.efficiency();
+    }
 
     if (! run)
         return;
@@ -61,6 +74,13 @@ void test_trsm_work( Params& params, bool run )
     lapack_larnv( idist, iseed, size_B, B );  // TODO
     lapack_lacpy( "g", Bm, Bn, B, ldb, Bref, ldb );
 
+    // B2 is input for the unblocked loops
+    TB* B2 = nullptr;
+    if (tmpl && params.ref() == 'y') {
+        B2 = new TB[ size_B ];
+        lapack_lacpy( "g", Bm, Bn, B, ldb, B2, ldb );
+    }
+
     // set unused data to nan
     if (uplo == Uplo::Lower) {
         for (int64_t j = 0; j < Am; ++j)
@@ -125,15 +145,70 @@ void test_trsm_work( Params& params, bool run )
         printf( "B = " ); print_matrix( Bm, Bn, B, ldb );
     }
 
+    if (tmpl) {
+        blas::set_template_threads( threads );
+        threads = blas::get_template_threads();
+    }
+
+    // for parallel efficiency, time a 1-thread run on a copy of B
+    double time1 = 0;
+    if (tmpl && threads > 1) {
+        TB* B1 = new TB[ size_B ];
+        lapack_lacpy( "g", Bm, Bn, B, ldb, B1, ldb );
+        blas::set_template_threads( 1 );
+        testsweeper::flush_cache( params.cache() );
+        time1 = get_wtime();
+        blas::trsm< TA, TB >( layout, side, uplo, trans, diag, m, n,
+                              alpha, A, lda, B1, ldb );
+        time1 = get_wtime() - time1;
+        blas::set_template_threads( threads );
+        delete[] B1;
+    }
+
     // run test
     testsweeper::flush_cache( params.cache() );
     double time = get_wtime();
-    blas::trsm( layout, side, uplo, trans, diag, m, n, alpha, A, lda, B, ldb );
+    if (tmpl) {
+        blas::trsm< TA, TB >( layout, side, uplo, trans, diag, m, n,
+                              alpha, A, lda, B, ldb );
+    }
+    else {
+        blas::trsm( layout, side, uplo, trans, diag, m, n,
+                    alpha, A, lda, B, ldb );
+    }
     time = get_wtime() - time;
 
     double gflop = Gflop < scalar_t >::trsm( side, m, n );
     params.time()   = time;
     params.gflops() = gflop / time;
+    if (tmpl) {
+        // restore default thread count
+        blas::set_template_threads( 0 );
+        if (threads == 1)
+            time1 = time;
+        params.time3() = time1;
+        params.efficiency() = time1 / (threads * time);
+    }
+
+    if (tmpl && params.ref() == 'y') {
+        // time the unblocked loops that the recursive solve replaced;
+        // they take column-major arguments, so swap sides if row-major.
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        if (layout == Layout::ColMajor) {
+            blas::internal::trsm_unblocked(
+                side, uplo, trans, diag, m, n, alpha, A, lda, B2, ldb );
+        }
+        else {
+            blas::internal::trsm_unblocked(
+                (side == Side::Left ? Side::Right : Side::Left),
+                (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower),
+                trans, diag, n, m, alpha, A, lda, B2, ldb );
+        }
+        time = get_wtime() - time;
+        params.time2()   = time;
+        params.gflops2() = gflop / time;
+    }
 
     if (verbose >= 2) {
         printf( "X = " ); print_matrix( Bm, Bn, B, ldb );
@@ -172,6 +247,7 @@ void test_trsm_work( Params& params, bool run )
     delete[] A;
     delete[] B;
     delete[] Bref;
+    delete[] B2;
 }
 
 // -----------------------------------------------------------------------------
@@ -196,6 +272,15 @@ void test_trsm( Params& params, bool run )
                 ( params, run );
             break;
 
+        // 16-bit input, float output
+        case DataType_Half:
+            test_trsm_work< blas::float16, float >( params, run );
+            break;
+
+        case DataType_BFloat16:
+            test_trsm_work< blas::bfloat16, float >( params, run );
+            break;
+
         default:
             throw std::exception();
             break;
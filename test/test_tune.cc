@@ -0,0 +1,163 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack_wrappers.hh"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// -----------------------------------------------------------------------------
+/// Autotunes gemm, checks the saved crossover, and compares gemm results
+/// using the template and the native BLAS.
+template <typename T>
+void test_tune_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type<T>;
+
+    // get & mark input values
+    T alpha         = params.alpha();
+    T beta          = params.beta();
+    int64_t n       = params.dim.n();
+    int64_t verbose = params.verbose();
+
+    params.time.name( "tune (sec)" );
+
+    if (! run)
+        return;
+
+    // gemm routine of this precision, e.g., "dgemm"
+    std::string routine = "gemm";
+    if (std::is_same< T, float >::value)
+        routine = "s" + routine;
+    else if (std::is_same< T, double >::value)
+        routine = "d" + routine;
+    else if (std::is_same< T, std::complex<float> >::value)
+        routine = "c" + routine;
+    else
+        routine = "z" + routine;
+
+    // Each failed check adds 1 to error.
+    real_t error = 0;
+
+    assert_throw( blas::get_crossover( "nosuch" ), blas::Error );
+    assert_throw( blas::set_crossover( "nosuch", 0 ), blas::Error );
+    assert_throw( blas::set_crossover( routine, -1 ), blas::Error );
+    assert_throw( blas::autotune( "", "nosuch" ), blas::Error );
+
+    // a family name sets all its routines, including complex dotc
+    char const* dots[] = { "sdot", "ddot", "cdotc", "zdotc" };
+    double dot_orig[ 4 ];
+    for (int i = 0; i < 4; ++i)
+        dot_orig[ i ] = blas::get_crossover( dots[ i ] );
+    blas::set_crossover( "dot", 1234 );
+    for (int i = 0; i < 4; ++i) {
+        if (blas::get_crossover( dots[ i ] ) != 1234)
+            error += 1;
+        blas::set_crossover( dots[ i ], dot_orig[ i ] );
+    }
+
+    //----------
+    // tune, saving to a scratch file
+    double crossover_orig = blas::get_crossover( routine );
+    std::string filename = "blaspp_tune_test.txt";
+
+    double time = get_wtime();
+    blas::autotune( filename, routine );
+    time = get_wtime() - time;
+
+    double crossover = blas::get_crossover( routine );
+    if (verbose >= 1)
+        printf( "%s crossover %.0f (%.0f^3)\n",
+                routine.c_str(), crossover, std::cbrt( crossover ) );
+
+    // file should have the crossover
+    std::ifstream file( filename );
+    std::string line, name;
+    double saved = -1;
+    while (std::getline( file, line )) {
+        std::istringstream words( line );
+        if (words >> name && name == routine)
+            words >> saved;
+    }
+    file.close();
+    std::remove( filename.c_str() );
+    if (saved != crossover)
+        error += 1;
+
+    //----------
+    // gemm via template and via native BLAS
+    int64_t lda = roundup( n, int64_t( 64 ) );
+    T* A    = new T[ lda*n ];
+    T* B    = new T[ lda*n ];
+    T* C    = new T[ lda*n ];
+    T* Cref = new T[ lda*n ];
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, lda*n, A );
+    lapack_larnv( idist, iseed, lda*n, B );
+    lapack_larnv( idist, iseed, lda*n, C );
+    lapack_lacpy( "g", n, n, C, lda, Cref, lda );
+
+    double work = double( n ) * n * n;
+    blas::set_crossover( routine, work + 1 );
+    blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                n, n, n, alpha, A, lda, B, lda, beta, C, lda );
+
+    blas::set_crossover( routine, 0 );
+    blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                n, n, n, alpha, A, lda, B, lda, beta, Cref, lda );
+
+    blas::set_crossover( routine, crossover_orig );
+
+    // check error compared to native BLAS
+    real_t dummy;
+    real_t C_norm = lapack_lange( "m", n, n, Cref, lda, &dummy );
+    for (int64_t j = 0; j < n; ++j)
+        blas::axpy( n, -1.0, &Cref[ j*lda ], 1, &C[ j*lda ], 1 );
+    real_t diff = lapack_lange( "m", n, n, C, lda, &dummy );
+    if (C_norm > 0)
+        diff /= C_norm;
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    params.time()  = time;
+    params.error() = error + diff;
+    params.okay()  = (error == 0 && diff < 3*n*eps);
+
+    delete[] A;
+    delete[] B;
+    delete[] C;
+    delete[] Cref;
+}
+
+// -----------------------------------------------------------------------------
+void test_tune( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_tune_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_tune_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_tune_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_tune_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}